@@ -4,7 +4,7 @@
 #include <stdint.h>
 
 typedef struct {
-    int m;                 /* dimension: 10, 20, or 30 */
+    int m;                 /* dimension: > 0 (10, 20 or 30 for the reported runs) */
     int n;                 /* population size (experiments), default 30 */
     int problem_type;      /* 1..10 */
     char output_csv[256];  /* output filename */
@@ -14,7 +14,7 @@ typedef struct {
 /* Reads key=value config file. Returns 0 on success, nonzero on failure. */
 int config_load(const char* path, Config* out_cfg);
 
-/* Validates: m in {10,20,30}, n > 0, problem_type in [1,10], output_csv non-empty. */
+/* Validates: m > 0, n > 0, problem_type in [1,10], output_csv non-empty. */
 int config_validate(const Config* cfg);
 
 #endif
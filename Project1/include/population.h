@@ -15,6 +15,7 @@ typedef struct {
 } Fitness;
 
 /* population "class" */
+/* Returns 0 on success, 1 on bad arguments, 2 on allocation failure, 3 if n*m is too large. */
 int population_init(Population* pop, int n, int m);
 void population_free(Population* pop);
 
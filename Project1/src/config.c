@@ -89,7 +89,7 @@ int config_validate(const Config* cfg)
 {
     if (!cfg) return 1;
 
-    if (!(cfg->m == 10 || cfg->m == 20 || cfg->m == 30)) return 2;
+    if (cfg->m <= 0) return 2;
     if (cfg->n <= 0) return 3;
     if (cfg->problem_type < 1 || cfg->problem_type > 10) return 4;
     if (cfg->output_csv[0] == '\0') return 5;
@@ -30,7 +30,7 @@ int main(int argc, char** argv)
     rc = config_validate(&cfg);
     if (rc != 0) {
         fprintf(stderr, "ERROR: Invalid config (code %d)\n", rc);
-        fprintf(stderr, "Required: m in {10,20,30}, n>0, problem in [1..10], output_csv non-empty\n");
+        fprintf(stderr, "Required: m>0, n>0, problem in [1..10], output_csv non-empty\n");
         return 3;
     }
 
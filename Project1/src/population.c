@@ -1,5 +1,6 @@
 #include "population.h"
 #include "mt19937ar.h"
+#include <stdint.h>
 #include <stdlib.h>
 
 static double rand_uniform(double mn, double mx)
@@ -11,6 +12,8 @@ static double rand_uniform(double mn, double mx)
 int population_init(Population* pop, int n, int m)
 {
     if (!pop || n <= 0 || m <= 0) return 1;
+    /* n*m*sizeof(double) must fit in size_t (multi-GB populations for large m) */
+    if ((size_t)n > SIZE_MAX / sizeof(double) / (size_t)m) return 3;
     pop->n = n;
     pop->m = m;
     pop->data = (double*)malloc((size_t)n * (size_t)m * sizeof(double));
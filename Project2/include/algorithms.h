@@ -1,6 +1,9 @@
 #ifndef ALGORITHMS_H
 #define ALGORITHMS_H
 
+#include "config.h"
+#include "evalcache.h"
+#include "rng.h"
 #include "problem.h"
 
 /**
@@ -12,20 +15,64 @@
  * values, the best fitness found, and total execution time.
  */
 
+/**
+ * @brief Optional tuning knobs shared by the search algorithms.
+ *
+ * Passing NULL where a SearchOptions pointer is expected uses the
+ * defaults from search_options_default(). A search draws all of its
+ * random numbers from opt->rng, so searches with separate states (and
+ * separate caches) may run on different threads at once.
+ */
+typedef struct {
+    NeighborhoodType neighborhood; /**< Local search neighbor generation */
+    StorageType storage;           /**< Element type of candidate blocks */
+    LocalSearchType local;         /**< Local optimizer of repeated local search */
+    double target;                 /**< Stop once a fitness <= target is found (NAN = never) */
+    EvalCache* cache;              /**< Memo cache in front of local-search evaluations, or NULL */
+    int block;                     /**< Rows per evaluation call (0 = default, see autotune.h) */
+    Rng* rng;                      /**< Random stream of the run, or NULL for rng_global() */
+    int first;                     /**< Substream of the first sample/restart (counter-based rng) */
+} SearchOptions;
+
+/**
+ * @brief What a search run did, filled in when a SearchStats pointer is passed.
+ */
+typedef struct {
+    int iterations;      /**< Samples (blind) or restarts (RLS) run; fitness_out entries written */
+    double evals;        /**< Fitness evaluations performed */
+    double target_evals; /**< Evaluations until the target was reached, or NAN */
+    double target_ms;    /**< Milliseconds until the target was reached, or NAN */
+} SearchStats;
+
+/**
+ * @brief Fills a SearchOptions structure with default values.
+ *
+ * @param opt Pointer to the options to initialize.
+ */
+void search_options_default(SearchOptions* opt);
+
 /**
  * @brief Performs blind (random) search optimization.
  *
  * Random solution vectors are sampled uniformly within the given bounds
- * and evaluated independently.
+ * and evaluated independently. With STORAGE_F32 the samples are held
+ * as float; a sample that beats the best so far is widened and
+ * re-evaluated in double before it is accepted, and that value is
+ * stored in fitness_out. If opt->target is set, sampling stops at the
+ * first sample with fitness <= target. With a counter-based opt->rng
+ * (rng=philox) sample i is drawn from substream opt->first + i.
  *
  * @param p Pointer to the optimization problem.
  * @param m Dimension of the problem.
  * @param iters Number of random samples.
  * @param lower Lower bound for each dimension.
  * @param upper Upper bound for each dimension.
+ * @param opt Search options (NULL for defaults; storage, target, block, rng and first are used).
  * @param fitness_out Array of length @p iters storing fitness values.
  * @param best_out Output parameter for best fitness found.
+ * @param best_x_out Optional output for the best vector (m values), or NULL.
  * @param time_ms_out Output parameter for total execution time in milliseconds.
+ * @param stats_out Optional output for iteration/evaluation counts, or NULL.
  * @return 0 on success, non-zero on error.
  */
 int blind_search(const Problem* p,
@@ -33,9 +80,46 @@ int blind_search(const Problem* p,
                  int iters,
                  double lower,
                  double upper,
+                 const SearchOptions* opt,
                  double* fitness_out,
                  double* best_out,
-                 double* time_ms_out);
+                 double* best_x_out,
+                 double* time_ms_out,
+                 SearchStats* stats_out);
+
+/**
+ * @brief Performs blind search for several problems on the same samples.
+ *
+ * Every sample is drawn once as a vector of uniform [0,1) values and
+ * scaled to each problem's bounds. Problems that share bounds are
+ * evaluated together by the fused kernel (problem_eval_multi()), so a
+ * sample is generated and read once per distinct range. For each
+ * problem the fitness values equal those of blind_search() run from
+ * the same RNG state. Samples are always held as double.
+ *
+ * @param m Dimension of the problems.
+ * @param iters Number of random samples.
+ * @param mask Problems to run (PROBLEM_MASK(t) bits).
+ * @param lower Lower bound per problem, indexed by ProblemType.
+ * @param upper Upper bound per problem, indexed by ProblemType.
+ * @param rng Random stream, or NULL for rng_global().
+ * @param fitness_out Indexed by ProblemType; arrays of length @p iters.
+ * @param best_out Indexed by ProblemType; best fitness per problem.
+ * @param best_x_out Optional, indexed by ProblemType; best vector per
+ *                   problem (m values each), or NULL.
+ * @param time_ms_out Output parameter for total execution time in milliseconds.
+ * @return 0 on success, non-zero on error.
+ */
+int blind_search_multi(int m,
+                       int iters,
+                       unsigned mask,
+                       const double* lower,
+                       const double* upper,
+                       Rng* rng,
+                       double* const* fitness_out,
+                       double* best_out,
+                       double* const* best_x_out,
+                       double* time_ms_out);
 
 /**
  * @brief Performs a single local search.
@@ -71,7 +155,28 @@ int local_search(const Problem* p,
  *
  * The local search algorithm is executed multiple times from
  * randomly generated starting points. The best result across
- * all restarts is reported.
+ * all restarts is reported. With STORAGE_F32 the full neighborhood
+ * is generated into float blocks and the best neighbor of each block
+ * is re-evaluated in double before it can be accepted; the current
+ * solution itself is always double. With LS_LBFGS each restart runs
+ * lbfgs_minimize() for up to @p max_steps iterations instead, and
+ * neighbors, step_frac, neighborhood and storage are not used. If
+ * opt->target is set, the local search stops as soon as its fitness
+ * is <= target and no further restarts are run.
+ *
+ * With opt->cache set, the starting points, accepted moves and
+ * full-neighborhood blocks on double storage are looked up in the
+ * cache first and only misses are evaluated (and counted in
+ * stats_out->evals). The cache is kept across restarts, so a restart
+ * that walks into an explored basin reuses its values. Coordinate
+ * deltas, float32 blocks and L-BFGS bypass it. opt->block, if set,
+ * caps the neighbors evaluated per call.
+ *
+ * With a counter-based opt->rng (rng=philox) restart t draws from
+ * substream opt->first + t, so it can be rerun alone. The restarts of
+ * a builtin, untransformed problem then run on kernels_threads()
+ * threads when there is no cache and no target, with the same results
+ * as one thread.
  *
  * @param p Pointer to the optimization problem.
  * @param m Dimension of the problem.
@@ -81,9 +186,12 @@ int local_search(const Problem* p,
  * @param max_steps Maximum local search steps per restart.
  * @param lower Lower bound for each dimension.
  * @param upper Upper bound for each dimension.
+ * @param opt Search options (NULL for defaults).
  * @param fitness_out Array of length @p restarts storing per-run fitness values.
  * @param best_out Output parameter for best fitness found.
+ * @param best_x_out Optional output for the best vector (m values), or NULL.
  * @param time_ms_out Output parameter for total execution time in milliseconds.
+ * @param stats_out Optional output for restart/evaluation counts, or NULL.
  * @return 0 on success, non-zero on error.
  */
 int repeated_local_search(const Problem* p,
@@ -94,8 +202,11 @@ int repeated_local_search(const Problem* p,
                           int max_steps,
                           double lower,
                           double upper,
+                          const SearchOptions* opt,
                           double* fitness_out,
                           double* best_out,
-                          double* time_ms_out);
+                          double* best_x_out,
+                          double* time_ms_out,
+                          SearchStats* stats_out);
 
 #endif /* ALGORITHMS_H */
@@ -0,0 +1,123 @@
+#ifndef AUTOTUNE_H
+#define AUTOTUNE_H
+
+#include "problem.h"
+
+/**
+ * @file autotune.h
+ * @brief Per-machine choice of kernel variant, block size and threads.
+ *
+ * `project2 --autotune <config>` times every kernel variant the CPU
+ * supports, several evaluation block sizes (1 row per call is the plain
+ * one-vector path, larger blocks let the batch kernels interleave rows)
+ * and, for rows long enough to be split, several thread counts, for
+ * each (problem, m) in the config. The fastest combination is written
+ * to a small text profile. Normal runs load the profile at startup and
+ * use the entry matching the problem, dimension and precision.
+ *
+ * Every tuned setting leaves the fitness values bit-identical (all
+ * variants, block sizes and thread counts compute the same sums in the
+ * same order), so a profile changes run time only.
+ */
+
+/** Dimension from which the thread count is tuned (the blocked reduction in kernels.c). */
+#define AUTOTUNE_THREAD_DIM_MIN 16384
+
+/**
+ * @brief Tuned settings for one (problem, m, precision).
+ */
+typedef struct {
+    int problem;             /**< ProblemType (1..10) */
+    int m;                   /**< Dimension */
+    EvalPrecision precision; /**< Kernel precision the entry was measured with */
+    char isa[16];            /**< Fastest kernel variant */
+    int block;               /**< Fastest rows per evaluation call */
+    int threads;             /**< Fastest thread count (0 = not tuned) */
+    double ns_per_eval;      /**< Measured time per evaluation */
+} TuneEntry;
+
+/**
+ * @brief A machine profile: the tuned entries and the machine they belong to.
+ */
+typedef struct {
+    char machine[16]; /**< Widest kernel variant of the CPU */
+    int cpus;         /**< Threads available to the kernels */
+    TuneEntry* entries; /**< Entries (count values) */
+    int count;        /**< Number of entries */
+    int cap;          /**< Allocated entries */
+} TuneProfile;
+
+/**
+ * @brief Initializes an empty profile for the running machine.
+ *
+ * @param prof Profile to initialize.
+ */
+void autotune_init(TuneProfile* prof);
+
+/**
+ * @brief Frees the entries of a profile.
+ *
+ * @param prof Profile to free.
+ */
+void autotune_free(TuneProfile* prof);
+
+/**
+ * @brief Times the variants for one problem and dimension.
+ *
+ * Uses the precision set with kernels_set_precision(). The ISA and
+ * thread settings active on entry are restored before returning.
+ *
+ * @param type Problem to time (1..10).
+ * @param m Dimension.
+ * @param lower Lower bound of the sampled vectors.
+ * @param upper Upper bound of the sampled vectors.
+ * @param out Output entry with the fastest combination.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure.
+ */
+int autotune_measure(ProblemType type, int m, double lower, double upper, TuneEntry* out);
+
+/**
+ * @brief Adds an entry, replacing one with the same key.
+ *
+ * @param prof Profile.
+ * @param e Entry to store.
+ * @return 0 on success, 2 on allocation failure.
+ */
+int autotune_put(TuneProfile* prof, const TuneEntry* e);
+
+/**
+ * @brief Finds the entry for a problem, dimension and precision.
+ *
+ * @param prof Profile.
+ * @param type Problem.
+ * @param m Dimension.
+ * @param precision Kernel precision.
+ * @return Matching entry, or NULL.
+ */
+const TuneEntry* autotune_find(const TuneProfile* prof, int type, int m, EvalPrecision precision);
+
+/**
+ * @brief Loads a profile written by autotune_save().
+ *
+ * @param path Profile path.
+ * @param prof Output profile (initialized by this call).
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 if the file cannot be opened,
+ *         3 on a malformed file,
+ *         4 if it was written on a different machine (left empty).
+ */
+int autotune_load(const char* path, TuneProfile* prof);
+
+/**
+ * @brief Writes a profile.
+ *
+ * @param path Profile path.
+ * @param prof Profile.
+ * @return 0 on success, 1 on invalid arguments, 2 if the file cannot be written.
+ */
+int autotune_save(const char* path, const TuneProfile* prof);
+
+#endif /* AUTOTUNE_H */
@@ -2,6 +2,8 @@
 #define CONFIG_H
 
 #include <stdint.h>
+#include "problem.h"
+#include "rng.h"
 
 /**
  * @file config.h
@@ -22,21 +24,64 @@ typedef enum {
     ALG_ALL   = 99 /**< Run all supported algorithms */
 } AlgorithmType;
 
+/**
+ * @brief Neighbor generation used by (repeated) local search.
+ */
+typedef enum {
+    NB_FULL       = 0, /**< Perturb every coordinate of the current solution */
+    NB_COORDINATE = 1  /**< Perturb one random coordinate (delta evaluation) */
+} NeighborhoodType;
+
+/**
+ * @brief Local optimizer used by (repeated) local search.
+ */
+typedef enum {
+    LS_SAMPLING = 0, /**< Move to the best of `neighbors` random neighbors */
+    LS_LBFGS    = 1  /**< Bound-constrained L-BFGS on the analytic gradient */
+} LocalSearchType;
+
+/**
+ * @brief Fitness at which a run stops early.
+ */
+typedef enum {
+    TARGET_NONE    = 0, /**< Always run all iterations */
+    TARGET_OPTIMUM = 1, /**< Problem's known optimum + optimum_tol (if known) */
+    TARGET_VALUE   = 2  /**< Config::target_value, for every problem */
+} TargetMode;
+
 /**
  * @brief Configuration parameters loaded from a config file.
  */
 typedef struct {
-    int m;                 /**< Problem dimension (10, 20, 30) */
+    int m;                 /**< Problem dimension (10, 20, 30; any m > 0 is accepted) */
     int n;                 /**< Iterations per algorithm run (default 30) */
-    int problem_type;      /**< Problem identifier (1..10, or 0 = all) */
+    int problem_type;      /**< Problem identifier (1..10, 0 = all, PROB_PLUGIN or PROB_EXPR) */
+    char plugin_path[256]; /**< Shared library of problem=plugin:<path> */
+    char objective[384];   /**< Expression of objective=<expr> (see expr.h) */
     AlgorithmType alg;     /**< Algorithm to execute */
     int neighbors;         /**< Number of neighbors for (R)LS (default 30) */
     double step_frac;      /**< Step size as fraction of search range (default 0.05) */
     int max_ls_steps;      /**< Max local-search steps per restart (default 200) */
+    NeighborhoodType neighborhood; /**< (R)LS neighbor generation (default full) */
+    LocalSearchType local; /**< (R)LS local optimizer (default sampling) */
     char output_csv[256];  /**< Output CSV file path */
     uint32_t seed;         /**< Random seed (0 = system time) */
-    double lower;          /**< Lower bound of problem domain */
-    double upper;          /**< Upper bound of problem domain */
+    RngType rng;           /**< Random number engine (default mt19937) */
+    uint32_t seed_stream;  /**< Stream under the seed (philox key, MT19937 2^128 jumps; default 0) */
+    int replay;            /**< Run only this sample/restart (rng=philox; -1 = all) */
+    double lower;          /**< Lower bound of problem domain (NAN = problem's range, lower=default) */
+    double upper;          /**< Upper bound of problem domain (NAN = problem's range, upper=default) */
+    char isa[16];          /**< Kernel ISA variant ("auto", "sse2", "avx2", "avx512") */
+    int threads;           /**< Threads for large-dimension evaluation (0 = OpenMP default) */
+    EvalPrecision precision; /**< Kernel precision (default exact) */
+    StorageType storage;   /**< Element type of candidate blocks (default double) */
+    TransformKind transform[PROB_EGG_HOLDER + 1]; /**< Shift/rotation per problem (default none) */
+    uint32_t transform_seed; /**< Seed for the shifts and rotations (default 1) */
+    TargetMode target;     /**< Early-stop fitness (default none) */
+    double target_value;   /**< Fitness to reach with TARGET_VALUE */
+    double cache_resolution; /**< (R)LS evaluation cache key step (0 = exact, NAN = off) */
+    int cache_mb;          /**< Evaluation cache budget in MiB (default 64) */
+    char profile[256];     /**< Autotune profile path ("" = none; default project2.profile) */
 } Config;
 
 /**
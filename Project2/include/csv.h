@@ -27,24 +27,26 @@ int csv_init_results(const char* path);
  * @brief Appends a single result row to the CSV file.
  *
  * The output row format is:
- * algorithm, problem, dimension, iteration, fitness, time_ms
+ * algorithm, problem, dimension, iteration, fitness, time_ms, rng
  *
  * @param path Path to the CSV output file.
  * @param alg Algorithm identifier.
- * @param problem Problem identifier.
+ * @param problem Problem that was run (its short name is written).
  * @param m Problem dimension.
  * @param iteration Iteration or restart index.
  * @param fitness Fitness value.
  * @param time_ms Runtime in milliseconds.
+ * @param rng Random number engine of the run (written by name).
  * @return 0 on success, non-zero on failure.
  */
 int csv_append_result(const char* path,
                       AlgorithmType alg,
-                      ProblemType problem,
+                      const Problem* problem,
                       int m,
                       int iteration,
                       double fitness,
-                      double time_ms);
+                      double time_ms,
+                      RngType rng);
 
 /**
  * @brief Returns a human-readable algorithm name.
@@ -0,0 +1,83 @@
+#ifndef DSFMT_H
+#define DSFMT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file dsfmt.h
+ * @brief Double precision SIMD-oriented Fast Mersenne Twister (dSFMT-19937).
+ *
+ * dSFMT (Saito and Matsumoto) keeps its state as 128-bit words and
+ * produces IEEE doubles in [1, 2) directly: the recursion leaves every
+ * 64-bit word with the exponent of 1.0 and 52 random mantissa bits, so
+ * an output is a plain load instead of an integer-to-double conversion.
+ * The state is regenerated DSFMT_N 128-bit words at a time (SSE2 on
+ * x86, portable 64-bit code elsewhere; both give the same stream). The
+ * seeding and recursion follow the reference dSFMT.c with the
+ * dSFMT-params19937.h parameters. Period 2^19937 - 1.
+ */
+
+/** 128-bit words in the dSFMT-19937 state (excluding the lung). */
+#define DSFMT_N 191
+
+/** 64-bit outputs per regeneration of the state. */
+#define DSFMT_N64 (DSFMT_N * 2)
+
+/**
+ * @brief State of one dSFMT stream.
+ *
+ * A state must be seeded with dsfmt_init() before use.
+ */
+typedef struct {
+    _Alignas(16) uint64_t status[(DSFMT_N + 1) * 2]; /**< 128-bit words as 64-bit pairs; the last is the lung */
+    int idx; /**< Index of the next 64-bit output (DSFMT_N64 = regenerate) */
+} DSFMTState;
+
+/**
+ * @brief Seeds a generator state.
+ *
+ * @param st State to initialize.
+ * @param s Seed value.
+ */
+void dsfmt_init(DSFMTState* st, uint32_t s);
+
+/**
+ * @brief Draws a double in [1, 2).
+ *
+ * @param st Generator state.
+ * @return Random double in the range [1,2).
+ */
+double dsfmt_close1_open2(DSFMTState* st);
+
+/**
+ * @brief Draws a double in [0, 1) (52 random bits).
+ *
+ * @param st Generator state.
+ * @return Random double in the range [0,1).
+ */
+double dsfmt_real(DSFMTState* st);
+
+/**
+ * @brief Draws a 32-bit unsigned integer (the low mantissa bits of one output).
+ *
+ * @param st Generator state.
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t dsfmt_next(DSFMTState* st);
+
+/**
+ * @brief Fills an array with uniform random values in [lo, hi).
+ *
+ * out[i] is exactly lo + (hi - lo) * dsfmt_real(st) for n successive
+ * draws, and the state ends where those draws would leave it.
+ *
+ * @param st Generator state.
+ * @param out Output array (n values).
+ * @param n Number of values.
+ * @param lo Lower bound.
+ * @param hi Upper bound.
+ */
+void dsfmt_fill_real(DSFMTState* st, double* out, size_t n, double lo, double hi);
+
+#endif /* DSFMT_H */
@@ -0,0 +1,103 @@
+#ifndef EVALCACHE_H
+#define EVALCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file evalcache.h
+ * @brief Memo cache of fitness values keyed by (quantized) vectors.
+ *
+ * An open-addressing hash table with a fixed number of slots, sized
+ * once from a memory budget. Each slot holds the key of one vector (m
+ * words), its hash and its fitness. A key is either the exact bit
+ * pattern of every coordinate, or every coordinate rounded to a
+ * multiple of a resolution, so vectors closer than that share one
+ * entry. Lookups probe at most EVALCACHE_PROBES consecutive slots;
+ * when they are all taken an insert overwrites the entry at the home
+ * slot, so the table never grows and old entries simply drop out.
+ *
+ * With exact keys a hit returns exactly what problem_eval() would; with
+ * a resolution it returns the fitness of the first vector evaluated in
+ * that cell.
+ */
+
+/** Slots probed per lookup or insert. */
+#define EVALCACHE_PROBES 8
+
+/**
+ * @brief A fitness cache for vectors of one dimension.
+ */
+typedef struct {
+    int m;              /**< Dimension of the cached vectors */
+    double inv_res;     /**< 1 / resolution, or 0 for exact keys */
+    size_t mask;        /**< Number of slots - 1 (a power of two minus one) */
+    uint64_t* keys;     /**< Slot keys, m words each */
+    uint64_t* hashes;   /**< Slot hashes (0 = empty) */
+    double* values;     /**< Slot fitness values */
+    uint64_t* key;      /**< Scratch key (m words) */
+    double hits;        /**< Lookups answered from the cache */
+    double misses;      /**< Lookups that were not */
+} EvalCache;
+
+/**
+ * @brief Allocates a cache.
+ *
+ * The slot count is the largest power of two whose slots fit in
+ * @p max_bytes (at least 16).
+ *
+ * @param c Cache to initialize.
+ * @param m Dimension of the vectors.
+ * @param resolution Quantization step of the keys, or 0 for exact keys.
+ * @param max_bytes Memory budget for the slots.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure.
+ */
+int evalcache_init(EvalCache* c, int m, double resolution, size_t max_bytes);
+
+/**
+ * @brief Frees a cache.
+ *
+ * @param c Cache to free.
+ */
+void evalcache_free(EvalCache* c);
+
+/**
+ * @brief Looks up the fitness of a vector.
+ *
+ * Counts a hit or a miss.
+ *
+ * @param c Cache.
+ * @param x Vector (m values).
+ * @param f_out Output fitness on a hit.
+ * @return 1 on a hit, 0 on a miss.
+ */
+int evalcache_lookup(EvalCache* c, const double* x, double* f_out);
+
+/**
+ * @brief Stores the fitness of a vector.
+ *
+ * @param c Cache.
+ * @param x Vector (m values).
+ * @param f Fitness of x.
+ */
+void evalcache_insert(EvalCache* c, const double* x, double f);
+
+/**
+ * @brief Returns the number of slots.
+ *
+ * @param c Cache.
+ * @return Slot count.
+ */
+size_t evalcache_slots(const EvalCache* c);
+
+/**
+ * @brief Returns the memory used by the slots.
+ *
+ * @param c Cache.
+ * @return Size in bytes.
+ */
+size_t evalcache_bytes(const EvalCache* c);
+
+#endif /* EVALCACHE_H */
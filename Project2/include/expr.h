@@ -0,0 +1,209 @@
+#ifndef EXPR_H
+#define EXPR_H
+
+#include <stdint.h>
+#include "problem.h"
+
+/**
+ * @file expr.h
+ * @brief User-defined objectives written as expressions in the config.
+ *
+ * An expression such as
+ * @code
+ * objective=sum(x[i]^2 - 10*cos(2*pi*x[i])) + 10*m
+ * @endcode
+ * is compiled once into a small register bytecode. The interpreter
+ * (the `expr` entry of the active KernelTable) runs every instruction
+ * over a whole register of EXPR_LANES values before moving to the
+ * next one, so the dispatch cost is paid once per instruction and
+ * block rather than once per coordinate, and the arithmetic loops and
+ * vecmath calls vectorize like the hand-written kernels.
+ *
+ * Language:
+ * - numbers, `pi`, `e`, `m` (the dimension), `+ - * / ^` (or `**`),
+ *   unary minus and parentheses; `^` binds tighter than unary minus
+ *   and is right-associative.
+ * - functions: `sin cos tan exp log sqrt abs`.
+ * - `sum(body)` and `prod(body)` reduce over the coordinate index `i`;
+ *   inside the body `x[i]`, `x[i+c]`, `x[i-c]` (integer c) and `i`
+ *   are available. The index runs over every i for which all the
+ *   offsets used stay inside 0..m-1, so `sum(x[i+1] - x[i])` has m-1
+ *   terms. Reductions cannot be nested.
+ * - `x[c]` (integer c) reads a fixed coordinate anywhere; it is NAN
+ *   if c >= m.
+ */
+
+/*
+ * Name of the interpreter exported by one build of expr_kernels.c
+ * (expr_batch_<isa>, or expr_batch_fast_<isa> with KERNEL_FAST); the
+ * kernels.c build with the same flags puts it in its KernelTable.
+ */
+#if defined(KERNEL_FAST)
+#define EXPR_BATCH_NAME2(isa) expr_batch_fast_##isa
+#else
+#define EXPR_BATCH_NAME2(isa) expr_batch_##isa
+#endif
+#define EXPR_BATCH_NAME(isa) EXPR_BATCH_NAME2(isa)
+
+/** Values per interpreter register (one block of lanes). */
+#define EXPR_LANES 256
+
+/** Maximum number of registers an expression may need. */
+#define EXPR_MAX_REGS 16
+
+/** Maximum number of instructions of a compiled expression. */
+#define EXPR_MAX_CODE 256
+
+/** Maximum number of distinct constants. */
+#define EXPR_MAX_CONSTS 64
+
+/** Maximum number of sum()/prod() reductions. */
+#define EXPR_MAX_REDUCE 8
+
+/**
+ * @brief Bytecode operations.
+ *
+ * dst, a and b are register numbers; imm is a constant-pool index, a
+ * coordinate offset or index, or a reduction number.
+ */
+typedef enum {
+    EXPR_OP_CONST,  /**< r[dst] = consts[imm] */
+    EXPR_OP_X,      /**< r[dst] = x[i + imm] (reduction body) */
+    EXPR_OP_XAT,    /**< r[dst] = x[imm] */
+    EXPR_OP_INDEX,  /**< r[dst] = i (reduction body) */
+    EXPR_OP_DIM,    /**< r[dst] = m */
+    EXPR_OP_REDUCE, /**< r[dst] = value of reduction imm (top level) */
+    EXPR_OP_ADD,    /**< r[dst] = r[a] + r[b] */
+    EXPR_OP_SUB,    /**< r[dst] = r[a] - r[b] */
+    EXPR_OP_MUL,    /**< r[dst] = r[a] * r[b] */
+    EXPR_OP_DIV,    /**< r[dst] = r[a] / r[b] */
+    EXPR_OP_POW,    /**< r[dst] = pow(r[a], r[b]) */
+    EXPR_OP_ADDK,   /**< r[dst] = r[a] + consts[imm] */
+    EXPR_OP_MULK,   /**< r[dst] = r[a] * consts[imm] */
+    EXPR_OP_POWK,   /**< r[dst] = pow(r[a], consts[imm]) */
+    EXPR_OP_SQUARE, /**< r[dst] = r[a] * r[a] */
+    EXPR_OP_NEG,    /**< r[dst] = -r[a] */
+    EXPR_OP_ABS,    /**< r[dst] = |r[a]| */
+    EXPR_OP_SQRT,   /**< r[dst] = sqrt(r[a]) */
+    EXPR_OP_SIN,    /**< r[dst] = sin(r[a]) */
+    EXPR_OP_COS,    /**< r[dst] = cos(r[a]) */
+    EXPR_OP_TAN,    /**< r[dst] = tan(r[a]) */
+    EXPR_OP_EXP,    /**< r[dst] = exp(r[a]) */
+    EXPR_OP_LOG     /**< r[dst] = log(r[a]) */
+} ExprOp;
+
+/**
+ * @brief One bytecode instruction.
+ */
+typedef struct {
+    uint8_t op;  /**< ExprOp */
+    uint8_t dst; /**< Destination register */
+    uint8_t a;   /**< First operand register */
+    uint8_t b;   /**< Second operand register */
+    int32_t imm; /**< Immediate operand (see ExprOp) */
+} ExprInstr;
+
+/**
+ * @brief One sum() or prod() and the instructions of its body.
+ */
+typedef struct {
+    int begin;   /**< First instruction of the body */
+    int end;     /**< One past the last instruction of the body */
+    int result;  /**< Register holding the term after the body ran */
+    int product; /**< Non-zero for prod(), zero for sum() */
+    int lo_off;  /**< Smallest offset c of any x[i+c] in the body (<= 0) */
+    int hi_off;  /**< Largest offset c of any x[i+c] in the body (>= 0) */
+} ExprReduce;
+
+/**
+ * @brief A compiled expression and the workspace of its interpreter.
+ *
+ * The reduction bodies come first in @c code, followed by the top-level
+ * instructions, which run once per vector after every reduction is
+ * complete. Evaluation writes to the workspace, so a program must not
+ * be evaluated from two threads at once.
+ */
+typedef struct ExprProgram {
+    ExprInstr code[EXPR_MAX_CODE];       /**< Instructions */
+    int ncode;                           /**< Number of instructions */
+    int top_begin;                       /**< First top-level instruction */
+    int top_result;                      /**< Register holding f after the top level ran */
+    double consts[EXPR_MAX_CONSTS];      /**< Constant pool */
+    int nconsts;                         /**< Number of constants */
+    ExprReduce reduce[EXPR_MAX_REDUCE];  /**< Reductions */
+    int nreduce;                         /**< Number of reductions */
+    int nregs;                           /**< Registers used */
+    double* regs;                        /**< (EXPR_MAX_REGS + 1) * EXPR_LANES values */
+    double* acc;                         /**< EXPR_MAX_REDUCE * EXPR_LANES reduction results */
+    char source[384];                    /**< Expression text */
+} ExprProgram;
+
+/**
+ * @brief Compiles an expression.
+ *
+ * @param src Expression text.
+ * @param out Output program; release with expr_free().
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure,
+ *         3 on a syntax error or an expression over the size limits
+ *           (see expr_error()).
+ */
+int expr_compile(const char* src, ExprProgram** out);
+
+/**
+ * @brief Frees a compiled expression.
+ *
+ * @param prog Program from expr_compile(), or NULL.
+ */
+void expr_free(ExprProgram* prog);
+
+/**
+ * @brief Returns the message of the last failed expr_compile().
+ *
+ * @return Error text with the column it refers to; never NULL.
+ */
+const char* expr_error(void);
+
+/**
+ * @brief Evaluates a program with plain libm calls, one value at a time.
+ *
+ * Runs the same bytecode as the interpreter kernel, so the two differ
+ * only by the vecmath error (a few ULP per function, or the fast-mode
+ * error with precision=fast).
+ *
+ * @param prog Compiled program.
+ * @param x Input vector.
+ * @param m Dimension.
+ * @return Fitness value.
+ */
+double expr_eval_reference(const ExprProgram* prog, const double* x, int m);
+
+/**
+ * @brief Builds a Problem descriptor that evaluates a program.
+ *
+ * The descriptor has type PROB_EXPR, the expression text as its name
+ * and the given bounds; it has no known optimum and no delta, bounded,
+ * float32 or gradient kernels. The evaluation functions take no
+ * context argument, so only one program can be bound at a time: a
+ * later call rebinds every PROB_EXPR descriptor. The interpreter of
+ * the active kernel variant is bound, as in problem_create().
+ *
+ * @param prog Compiled program; must outlive the descriptor's use.
+ * @param lower Default lower bound.
+ * @param upper Default upper bound.
+ * @param out Output problem descriptor.
+ * @return 0 on success, 1 on invalid arguments.
+ */
+int expr_problem(ExprProgram* prog, double lower, double upper, Problem* out);
+
+/**
+ * @brief Evaluates the bound program with libm (see expr_eval_reference()).
+ *
+ * @param x Input vector.
+ * @param m Dimension.
+ * @return Fitness value, or NAN if no program is bound.
+ */
+double expr_bound_reference(const double* x, int m);
+
+#endif /* EXPR_H */
@@ -0,0 +1,133 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include "problem.h"
+
+/**
+ * @file kernels.h
+ * @brief Instruction-set variants of the problem evaluation kernels.
+ *
+ * kernels.c is compiled several times with different instruction-set
+ * flags. Each build exports a KernelTable; the table matching the
+ * running CPU is chosen once at startup and problem_create() binds its
+ * entries into each Problem descriptor.
+ */
+
+/**
+ * @brief Shift/rotation of a block: Z = (X - 1 o^T) R^T (see transform.h).
+ */
+typedef void (*TransformRowsFn)(const double* X, int k, int m, const double* shift,
+                                const double* rot_t, double* Z);
+
+struct ExprProgram;
+
+/**
+ * @brief Interpreter for compiled expressions: fitness of k row-major vectors (see expr.h).
+ */
+typedef void (*ExprRunFn)(struct ExprProgram* prog, const double* X, int k, int m, double* f_out);
+
+/**
+ * @brief One compiled variant of the evaluation kernels.
+ */
+typedef struct {
+    const char* isa;                          /**< Variant name ("sse2", "avx2", ...) */
+    EvalPrecision precision;                  /**< Exact or fast (VM_FAST) polynomials */
+    ProblemBatchFn batch[PROB_EGG_HOLDER + 1]; /**< Batch kernels indexed by ProblemType */
+    ProblemEvalFn eval[PROB_EGG_HOLDER + 1];   /**< Scalar kernels indexed by ProblemType */
+    ProblemDeltaFn delta[PROB_EGG_HOLDER + 1]; /**< Delta kernels indexed by ProblemType */
+    ProblemBoundedFn bounded[PROB_EGG_HOLDER + 1]; /**< Early-abandon kernels (NULL if not eligible) */
+    ProblemBatchF32Fn batch_f32[PROB_EGG_HOLDER + 1]; /**< Batch kernels for float-stored rows */
+    ProblemMultiFn multi;                     /**< Fused kernel for several problems */
+    TransformRowsFn transform;                /**< Cache-blocked shift/rotation of a block */
+    void (*orthogonalize)(double* q, int m);  /**< Gram-Schmidt on the rows of an m x m matrix */
+    ProblemGradFn grad[PROB_EGG_HOLDER + 1];  /**< Value-and-gradient kernels indexed by ProblemType */
+    ExprRunFn expr;                           /**< Bytecode interpreter for objective= expressions */
+} KernelTable;
+
+#if defined(KERNEL_DISPATCH_X86)
+extern const KernelTable kernels_sse2;   /**< Baseline x86-64 build */
+extern const KernelTable kernels_avx2;   /**< AVX2 + FMA build */
+extern const KernelTable kernels_avx512; /**< AVX-512 (F/DQ/VL) build */
+extern const KernelTable kernels_fast_sse2;   /**< Fast-precision baseline build */
+extern const KernelTable kernels_fast_avx2;   /**< Fast-precision AVX2 + FMA build */
+extern const KernelTable kernels_fast_avx512; /**< Fast-precision AVX-512 build */
+#else
+extern const KernelTable kernels_generic; /**< Build for the compiler's default target */
+extern const KernelTable kernels_fast_generic; /**< Fast-precision default build */
+#endif
+
+/**
+ * @brief Selects the kernel variant to use.
+ *
+ * "auto" (or NULL/empty) picks the widest variant the CPU supports.
+ * A variant name forces that variant if the CPU supports it; otherwise
+ * the automatic choice is kept.
+ *
+ * @param isa Variant name or "auto".
+ * @return 0 on success,
+ *         1 if the name is unknown,
+ *         2 if the CPU does not support the requested variant.
+ */
+int kernels_select(const char* isa);
+
+/**
+ * @brief Returns the name of a kernel variant the CPU supports.
+ *
+ * @param i Index, from 0 (the widest, which "auto" picks) upwards.
+ * @return Variant name, or NULL past the last supported variant.
+ */
+const char* kernels_variant_name(int i);
+
+/**
+ * @brief Returns the active kernel table.
+ *
+ * Runs the automatic selection on first use if kernels_select() has
+ * not been called. With PRECISION_FAST set, the fast-precision build
+ * of the selected variant is returned.
+ *
+ * @return Pointer to the active KernelTable.
+ */
+const KernelTable* kernels_active(void);
+
+/**
+ * @brief Selects exact (default) or fast-precision kernels.
+ *
+ * Fast kernels use shorter sin/cos/exp/log polynomials (see vecmath.h;
+ * the error per evaluation is bounded by each problem's fast_err).
+ * Problem descriptors bind their kernels in problem_create(), so this
+ * must be called before creating them.
+ *
+ * @param p Precision mode.
+ */
+void kernels_set_precision(EvalPrecision p);
+
+/**
+ * @brief Sets the number of threads used for large-dimension rows.
+ *
+ * Only rows long enough for the blocked reduction are split across
+ * threads; the result does not depend on the thread count. Has no
+ * effect in builds without OpenMP.
+ *
+ * @param threads Thread count, or 0 to keep the OpenMP default
+ *                (OMP_NUM_THREADS or the number of cores).
+ */
+void kernels_set_threads(int threads);
+
+/**
+ * @brief Returns the number of threads available to the kernels.
+ *
+ * @return Thread count (1 in builds without OpenMP).
+ */
+int kernels_threads(void);
+
+/**
+ * @brief Returns the number of processors the kernels could use.
+ *
+ * Unlike kernels_threads() this does not follow threads= or
+ * OMP_NUM_THREADS.
+ *
+ * @return Processor count (1 in builds without OpenMP).
+ */
+int kernels_cpus(void);
+
+#endif /* KERNELS_H */
@@ -1,6 +1,7 @@
 #ifndef MT19937AR_H
 #define MT19937AR_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 /**
@@ -8,9 +9,110 @@
  * @brief Mersenne Twister MT19937 random number generator interface.
  *
  * This header declares functions for initializing and using the
- * MT19937 pseudorandom number generator.
+ * MT19937 pseudorandom number generator. The generator state is an
+ * explicit MTState, so independent streams can be used from different
+ * threads. The init_genrand()/genrand_*() functions are wrappers over
+ * one process-wide state (see mt_global()) and are not thread-safe.
  */
 
+/** Words in the MT19937 state vector. */
+#define MT_N 624
+
+/**
+ * @brief State of one MT19937 stream.
+ *
+ * A state must be seeded with mt_init() before use; a state with
+ * mti == MT_N + 1 is seeded with the reference default (5489) on its
+ * first draw.
+ */
+typedef struct {
+    uint32_t mt[MT_N]; /**< State vector */
+    int mti;           /**< Index of the next word (MT_N = regenerate) */
+} MTState;
+
+/**
+ * @brief Seeds a generator state.
+ *
+ * @param st State to initialize.
+ * @param s Seed value.
+ */
+void mt_init(MTState* st, uint32_t s);
+
+/**
+ * @brief Draws a 32-bit unsigned random integer from a state.
+ *
+ * @param st Generator state.
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t mt_next(MTState* st);
+
+/**
+ * @brief Draws a floating-point random number in [0, 1) from a state.
+ *
+ * Same values as genrand_real2() on the same stream.
+ *
+ * @param st Generator state.
+ * @return Random double in the range [0,1).
+ */
+double mt_real(MTState* st);
+
+/**
+ * @brief Fills an array with uniform random values in [lo, hi).
+ *
+ * out[i] is exactly lo + (hi - lo) * mt_real(st) for n successive
+ * draws, so a fill and the equivalent scalar loop leave the same values
+ * and the same state. The words are generated a state vector at a
+ * time, which is several times faster than n mt_real() calls.
+ *
+ * @param st Generator state.
+ * @param out Output array (n values).
+ * @param n Number of values.
+ * @param lo Lower bound.
+ * @param hi Upper bound.
+ */
+void mt_fill_real(MTState* st, double* out, size_t n, double lo, double hi);
+
+/** Jump tables in mt_jump_table: table k advances 2^(128 + k) draws. */
+#define MT_JUMP_TABLES 32
+
+/**
+ * @brief Jump polynomials for 2^128, 2^129, ..., 2^159 draws.
+ *
+ * Generated by scripts/mt_jump.py (src/mt_jump_table.c); coefficient j
+ * of a polynomial is bit j % 32 of word j / 32.
+ */
+extern const uint32_t mt_jump_table[MT_JUMP_TABLES][MT_N];
+
+/**
+ * @brief Advances a state by the jump a polynomial encodes.
+ *
+ * @param st Generator state.
+ * @param poly Jump polynomial (from scripts/mt_jump.py).
+ */
+void mt_jump_poly(MTState* st, const uint32_t poly[MT_N]);
+
+/**
+ * @brief Advances a state by n * 2^128 draws.
+ *
+ * The state afterwards gives the draws a state left alone would give
+ * after n * 2^128 more, so mt_init(s) followed by mt_jump(n) is stream
+ * n of seed s: streams never overlap unless one draws 2^128 values.
+ * Each set bit of n costs one jump of a few milliseconds.
+ *
+ * @param st Generator state.
+ * @param n Multiple of 2^128 to advance by.
+ */
+void mt_jump(MTState* st, uint32_t n);
+
+/**
+ * @brief Returns the process-wide state behind the genrand_*() functions.
+ *
+ * APIs that take an optional MTState use this one when given NULL.
+ *
+ * @return Global generator state.
+ */
+MTState* mt_global(void);
+
 /**
  * @brief Initializes the random number generator with a seed.
  *
@@ -0,0 +1,85 @@
+#ifndef OBJECTIVE_PLUGIN_H
+#define OBJECTIVE_PLUGIN_H
+
+#include <stdint.h>
+
+/**
+ * @file objective_plugin.h
+ * @brief Stable C ABI for objective functions loaded from shared libraries.
+ *
+ * A plugin is a shared library (.so / .dll / .dylib) that exports one
+ * function, OBJECTIVE_PLUGIN_ENTRY, returning a pointer to a static
+ * ObjectivePlugin table. project2 loads it with
+ * @code
+ * problem=plugin:/path/libobj.so
+ * @endcode
+ * and then calls the table's functions directly: eval_batch with whole
+ * blocks of samples (blind search) and neighbors (local search), eval
+ * for single vectors, and the optional hooks where the host can use
+ * them. This header depends on nothing else in project2, so a plugin
+ * only needs this file to build:
+ * @code
+ * cc -O2 -shared -fPIC -Iinclude myobj.c -o libmyobj.so
+ * @endcode
+ *
+ * All vectors are row-major arrays of double. The host calls the
+ * functions from one thread, but plugins should still keep no mutable
+ * global state.
+ *
+ * ABI rules: fields are only ever appended. A host accepts any table
+ * whose abi_version equals OBJECTIVE_PLUGIN_ABI and whose struct_size
+ * covers the fields it reads.
+ */
+
+/** ABI version this header describes. */
+#define OBJECTIVE_PLUGIN_ABI 1
+
+/** Name of the exported entry point. */
+#define OBJECTIVE_PLUGIN_ENTRY "objective_plugin"
+
+#if defined(_WIN32)
+#define OBJECTIVE_PLUGIN_EXPORT __declspec(dllexport)
+#elif defined(__GNUC__)
+#define OBJECTIVE_PLUGIN_EXPORT __attribute__((visibility("default")))
+#else
+#define OBJECTIVE_PLUGIN_EXPORT
+#endif
+
+/**
+ * @brief Function table exported by an objective plugin.
+ */
+typedef struct ObjectivePlugin {
+    uint32_t abi_version;   /**< Must be OBJECTIVE_PLUGIN_ABI */
+    uint32_t struct_size;   /**< sizeof(ObjectivePlugin) as compiled into the plugin */
+    const char* name;       /**< Human-readable name */
+    const char* short_name; /**< Compact name for the CSV (no commas) */
+    double lower;           /**< Default lower bound of the search domain */
+    double upper;           /**< Default upper bound of the search domain */
+    double optimum;         /**< Known global minimum, or NAN if unknown */
+    double optimum_tol;     /**< Fitness within this of optimum counts as optimal (target=optimum) */
+
+    /** Required: fitness of one vector of dimension m. */
+    double (*eval)(const double* x, int m);
+
+    /** Required: fitness of k row-major vectors into f_out[0..k-1]. */
+    void (*eval_batch)(const double* X, int k, int m, double* f_out);
+
+    /** Optional (NULL): fitness of x with x[j] replaced by xj, given f(x) = f_old. */
+    double (*eval_delta)(const double* x, int m, double f_old, int j, double xj);
+
+    /** Optional (NULL): fitness of x, with the gradient written to g[0..m-1]. */
+    double (*eval_grad)(const double* x, int m, double* g);
+} ObjectivePlugin;
+
+/**
+ * @brief Signature of the exported entry point.
+ *
+ * A plugin defines
+ * @code
+ * OBJECTIVE_PLUGIN_EXPORT const ObjectivePlugin* objective_plugin(void);
+ * @endcode
+ * returning a pointer that stays valid while the library is loaded.
+ */
+typedef const ObjectivePlugin* (*ObjectivePluginEntryFn)(void);
+
+#endif /* OBJECTIVE_PLUGIN_H */
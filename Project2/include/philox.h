@@ -0,0 +1,90 @@
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file philox.h
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * Philox (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+ * is a keyed bijection: ten rounds of multiply-xor turn a 128-bit
+ * counter and a 64-bit key into four random 32-bit words. There is no
+ * state to advance, so any draw can be computed on its own.
+ *
+ * A PhiloxState is keyed by (seed, stream) and addresses its draws as
+ * (substream, index): draw k of substream t is word k % 4 of
+ * philox4x32_10({k / 4 (64 bits), t (64 bits)}, {seed, stream}). The
+ * searches use one substream per sample or restart, so each of them
+ * can be regenerated, or run on another thread, without the others.
+ */
+
+/**
+ * @brief Computes one Philox4x32-10 block.
+ *
+ * @param ctr Counter (4 words).
+ * @param key Key (2 words).
+ * @param out Output (4 words).
+ */
+void philox4x32_10(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4]);
+
+/**
+ * @brief A position in the Philox draws of one (seed, stream).
+ */
+typedef struct {
+    uint32_t key[2]; /**< seed, stream */
+    uint32_t ctr[4]; /**< Block of the substream (words 0-1), substream (words 2-3) */
+    uint32_t out[4]; /**< Current block */
+    int pos;         /**< Next word of out (4 = compute the block at ctr) */
+} PhiloxState;
+
+/**
+ * @brief Keys a state and positions it at the start of substream 0.
+ *
+ * @param st State to initialize.
+ * @param seed Seed (first key word).
+ * @param stream Stream under that seed (second key word).
+ */
+void philox_init(PhiloxState* st, uint32_t seed, uint32_t stream);
+
+/**
+ * @brief Positions a state at draw @p index of substream @p substream.
+ *
+ * @param st State.
+ * @param substream Substream (a sample or restart number).
+ * @param index Draw within the substream.
+ */
+void philox_seek(PhiloxState* st, uint64_t substream, uint64_t index);
+
+/**
+ * @brief Draws a 32-bit unsigned random integer.
+ *
+ * @param st State.
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t philox_next(PhiloxState* st);
+
+/**
+ * @brief Draws a double in [0, 1) from one 32-bit word.
+ *
+ * @param st State.
+ * @return Random double in the range [0,1).
+ */
+double philox_real(PhiloxState* st);
+
+/**
+ * @brief Fills an array with uniform random values in [lo, hi).
+ *
+ * out[i] is exactly lo + (hi - lo) * philox_real(st) for n successive
+ * draws. Whole blocks are computed four words at a time.
+ *
+ * @param st State.
+ * @param out Output array (n values).
+ * @param n Number of values.
+ * @param lo Lower bound.
+ * @param hi Upper bound.
+ */
+void philox_fill_real(PhiloxState* st, double* out, size_t n, double lo, double hi);
+
+#endif /* PHILOX_H */
@@ -0,0 +1,58 @@
+#ifndef PLUGIN_H
+#define PLUGIN_H
+
+#include "objective_plugin.h"
+#include "problem.h"
+
+/**
+ * @file plugin.h
+ * @brief Host side of objective plugins (see objective_plugin.h).
+ *
+ * Loads a plugin library with dlopen (LoadLibrary on Windows), checks
+ * its ABI and binds its functions into a Problem descriptor, so the
+ * algorithms use a plugin exactly like a built-in problem.
+ */
+
+/**
+ * @brief A loaded plugin library.
+ */
+typedef struct {
+    void* lib;                  /**< dlopen / LoadLibrary handle */
+    const ObjectivePlugin* api; /**< Function table exported by the plugin */
+} PluginHandle;
+
+/**
+ * @brief Loads an objective plugin and builds its Problem descriptor.
+ *
+ * The descriptor has type PROB_PLUGIN and the plugin's name, bounds
+ * and optimum. eval, eval_batch, eval_delta and eval_grad are the
+ * plugin's own functions (the optional ones may be NULL); there is no
+ * bounded or float32 kernel, and the plugin is its own reference
+ * (problem_eval_reference() calls eval).
+ *
+ * @param path Path of the shared library.
+ * @param h Output handle; pass to plugin_unload() when done.
+ * @param out Output problem descriptor, valid while @p h is loaded.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 if the library cannot be loaded,
+ *         3 if it does not export OBJECTIVE_PLUGIN_ENTRY,
+ *         4 on an ABI mismatch or a missing required function.
+ */
+int plugin_load(const char* path, PluginHandle* h, Problem* out);
+
+/**
+ * @brief Unloads a plugin library.
+ *
+ * @param h Handle filled by plugin_load().
+ */
+void plugin_unload(PluginHandle* h);
+
+/**
+ * @brief Returns the last loader error message.
+ *
+ * @return dlerror() text (or a generic message on Windows); never NULL.
+ */
+const char* plugin_error(void);
+
+#endif /* PLUGIN_H */
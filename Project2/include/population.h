@@ -1,6 +1,7 @@
 #ifndef POPULATION_H
 #define POPULATION_H
 
+#include "rng.h"
 #include "problem.h"
 
 /**
@@ -16,12 +17,15 @@
  * @brief Population of candidate solutions.
  *
  * The population is stored as an n-by-m matrix in row-major order,
- * where each row represents one solution vector.
+ * where each row represents one solution vector. Depending on the
+ * storage type exactly one of data and data_f32 is allocated.
  */
 typedef struct {
     int n;        /**< Number of individuals (experiments) */
     int m;        /**< Dimension of each individual */
-    double* data; /**< Contiguous array of size n*m (row-major) */
+    StorageType storage; /**< Element type of the matrix */
+    double* data; /**< Contiguous array of size n*m (STORAGE_F64), else NULL */
+    float* data_f32; /**< Contiguous array of size n*m (STORAGE_F32), else NULL */
 } Population;
 
 /**
@@ -44,6 +48,20 @@ typedef struct {
  */
 int population_init(Population* pop, int n, int m);
 
+/**
+ * @brief Initializes a population with the given element type.
+ *
+ * STORAGE_F32 halves the memory of the matrix and the bandwidth
+ * needed to evaluate it; fitness values stay double.
+ *
+ * @param pop Pointer to Population structure.
+ * @param n Number of individuals.
+ * @param m Dimension of each individual.
+ * @param storage Element type of the matrix.
+ * @return 0 on success, non-zero on failure (see population_init()).
+ */
+int population_init_storage(Population* pop, int n, int m, StorageType storage);
+
 /**
  * @brief Frees memory associated with a population.
  *
@@ -75,10 +93,11 @@ void fitness_free(Fitness* fit);
  * Values are generated within the specified lower and upper bounds.
  *
  * @param pop Pointer to Population structure.
+ * @param rng Random stream, or NULL for rng_global().
  * @param lower Lower bound for values.
  * @param upper Upper bound for values.
  */
-void population_randomize(Population* pop, double lower, double upper);
+void population_randomize(Population* pop, Rng* rng, double lower, double upper);
 
 /**
  * @brief Evaluates the fitness of each individual in the population.
@@ -96,8 +115,31 @@ void population_evaluate(const Population* pop, const Problem* prob, Fitness* fi
  *
  * @param pop Pointer to Population structure.
  * @param i Row index.
- * @return Pointer to the requested solution vector.
+ * @return Pointer to the requested solution vector, or NULL for a
+ *         STORAGE_F32 population (see population_row_f32()).
  */
 const double* population_row(const Population* pop, int i);
 
+/**
+ * @brief Returns a pointer to a specific row of a STORAGE_F32 population.
+ *
+ * @param pop Pointer to Population structure.
+ * @param i Row index.
+ * @return Pointer to the requested solution vector, or NULL for a
+ *         STORAGE_F64 population.
+ */
+const float* population_row_f32(const Population* pop, int i);
+
+/**
+ * @brief Copies a row into a double vector.
+ *
+ * Used to promote a candidate (typically a new best) out of a float
+ * population before it is re-evaluated, kept or reported.
+ *
+ * @param pop Pointer to Population structure.
+ * @param i Row index.
+ * @param x_out Output vector (m values).
+ */
+void population_row_copy(const Population* pop, int i, double* x_out);
+
 #endif /* POPULATION_H */
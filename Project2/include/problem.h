@@ -1,6 +1,9 @@
 #ifndef PROBLEM_H
 #define PROBLEM_H
 
+#include <math.h>
+#include "transform.h"
+
 /**
  * @file problem.h
  * @brief Benchmark optimization problem definitions.
@@ -23,24 +26,126 @@ typedef enum {
     PROB_STRETCH_V_SINE_WAVE,   /**< Stretch V Sine Wave function */
     PROB_ACKLEY_ONE,            /**< Ackley function (variant one) */
     PROB_ACKLEY_TWO,            /**< Ackley function (variant two) */
-    PROB_EGG_HOLDER              /**< Egg Holder function */
+    PROB_EGG_HOLDER,             /**< Egg Holder function */
+    PROB_PLUGIN = 100,           /**< Objective loaded from a shared library (see plugin.h) */
+    PROB_EXPR = 101              /**< Objective compiled from objective=<expression> (see expr.h) */
 } ProblemType;
 
+/**
+ * @brief Precision of the evaluation kernels.
+ */
+typedef enum {
+    PRECISION_EXACT = 0, /**< Full-accuracy kernels (a few ULP from libm) */
+    PRECISION_FAST  = 1  /**< Shorter polynomials, ~1e-10 relative error per function */
+} EvalPrecision;
+
+/**
+ * @brief Element type of stored candidate vectors.
+ */
+typedef enum {
+    STORAGE_F64 = 0, /**< double coordinates (default) */
+    STORAGE_F32 = 1  /**< float coordinates, widened to double for evaluation */
+} StorageType;
+
+/**
+ * @brief Scalar evaluation function: fitness of one vector of dimension m.
+ */
+typedef double (*ProblemEvalFn)(const double* x, int m);
+
+/**
+ * @brief Batch evaluation function: fitness of k row-major vectors of dimension m.
+ */
+typedef void (*ProblemBatchFn)(const double* X, int k, int m, double* f_out);
+
+/**
+ * @brief Batch evaluation function for k row-major float vectors of dimension m.
+ */
+typedef void (*ProblemBatchF32Fn)(const float* X, int k, int m, double* f_out);
+
+/**
+ * @brief Delta evaluation function: fitness of x with x[j] replaced by xj,
+ *        given the fitness f_old of x.
+ */
+typedef double (*ProblemDeltaFn)(const double* x, int m, double f_old, int j, double xj);
+
+/**
+ * @brief Bounded evaluation function: fitness of x, or
+ *        PROBLEM_EVAL_ABANDONED once it is certain to be >= cutoff.
+ */
+typedef double (*ProblemBoundedFn)(const double* x, int m, double cutoff);
+
+/**
+ * @brief Fused evaluation function: fitness of k row-major vectors for
+ *        every problem selected in mask, f_out indexed by ProblemType.
+ */
+typedef void (*ProblemMultiFn)(const double* X, int k, int m, unsigned mask, double* const* f_out);
+
+/**
+ * @brief Gradient function: fitness of x, with its gradient written to g.
+ */
+typedef double (*ProblemGradFn)(const double* x, int m, double* g);
+
+/** Mask bit selecting problem type t in problem_eval_multi(). */
+#define PROBLEM_MASK(t) (1u << (t))
+
+/** Mask selecting all ten problems. */
+#define PROBLEM_MASK_ALL (((1u << (PROB_EGG_HOLDER + 1)) - 1u) & ~1u)
+
+/** Returned by problem_eval_bounded() for a vector that cannot beat the cutoff. */
+#define PROBLEM_EVAL_ABANDONED INFINITY
+
 /**
  * @brief Problem descriptor.
+ *
+ * Everything that depends on the problem type is resolved once by
+ * problem_create(), so evaluation is a single indirect call.
  */
 typedef struct {
-    ProblemType type; /**< Problem type identifier */
+    ProblemType type;          /**< Problem type identifier */
+    const char* name;          /**< Human-readable name */
+    const char* short_name;    /**< Compact name used in CSV output */
+    double lower;              /**< Default lower bound of the search domain */
+    double upper;              /**< Default upper bound of the search domain */
+    int separable;             /**< Non-zero if f is a sum of per-coordinate terms */
+    double optimum;            /**< Known global minimum value, or NAN if unknown */
+    double optimum_tol;        /**< Fitness within this of optimum counts as optimal, or NAN */
+    double fast_err;           /**< Max |f_fast - f_libm| / max(|f_libm|, 1) of precision=fast */
+    ProblemEvalFn eval;        /**< Scalar evaluation function */
+    ProblemBatchFn eval_batch; /**< Batch evaluation function */
+    ProblemDeltaFn eval_delta; /**< Single-coordinate delta function, or NULL */
+    ProblemBoundedFn eval_bounded; /**< Early-abandon evaluation, or NULL if terms can go unbounded below */
+    ProblemBatchF32Fn eval_batch_f32; /**< Batch evaluation of float-stored vectors */
+    ProblemGradFn eval_grad;   /**< Value-and-gradient function */
+    Transform* transform;      /**< Shift/rotation applied to every input, or NULL */
 } Problem;
 
 /**
- * @brief Creates a Problem structure.
+ * @brief Creates a Problem descriptor.
+ *
+ * Looks up the problem's metadata and binds the evaluation functions of
+ * the active kernel variant, so kernels_select() should be called first
+ * if a specific variant is wanted. Unknown types yield a descriptor
+ * named "Unknown" whose evaluation functions return NAN.
  *
  * @param t Problem type identifier.
- * @return Initialized Problem structure.
+ * @return Initialized Problem descriptor.
  */
 Problem problem_create(ProblemType t);
 
+/**
+ * @brief Makes a problem evaluate f(R (x - o)) instead of f(x).
+ *
+ * Every problem_eval*() call on @p p transforms its input first (whole
+ * blocks at a time). The delta kernels assume untransformed
+ * coordinates, so they are dropped; problem_eval_delta() falls back to
+ * a full evaluation. The transform is not copied and must outlive
+ * the descriptor's use.
+ *
+ * @param p Problem descriptor to modify.
+ * @param tr Transform built for p's dimension, or NULL to remove it.
+ */
+void problem_set_transform(Problem* p, Transform* tr);
+
 /**
  * @brief Returns a human-readable name for a problem.
  *
@@ -49,6 +154,14 @@ Problem problem_create(ProblemType t);
  */
 const char* problem_name(const Problem* p);
 
+/**
+ * @brief Returns the short name of a problem used in CSV output.
+ *
+ * @param p Pointer to the problem.
+ * @return Short name of the problem.
+ */
+const char* problem_short_name(const Problem* p);
+
 /**
  * @brief Returns the recommended input range for a problem.
  *
@@ -68,4 +181,131 @@ void problem_range(const Problem* p, double* out_min, double* out_max);
  */
 double problem_eval(const Problem* p, const double* x, int m);
 
+/**
+ * @brief Evaluates the objective function with plain libm calls.
+ *
+ * Independent of the kernel variant and precision mode. Used to check
+ * results of the fast kernels; much slower than problem_eval().
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Input solution vector.
+ * @param m Dimension of the solution vector.
+ * @return Fitness value, or NAN if inputs are invalid.
+ */
+double problem_eval_reference(const Problem* p, const double* x, int m);
+
+/**
+ * @brief Evaluates the objective function for a block of solution vectors.
+ *
+ * The block is stored row-major: vector r occupies X[r*m .. r*m+m-1].
+ * Dispatch on the problem type happens once per block, so callers that
+ * evaluate many vectors should prefer this over repeated problem_eval().
+ * A problem with a transform has each group of up to TRANSFORM_BLOCK
+ * rows transformed by one matrix-matrix product before evaluation.
+ *
+ * @param p Pointer to the problem definition.
+ * @param X Block of k solution vectors (k*m values).
+ * @param k Number of vectors in the block.
+ * @param m Dimension of each vector.
+ * @param f_out Output array of length @p k receiving fitness values.
+ */
+void problem_eval_batch(const Problem* p, const double* X, int k, int m, double* f_out);
+
+/**
+ * @brief Evaluates a block of solution vectors stored as float.
+ *
+ * Each coordinate is widened to double as it is read and the fitness
+ * is computed in double, so f_out[r] equals problem_eval() of row r
+ * converted to double. Compared with problem_eval_batch() on a double
+ * block, only the memory traffic for X is halved.
+ *
+ * @param p Pointer to the problem definition.
+ * @param X Block of k solution vectors (row-major, k*m floats).
+ * @param k Number of vectors in the block.
+ * @param m Dimension of each vector.
+ * @param f_out Output array of length @p k receiving fitness values.
+ */
+void problem_eval_batch_f32(const Problem* p, const float* X, int k, int m, double* f_out);
+
+/**
+ * @brief Evaluates the fitness after changing a single coordinate.
+ *
+ * Given x and its fitness f_old, returns the fitness of x with x[j]
+ * replaced by new_xj, without modifying x. Every built-in problem does
+ * this in O(1) (Griewangk: O(m) multiply-adds, O(1) transcendentals).
+ * The result is not bit-identical to a fresh problem_eval(): it is
+ * obtained from f_old by cancellation, so its error is a few ulps of the
+ * sums inside f (e.g. 1 + sum(x^2)/4000 for Griewangk) rather than of f
+ * itself. Callers that chain many deltas should re-evaluate accepted
+ * moves.
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Current solution vector.
+ * @param m Dimension of the solution vector.
+ * @param f_old Fitness of x.
+ * @param j Index of the coordinate to change.
+ * @param new_xj New value of coordinate j.
+ * @param scratch m doubles for the full-evaluation fallback (problems
+ *                without a delta kernel), or NULL to allocate them per call.
+ * @return Fitness of the modified vector, or NAN if inputs are invalid.
+ */
+double problem_eval_delta(const Problem* p, const double* x, int m,
+                          double f_old, int j, double new_xj, double* scratch);
+
+/**
+ * @brief Evaluates a vector only as far as needed to compare it with a cutoff.
+ *
+ * Problems whose terms are bounded below (De Jong 1, Rosenbrock,
+ * Rastrigin, Stretch V Sine Wave, Ackley One) stop summing as soon as
+ * the remaining terms cannot bring f below the cutoff. If f < cutoff
+ * the exact fitness is returned, identical to problem_eval(); otherwise
+ * the result is either f or PROBLEM_EVAL_ABANDONED. Other problems are
+ * evaluated in full.
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Input solution vector.
+ * @param m Dimension of the solution vector.
+ * @param cutoff Fitness the vector has to beat.
+ * @return Fitness value, PROBLEM_EVAL_ABANDONED, or NAN if inputs are invalid.
+ */
+double problem_eval_bounded(const Problem* p, const double* x, int m, double cutoff);
+
+/**
+ * @brief Evaluates a vector and its analytic gradient.
+ *
+ * The value is computed with the same term expressions, in the same
+ * order, as problem_eval(), so the two agree exactly for m below
+ * LARGE_DIM_MIN (16384) and up to rounding above. Each transcendental
+ * is computed once and shared between the value and the derivative,
+ * so the gradient costs roughly one extra evaluation rather than the
+ * 2m of central differences. With a transform the gradient is taken
+ * with respect to x: g = R^T grad f(z). Where a term is not
+ * differentiable (|x| at 0, sqrt at 0) that part of the derivative is 0.
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Input solution vector.
+ * @param m Dimension of the solution vector.
+ * @param g Output gradient (m values).
+ * @return Fitness value, or NAN if inputs are invalid.
+ */
+double problem_eval_grad(const Problem* p, const double* x, int m, double* g);
+
+/**
+ * @brief Evaluates several problems on the same block of vectors.
+ *
+ * One pass over the block computes the values shared between problems
+ * (x_i^2, x_i^2 + x_{i+1}^2, cos(2 pi x_i), ...) once, then forms
+ * every selected problem's fitness from them. Each result is identical
+ * to problem_eval_batch() for that problem. Problems are always
+ * untransformed here.
+ *
+ * @param X Block of k solution vectors (row-major, k*m values).
+ * @param k Number of vectors in the block.
+ * @param m Dimension of each vector.
+ * @param mask Problems to evaluate (PROBLEM_MASK(t) bits, or PROBLEM_MASK_ALL).
+ * @param f_out Indexed by ProblemType; f_out[t] receives k values for
+ *              every selected t (entries of unselected problems are unused).
+ */
+void problem_eval_multi(const double* X, int k, int m, unsigned mask, double* const* f_out);
+
 #endif /* PROBLEM_H */
@@ -0,0 +1,126 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dsfmt.h"
+#include "mt19937ar.h"
+#include "philox.h"
+
+/**
+ * @file rng.h
+ * @brief Random number generator selected at run time (rng= in the config).
+ *
+ * An Rng holds the state of one of the engines and forwards to it. The
+ * searches draw everything through an Rng, so the engine is a config
+ * choice. Fill calls dispatch once per call; single draws once per
+ * value.
+ *
+ * The counter-based engine (Philox) also has substreams: the searches
+ * switch to substream t before drawing sample or restart t, so what
+ * that sample or restart sees does not depend on the ones before it.
+ * The sequential engines ignore the switch and keep one stream.
+ */
+
+/**
+ * @brief Random number engines.
+ */
+typedef enum {
+    RNG_MT19937 = 0, /**< Mersenne Twister MT19937, 32 bits per value (default) */
+    RNG_DSFMT   = 1, /**< dSFMT-19937, 52-bit doubles straight from the state */
+    RNG_PHILOX  = 2  /**< Philox4x32-10, counter-based with substreams */
+} RngType;
+
+/**
+ * @brief One random stream of any engine.
+ */
+typedef struct {
+    RngType type; /**< Engine */
+    union {
+        MTState mt;       /**< RNG_MT19937 state */
+        DSFMTState dsfmt; /**< RNG_DSFMT state */
+        PhiloxState philox; /**< RNG_PHILOX state */
+    } state;              /**< State of the engine in use */
+} Rng;
+
+/**
+ * @brief Seeds a stream of the given engine.
+ *
+ * @param rng Stream to initialize.
+ * @param type Engine.
+ * @param seed Seed value.
+ * @param stream Independent stream under the same seed: the second
+ *               Philox key word, or @p stream jumps of 2^128 draws for
+ *               MT19937 (see mt_jump(), a few ms per set bit). dSFMT ignores it.
+ * @return 0 on success, 1 on invalid arguments.
+ */
+int rng_init(Rng* rng, RngType type, uint32_t seed, uint32_t stream);
+
+/**
+ * @brief Tells whether the engine has substreams (see rng_substream()).
+ *
+ * @param rng Stream.
+ * @return 1 for a counter-based engine, 0 otherwise.
+ */
+int rng_counter_based(const Rng* rng);
+
+/**
+ * @brief Moves to the start of substream @p t.
+ *
+ * With a counter-based engine the next draws are those of substream t,
+ * whatever was drawn before; other engines are left as they are.
+ *
+ * @param rng Stream.
+ * @param t Substream (a sample or restart number).
+ */
+void rng_substream(Rng* rng, uint64_t t);
+
+/**
+ * @brief Draws a 32-bit unsigned random integer.
+ *
+ * @param rng Stream.
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t rng_next(Rng* rng);
+
+/**
+ * @brief Draws a double in [0, 1).
+ *
+ * @param rng Stream.
+ * @return Random double in the range [0,1).
+ */
+double rng_real(Rng* rng);
+
+/**
+ * @brief Fills an array with uniform random values in [lo, hi).
+ *
+ * out[i] is exactly lo + (hi - lo) * rng_real(rng) for n successive
+ * draws.
+ *
+ * @param rng Stream.
+ * @param out Output array (n values).
+ * @param n Number of values.
+ * @param lo Lower bound.
+ * @param hi Upper bound.
+ */
+void rng_fill_real(Rng* rng, double* out, size_t n, double lo, double hi);
+
+/**
+ * @brief Returns the process-wide stream used where an Rng is optional.
+ *
+ * An MT19937 stream with the reference default seed, separate from
+ * the state behind genrand_*().
+ *
+ * @return Global stream.
+ */
+Rng* rng_global(void);
+
+/**
+ * @brief Returns the config name of an engine.
+ *
+ * @param type Engine.
+ * @return "mt19937", "dsfmt", "philox" or "unknown".
+ */
+const char* rng_name(RngType type);
+
+#endif /* RNG_H */
@@ -0,0 +1,125 @@
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file transform.h
+ * @brief Shifted and rotated problem variants.
+ *
+ * A transformed problem evaluates f(z) with z = R (x - o), as in the
+ * CEC benchmark suites: the shift o moves the optimum away from its
+ * textbook location and the orthogonal rotation R couples all
+ * coordinates, so separable problems stop being separable. Blocks of
+ * candidates are transformed together as one cache-blocked
+ * matrix-matrix product (see the transform kernel in kernels.c).
+ */
+
+/**
+ * @brief Transformation applied to a problem's input.
+ */
+typedef enum {
+    TRANSFORM_NONE         = 0, /**< f(x) */
+    TRANSFORM_SHIFT        = 1, /**< f(x - o) */
+    TRANSFORM_ROTATE       = 2, /**< f(R x) */
+    TRANSFORM_SHIFT_ROTATE = 3  /**< f(R (x - o)) */
+} TransformKind;
+
+/**
+ * @brief Shift vector, rotation and workspace of one transformed problem.
+ */
+typedef struct Transform {
+    int m;              /**< Dimension */
+    TransformKind kind; /**< Which parts are active */
+    double* shift;      /**< o (m values), or NULL */
+    double* rot_t;      /**< R^T (m*m, row-major), or NULL */
+    double* work;       /**< Transformed rows (and widened float rows) */
+    size_t work_rows;   /**< Rows that fit in work */
+} Transform;
+
+/**
+ * @brief Builds the shift and rotation for one problem.
+ *
+ * The shift is drawn uniformly from the middle 80% of [lower, upper];
+ * the rotation is a random orthogonal matrix (Gram-Schmidt on a
+ * Gaussian matrix, O(m^3) once). Both come from the MT19937 generator
+ * seeded with @p seed, so the global generator must be re-seeded
+ * afterwards.
+ *
+ * @param tr Transform to initialize.
+ * @param m Dimension.
+ * @param kind Transformation to build.
+ * @param lower Lower bound of the search range.
+ * @param upper Upper bound of the search range.
+ * @param seed Seed for the shift and rotation.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure.
+ */
+int transform_init(Transform* tr, int m, TransformKind kind,
+                   double lower, double upper, uint32_t seed);
+
+/**
+ * @brief Frees a transform.
+ *
+ * @param tr Transform to free.
+ */
+void transform_free(Transform* tr);
+
+/**
+ * @brief Transforms k row-major vectors.
+ *
+ * @param tr Transform.
+ * @param X Block of k vectors (k*m values).
+ * @param k Number of vectors (at most TRANSFORM_BLOCK).
+ * @return Pointer to the k transformed vectors (valid until the next
+ *         call on this transform), or NULL on allocation failure.
+ */
+const double* transform_rows(Transform* tr, const double* X, int k);
+
+/**
+ * @brief transform_rows() for vectors stored as float.
+ *
+ * @param tr Transform.
+ * @param X Block of k vectors (k*m floats).
+ * @param k Number of vectors (at most TRANSFORM_BLOCK).
+ * @return Pointer to the k transformed vectors, or NULL on allocation failure.
+ */
+const double* transform_rows_f32(Transform* tr, const float* X, int k);
+
+/**
+ * @brief Returns m doubles of scratch that do not overlap transform_rows() output.
+ *
+ * Used by problem_eval_grad() to hold the gradient with respect to z
+ * while the transformed row is still live.
+ *
+ * @param tr Transform (transform_rows() must have run on it at least once).
+ * @return Pointer to the scratch, or NULL if there is no workspace yet.
+ */
+double* transform_grad_scratch(Transform* tr);
+
+/**
+ * @brief Maps a gradient with respect to z back to one with respect to x.
+ *
+ * With z = R (x - o), grad_x f = R^T grad_z f; the shift does not
+ * change the gradient.
+ *
+ * @param tr Transform.
+ * @param g_z Gradient with respect to z (m values).
+ * @param g_x Output gradient with respect to x (m values, not aliasing g_z).
+ */
+void transform_pullback(const Transform* tr, const double* g_z, double* g_x);
+
+/** Largest block transform_rows() accepts; callers split larger ones. */
+#define TRANSFORM_BLOCK 64
+
+/**
+ * @brief Returns the config/summary name of a transformation.
+ *
+ * @param kind Transformation.
+ * @return "none", "shift", "rotate" or "shift_rotate".
+ */
+const char* transform_name(TransformKind kind);
+
+#endif /* TRANSFORM_H */
@@ -0,0 +1,310 @@
+#ifndef VECMATH_H
+#define VECMATH_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @file vecmath.h
+ * @brief Array-oriented elementary functions for the problem kernels.
+ *
+ * Each function maps an input array onto an output array. The work is
+ * split into two loops: a branch-free main loop built only from
+ * multiply/add, compares and integer bit operations, which the compiler
+ * vectorizes onto SSE2, AVX2 or AVX-512 lanes depending on the target
+ * flags of the including translation unit, and a scalar fix-up loop
+ * that hands the rare lanes outside the supported range back to libm.
+ * The functions are defined in this header so that every translation
+ * unit (and every ISA build of it) gets its own inlined copy.
+ *
+ * Accuracy, measured against libm on 4*10^6 random arguments per range:
+ * - vm_sqrt: correctly rounded (hardware square root), 0 ULP.
+ * - vm_sin, vm_cos: max 2 ULP for |x| <= VM_TRIG_MAX away from the zeros
+ *   of the function; near a zero the error is bounded in absolute terms
+ *   by about 2^-53 * |x| instead. Larger |x| falls back to libm.
+ * - vm_exp: max 1 ULP for VM_EXP_MIN <= x <= VM_EXP_MAX, libm outside.
+ * - vm_log: max 2 ULP for normal positive x, libm otherwise.
+ * - vm_pow: exp(e * log(x)); max 2 ULP while |e * ln x| <= 1 and grows
+ *   by about |e * ln x| ULP beyond that (128 ULP at e = 0.25, x = 1e300).
+ *   Non-positive, subnormal or non-finite x and results outside the
+ *   normal exp range fall back to libm.
+ *
+ * Defining VM_FAST before including this header (the "fast" kernel
+ * builds do) swaps the sin/cos, exp and log polynomials for shorter
+ * ones interpolated at Chebyshev nodes (near-minimax). Range reduction,
+ * special cases and the libm fall-back are unchanged; sqrt stays the
+ * hardware instruction. Measured max relative error in that mode:
+ * - vm_sin, vm_cos: 1.1e-10 (absolute near the zeros of the function).
+ * - vm_exp: 2.2e-10.
+ * - vm_log: 1.1e-13.
+ * - vm_pow: 2.2e-10 (dominated by the exp step).
+ *
+ * Input and output arrays must not overlap. The main loops only
+ * vectorize when the including file is compiled with -fno-math-errno
+ * and -fno-trapping-math (see KERNEL_CFLAGS in the Makefile); neither
+ * flag changes the computed values.
+ */
+
+/** Largest |x| handled by the vm_sin/vm_cos main loop. */
+#define VM_TRIG_MAX 4.0e6
+
+/** Round-to-integer shifter: adding it leaves the integer in the low mantissa bits. */
+#define VM_SHIFTER 0x1.8p52
+
+/* pi split into two 30-bit parts and a remainder (Cody-Waite reduction) */
+#define VM_PI_A     0x1.921fb54p+1
+#define VM_PI_B     0x1.10b46118p-29
+#define VM_PI_C     0x1.313198a2e037p-60
+#define VM_INV_PI   0x1.45f306dc9c883p-2
+
+/* ln 2 split into a 32-bit head and a tail */
+#define VM_LN2_HI   0x1.62e42feep-1
+#define VM_LN2_LO   0x1.a39ef35793c76p-33
+#define VM_LOG2E    0x1.71547652b82fep+0
+
+#define VM_EXP_MIN  (-708.0)
+#define VM_EXP_MAX  709.0
+
+static inline uint64_t vm_as_u64(double d)
+{
+    uint64_t u;
+    memcpy(&u, &d, sizeof(u));
+    return u;
+}
+
+static inline double vm_as_f64(uint64_t u)
+{
+    double d;
+    memcpy(&d, &u, sizeof(d));
+    return d;
+}
+
+#if defined(VM_FAST)
+
+/**
+ * @brief Odd polynomial for sin(r), |r| <= pi/2 (terms up to r^11, fast mode).
+ */
+static inline double vm_sin_poly(double r)
+{
+    double r2 = r * r;
+    double p = -0x1.9db1cc2e4fdd5p-26;
+    p = p * r2 + 0x1.719691800d4d9p-19;
+    p = p * r2 - 0x1.a01905ba41bf5p-13;
+    p = p * r2 + 0x1.11110fdaaf843p-7;
+    p = p * r2 - 0x1.555555546052fp-3;
+    return r + r * r2 * p;
+}
+
+#else
+
+/**
+ * @brief Odd Taylor polynomial for sin(r), |r| <= pi/2 (terms up to r^21).
+ */
+static inline double vm_sin_poly(double r)
+{
+    double r2 = r * r;
+    double p = 0x1.71b8ef6dcf572p-66;
+    p = p * r2 - 0x1.2f49b46814157p-57;
+    p = p * r2 + 0x1.952c77030ad4ap-49;
+    p = p * r2 - 0x1.ae7f3e733b81fp-41;
+    p = p * r2 + 0x1.6124613a86d09p-33;
+    p = p * r2 - 0x1.ae64567f544e4p-26;
+    p = p * r2 + 0x1.71de3a556c734p-19;
+    p = p * r2 - 0x1.a01a01a01a01ap-13;
+    p = p * r2 + 0x1.1111111111111p-7;
+    p = p * r2 - 0x1.5555555555555p-3;
+    return r + r * r2 * p;
+}
+
+#endif /* VM_FAST */
+
+/**
+ * @brief Branch-free sin(x) for |x| <= VM_TRIG_MAX.
+ *
+ * x = q*pi + r with q = round(x/pi); sin(x) = (-1)^q * sin(r).
+ */
+static inline double vm_sin_lane(double x)
+{
+    double t = x * VM_INV_PI + VM_SHIFTER;
+    double q = t - VM_SHIFTER;
+    double r = x - q * VM_PI_A;
+    r = r - q * VM_PI_B;
+    r = r - q * VM_PI_C;
+    uint64_t sign = vm_as_u64(t) << 63;
+    return vm_as_f64(vm_as_u64(vm_sin_poly(r)) ^ sign);
+}
+
+/**
+ * @brief Branch-free cos(x) for |x| <= VM_TRIG_MAX.
+ *
+ * x = (q + 1/2)*pi + r with q = round(x/pi - 1/2);
+ * cos(x) = -(-1)^q * sin(r).
+ */
+static inline double vm_cos_lane(double x)
+{
+    double t = (x * VM_INV_PI - 0.5) + VM_SHIFTER;
+    double h = (t - VM_SHIFTER) + 0.5;
+    double r = x - h * VM_PI_A;
+    r = r - h * VM_PI_B;
+    r = r - h * VM_PI_C;
+    uint64_t sign = (~vm_as_u64(t)) << 63;
+    return vm_as_f64(vm_as_u64(vm_sin_poly(r)) ^ sign);
+}
+
+/**
+ * @brief Branch-free exp(x) for VM_EXP_MIN <= x <= VM_EXP_MAX.
+ *
+ * x = q*ln2 + r with |r| <= ln2/2; exp(x) = 2^q * exp(r), where exp(r)
+ * is a degree-13 Taylor polynomial (degree 7 with VM_FAST) and 2^q is
+ * assembled in the exponent field directly.
+ */
+static inline double vm_exp_lane(double x)
+{
+    x = x < VM_EXP_MIN ? VM_EXP_MIN : x;
+    x = x > VM_EXP_MAX ? VM_EXP_MAX : x;
+
+    double t = x * VM_LOG2E + VM_SHIFTER;
+    double q = t - VM_SHIFTER;
+    double r = x - q * VM_LN2_HI;
+    r = r - q * VM_LN2_LO;
+
+#if defined(VM_FAST)
+    double p = 0x1.a124e3ee80b6dp-13;
+    p = p * r + 0x1.6d431504dcc2ap-10;
+    p = p * r + 0x1.1110e0f72865cp-7;
+    p = p * r + 0x1.5554e9114ebbep-5;
+    p = p * r + 0x1.5555555a7821dp-3;
+    p = p * r + 0x1.0000000b8f62bp-1;
+#else
+    double p = 0x1.6124613a86d09p-33;
+    p = p * r + 0x1.1eed8eff8d898p-29;
+    p = p * r + 0x1.ae64567f544e4p-26;
+    p = p * r + 0x1.27e4fb7789f5cp-22;
+    p = p * r + 0x1.71de3a556c734p-19;
+    p = p * r + 0x1.a01a01a01a01ap-16;
+    p = p * r + 0x1.a01a01a01a01ap-13;
+    p = p * r + 0x1.6c16c16c16c17p-10;
+    p = p * r + 0x1.1111111111111p-7;
+    p = p * r + 0x1.5555555555555p-5;
+    p = p * r + 0x1.5555555555555p-3;
+    p = p * r + 0.5;
+#endif
+    p = 1.0 + r + r * r * p;
+
+    uint64_t qi = vm_as_u64(t) - vm_as_u64(VM_SHIFTER);
+    double scale = vm_as_f64((qi + 1023u) << 52);
+    return p * scale;
+}
+
+/**
+ * @brief Branch-free natural logarithm for normal positive x.
+ *
+ * x = 2^e * f with f in [sqrt(1/2), sqrt(2)); ln f = 2*atanh(s) with
+ * s = (f-1)/(f+1), evaluated as an odd series up to s^21 (s^11 with
+ * VM_FAST).
+ */
+static inline double vm_log_lane(double x)
+{
+    uint64_t bits = vm_as_u64(x);
+    uint64_t efield = (bits >> 52) & 0x7ffu;
+    double f = vm_as_f64((bits & 0x000fffffffffffffu) | 0x3ff0000000000000u);
+    double e = (vm_as_f64(efield | 0x4330000000000000u) - 0x1p52) - 1023.0;
+
+    int big = f > 0x1.6a09e667f3bcdp+0;
+    f = f * (big ? 0.5 : 1.0);
+    e = e + (big ? 1.0 : 0.0);
+
+    double s = (f - 1.0) / (f + 1.0);
+    double s2 = s * s;
+#if defined(VM_FAST)
+    double p = 0x1.8c8c11535e4f6p-4;
+    p = p * s2 + 0x1.c67ada09e6eefp-4;
+    p = p * s2 + 0x1.249323e4c4381p-3;
+    p = p * s2 + 0x1.999998cafc0c6p-3;
+    p = p * s2 + 0x1.5555555564e96p-2;
+#else
+    double p = 0x1.8618618618618p-5;
+    p = p * s2 + 0x1.af286bca1af28p-5;
+    p = p * s2 + 0x1.e1e1e1e1e1e1ep-5;
+    p = p * s2 + 0x1.1111111111111p-4;
+    p = p * s2 + 0x1.3b13b13b13b14p-4;
+    p = p * s2 + 0x1.745d1745d1746p-4;
+    p = p * s2 + 0x1.c71c71c71c71cp-4;
+    p = p * s2 + 0x1.2492492492492p-3;
+    p = p * s2 + 0x1.999999999999ap-3;
+    p = p * s2 + 0x1.5555555555555p-2;
+#endif
+    double lf = 2.0 * s + 2.0 * s * s2 * p;
+
+    return e * VM_LN2_HI + (lf + e * VM_LN2_LO);
+}
+
+/**
+ * @brief y[i] = sqrt(x[i]).
+ */
+static inline void vm_sqrt(const double* restrict x, double* restrict y, int n)
+{
+    for (int i = 0; i < n; i++) y[i] = sqrt(x[i]);
+}
+
+/**
+ * @brief y[i] = sin(x[i]).
+ */
+static inline void vm_sin(const double* restrict x, double* restrict y, int n)
+{
+    for (int i = 0; i < n; i++) y[i] = vm_sin_lane(x[i]);
+    for (int i = 0; i < n; i++) {
+        if (!(fabs(x[i]) <= VM_TRIG_MAX)) y[i] = sin(x[i]);
+    }
+}
+
+/**
+ * @brief y[i] = cos(x[i]).
+ */
+static inline void vm_cos(const double* restrict x, double* restrict y, int n)
+{
+    for (int i = 0; i < n; i++) y[i] = vm_cos_lane(x[i]);
+    for (int i = 0; i < n; i++) {
+        if (!(fabs(x[i]) <= VM_TRIG_MAX)) y[i] = cos(x[i]);
+    }
+}
+
+/**
+ * @brief y[i] = exp(x[i]).
+ */
+static inline void vm_exp(const double* restrict x, double* restrict y, int n)
+{
+    for (int i = 0; i < n; i++) y[i] = vm_exp_lane(x[i]);
+    for (int i = 0; i < n; i++) {
+        if (!(x[i] >= VM_EXP_MIN && x[i] <= VM_EXP_MAX)) y[i] = exp(x[i]);
+    }
+}
+
+/**
+ * @brief y[i] = log(x[i]).
+ */
+static inline void vm_log(const double* restrict x, double* restrict y, int n)
+{
+    for (int i = 0; i < n; i++) y[i] = vm_log_lane(x[i]);
+    for (int i = 0; i < n; i++) {
+        if (!(x[i] >= 0x1p-1022 && x[i] <= 0x1.fffffffffffffp+1023)) y[i] = log(x[i]);
+    }
+}
+
+/**
+ * @brief y[i] = pow(x[i], e) for a common exponent e.
+ */
+static inline void vm_pow(const double* restrict x, double e, double* restrict y, int n)
+{
+    for (int i = 0; i < n; i++) y[i] = vm_exp_lane(e * vm_log_lane(x[i]));
+    for (int i = 0; i < n; i++) {
+        /* the second test catches lanes where y*ln(x) left the exp range */
+        if (!(x[i] >= 0x1p-1022 && x[i] <= 0x1.fffffffffffffp+1023) ||
+            !(y[i] > 0x1p-1021 && y[i] < 0x1p+1020)) {
+            y[i] = pow(x[i], e);
+        }
+    }
+}
+
+#endif /* VECMATH_H */
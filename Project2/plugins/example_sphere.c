@@ -0,0 +1,111 @@
+/**
+ * @file example_sphere.c
+ * @brief Example objective plugin: a shifted sphere.
+ *
+ * f(x) = sum_j (x_j - 1)^2 on [-5.12, 5.12]^m, minimum 0 at x = 1.
+ * Build with `make plugins` and run with
+ * @code
+ * problem=plugin:build/libexample_sphere.so
+ * @endcode
+ */
+
+#include "objective_plugin.h"
+#include <stddef.h>
+
+/** Center of the sphere. */
+#define SPHERE_CENTER 1.0
+
+/**
+ * @brief Fitness of one vector.
+ *
+ * @param x Input vector.
+ * @param m Dimension.
+ * @return Fitness value.
+ */
+static double sphere_eval(const double* x, int m)
+{
+    double s = 0.0;
+    for (int j = 0; j < m; j++) {
+        double d = x[j] - SPHERE_CENTER;
+        s += d * d;
+    }
+    return s;
+}
+
+/**
+ * @brief Fitness of k row-major vectors.
+ *
+ * @param X Block of k vectors.
+ * @param k Number of vectors.
+ * @param m Dimension.
+ * @param f_out Output fitness values (k values).
+ */
+static void sphere_eval_batch(const double* X, int k, int m, double* f_out)
+{
+    for (int i = 0; i < k; i++) {
+        f_out[i] = sphere_eval(X + (size_t)i * (size_t)m, m);
+    }
+}
+
+/**
+ * @brief Fitness after replacing x[j] with xj.
+ *
+ * @param x Input vector.
+ * @param m Dimension.
+ * @param f_old Fitness of x.
+ * @param j Changed coordinate.
+ * @param xj New value of x[j].
+ * @return Fitness of the changed vector.
+ */
+static double sphere_eval_delta(const double* x, int m, double f_old, int j, double xj)
+{
+    (void)m;
+    double a = x[j] - SPHERE_CENTER;
+    double b = xj - SPHERE_CENTER;
+    return f_old - a * a + b * b;
+}
+
+/**
+ * @brief Fitness and gradient of one vector.
+ *
+ * @param x Input vector.
+ * @param m Dimension.
+ * @param g Output gradient (m values).
+ * @return Fitness value.
+ */
+static double sphere_eval_grad(const double* x, int m, double* g)
+{
+    double s = 0.0;
+    for (int j = 0; j < m; j++) {
+        double d = x[j] - SPHERE_CENTER;
+        s += d * d;
+        g[j] = 2.0 * d;
+    }
+    return s;
+}
+
+/** Function table handed to the host. */
+static const ObjectivePlugin sphere_plugin = {
+    OBJECTIVE_PLUGIN_ABI,
+    (uint32_t)sizeof(ObjectivePlugin),
+    "Shifted Sphere (plugin)",
+    "ShiftedSphere",
+    -5.12,
+    5.12,
+    0.0,
+    1e-8,
+    sphere_eval,
+    sphere_eval_batch,
+    sphere_eval_delta,
+    sphere_eval_grad
+};
+
+/**
+ * @brief Plugin entry point.
+ *
+ * @return Pointer to the plugin's function table.
+ */
+OBJECTIVE_PLUGIN_EXPORT const ObjectivePlugin* objective_plugin(void)
+{
+    return &sphere_plugin;
+}
@@ -0,0 +1,146 @@
+"""
+@file mt_jump.py
+@brief Generates MT19937 jump polynomial tables (src/mt_jump_table.c).
+
+A jump of J steps of MT19937 is the polynomial p(x) = x^(J-1) mod phi(x),
+where phi is the characteristic polynomial of the generator (degree
+19937). mt_jump_poly() evaluates p at the state transition (Horner's
+rule) after one plain step, which gives the state J steps ahead.
+
+phi is recovered with Berlekamp-Massey from the top bits of the
+generator's output. Table k is the jump of 2^(log2 + k) steps, printed
+as C with coefficient j in bit j % 32 of word j / 32:
+
+    python3 scripts/mt_jump.py > src/mt_jump_table.c
+    python3 scripts/mt_jump.py --log2 10 --count 1 --name mt_jump_2e10 > verify/mt_jump_2e10.c
+"""
+
+import argparse
+
+N = 624
+M = 397
+MATRIX_A = 0x9908B0DF
+UPPER_MASK = 0x80000000
+LOWER_MASK = 0x7FFFFFFF
+
+
+def mt_words(seed, count):
+    """
+    @brief Generates untempered MT19937 state words x_0, x_1, ...
+
+    @param seed Seed (as for mt_init()).
+    @param count Number of words.
+    @return List of words; the first N are the seeded state.
+    """
+    x = [seed & 0xFFFFFFFF]
+    for i in range(1, N):
+        x.append((1812433253 * (x[-1] ^ (x[-1] >> 30)) + i) & 0xFFFFFFFF)
+    while len(x) < count:
+        q = len(x) - N
+        y = (x[q] & UPPER_MASK) | (x[q + 1] & LOWER_MASK)
+        x.append(x[q + M] ^ (y >> 1) ^ (MATRIX_A if y & 1 else 0))
+    return x
+
+
+def berlekamp_massey(bits):
+    """
+    @brief Finds the shortest linear recurrence of a bit sequence.
+
+    @param bits Sequence of 0/1 values.
+    @return (C, L): connection polynomial as an int (bit i = c_i) and its degree.
+    """
+    c, b, length, shift = 1, 1, 0, 1
+    window = 0
+    for n, s in enumerate(bits):
+        window = (window << 1) | s
+        if bin(c & window).count("1") & 1:
+            t = c
+            c ^= b << shift
+            if 2 * length <= n:
+                length = n + 1 - length
+                b = t
+                shift = 1
+                continue
+        shift += 1
+    return c, length
+
+
+def poly_mod(a, phi, deg):
+    """
+    @brief Reduces a GF(2) polynomial modulo phi.
+
+    @param a Polynomial (bit i = coefficient of x^i).
+    @param phi Modulus.
+    @param deg Degree of phi.
+    @return a mod phi.
+    """
+    while a.bit_length() > deg:
+        a ^= phi << (a.bit_length() - 1 - deg)
+    return a
+
+
+def poly_mulmod(a, b, phi, deg):
+    """
+    @brief Multiplies two GF(2) polynomials modulo phi.
+
+    @return a * b mod phi.
+    """
+    r = 0
+    while b:
+        low = b & -b
+        r ^= a << (low.bit_length() - 1)
+        b ^= low
+    return poly_mod(r, phi, deg)
+
+
+def main():
+    """
+    @brief Prints the jump tables for 2^log2, 2^(log2 + 1), ... steps.
+    """
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--log2", type=int, default=128, help="first table jumps 2^log2 steps")
+    ap.add_argument("--count", type=int, default=32, help="number of tables")
+    ap.add_argument("--name", default="mt_jump_table", help="C array name")
+    args = ap.parse_args()
+
+    bits = [w >> 31 for w in mt_words(5489, 2 * 19937 + 64)]
+    conn, deg = berlekamp_massey(bits)
+    if deg != 19937:
+        raise RuntimeError(f"unexpected recurrence degree {deg}")
+
+    # characteristic polynomial: x^L + c_1 x^(L-1) + ... + c_L
+    phi = int(format(conn, f"0{deg + 1}b")[::-1], 2)
+
+    x_inv = (phi ^ 1) >> 1  # phi(0) = 1, so x * ((phi - 1) / x) = 1
+
+    print("/**")
+    print(f" * @file {args.name}.c")
+    if args.count == 1:
+        print(f" * @brief MT19937 jump polynomial for 2^{args.log2} steps.")
+    else:
+        print(f" * @brief MT19937 jump polynomials for 2^{args.log2} .. 2^{args.log2 + args.count - 1} steps.")
+    print(" *")
+    print(f" * Generated by scripts/mt_jump.py --log2 {args.log2} --count {args.count}"
+          f" --name {args.name}; do not edit.")
+    print(" */")
+    print()
+    print('#include "mt19937ar.h"')
+    print()
+    print(f"const uint32_t {args.name}[{args.count}][MT_N] = {{")
+    r = 2  # x^(2^e), e = 0
+    for e in range(args.log2 + args.count):
+        if e > 0:
+            r = poly_mod(int("0".join(bin(r)[2:]), 2), phi, deg)  # squaring spreads the bits
+        if e < args.log2:
+            continue
+        p = poly_mulmod(r, x_inv, phi, deg)
+        words = [(p >> (32 * i)) & 0xFFFFFFFF for i in range(N)]
+        print(f"    {{ /* 2^{e} */")
+        for i in range(0, N, 8):
+            print("        " + ", ".join(f"0x{w:08x}u" for w in words[i:i + 8]) + ",")
+        print("    },")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
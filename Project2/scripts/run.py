@@ -22,9 +22,10 @@ Python Script Responsibilities:
 
 import argparse
 import csv
+import hashlib
+import os
 import subprocess
 import tempfile
-import time
 from pathlib import Path
 from statistics import mean, stdev, median
 
@@ -73,6 +74,42 @@ def set_cfg_value(lines, key, value):
     return out
 
 
+def get_cfg_value(lines, key, default=None):
+    """
+    @brief Reads the value of a key from configuration file lines.
+
+    @param lines List of configuration file lines.
+    @param key Configuration key to look up.
+    @param default Value returned if the key is not set.
+    @return The (last) value of the key, or default.
+    """
+    key = key.lower()
+    value = default
+
+    for line in lines:
+        if "=" in line and not line.strip().startswith("#"):
+            k, v = line.split("=", 1)
+            if k.strip().lower() == key:
+                value = v.split("#", 1)[0].strip()
+
+    return value
+
+
+def run_seed(master, r):
+    """
+    @brief Derives the seed of run r from the master seed.
+
+    Used for engines without seed_stream= support (rng=dsfmt): the runs
+    get distinct, unrelated seeds instead of non-overlapping streams.
+
+    @param master Master seed.
+    @param r Run index.
+    @return Nonzero 32-bit seed (seed=0 means "use the clock").
+    """
+    digest = hashlib.sha256(f"{master}:{r}".encode()).digest()
+    return int.from_bytes(digest[:4], "little") or 1
+
+
 def write_cfg(lines, path):
     """
     @brief Writes configuration lines to a file.
@@ -126,7 +163,8 @@ def main():
     This function:
     - Parses command-line arguments
     - Runs the executable multiple times
-    - Modifies the configuration per run
+    - Modifies the configuration per run (one master seed, seed_stream=run;
+      derived per-run seeds for rng=dsfmt)
     - Aggregates results into a master CSV
     - Computes summary statistics
     """
@@ -135,6 +173,8 @@ def main():
     ap.add_argument("--config", required=True)
     ap.add_argument("--runs", type=int, default=30)
     ap.add_argument("--out", default="data/project2_master.csv")
+    ap.add_argument("--seed", type=int, default=None,
+                    help="master seed in 1..2^32-1 (default: random); run r uses seed_stream=r")
     args = ap.parse_args()
 
     exe = args.exe
@@ -143,6 +183,14 @@ def main():
     master_csv = Path(args.out)
 
     base_lines = read_cfg_lines(base_cfg)
+    # one master seed, split into non-overlapping streams (one per run);
+    # the default comes from os.urandom so concurrent drivers differ
+    if args.seed is not None and not 0 < args.seed < 2**32:
+        ap.error("--seed must be in 1..2^32-1")
+    seed = args.seed if args.seed is not None else (int.from_bytes(os.urandom(4), "little") or 1)
+    # dSFMT has no jump-ahead, so its runs get derived seeds instead
+    streams = get_cfg_value(base_lines, "rng", "mt19937").lower() != "dsfmt"
+    print(f"Master seed: {seed}")
 
     all_fitness = []
     all_times = []
@@ -156,7 +204,11 @@ def main():
 
             lines = list(base_lines)
             lines = set_cfg_value(lines, "output", run_csv)
-            lines = set_cfg_value(lines, "seed", int(time.time()) + r)
+            if streams:
+                lines = set_cfg_value(lines, "seed", seed)
+                lines = set_cfg_value(lines, "seed_stream", r)
+            else:
+                lines = set_cfg_value(lines, "seed", run_seed(seed, r))
 
             write_cfg(lines, run_cfg)
 
@@ -8,36 +8,87 @@
  */
 
 #include "algorithms.h"
-#include "mt19937ar.h"
+#include "kernels.h"
+#include "lbfgs.h"
+#include "rng.h"
 #include "timing.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
+/** Number of random samples generated and evaluated per block in blind search. */
+#define BLIND_BATCH 64
+
+/** Memory cap for a block of candidate vectors (matters only for very large m). */
+#define BLOCK_BYTES ((size_t)64 << 20)
+
+/**
+ * @brief Number of m-dimensional rows to generate per evaluation block.
+ *
+ * @param m Dimension of each row.
+ * @param max_rows Preferred block size.
+ * @param elem Size of one coordinate (sizeof(double) or sizeof(float)).
+ * @return max_rows, reduced so the block stays under BLOCK_BYTES (at least 1).
+ */
+static int block_rows(int m, int max_rows, size_t elem)
+{
+    size_t rows = BLOCK_BYTES / ((size_t)m * elem);
+    if (rows < 1) rows = 1;
+    return rows < (size_t)max_rows ? (int)rows : max_rows;
+}
+
 /**
  * @brief Generates a uniform random number in a given range.
  *
+ * @param rng Random stream.
  * @param a Lower bound.
  * @param b Upper bound.
  * @return Random double in the range [a, b).
  */
-static double urand(double a, double b)
+static double urand(Rng* rng, double a, double b)
 {
-    return a + (b - a) * genrand_real2(); /* genrand_real2 in [0,1) */
+    return a + (b - a) * rng_real(rng); /* rng_real in [0,1) */
 }
 
 /**
  * @brief Generates a random vector with values in a given range.
  *
+ * @param rng Random stream.
  * @param x Output vector.
  * @param m Dimension of the vector.
  * @param lower Lower bound for each element.
  * @param upper Upper bound for each element.
  */
-static void rand_vector_range(double* x, int m, double lower, double upper)
+static void rand_vector_range(Rng* rng, double* x, int m, double lower, double upper)
 {
-    for (int i = 0; i < m; i++) {
-        x[i] = lower + (upper - lower) * genrand_real2();
+    rng_fill_real(rng, x, (size_t)m, lower, upper);
+}
+
+/**
+ * @brief Draws a block of sample rows.
+ *
+ * With a counter-based stream row r is drawn from substream
+ * @p first + r, so a sample depends only on its number; otherwise the
+ * rows are consecutive draws and the block is one fill.
+ *
+ * @param rng Random stream.
+ * @param X Output rows (k*m values).
+ * @param k Number of rows.
+ * @param m Dimension of each row.
+ * @param first Number of the first sample.
+ * @param lower Lower bound for each element.
+ * @param upper Upper bound for each element.
+ */
+static void rand_rows_range(Rng* rng, double* X, int k, int m, int first,
+                            double lower, double upper)
+{
+    if (!rng_counter_based(rng)) {
+        rng_fill_real(rng, X, (size_t)k * (size_t)m, lower, upper);
+        return;
+    }
+    for (int r = 0; r < k; r++) {
+        rng_substream(rng, (uint64_t)first + (uint64_t)r);
+        rng_fill_real(rng, X + (size_t)r * (size_t)m, (size_t)m, lower, upper);
     }
 }
 
@@ -57,55 +108,632 @@ static void clamp_vector_range(double* x, int m, double lower, double upper)
     }
 }
 
+/**
+ * @brief Fills a SearchStats structure if one was requested.
+ *
+ * @param stats Output, or NULL.
+ * @param iterations Samples or restarts run.
+ * @param evals Evaluations performed.
+ * @param target_evals Evaluations until the target was reached, or NAN.
+ * @param target_ms Milliseconds until the target was reached, or NAN.
+ */
+static void set_stats(SearchStats* stats, int iterations, double evals,
+                      double target_evals, double target_ms)
+{
+    if (!stats) return;
+    stats->iterations = iterations;
+    stats->evals = evals;
+    stats->target_evals = target_evals;
+    stats->target_ms = target_ms;
+}
+
+/**
+ * @brief Promotes a float-stored candidate to double and re-evaluates it.
+ *
+ * Candidates held as float are only screened on their block fitness;
+ * one that would become the new best is widened and scored again on
+ * the double path, and that value is the one accepted and reported.
+ *
+ * @param p Pointer to the optimization problem.
+ * @param xf Candidate vector (m floats).
+ * @param m Dimension of the vector.
+ * @param x_out Output double vector (m values).
+ * @return Fitness of x_out.
+ */
+static double promote_f32(const Problem* p, const float* xf, int m, double* x_out)
+{
+    for (int j = 0; j < m; j++) x_out[j] = (double)xf[j];
+    return problem_eval(p, x_out, m);
+}
+
+/**
+ * @brief Blind search on float-stored sample blocks (storage=float32).
+ *
+ * Draws the same random numbers as the double path and rounds each
+ * coordinate to float. Blocks are evaluated with
+ * problem_eval_batch_f32(); a sample that beats the best so far is
+ * promoted (see promote_f32()) before it is accepted, and its
+ * fitness_out entry is the promoted value.
+ *
+ * Parameters and return value as for blind_search(), with @p rng,
+ * @p batch and @p target taken from its options.
+ */
+static int blind_search_f32(const Problem* p, int m, int iters, double lower, double upper,
+                            Rng* rng, int first, int batch, double target, double* fitness_out, double* best_out,
+                            double* best_x_out, double* time_ms_out, SearchStats* stats_out)
+{
+    int block = block_rows(m, iters < batch ? iters : batch, sizeof(float));
+    float* X = (float*)malloc((size_t)block * (size_t)m * sizeof(float));
+    double* x_cand = (double*)malloc((size_t)m * sizeof(double));
+    if (!X || !x_cand) {
+        free(X);
+        free(x_cand);
+        return 2;
+    }
+
+    double best = INFINITY;
+    double evals = 0.0;
+    double target_ms = NAN;
+    int done = iters;
+
+    double t0 = now_ms();
+    for (int i = 0; i < done; i += block) {
+        int k = (iters - i < block) ? iters - i : block;
+        for (int r = 0; r < k; r++) {
+            /* x_cand is free until a promotion, draw each row there */
+            float* row = X + (size_t)r * (size_t)m;
+            rand_rows_range(rng, x_cand, 1, m, first + i + r, lower, upper);
+            for (int j = 0; j < m; j++) row[j] = (float)x_cand[j];
+        }
+        problem_eval_batch_f32(p, X, k, m, fitness_out + i);
+        evals += (double)k;
+        for (int r = 0; r < k; r++) {
+            if (!(fitness_out[i + r] < best)) continue;
+            double f = promote_f32(p, X + (size_t)r * (size_t)m, m, x_cand);
+            evals += 1.0;
+            fitness_out[i + r] = f;
+            if (f < best) {
+                best = f;
+                if (best_x_out) memcpy(best_x_out, x_cand, (size_t)m * sizeof(double));
+            }
+            if (f <= target) {
+                done = i + r + 1;
+                target_ms = now_ms() - t0;
+                break;
+            }
+        }
+    }
+    double t1 = now_ms();
+
+    *best_out = best;
+    *time_ms_out = t1 - t0;
+    set_stats(stats_out, done, evals, isnan(target_ms) ? NAN : evals, target_ms);
+
+    free(X);
+    free(x_cand);
+    return 0;
+}
+
 /**
  * @brief Performs blind (random) search optimization.
  *
  * Random solution vectors are generated uniformly within the given
- * bounds and evaluated. The best fitness value found is returned.
+ * bounds and evaluated in blocks of opt->block vectors (BLIND_BATCH if
+ * unset; fewer when m is so large that a block would exceed
+ * BLOCK_BYTES). The best
+ * fitness value found is returned. With opt->storage == STORAGE_F32
+ * the blocks are held as float (see blind_search_f32()). The search
+ * ends early at the first sample with fitness <= opt->target; the
+ * evaluations counted up to it include the rest of its block.
  *
  * @param p Pointer to the optimization problem.
  * @param m Dimension of the problem.
  * @param iters Number of random samples.
  * @param lower Lower bound for each dimension.
  * @param upper Upper bound for each dimension.
+ * @param opt Search options (NULL for defaults).
  * @param fitness_out Array to store fitness values per iteration.
  * @param best_out Output parameter for the best fitness value found.
+ * @param best_x_out Optional output for the best vector (m values), or NULL.
  * @param time_ms_out Output parameter for total runtime in milliseconds.
+ * @param stats_out Optional output for iteration/evaluation counts, or NULL.
  * @return 0 on success, non-zero on error.
  */
 int blind_search(const Problem* p, int m, int iters, double lower, double upper,
-                 double* fitness_out, double* best_out, double* time_ms_out)
+                 const SearchOptions* opt,
+                 double* fitness_out, double* best_out, double* best_x_out,
+                 double* time_ms_out, SearchStats* stats_out)
 {
     if (!p || m <= 0 || iters <= 0 || !fitness_out || !best_out || !time_ms_out)
         return 1;
 
-    double* x = (double*)malloc((size_t)m * sizeof(double));
-    if (!x) return 2;
+    double target = opt ? opt->target : NAN;
+    int batch = (opt && opt->block > 0) ? opt->block : BLIND_BATCH;
+    Rng* rng = (opt && opt->rng) ? opt->rng : rng_global();
+    int first = opt ? opt->first : 0;
+
+    if (opt && opt->storage == STORAGE_F32) {
+        return blind_search_f32(p, m, iters, lower, upper, rng, first, batch, target,
+                                fitness_out, best_out, best_x_out, time_ms_out, stats_out);
+    }
+
+    int block = block_rows(m, iters < batch ? iters : batch, sizeof(double));
+    double* X = (double*)malloc((size_t)block * (size_t)m * sizeof(double));
+    if (!X) return 2;
 
     double best = INFINITY;
+    double evals = 0.0;
+    double target_ms = NAN;
+    int done = iters;
 
     double t0 = now_ms();
-    for (int i = 0; i < iters; i++) {
-        rand_vector_range(x, m, lower, upper);
-        double f = problem_eval(p, x, m);
-        fitness_out[i] = f;
-        if (f < best) best = f;
+    for (int i = 0; i < done; i += block) {
+        int k = (iters - i < block) ? iters - i : block;
+        rand_rows_range(rng, X, k, m, first + i, lower, upper);
+        problem_eval_batch(p, X, k, m, fitness_out + i);
+        evals += (double)k;
+        for (int r = 0; r < k; r++) {
+            if (fitness_out[i + r] < best) {
+                best = fitness_out[i + r];
+                if (best_x_out) {
+                    memcpy(best_x_out, X + (size_t)r * (size_t)m, (size_t)m * sizeof(double));
+                }
+            }
+            if (fitness_out[i + r] <= target) {
+                done = i + r + 1;
+                target_ms = now_ms() - t0;
+                break;
+            }
+        }
     }
     double t1 = now_ms();
 
     *best_out = best;
     *time_ms_out = t1 - t0;
+    set_stats(stats_out, done, evals, isnan(target_ms) ? NAN : evals, target_ms);
 
-    free(x);
+    free(X);
     return 0;
 }
 
+/**
+ * @brief Performs blind search for several problems on the same samples.
+ *
+ * Each block of samples is drawn once as uniform [0,1) values. For
+ * every distinct (lower, upper) range among the selected problems the
+ * block is scaled to that range and the problems sharing it are
+ * evaluated in one fused pass.
+ *
+ * @param m Dimension of the problems.
+ * @param iters Number of random samples.
+ * @param mask Problems to run (PROBLEM_MASK(t) bits).
+ * @param lower Lower bound per problem, indexed by ProblemType.
+ * @param upper Upper bound per problem, indexed by ProblemType.
+ * @param rng Random stream, or NULL for rng_global().
+ * @param fitness_out Indexed by ProblemType; arrays of length @p iters.
+ * @param best_out Indexed by ProblemType; best fitness per problem.
+ * @param best_x_out Optional, indexed by ProblemType; best vector per problem.
+ * @param time_ms_out Output parameter for total runtime in milliseconds.
+ * @return 0 on success, non-zero on error.
+ */
+int blind_search_multi(int m, int iters, unsigned mask,
+                       const double* lower, const double* upper, Rng* rng,
+                       double* const* fitness_out, double* best_out,
+                       double* const* best_x_out, double* time_ms_out)
+{
+    mask &= PROBLEM_MASK_ALL;
+    if (m <= 0 || iters <= 0 || !mask || !lower || !upper ||
+        !fitness_out || !best_out || !time_ms_out)
+        return 1;
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+        if ((mask & PROBLEM_MASK(t)) && !fitness_out[t]) return 1;
+    }
+    if (!rng) rng = rng_global();
+
+    /* group the problems by search range */
+    unsigned group[PROB_EGG_HOLDER + 1];
+    int lead[PROB_EGG_HOLDER + 1];
+    int groups = 0;
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+        if (!(mask & PROBLEM_MASK(t))) continue;
+        int g = 0;
+        while (g < groups && !(lower[lead[g]] == lower[t] && upper[lead[g]] == upper[t])) g++;
+        if (g == groups) {
+            lead[groups] = t;
+            group[groups++] = 0;
+        }
+        group[g] |= PROBLEM_MASK(t);
+        best_out[t] = INFINITY;
+    }
+
+    int block = block_rows(m, iters < BLIND_BATCH ? iters : BLIND_BATCH, sizeof(double));
+    size_t len = (size_t)block * (size_t)m;
+    double* U = (double*)malloc(len * sizeof(double));
+    double* X = (double*)malloc(len * sizeof(double));
+    if (!U || !X) {
+        free(U);
+        free(X);
+        return 2;
+    }
+
+    double* f_out[PROB_EGG_HOLDER + 1];
+
+    double t0 = now_ms();
+    for (int i = 0; i < iters; i += block) {
+        int k = (iters - i < block) ? iters - i : block;
+        size_t n = (size_t)k * (size_t)m;
+        rand_rows_range(rng, U, k, m, i, 0.0, 1.0);
+
+        for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+            f_out[t] = (mask & PROBLEM_MASK(t)) ? fitness_out[t] + i : NULL;
+        }
+        for (int g = 0; g < groups; g++) {
+            double lo = lower[lead[g]];
+            double hi = upper[lead[g]];
+            for (size_t j = 0; j < n; j++) X[j] = lo + (hi - lo) * U[j];
+            problem_eval_multi(X, k, m, group[g], f_out);
+
+            for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+                if (!(group[g] & PROBLEM_MASK(t))) continue;
+                for (int r = 0; r < k; r++) {
+                    if (f_out[t][r] < best_out[t]) {
+                        best_out[t] = f_out[t][r];
+                        if (best_x_out && best_x_out[t]) {
+                            memcpy(best_x_out[t], X + (size_t)r * (size_t)m,
+                                   (size_t)m * sizeof(double));
+                        }
+                    }
+                }
+            }
+        }
+    }
+    double t1 = now_ms();
+
+    *time_ms_out = t1 - t0;
+
+    free(U);
+    free(X);
+    return 0;
+}
+
+/**
+ * @brief Fills a SearchOptions structure with default values.
+ *
+ * @param opt Pointer to the options to initialize.
+ */
+void search_options_default(SearchOptions* opt)
+{
+    if (!opt) return;
+    opt->neighborhood = NB_FULL;
+    opt->storage = STORAGE_F64;
+    opt->local = LS_SAMPLING;
+    opt->target = NAN;
+    opt->cache = NULL;
+    opt->block = 0;
+    opt->rng = NULL;
+    opt->first = 0;
+}
+
+/**
+ * @brief Workspace for evaluating neighbor blocks through an EvalCache.
+ */
+typedef struct {
+    EvalCache* cache; /**< Cache, or NULL for none */
+    double* rows;     /**< Neighbors that missed (rows*m values) */
+    double* f;        /**< Their fitness (rows values) */
+    int* idx;         /**< Their index in the block (rows values) */
+} CacheWork;
+
+/**
+ * @brief Evaluates one vector through the cache, if there is one.
+ *
+ * @param p Pointer to the optimization problem.
+ * @param cache Cache, or NULL.
+ * @param x Vector.
+ * @param m Dimension.
+ * @param evals Evaluation counter (incremented unless the cache answers).
+ * @return Fitness of x.
+ */
+static double eval_cached(const Problem* p, EvalCache* cache, const double* x, int m,
+                          double* evals)
+{
+    double f;
+    if (cache && evalcache_lookup(cache, x, &f)) return f;
+
+    f = problem_eval(p, x, m);
+    *evals += 1.0;
+    if (cache) evalcache_insert(cache, x, f);
+    return f;
+}
+
+/**
+ * @brief Evaluates a neighbor block, answering what it can from the cache.
+ *
+ * Misses are evaluated as in full_step(): against the running cutoff
+ * with the bounded kernel, or gathered into one batch. A bounded
+ * result is only stored when it beat the cutoff (otherwise it may be
+ * ABANDONED rather than the fitness).
+ *
+ * @param p Pointer to the optimization problem.
+ * @param cw Cache and gather workspace.
+ * @param nb Neighbor block (nk*m values).
+ * @param nk Number of neighbors.
+ * @param m Dimension.
+ * @param cutoff Fitness a neighbor has to beat.
+ * @param f_nb Output fitness per neighbor.
+ * @param evals Evaluation counter (incremented per miss).
+ */
+static void eval_block_cached(const Problem* p, const CacheWork* cw, const double* nb,
+                              int nk, int m, double cutoff, double* f_nb, double* evals)
+{
+    if (p->eval_bounded) {
+        for (int k = 0; k < nk; k++) {
+            const double* x = nb + (size_t)k * (size_t)m;
+            if (!evalcache_lookup(cw->cache, x, &f_nb[k])) {
+                f_nb[k] = problem_eval_bounded(p, x, m, cutoff);
+                *evals += 1.0;
+                if (f_nb[k] < cutoff) evalcache_insert(cw->cache, x, f_nb[k]);
+            }
+            if (f_nb[k] < cutoff) cutoff = f_nb[k];
+        }
+        return;
+    }
+
+    int miss = 0;
+    for (int k = 0; k < nk; k++) {
+        const double* x = nb + (size_t)k * (size_t)m;
+        if (evalcache_lookup(cw->cache, x, &f_nb[k])) continue;
+        memcpy(cw->rows + (size_t)miss * (size_t)m, x, (size_t)m * sizeof(double));
+        cw->idx[miss++] = k;
+    }
+    if (miss == 0) return;
+
+    problem_eval_batch(p, cw->rows, miss, m, cw->f);
+    *evals += (double)miss;
+    for (int r = 0; r < miss; r++) {
+        f_nb[cw->idx[r]] = cw->f[r];
+        evalcache_insert(cw->cache, cw->rows + (size_t)r * (size_t)m, cw->f[r]);
+    }
+}
+
+/**
+ * @brief Performs one full-vector local search step.
+ *
+ * Builds a block of neighbors by perturbing every coordinate of the
+ * current solution, evaluates the block in one batch and moves to the
+ * best neighbor if it improves on the current solution. When m is so
+ * large that all neighbors do not fit in one block, they are generated
+ * and evaluated rows at a time and the best so far is kept in x_cand;
+ * the neighbors and their order are the same either way. Problems with
+ * a bounded kernel evaluate each neighbor against the best fitness seen
+ * so far and abandon it early (see problem_eval_bounded()). With a
+ * cache, neighbors it already holds are not evaluated again.
+ *
+ * @param p Pointer to the optimization problem.
+ * @param m Dimension of the problem.
+ * @param x_best Current solution (updated on improvement).
+ * @param f_best Fitness of the current solution (updated on improvement).
+ * @param cw Evaluation cache workspace (cw->cache NULL for none).
+ * @param rng Random stream.
+ * @param nb Workspace for the neighbor block (rows*m values).
+ * @param f_nb Workspace for neighbor fitness values (rows values).
+ * @param x_cand Workspace for the best neighbor (m values, used when rows < neighbors).
+ * @param rows Neighbors generated and evaluated per block.
+ * @param neighbors Number of neighbors sampled.
+ * @param step Maximum perturbation per coordinate.
+ * @param lower Lower bound for each dimension.
+ * @param upper Upper bound for each dimension.
+ * @param evals Evaluation counter (incremented).
+ * @return 1 if the solution improved, 0 otherwise.
+ */
+static int full_step(const Problem* p, int m, double* x_best, double* f_best,
+                     const CacheWork* cw, Rng* rng, double* nb, double* f_nb, double* x_cand, int rows,
+                     int neighbors, double step,
+                     double lower, double upper, double* evals)
+{
+    const double* x_nb_best = NULL;
+    double f_nb_best = *f_best;
+
+    for (int k0 = 0; k0 < neighbors; k0 += rows) {
+        int nk = (neighbors - k0 < rows) ? neighbors - k0 : rows;
+        for (int k = 0; k < nk; k++) {
+            double* x_try = nb + (size_t)k * (size_t)m;
+            /* draw the perturbations in place, then add the current solution */
+            rng_fill_real(rng, x_try, (size_t)m, -step, step);
+            for (int d = 0; d < m; d++) {
+                x_try[d] = x_best[d] + x_try[d];
+            }
+            clamp_vector_range(x_try, m, lower, upper);
+        }
+
+        if (cw->cache) {
+            eval_block_cached(p, cw, nb, nk, m, f_nb_best, f_nb, evals);
+        } else if (p->eval_bounded) {
+            /* only a neighbor beating the best so far matters, so the
+               others may stop early (they come back as ABANDONED) */
+            double cutoff = f_nb_best;
+            for (int k = 0; k < nk; k++) {
+                f_nb[k] = problem_eval_bounded(p, nb + (size_t)k * (size_t)m, m, cutoff);
+                if (f_nb[k] < cutoff) cutoff = f_nb[k];
+            }
+            *evals += (double)nk;
+        } else {
+            problem_eval_batch(p, nb, nk, m, f_nb);
+            *evals += (double)nk;
+        }
+
+        int k_best = -1;
+        for (int k = 0; k < nk; k++) {
+            if (f_nb[k] < f_nb_best) {
+                f_nb_best = f_nb[k];
+                k_best = k;
+            }
+        }
+        if (k_best < 0) continue;
+
+        x_nb_best = nb + (size_t)k_best * (size_t)m;
+        if (nk < neighbors - k0) {
+            /* the next block overwrites nb, keep the candidate */
+            memcpy(x_cand, x_nb_best, (size_t)m * sizeof(double));
+            x_nb_best = x_cand;
+        }
+    }
+
+    if (!x_nb_best) return 0;
+
+    memcpy(x_best, x_nb_best, (size_t)m * sizeof(double));
+    *f_best = f_nb_best;
+    return 1;
+}
+
+/**
+ * @brief full_step() on a float-stored neighbor block (storage=float32).
+ *
+ * Neighbors are generated from the double x_best exactly as in
+ * full_step() and rounded to float. Each block is screened with
+ * problem_eval_batch_f32(); the block's best neighbor, if it beats the
+ * best so far, is promoted (see promote_f32()) and accepted on its
+ * double fitness. No early abandoning: the bounded kernels read
+ * double rows.
+ *
+ * @param p Pointer to the optimization problem.
+ * @param m Dimension of the problem.
+ * @param x_best Current solution (updated on improvement).
+ * @param f_best Fitness of the current solution (updated on improvement).
+ * @param rng Random stream.
+ * @param nb Workspace for the neighbor block (rows*m floats).
+ * @param f_nb Workspace for neighbor fitness values (rows values).
+ * @param x_cand Workspace of 2*m values: accepted candidate, promotion scratch.
+ * @param rows Neighbors generated and evaluated per block.
+ * @param neighbors Number of neighbors sampled.
+ * @param step Maximum perturbation per coordinate.
+ * @param lower Lower bound for each dimension.
+ * @param upper Upper bound for each dimension.
+ * @param evals Evaluation counter (incremented, promotions included).
+ * @return 1 if the solution improved, 0 otherwise.
+ */
+static int full_step_f32(const Problem* p, int m, double* x_best, double* f_best,
+                         Rng* rng, float* nb, double* f_nb, double* x_cand, int rows,
+                         int neighbors, double step,
+                         double lower, double upper, double* evals)
+{
+    double* x_prom = x_cand + m;
+    double f_nb_best = *f_best;
+    int found = 0;
+
+    for (int k0 = 0; k0 < neighbors; k0 += rows) {
+        int nk = (neighbors - k0 < rows) ? neighbors - k0 : rows;
+        for (int k = 0; k < nk; k++) {
+            float* x_try = nb + (size_t)k * (size_t)m;
+            /* x_prom is free until the block is screened */
+            rng_fill_real(rng, x_prom, (size_t)m, -step, step);
+            for (int d = 0; d < m; d++) {
+                double v = x_best[d] + x_prom[d];
+                if (v < lower) v = lower;
+                else if (v > upper) v = upper;
+                x_try[d] = (float)v;
+            }
+        }
+
+        problem_eval_batch_f32(p, nb, nk, m, f_nb);
+        *evals += (double)nk;
+
+        int k_best = -1;
+        double f_screen = f_nb_best;
+        for (int k = 0; k < nk; k++) {
+            if (f_nb[k] < f_screen) {
+                f_screen = f_nb[k];
+                k_best = k;
+            }
+        }
+        if (k_best < 0) continue;
+
+        double f = promote_f32(p, nb + (size_t)k_best * (size_t)m, m, x_prom);
+        *evals += 1.0;
+        if (f < f_nb_best) {
+            f_nb_best = f;
+            memcpy(x_cand, x_prom, (size_t)m * sizeof(double));
+            found = 1;
+        }
+    }
+
+    if (!found) return 0;
+
+    memcpy(x_best, x_cand, (size_t)m * sizeof(double));
+    *f_best = f_nb_best;
+    return 1;
+}
+
+/**
+ * @brief Performs one coordinate-wise local search step.
+ *
+ * Each neighbor changes a single random coordinate of the current
+ * solution and is scored with problem_eval_delta(), which costs O(1)
+ * instead of O(m). The best improving move is applied and the new
+ * solution is re-evaluated in full so rounding in the deltas does not
+ * accumulate across steps (through the cache, if there is one). If the
+ * full value does not improve on the current one, the move is undone.
+ *
+ * @param p Pointer to the optimization problem.
+ * @param m Dimension of the problem.
+ * @param x_best Current solution (updated on improvement).
+ * @param f_best Fitness of the current solution (updated on improvement).
+ * @param cache Evaluation cache, or NULL.
+ * @param rng Random stream.
+ * @param scratch m doubles for problems without a delta kernel.
+ * @param neighbors Number of neighbors sampled.
+ * @param step Maximum perturbation of the chosen coordinate.
+ * @param lower Lower bound for each dimension.
+ * @param upper Upper bound for each dimension.
+ * @param evals Evaluation counter (incremented).
+ * @return 1 if the solution improved, 0 otherwise.
+ */
+static int coordinate_step(const Problem* p, int m, double* x_best, double* f_best,
+                           EvalCache* cache, Rng* rng, double* scratch, int neighbors,
+                           double step, double lower, double upper, double* evals)
+{
+    int j_best = -1;
+    double v_best = 0.0;
+    double f_nb_best = *f_best;
+
+    for (int k = 0; k < neighbors; k++) {
+        int j = (int)(rng_next(rng) % (uint32_t)m);
+        double v = x_best[j] + urand(rng, -step, step);
+        if (v < lower) v = lower;
+        else if (v > upper) v = upper;
+
+        double f = problem_eval_delta(p, x_best, m, *f_best, j, v, scratch);
+        *evals += 1.0;
+
+        if (f < f_nb_best) {
+            f_nb_best = f;
+            j_best = j;
+            v_best = v;
+        }
+    }
+
+    if (j_best < 0) return 0;
+
+    double x_old = x_best[j_best];
+    x_best[j_best] = v_best;
+    double f = eval_cached(p, cache, x_best, m, evals);
+    if (!(f < *f_best)) {
+        x_best[j_best] = x_old;
+        return 0;
+    }
+    *f_best = f;
+    return 1;
+}
+
 /**
  * @brief Performs a single local search starting from an initial solution.
  *
- * The algorithm samples neighboring candidate solutions and moves
- * to an improved solution if found, until no improvement is possible
- * or the maximum number of steps is reached.
+ * Each step samples a set of neighboring candidate solutions around
+ * the current solution and moves to the best neighbor if it improves
+ * on the current solution. The search stops when no improvement is
+ * found or the maximum number of steps is reached. With LS_LBFGS the
+ * search is handed to lbfgs_minimize(), max_steps being its iteration
+ * cap. Either way it also stops once the fitness is <= opt->target.
  *
  * @param p Pointer to the optimization problem.
  * @param m Dimension of the problem.
@@ -115,6 +743,9 @@ int blind_search(const Problem* p, int m, int iters, double lower, double upper,
  * @param max_steps Maximum number of local search steps.
  * @param lower Lower bound for each dimension.
  * @param upper Upper bound for each dimension.
+ * @param opt Search options (neighbor generation mode, block storage).
+ * @param rng Random stream for the neighbors.
+ * @param x_out Optional output for the final solution (m values), or NULL.
  * @param steps_used Optional output for steps taken.
  * @param evals_used Optional output for number of evaluations.
  * @return Best fitness value found.
@@ -122,63 +753,188 @@ int blind_search(const Problem* p, int m, int iters, double lower, double upper,
 static double local_search_from(const Problem* p, int m, const double* x0,
                                 int neighbors, double step_frac,
                                 int max_steps, double lower, double upper,
+                                const SearchOptions* opt, Rng* rng, double* x_out,
                                 int* steps_used, double* evals_used)
 {
+    if (opt->local == LS_LBFGS) {
+        double* x = (double*)malloc((size_t)m * sizeof(double));
+        double f = INFINITY;
+        int iters = 0;
+        double evals = 0.0;
+        if (x) {
+            memcpy(x, x0, (size_t)m * sizeof(double));
+            if (lbfgs_minimize(p, m, x, lower, upper, max_steps, opt->target,
+                               &f, &iters, &evals) == 0 && x_out)
+                memcpy(x_out, x, (size_t)m * sizeof(double));
+            free(x);
+        }
+        if (steps_used) *steps_used = iters;
+        if (evals_used) *evals_used = evals;
+        return f;
+    }
+
     double step = step_frac * (upper - lower);
+    int coordinate = (opt->neighborhood == NB_COORDINATE);
+    int f32 = !coordinate && (opt->storage == STORAGE_F32);
+
+    int rows = block_rows(m, (opt->block > 0 && opt->block < neighbors) ? opt->block : neighbors,
+                          f32 ? sizeof(float) : sizeof(double));
+
+    /* float blocks always keep the promoted candidate (and its scratch);
+       coordinate steps use it as the scratch of full-evaluation deltas */
+    int cand_len = f32 ? 2 * m : ((coordinate || rows < neighbors) ? m : 0);
+
+    /* double neighbor blocks that miss the cache are gathered into cw.rows */
+    CacheWork cw = { f32 ? NULL : opt->cache, NULL, NULL, NULL };
+    int gather = cw.cache && !coordinate;
 
     double* x_best = (double*)malloc((size_t)m * sizeof(double));
-    double* x_try  = (double*)malloc((size_t)m * sizeof(double));
-    if (!x_best || !x_try) {
+    double* nb = NULL;
+    float* nb_f32 = NULL;
+    double* f_nb = NULL;
+    double* x_cand = NULL;
+    if (!coordinate) {
+        if (f32) nb_f32 = (float*)malloc((size_t)rows * (size_t)m * sizeof(float));
+        else     nb     = (double*)malloc((size_t)rows * (size_t)m * sizeof(double));
+        f_nb = (double*)malloc((size_t)rows * sizeof(double));
+    }
+    if (cand_len) x_cand = (double*)malloc((size_t)cand_len * sizeof(double));
+    if (gather) {
+        cw.rows = (double*)malloc((size_t)rows * (size_t)m * sizeof(double));
+        cw.f = (double*)malloc((size_t)rows * sizeof(double));
+        cw.idx = (int*)malloc((size_t)rows * sizeof(int));
+    }
+    if (!x_best || (cand_len && !x_cand) || (!coordinate && ((!nb && !nb_f32) || !f_nb)) ||
+        (gather && (!cw.rows || !cw.f || !cw.idx))) {
         free(x_best);
-        free(x_try);
+        free(nb);
+        free(nb_f32);
+        free(f_nb);
+        free(x_cand);
+        free(cw.rows);
+        free(cw.f);
+        free(cw.idx);
         if (steps_used) *steps_used = 0;
         if (evals_used) *evals_used = 0.0;
         return INFINITY;
     }
 
     memcpy(x_best, x0, (size_t)m * sizeof(double));
-    double f_best = problem_eval(p, x_best, m);
-    double evals = 1.0;
+    double evals = 0.0;
+    double f_best = eval_cached(p, cw.cache, x_best, m, &evals);
 
     int step_count = 0;
     int improved = 1;
 
-    while (improved && step_count < max_steps) {
-        improved = 0;
-
-        double f_nb_best = f_best;
-        memcpy(x_try, x_best, (size_t)m * sizeof(double));
-
-        for (int k = 0; k < neighbors; k++) {
-            memcpy(x_try, x_best, (size_t)m * sizeof(double));
-            for (int d = 0; d < m; d++) {
-                x_try[d] += urand(-step, step);
-            }
-            clamp_vector_range(x_try, m, lower, upper);
-            double f = problem_eval(p, x_try, m);
-            evals += 1.0;
-
-            if (f < f_nb_best) {
-                f_nb_best = f;
-                memcpy(x_best, x_try, (size_t)m * sizeof(double));
-                improved = 1;
-            }
-        }
-
-        if (improved) {
-            f_best = f_nb_best;
+    while (improved && step_count < max_steps && !(f_best <= opt->target)) {
+        if (coordinate) {
+            improved = coordinate_step(p, m, x_best, &f_best, cw.cache, rng, x_cand, neighbors,
+                                       step, lower, upper, &evals);
+        } else if (f32) {
+            improved = full_step_f32(p, m, x_best, &f_best, rng, nb_f32, f_nb, x_cand, rows,
+                                     neighbors, step, lower, upper, &evals);
+        } else {
+            improved = full_step(p, m, x_best, &f_best, &cw, rng, nb, f_nb, x_cand, rows,
+                                 neighbors, step, lower, upper, &evals);
         }
         step_count++;
     }
 
     if (steps_used) *steps_used = step_count;
     if (evals_used) *evals_used = evals;
+    if (x_out) memcpy(x_out, x_best, (size_t)m * sizeof(double));
 
     free(x_best);
-    free(x_try);
+    free(nb);
+    free(nb_f32);
+    free(f_nb);
+    free(x_cand);
+    free(cw.rows);
+    free(cw.f);
+    free(cw.idx);
     return f_best;
 }
 
+#if defined(_OPENMP)
+/**
+ * @brief Runs the restarts of repeated_local_search() on several threads.
+ *
+ * Only used with a counter-based stream: restart t draws from substream
+ * opt->first + t of a private copy of the stream, so it does the same work on any
+ * thread. Each thread keeps the first best of the restarts it ran, and
+ * the merge keeps the lowest restart number among equal values, which
+ * is the restart the sequential loop reports. The evaluation counts are
+ * whole numbers, so their sum does not depend on the order either.
+ *
+ * Parameters as for repeated_local_search(); @p rng is the run's stream.
+ *
+ * @param evals_out Output for the evaluations performed.
+ * @return 0 on success, 2 on allocation failure.
+ */
+static int rls_parallel(const Problem* p, int m, int restarts, int neighbors,
+                        double step_frac, int max_steps, double lower, double upper,
+                        const SearchOptions* opt, const Rng* rng,
+                        double* fitness_out, double* best_out, double* best_x_out,
+                        double* evals_out)
+{
+    double best = INFINITY;
+    int best_t = restarts;
+    double evals = 0.0;
+    int failed = 0;
+
+#pragma omp parallel reduction(+:evals)
+    {
+        Rng local = *rng;
+        double* x0 = (double*)malloc((size_t)m * sizeof(double));
+        double* x_run = (double*)malloc((size_t)m * sizeof(double));
+        double* x_keep = best_x_out ? (double*)malloc((size_t)m * sizeof(double)) : NULL;
+        int ok = x0 && x_run && (!best_x_out || x_keep);
+        double my_best = INFINITY;
+        int my_t = restarts;
+
+        /* every thread reaches the loop, a failed one just skips its share */
+#pragma omp for schedule(dynamic, 1)
+        for (int t = 0; t < restarts; t++) {
+            if (!ok) {
+                fitness_out[t] = INFINITY;
+                continue;
+            }
+            rng_substream(&local, (uint64_t)opt->first + (uint64_t)t);
+            rand_vector_range(&local, x0, m, lower, upper);
+            double run_evals = 0.0;
+            double f = local_search_from(p, m, x0, neighbors, step_frac,
+                                         max_steps, lower, upper, opt, &local, x_run,
+                                         NULL, &run_evals);
+            evals += run_evals;
+            fitness_out[t] = f;
+            if (f < my_best) {
+                my_best = f;
+                my_t = t;
+                if (x_keep) memcpy(x_keep, x_run, (size_t)m * sizeof(double));
+            }
+        }
+
+#pragma omp critical
+        {
+            if (!ok) failed = 1;
+            if (my_t < restarts && (my_best < best || (my_best == best && my_t < best_t))) {
+                best = my_best;
+                best_t = my_t;
+                if (best_x_out) memcpy(best_x_out, x_keep, (size_t)m * sizeof(double));
+            }
+        }
+
+        free(x0);
+        free(x_run);
+        free(x_keep);
+    }
+
+    *best_out = best;
+    *evals_out = evals;
+    return failed ? 2 : 0;
+}
+#endif
+
 /**
  * @brief Performs repeated local search with random restarts.
  *
@@ -194,40 +950,91 @@ static double local_search_from(const Problem* p, int m, const double* x0,
  * @param max_steps Maximum local search steps per restart.
  * @param lower Lower bound for each dimension.
  * @param upper Upper bound for each dimension.
+ * @param opt Search options (NULL for defaults).
  * @param fitness_out Array to store best fitness per restart.
  * @param best_out Output parameter for best overall fitness.
+ * @param best_x_out Optional output for the best vector (m values), or NULL.
  * @param time_ms_out Output parameter for runtime in milliseconds.
+ * @param stats_out Optional output for restart/evaluation counts, or NULL.
  * @return 0 on success, non-zero on error.
  */
 int repeated_local_search(const Problem* p, int m, int restarts, int neighbors,
                           double step_frac, int max_steps,
                           double lower, double upper,
+                          const SearchOptions* opt,
                           double* fitness_out, double* best_out,
-                          double* time_ms_out)
+                          double* best_x_out, double* time_ms_out,
+                          SearchStats* stats_out)
 {
     if (!p || m <= 0 || restarts <= 0 || neighbors <= 0 ||
         step_frac <= 0.0 || max_steps <= 0 ||
         !fitness_out || !best_out || !time_ms_out)
         return 1;
 
+    SearchOptions defaults;
+    if (!opt) {
+        search_options_default(&defaults);
+        opt = &defaults;
+    }
+    Rng* rng = opt->rng ? opt->rng : rng_global();
+
+#if defined(_OPENMP)
+    /* restarts are independent with substreams; the cache, an early stop
+       and the scratch of transforms, expressions and plugins are not */
+    if (rng_counter_based(rng) && !opt->cache && isnan(opt->target) &&
+        p->type >= PROB_SCHWEFEL && p->type <= PROB_EGG_HOLDER && !p->transform &&
+        kernels_threads() > 1 && restarts > 1) {
+        double evals = 0.0;
+        double t0 = now_ms();
+        int rc = rls_parallel(p, m, restarts, neighbors, step_frac, max_steps, lower, upper,
+                              opt, rng, fitness_out, best_out, best_x_out, &evals);
+        *time_ms_out = now_ms() - t0;
+        set_stats(stats_out, restarts, evals, NAN, NAN);
+        return rc;
+    }
+#endif
+
     double* x0 = (double*)malloc((size_t)m * sizeof(double));
-    if (!x0) return 2;
+    double* x_run = best_x_out ? (double*)malloc((size_t)m * sizeof(double)) : NULL;
+    if (!x0 || (best_x_out && !x_run)) {
+        free(x0);
+        free(x_run);
+        return 2;
+    }
 
     double global_best = INFINITY;
+    double evals = 0.0;
+    double target_evals = NAN;
+    double target_ms = NAN;
+    int done = restarts;
 
     double t0 = now_ms();
-    for (int t = 0; t < restarts; t++) {
-        rand_vector_range(x0, m, lower, upper);
+    for (int t = 0; t < done; t++) {
+        rng_substream(rng, (uint64_t)opt->first + (uint64_t)t);
+        rand_vector_range(rng, x0, m, lower, upper);
+        double run_evals = 0.0;
         double f = local_search_from(p, m, x0, neighbors, step_frac,
-                                     max_steps, lower, upper, NULL, NULL);
+                                     max_steps, lower, upper, opt, rng, x_run,
+                                     NULL, &run_evals);
+        evals += run_evals;
         fitness_out[t] = f;
-        if (f < global_best) global_best = f;
+        if (f < global_best) {
+            global_best = f;
+            if (best_x_out) memcpy(best_x_out, x_run, (size_t)m * sizeof(double));
+        }
+        if (f <= opt->target) {
+            done = t + 1;
+            target_evals = evals;
+            target_ms = now_ms() - t0;
+        }
     }
     double t1 = now_ms();
 
     *best_out = global_best;
     *time_ms_out = t1 - t0;
+    set_stats(stats_out, done, evals, target_evals, target_ms);
 
     free(x0);
+    free(x_run);
     return 0;
 }
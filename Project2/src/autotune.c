@@ -0,0 +1,367 @@
+/**
+ * @file autotune.c
+ * @brief Timing of the kernel variants and the per-machine profile file.
+ *
+ * The profile is plain text:
+ * @code
+ * # project2 autotune profile
+ * machine=avx512 cpus=8
+ * # problem m precision isa block threads ns_per_eval
+ * 1 30 exact avx512 64 0 41.2
+ * @endcode
+ * The machine line records the widest kernel variant and the processor
+ * count; a profile from another machine is not used.
+ */
+
+#include "autotune.h"
+#include "kernels.h"
+#include "timing.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Vectors evaluated per timing pass (fewer for very long rows). */
+#define TUNE_ROWS 256
+
+/** Memory cap for the timed block of vectors. */
+#define TUNE_BLOCK_BYTES ((size_t)16 << 20)
+
+/** Minimum length of one timing repetition in milliseconds. */
+#define TUNE_MIN_MS 2.0
+
+/** Repetitions per candidate; the fastest counts. */
+#define TUNE_REPS 3
+
+/** A candidate must beat the best so far by this fraction to replace it. */
+#define TUNE_MARGIN 0.02
+
+/** Block size of the untuned program (BLIND_BATCH in algorithms.c). */
+#define TUNE_DEFAULT_BLOCK 64
+
+/** Block sizes tried, in rows per problem_eval_batch() call. */
+static const int tune_blocks[] = { 1, 4, 16, 64, 256 };
+
+#define NUM_TUNE_BLOCKS ((int)(sizeof(tune_blocks) / sizeof(tune_blocks[0])))
+
+/**
+ * @brief Initializes an empty profile for the running machine.
+ *
+ * @param prof Profile to initialize.
+ */
+void autotune_init(TuneProfile* prof)
+{
+    const char* widest = kernels_variant_name(0);
+
+    strncpy(prof->machine, widest ? widest : "unknown", sizeof(prof->machine) - 1);
+    prof->machine[sizeof(prof->machine) - 1] = '\0';
+    prof->cpus = kernels_cpus();
+    prof->entries = NULL;
+    prof->count = 0;
+    prof->cap = 0;
+}
+
+/**
+ * @brief Frees the entries of a profile.
+ *
+ * @param prof Profile to free.
+ */
+void autotune_free(TuneProfile* prof)
+{
+    if (!prof) return;
+
+    free(prof->entries);
+    prof->entries = NULL;
+    prof->count = 0;
+    prof->cap = 0;
+}
+
+/**
+ * @brief Fills a block with uniform values in [lower, upper).
+ *
+ * Uses its own xorshift generator so tuning does not touch the MT19937
+ * state of the searches.
+ *
+ * @param X Output block (n values).
+ * @param n Number of values.
+ * @param lower Lower bound.
+ * @param upper Upper bound.
+ * @param seed Non-zero seed.
+ */
+static void fill_uniform(double* X, size_t n, double lower, double upper, uint64_t seed)
+{
+    uint64_t s = seed;
+    for (size_t i = 0; i < n; i++) {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        double u = (double)(s >> 11) * (1.0 / 9007199254740992.0);
+        X[i] = lower + (upper - lower) * u;
+    }
+}
+
+/**
+ * @brief Times one combination of problem descriptor and block size.
+ *
+ * @param p Problem descriptor (bound to the variant under test).
+ * @param X Block of vectors (rows*m values).
+ * @param rows Number of vectors.
+ * @param m Dimension.
+ * @param block Rows per evaluation call.
+ * @param f Workspace for the fitness values (rows values).
+ * @return Fastest time per evaluation over TUNE_REPS repetitions, in ns.
+ */
+static double time_variant(const Problem* p, const double* X, int rows, int m, int block,
+                           double* f)
+{
+    double best = INFINITY;
+
+    for (int rep = 0; rep < TUNE_REPS; rep++) {
+        double passes = 0.0;
+        double t0 = now_ms();
+        double t1;
+        do {
+            for (int i = 0; i < rows; i += block) {
+                int k = (rows - i < block) ? rows - i : block;
+                problem_eval_batch(p, X + (size_t)i * (size_t)m, k, m, f + i);
+            }
+            passes += 1.0;
+            t1 = now_ms();
+        } while (t1 - t0 < TUNE_MIN_MS);
+
+        double ns = (t1 - t0) * 1e6 / (passes * (double)rows);
+        if (ns < best) best = ns;
+    }
+    return best;
+}
+
+/**
+ * @brief Records a candidate if it beats the best so far by TUNE_MARGIN.
+ *
+ * @param out Best entry so far (ns_per_eval INFINITY if none).
+ * @param ns Candidate time per evaluation.
+ * @param isa Candidate variant.
+ * @param block Candidate block size.
+ * @param threads Candidate thread count.
+ */
+static void consider(TuneEntry* out, double ns, const char* isa, int block, int threads)
+{
+    if (!(ns < out->ns_per_eval * (1.0 - TUNE_MARGIN))) return;
+
+    strncpy(out->isa, isa, sizeof(out->isa) - 1);
+    out->isa[sizeof(out->isa) - 1] = '\0';
+    out->block = block;
+    out->threads = threads;
+    out->ns_per_eval = ns;
+}
+
+/**
+ * @brief Times the variants for one problem and dimension.
+ *
+ * The untuned configuration (widest variant, default block, all
+ * threads) is timed first, so another combination only wins if it is
+ * clearly faster.
+ *
+ * @param type Problem to time (1..10).
+ * @param m Dimension.
+ * @param lower Lower bound of the sampled vectors.
+ * @param upper Upper bound of the sampled vectors.
+ * @param out Output entry with the fastest combination.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure.
+ */
+int autotune_measure(ProblemType type, int m, double lower, double upper, TuneEntry* out)
+{
+    if (type < PROB_SCHWEFEL || type > PROB_EGG_HOLDER || m <= 0 || !(lower < upper) || !out)
+        return 1;
+
+    size_t cap = TUNE_BLOCK_BYTES / ((size_t)m * sizeof(double));
+    int rows = (cap < 1) ? 1 : (cap < TUNE_ROWS ? (int)cap : TUNE_ROWS);
+    double* X = (double*)malloc((size_t)rows * (size_t)m * sizeof(double));
+    double* f = (double*)malloc((size_t)rows * sizeof(double));
+    if (!X || !f) {
+        free(X);
+        free(f);
+        return 2;
+    }
+    fill_uniform(X, (size_t)rows * (size_t)m, lower, upper,
+                 0x9e3779b97f4a7c15ULL ^ ((uint64_t)type << 32) ^ (uint64_t)m);
+
+    char saved_isa[16];
+    strncpy(saved_isa, kernels_active()->isa, sizeof(saved_isa) - 1);
+    saved_isa[sizeof(saved_isa) - 1] = '\0';
+    int saved_threads = kernels_threads();
+    int cpus = kernels_cpus();
+    int tune_threads = (m >= AUTOTUNE_THREAD_DIM_MIN && cpus > 1);
+
+    out->problem = (int)type;
+    out->m = m;
+    out->precision = kernels_active()->precision;
+    out->ns_per_eval = INFINITY;
+
+    /* the untuned configuration first */
+    const char* widest = kernels_variant_name(0);
+    kernels_select(widest);
+    kernels_set_threads(cpus);
+    Problem p = problem_create(type);
+    int def_block = (TUNE_DEFAULT_BLOCK < rows) ? TUNE_DEFAULT_BLOCK : rows;
+    consider(out, time_variant(&p, X, rows, m, def_block, f), widest, def_block,
+             tune_threads ? cpus : 0);
+
+    for (int v = 0; kernels_variant_name(v); v++) {
+        const char* isa = kernels_variant_name(v);
+        kernels_select(isa);
+        p = problem_create(type);
+
+        /* thread counts 1, 2, 4, ... and all processors, for long rows only */
+        int th = tune_threads ? 1 : cpus;
+        for (;;) {
+            kernels_set_threads(th);
+            for (int b = 0; b < NUM_TUNE_BLOCKS; b++) {
+                int block = (tune_blocks[b] < rows) ? tune_blocks[b] : rows;
+                consider(out, time_variant(&p, X, rows, m, block, f), isa, block,
+                         tune_threads ? th : 0);
+                if (block == rows) break;
+            }
+            if (th == cpus) break;
+            th = (th * 2 < cpus) ? th * 2 : cpus;
+        }
+    }
+
+    kernels_select(saved_isa);
+    kernels_set_threads(saved_threads);
+    free(X);
+    free(f);
+    return 0;
+}
+
+/**
+ * @brief Adds an entry, replacing one with the same key.
+ *
+ * @param prof Profile.
+ * @param e Entry to store.
+ * @return 0 on success, 2 on allocation failure.
+ */
+int autotune_put(TuneProfile* prof, const TuneEntry* e)
+{
+    for (int i = 0; i < prof->count; i++) {
+        TuneEntry* o = &prof->entries[i];
+        if (o->problem == e->problem && o->m == e->m && o->precision == e->precision) {
+            *o = *e;
+            return 0;
+        }
+    }
+
+    if (prof->count == prof->cap) {
+        int cap = prof->cap ? 2 * prof->cap : 16;
+        TuneEntry* grown = (TuneEntry*)realloc(prof->entries, (size_t)cap * sizeof(TuneEntry));
+        if (!grown) return 2;
+        prof->entries = grown;
+        prof->cap = cap;
+    }
+    prof->entries[prof->count++] = *e;
+    return 0;
+}
+
+/**
+ * @brief Finds the entry for a problem, dimension and precision.
+ *
+ * @param prof Profile.
+ * @param type Problem.
+ * @param m Dimension.
+ * @param precision Kernel precision.
+ * @return Matching entry, or NULL.
+ */
+const TuneEntry* autotune_find(const TuneProfile* prof, int type, int m, EvalPrecision precision)
+{
+    if (!prof) return NULL;
+
+    for (int i = 0; i < prof->count; i++) {
+        const TuneEntry* e = &prof->entries[i];
+        if (e->problem == type && e->m == m && e->precision == precision) return e;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Loads a profile written by autotune_save().
+ *
+ * @param path Profile path.
+ * @param prof Output profile (initialized by this call).
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 if the file cannot be opened,
+ *         3 on a malformed file,
+ *         4 if it was written on a different machine (left empty).
+ */
+int autotune_load(const char* path, TuneProfile* prof)
+{
+    if (!path || !prof) return 1;
+    autotune_init(prof);
+
+    FILE* fp = fopen(path, "r");
+    if (!fp) return 2;
+
+    char line[256];
+    int have_machine = 0;
+    int rc = 0;
+    while (rc == 0 && fgets(line, sizeof(line), fp)) {
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+
+        char machine[16];
+        int cpus;
+        if (sscanf(line, "machine=%15s cpus=%d", machine, &cpus) == 2) {
+            have_machine = 1;
+            if (strcmp(machine, prof->machine) != 0 || cpus != prof->cpus) rc = 4;
+            continue;
+        }
+
+        TuneEntry e;
+        char prec[16];
+        if (!have_machine ||
+            sscanf(line, "%d %d %15s %15s %d %d %lf", &e.problem, &e.m, prec, e.isa,
+                   &e.block, &e.threads, &e.ns_per_eval) != 7 ||
+            e.problem < PROB_SCHWEFEL || e.problem > PROB_EGG_HOLDER || e.m <= 0 ||
+            e.block <= 0 || e.threads < 0) {
+            rc = 3;
+            break;
+        }
+        e.precision = (strcmp(prec, "fast") == 0) ? PRECISION_FAST : PRECISION_EXACT;
+        if (autotune_put(prof, &e) != 0) rc = 3;
+    }
+    fclose(fp);
+
+    if (rc == 0 && !have_machine) rc = 3;
+    if (rc != 0) {
+        autotune_free(prof);
+    }
+    return rc;
+}
+
+/**
+ * @brief Writes a profile.
+ *
+ * @param path Profile path.
+ * @param prof Profile.
+ * @return 0 on success, 1 on invalid arguments, 2 if the file cannot be written.
+ */
+int autotune_save(const char* path, const TuneProfile* prof)
+{
+    if (!path || !prof) return 1;
+
+    FILE* fp = fopen(path, "w");
+    if (!fp) return 2;
+
+    fprintf(fp, "# project2 autotune profile (written by --autotune; delete to re-tune)\n");
+    fprintf(fp, "machine=%s cpus=%d\n", prof->machine, prof->cpus);
+    fprintf(fp, "# problem m precision isa block threads ns_per_eval\n");
+    for (int i = 0; i < prof->count; i++) {
+        const TuneEntry* e = &prof->entries[i];
+        fprintf(fp, "%d %d %s %s %d %d %.1f\n", e->problem, e->m,
+                e->precision == PRECISION_FAST ? "fast" : "exact",
+                e->isa, e->block, e->threads, e->ns_per_eval);
+    }
+    return fclose(fp) == 0 ? 0 : 2;
+}
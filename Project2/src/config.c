@@ -12,6 +12,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
 #include <time.h>
 
 /**
@@ -82,6 +85,77 @@ static AlgorithmType parse_algorithm(const char* s)
     return ALG_ALL;
 }
 
+/**
+ * @brief Parses a transformation name.
+ *
+ * @param s Input string ("none", "shift", "rotate", "shift_rotate").
+ * @return Parsed TransformKind (TRANSFORM_NONE if unrecognized).
+ */
+static TransformKind parse_transform(const char* s)
+{
+    if (streqi(s, "shift")) return TRANSFORM_SHIFT;
+    if (streqi(s, "rotate")) return TRANSFORM_ROTATE;
+    if (streqi(s, "shift_rotate") || streqi(s, "shift+rotate")) return TRANSFORM_SHIFT_ROTATE;
+    return TRANSFORM_NONE;
+}
+
+/**
+ * @brief Parses a target= value.
+ *
+ * @param s Input string ("none", "optimum" or a fitness value).
+ * @param value Output fitness for TARGET_VALUE.
+ * @return Parsed TargetMode (TARGET_NONE if unrecognized).
+ */
+static TargetMode parse_target(const char* s, double* value)
+{
+    if (streqi(s, "optimum") || streqi(s, "opt") || streqi(s, "auto")) return TARGET_OPTIMUM;
+
+    char* end = NULL;
+    double v = strtod(s, &end);
+    if (end == s || *end != '\0' || isnan(v)) return TARGET_NONE;
+    *value = v;
+    return TARGET_VALUE;
+}
+
+/**
+ * @brief Parses a cache= value.
+ *
+ * @param s Input string ("off", "exact" or a key resolution > 0).
+ * @return Resolution (0 for exact keys), or NAN for off/unrecognized.
+ */
+static double parse_cache(const char* s)
+{
+    if (streqi(s, "exact") || streqi(s, "on")) return 0.0;
+
+    char* end = NULL;
+    double v = strtod(s, &end);
+    if (end == s || *end != '\0' || !(v > 0.0) || isinf(v)) return NAN;
+    return v;
+}
+
+/**
+ * @brief Parses a seed_stream= value.
+ *
+ * Only plain non-negative decimal integers that fit 32 bits are taken
+ * (strtoul would wrap "-1" to 4294967295); a trailing comment is allowed.
+ *
+ * @param s Input string.
+ * @param out Output stream number.
+ * @return 0 on success, 1 if the value is invalid.
+ */
+static int parse_stream(const char* s, uint32_t* out)
+{
+    if (!isdigit((unsigned char)s[0])) return 1;
+
+    errno = 0;
+    char* end = NULL;
+    unsigned long long v = strtoull(s, &end, 10);
+    while (isspace((unsigned char)*end)) end++;
+    if (errno == ERANGE || v > UINT32_MAX || (*end != '\0' && *end != '#')) return 1;
+    *out = (uint32_t)v;
+    return 0;
+}
+
 /**
  * @brief Loads configuration values from a file.
  *
@@ -109,19 +183,40 @@ int config_load(const char* path, Config* out_cfg)
     out_cfg->m = 0;                 /* 0 => run all {10,20,30} */
     out_cfg->n = 30;                /* iterations per algorithm run */
     out_cfg->problem_type = 0;      /* 0 => run all {1..10} */
+    out_cfg->plugin_path[0] = '\0';
+    out_cfg->objective[0] = '\0';
     out_cfg->alg = ALG_ALL;         /* run all algorithms */
     out_cfg->neighbors = 30;
     out_cfg->step_frac = 0.05;
     out_cfg->max_ls_steps = 200;
+    out_cfg->neighborhood = NB_FULL;
+    out_cfg->local = LS_SAMPLING;
     out_cfg->output_csv[0] = '\0';
     out_cfg->seed = 0;
-    out_cfg->lower = -100.0;
+    out_cfg->rng = RNG_MT19937;
+    out_cfg->seed_stream = 0;
+    out_cfg->replay = -1;
+    out_cfg->lower = -100.0;        /* NAN (lower=default) => problem's range */
     out_cfg->upper =  100.0;
+    strncpy(out_cfg->isa, "auto", sizeof(out_cfg->isa) - 1);
+    out_cfg->isa[sizeof(out_cfg->isa) - 1] = '\0';
+    out_cfg->threads = 0;           /* 0 => OpenMP default */
+    out_cfg->precision = PRECISION_EXACT;
+    out_cfg->storage = STORAGE_F64;
+    for (int t = 0; t <= PROB_EGG_HOLDER; t++) out_cfg->transform[t] = TRANSFORM_NONE;
+    out_cfg->transform_seed = 1;
+    out_cfg->target = TARGET_NONE;
+    out_cfg->target_value = NAN;
+    out_cfg->cache_resolution = NAN; /* NAN => no cache */
+    out_cfg->cache_mb = 64;
+    strncpy(out_cfg->profile, "project2.profile", sizeof(out_cfg->profile) - 1);
+    out_cfg->profile[sizeof(out_cfg->profile) - 1] = '\0';
 
     FILE* fp = fopen(path, "r");
     if (!fp) return 2;
 
     char line[512];
+    int bad_stream = 0;
     while (fgets(line, sizeof(line), fp)) {
         trim(line);
         if (line[0] == '\0') continue;
@@ -142,8 +237,19 @@ int config_load(const char* path, Config* out_cfg)
         } else if (streqi(key, "n") || streqi(key, "iterations") || streqi(key, "iters")) {
             out_cfg->n = (int)strtol(val, NULL, 10);
         } else if (streqi(key, "problem") || streqi(key, "problem_type")) {
-            if (streqi(val, "all")) out_cfg->problem_type = 0;
-            else out_cfg->problem_type = (int)strtol(val, NULL, 10);
+            if (streqi(val, "all")) {
+                out_cfg->problem_type = 0;
+            } else if (strncmp(val, "plugin:", 7) == 0) {
+                out_cfg->problem_type = PROB_PLUGIN;
+                strncpy(out_cfg->plugin_path, val + 7, sizeof(out_cfg->plugin_path) - 1);
+                out_cfg->plugin_path[sizeof(out_cfg->plugin_path) - 1] = '\0';
+            } else {
+                out_cfg->problem_type = (int)strtol(val, NULL, 10);
+            }
+        } else if (streqi(key, "objective") || streqi(key, "expr")) {
+            out_cfg->problem_type = PROB_EXPR;
+            strncpy(out_cfg->objective, val, sizeof(out_cfg->objective) - 1);
+            out_cfg->objective[sizeof(out_cfg->objective) - 1] = '\0';
         } else if (streqi(key, "algorithm") || streqi(key, "alg")) {
             out_cfg->alg = parse_algorithm(val);
         } else if (streqi(key, "neighbors") || streqi(key, "k")) {
@@ -152,6 +258,16 @@ int config_load(const char* path, Config* out_cfg)
             out_cfg->step_frac = strtod(val, NULL);
         } else if (streqi(key, "max_ls_steps") || streqi(key, "ls_steps")) {
             out_cfg->max_ls_steps = (int)strtol(val, NULL, 10);
+        } else if (streqi(key, "neighborhood") || streqi(key, "neighbourhood")) {
+            if (streqi(val, "coordinate") || streqi(val, "coord"))
+                out_cfg->neighborhood = NB_COORDINATE;
+            else
+                out_cfg->neighborhood = NB_FULL;
+        } else if (streqi(key, "local") || streqi(key, "local_search")) {
+            if (streqi(val, "lbfgs") || streqi(val, "l-bfgs") || streqi(val, "lbfgsb") || streqi(val, "l-bfgs-b"))
+                out_cfg->local = LS_LBFGS;
+            else
+                out_cfg->local = LS_SAMPLING;
         } else if (streqi(key, "output") || streqi(key, "output_csv")) {
             strncpy(out_cfg->output_csv, val, sizeof(out_cfg->output_csv) - 1);
             out_cfg->output_csv[sizeof(out_cfg->output_csv) - 1] = '\0';
@@ -161,22 +277,79 @@ int config_load(const char* path, Config* out_cfg)
             } else {
                 out_cfg->seed = (uint32_t)strtoul(val, NULL, 10);
             }
+        } else if (streqi(key, "seed_stream")) {
+            if (parse_stream(val, &out_cfg->seed_stream) != 0) {
+                fprintf(stderr, "Invalid seed_stream '%s': expected an integer in 0..4294967295\n", val);
+                bad_stream = 1;
+            }
+        } else if (streqi(key, "replay")) {
+            long v = strtol(val, NULL, 10);
+            out_cfg->replay = (v >= 0 && v <= INT_MAX) ? (int)v : -1;
         } else if (streqi(key, "lower") || streqi(key, "min")) {
-            out_cfg->lower = strtod(val, NULL);
+            out_cfg->lower = streqi(val, "default") ? NAN : strtod(val, NULL);
         } else if (streqi(key, "upper") || streqi(key, "max")) {
-            out_cfg->upper = strtod(val, NULL);
+            out_cfg->upper = streqi(val, "default") ? NAN : strtod(val, NULL);
+        } else if (streqi(key, "isa") || streqi(key, "kernel_isa")) {
+            size_t i = 0;
+            for (; val[i] && i < sizeof(out_cfg->isa) - 1; i++)
+                out_cfg->isa[i] = (char)tolower((unsigned char)val[i]);
+            out_cfg->isa[i] = '\0';
+        } else if (streqi(key, "precision")) {
+            if (streqi(val, "fast"))
+                out_cfg->precision = PRECISION_FAST;
+            else
+                out_cfg->precision = PRECISION_EXACT;
+        } else if (streqi(key, "rng")) {
+            if (streqi(val, "dsfmt"))
+                out_cfg->rng = RNG_DSFMT;
+            else if (streqi(val, "philox"))
+                out_cfg->rng = RNG_PHILOX;
+            else
+                out_cfg->rng = RNG_MT19937;
+        } else if (streqi(key, "storage")) {
+            if (streqi(val, "float32") || streqi(val, "float") || streqi(val, "f32"))
+                out_cfg->storage = STORAGE_F32;
+            else
+                out_cfg->storage = STORAGE_F64;
+        } else if (streqi(key, "transform")) {
+            TransformKind kind = parse_transform(val);
+            for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) out_cfg->transform[t] = kind;
+        } else if (strncmp(key, "transform_", 10) == 0 && isdigit((unsigned char)key[10])) {
+            int t = (int)strtol(key + 10, NULL, 10);
+            if (t >= PROB_SCHWEFEL && t <= PROB_EGG_HOLDER) out_cfg->transform[t] = parse_transform(val);
+        } else if (streqi(key, "transform_seed")) {
+            out_cfg->transform_seed = (uint32_t)strtoul(val, NULL, 10);
+        } else if (streqi(key, "target")) {
+            out_cfg->target = parse_target(val, &out_cfg->target_value);
+        } else if (streqi(key, "cache")) {
+            out_cfg->cache_resolution = parse_cache(val);
+        } else if (streqi(key, "cache_mb")) {
+            out_cfg->cache_mb = (int)strtol(val, NULL, 10);
+        } else if (streqi(key, "profile")) {
+            if (streqi(val, "none") || streqi(val, "off")) {
+                out_cfg->profile[0] = '\0';
+            } else {
+                strncpy(out_cfg->profile, val, sizeof(out_cfg->profile) - 1);
+                out_cfg->profile[sizeof(out_cfg->profile) - 1] = '\0';
+            }
+        } else if (streqi(key, "threads") || streqi(key, "num_threads")) {
+            out_cfg->threads = (int)strtol(val, NULL, 10);
         }
     }
     fclose(fp);
+    if (bad_stream) return 3;
 
     /* validation and fallbacks */
     if (out_cfg->n <= 0) out_cfg->n = 30;
     if (out_cfg->neighbors <= 0) out_cfg->neighbors = 30;
     if (out_cfg->step_frac <= 0.0) out_cfg->step_frac = 0.05;
     if (out_cfg->max_ls_steps <= 0) out_cfg->max_ls_steps = 200;
+    if (out_cfg->threads < 0) out_cfg->threads = 0;
+    if (out_cfg->cache_mb <= 0) out_cfg->cache_mb = 64;
     if (out_cfg->seed == 0) out_cfg->seed = (uint32_t)time(NULL);
 
-    if (out_cfg->lower >= out_cfg->upper) {
+    if (!isnan(out_cfg->lower) && !isnan(out_cfg->upper) &&
+        out_cfg->lower >= out_cfg->upper) {
         fprintf(stderr,
                 "Invalid range in config: lower (%.6f) must be < upper (%.6f)\n",
                 out_cfg->lower, out_cfg->upper);
@@ -27,31 +27,6 @@ const char* csv_algorithm_name(AlgorithmType alg)
     }
 }
 
-/**
- * @brief Returns a short name for a problem type.
- *
- * This function is intended for internal CSV formatting only.
- *
- * @param p Problem type identifier.
- * @return Short string representation of the problem.
- */
-static const char* problem_short_name(ProblemType p)
-{
-    switch (p) {
-        case PROB_SCHWEFEL:             return "Schwefel";
-        case PROB_DEJONG1:              return "DeJong1";
-        case PROB_ROSENBROCK:           return "Rosenbrock";
-        case PROB_RASTRIGIN:            return "Rastrigin";
-        case PROB_GRIEWANGK:            return "Griewank";
-        case PROB_SINE_ENV_SINE_WAVE:   return "SineEnv";
-        case PROB_STRETCH_V_SINE_WAVE:  return "StretchV";
-        case PROB_ACKLEY_ONE:           return "Ackley1";
-        case PROB_ACKLEY_TWO:           return "Ackley2";
-        case PROB_EGG_HOLDER:           return "EggHolder";
-        default:                        return "Unknown";
-    }
-}
-
 /**
  * @brief Initializes a CSV results file.
  *
@@ -70,7 +45,7 @@ int csv_init_results(const char* path)
     FILE* fp = fopen(path, "w");
     if (!fp) return 2;
 
-    fprintf(fp, "algorithm,problem,dimension,iteration,fitness,time_ms\n");
+    fprintf(fp, "algorithm,problem,dimension,iteration,fitness,time_ms,rng\n");
     fclose(fp);
     return 0;
 }
@@ -80,35 +55,38 @@ int csv_init_results(const char* path)
  *
  * @param path Path to the CSV output file.
  * @param alg Algorithm identifier.
- * @param problem Problem identifier.
+ * @param problem Problem that was run (its short name is written).
  * @param m Problem dimension.
  * @param iteration Iteration or restart index.
  * @param fitness Fitness value.
  * @param time_ms Runtime in milliseconds.
+ * @param rng Random number engine of the run.
  * @return 0 on success,
  *         1 if path is invalid,
  *         2 if the file cannot be opened.
  */
 int csv_append_result(const char* path,
                       AlgorithmType alg,
-                      ProblemType problem,
+                      const Problem* problem,
                       int m,
                       int iteration,
                       double fitness,
-                      double time_ms)
+                      double time_ms,
+                      RngType rng)
 {
     if (!path || path[0] == '\0') return 1;
 
     FILE* fp = fopen(path, "a");
     if (!fp) return 2;
 
-    fprintf(fp, "%s,%s,%d,%d,%.15g,%.6f\n",
+    fprintf(fp, "%s,%s,%d,%d,%.15g,%.6f,%s\n",
             csv_algorithm_name(alg),
             problem_short_name(problem),
             m,
             iteration,
             fitness,
-            time_ms);
+            time_ms,
+            rng_name(rng));
 
     fclose(fp);
     return 0;
@@ -0,0 +1,188 @@
+/**
+ * @file dispatch.c
+ * @brief Runtime selection of the evaluation kernel variant.
+ *
+ * On x86 the CPU features are queried once (cpuid through the compiler
+ * builtins) and the widest supported KernelTable becomes active. Other
+ * targets have a single generic variant. Every variant also exists as
+ * a fast-precision build, used instead when PRECISION_FAST is set.
+ */
+
+#include "kernels.h"
+#include <stddef.h>
+#include <string.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/** Active kernel table (NULL until the first selection) */
+static const KernelTable* active = NULL;
+
+/** Precision of the tables returned by kernels_active() */
+static EvalPrecision precision = PRECISION_EXACT;
+
+#if defined(KERNEL_DISPATCH_X86)
+
+/**
+ * @brief Reports whether the running CPU supports a kernel variant.
+ *
+ * @param t Kernel table to test.
+ * @return Non-zero if supported.
+ */
+static int cpu_supports(const KernelTable* t)
+{
+    __builtin_cpu_init();
+    if (t == &kernels_avx512) {
+        return __builtin_cpu_supports("avx512f") &&
+               __builtin_cpu_supports("avx512dq") &&
+               __builtin_cpu_supports("avx512vl");
+    }
+    if (t == &kernels_avx2) {
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    }
+    return 1; /* SSE2 is part of x86-64 */
+}
+
+/** Variants from widest to narrowest */
+static const KernelTable* const variants[] = {
+    &kernels_avx512, &kernels_avx2, &kernels_sse2
+};
+
+/** Fast-precision builds, in the same order as variants */
+static const KernelTable* const fast_variants[] = {
+    &kernels_fast_avx512, &kernels_fast_avx2, &kernels_fast_sse2
+};
+
+#else
+
+static int cpu_supports(const KernelTable* t)
+{
+    (void)t;
+    return 1;
+}
+
+static const KernelTable* const variants[] = { &kernels_generic };
+static const KernelTable* const fast_variants[] = { &kernels_fast_generic };
+
+#endif
+
+#define NUM_VARIANTS ((int)(sizeof(variants) / sizeof(variants[0])))
+
+/**
+ * @brief Returns the widest variant supported by the CPU.
+ *
+ * @return Pointer to a KernelTable.
+ */
+static const KernelTable* select_auto(void)
+{
+    for (int i = 0; i < NUM_VARIANTS; i++) {
+        if (cpu_supports(variants[i])) return variants[i];
+    }
+    return variants[NUM_VARIANTS - 1];
+}
+
+/**
+ * @brief Selects the kernel variant to use.
+ *
+ * @param isa Variant name or "auto".
+ * @return 0 on success,
+ *         1 if the name is unknown,
+ *         2 if the CPU does not support the requested variant.
+ */
+int kernels_select(const char* isa)
+{
+    active = select_auto();
+    if (!isa || isa[0] == '\0' || strcmp(isa, "auto") == 0) return 0;
+
+    for (int i = 0; i < NUM_VARIANTS; i++) {
+        if (strcmp(isa, variants[i]->isa) == 0) {
+            if (!cpu_supports(variants[i])) return 2;
+            active = variants[i];
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Returns the name of a kernel variant the CPU supports.
+ *
+ * @param i Index, from 0 (the widest) upwards.
+ * @return Variant name, or NULL past the last supported variant.
+ */
+const char* kernels_variant_name(int i)
+{
+    for (int v = 0; v < NUM_VARIANTS; v++) {
+        if (!cpu_supports(variants[v])) continue;
+        if (i-- == 0) return variants[v]->isa;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Returns the active kernel table.
+ *
+ * @return Pointer to the active KernelTable.
+ */
+const KernelTable* kernels_active(void)
+{
+    if (!active) active = select_auto();
+    if (precision == PRECISION_FAST) {
+        for (int i = 0; i < NUM_VARIANTS; i++) {
+            if (variants[i] == active) return fast_variants[i];
+        }
+    }
+    return active;
+}
+
+/**
+ * @brief Selects exact or fast-precision kernels.
+ *
+ * @param p Precision mode.
+ */
+void kernels_set_precision(EvalPrecision p)
+{
+    precision = (p == PRECISION_FAST) ? PRECISION_FAST : PRECISION_EXACT;
+}
+
+/**
+ * @brief Sets the number of threads used for large-dimension rows.
+ *
+ * @param threads Thread count, or 0 to keep the OpenMP default.
+ */
+void kernels_set_threads(int threads)
+{
+#if defined(_OPENMP)
+    if (threads > 0) omp_set_num_threads(threads);
+#else
+    (void)threads;
+#endif
+}
+
+/**
+ * @brief Returns the number of threads available to the kernels.
+ *
+ * @return Thread count (1 in builds without OpenMP).
+ */
+int kernels_threads(void)
+{
+#if defined(_OPENMP)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief Returns the number of processors the kernels could use.
+ *
+ * @return Processor count (1 in builds without OpenMP).
+ */
+int kernels_cpus(void)
+{
+#if defined(_OPENMP)
+    return omp_get_num_procs();
+#else
+    return 1;
+#endif
+}
@@ -0,0 +1,208 @@
+/**
+ * @file evalcache.c
+ * @brief Open-addressing memo cache of fitness values.
+ *
+ * Keys are built in a scratch buffer, hashed word by word and compared
+ * in full against a slot before it counts as a hit, so a hash
+ * collision never returns the wrong value.
+ */
+
+#include "evalcache.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Bytes of one slot for dimension m.
+ */
+static size_t slot_bytes(int m)
+{
+    return (size_t)m * sizeof(uint64_t) + sizeof(uint64_t) + sizeof(double);
+}
+
+/**
+ * @brief Writes a zero byte to every page of an allocation.
+ *
+ * Goes through a volatile pointer because a plain memset() after
+ * malloc() may be turned into a lazily mapped calloc(). Only used on
+ * calloc() memory or memory whose contents do not matter yet.
+ *
+ * @param p Allocation.
+ * @param bytes Its size.
+ */
+static void prefault(void* p, size_t bytes)
+{
+    volatile unsigned char* b = (volatile unsigned char*)p;
+    for (size_t i = 0; i < bytes; i += 4096) b[i] = 0;
+}
+
+/**
+ * @brief Allocates a cache.
+ *
+ * @param c Cache to initialize.
+ * @param m Dimension of the vectors.
+ * @param resolution Quantization step of the keys, or 0 for exact keys.
+ * @param max_bytes Memory budget for the slots.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure.
+ */
+int evalcache_init(EvalCache* c, int m, double resolution, size_t max_bytes)
+{
+    if (!c || m <= 0 || !(resolution >= 0.0) || isinf(resolution)) return 1;
+
+    size_t slots = 16;
+    while (slots * 2 <= max_bytes / slot_bytes(m) && slots * 2 <= ((size_t)1 << 40)) slots *= 2;
+
+    c->m = m;
+    c->inv_res = (resolution > 0.0) ? 1.0 / resolution : 0.0;
+    c->mask = slots - 1;
+    c->keys = (uint64_t*)malloc(slots * (size_t)m * sizeof(uint64_t));
+    c->hashes = (uint64_t*)calloc(slots, sizeof(uint64_t));
+    c->values = (double*)malloc(slots * sizeof(double));
+    c->key = (uint64_t*)malloc((size_t)m * sizeof(uint64_t));
+    c->hits = 0.0;
+    c->misses = 0.0;
+    if (!c->keys || !c->hashes || !c->values || !c->key) {
+        evalcache_free(c);
+        return 2;
+    }
+
+    /* fault the pages in now so the search is not charged for them */
+    prefault(c->keys, slots * (size_t)m * sizeof(uint64_t));
+    prefault(c->hashes, slots * sizeof(uint64_t));
+    prefault(c->values, slots * sizeof(double));
+    return 0;
+}
+
+/**
+ * @brief Frees a cache.
+ *
+ * @param c Cache to free.
+ */
+void evalcache_free(EvalCache* c)
+{
+    if (!c) return;
+
+    free(c->keys);
+    free(c->hashes);
+    free(c->values);
+    free(c->key);
+    c->keys = NULL;
+    c->hashes = NULL;
+    c->values = NULL;
+    c->key = NULL;
+}
+
+/**
+ * @brief Builds the key of x in c->key and returns its hash.
+ *
+ * A quantized coordinate is stored as the bit pattern of the rounded
+ * multiple (an integer-valued double), which is exact for any
+ * magnitude. The hash mixes every word with a multiply-rotate step and
+ * finishes with the splitmix64 finalizer; 0 is reserved for empty
+ * slots.
+ *
+ * @param c Cache.
+ * @param x Vector (m values).
+ * @return Non-zero hash of the key.
+ */
+static uint64_t make_key(EvalCache* c, const double* x)
+{
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ (uint64_t)c->m;
+
+    for (int j = 0; j < c->m; j++) {
+        double v = (c->inv_res > 0.0) ? nearbyint(x[j] * c->inv_res) : x[j];
+        if (v == 0.0) v = 0.0; /* -0.0 and 0.0 share a key */
+        uint64_t w;
+        memcpy(&w, &v, sizeof(w));
+        c->key[j] = w;
+        h = (h ^ w) * 0xff51afd7ed558ccdULL;
+        h = (h << 31) | (h >> 33);
+    }
+
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h ? h : 1;
+}
+
+/**
+ * @brief Looks up the fitness of a vector.
+ *
+ * @param c Cache.
+ * @param x Vector (m values).
+ * @param f_out Output fitness on a hit.
+ * @return 1 on a hit, 0 on a miss.
+ */
+int evalcache_lookup(EvalCache* c, const double* x, double* f_out)
+{
+    uint64_t h = make_key(c, x);
+    size_t len = (size_t)c->m * sizeof(uint64_t);
+
+    for (size_t p = 0; p < EVALCACHE_PROBES; p++) {
+        size_t s = (h + p) & c->mask;
+        if (c->hashes[s] == 0) break;
+        if (c->hashes[s] == h && memcmp(c->keys + s * (size_t)c->m, c->key, len) == 0) {
+            *f_out = c->values[s];
+            c->hits += 1.0;
+            return 1;
+        }
+    }
+    c->misses += 1.0;
+    return 0;
+}
+
+/**
+ * @brief Stores the fitness of a vector.
+ *
+ * Uses the first empty slot of the probe window (or the slot already
+ * holding this key); if the window is full the home slot is replaced.
+ *
+ * @param c Cache.
+ * @param x Vector (m values).
+ * @param f Fitness of x.
+ */
+void evalcache_insert(EvalCache* c, const double* x, double f)
+{
+    uint64_t h = make_key(c, x);
+    size_t len = (size_t)c->m * sizeof(uint64_t);
+    size_t slot = h & c->mask;
+
+    for (size_t p = 0; p < EVALCACHE_PROBES; p++) {
+        size_t s = (h + p) & c->mask;
+        if (c->hashes[s] == 0 ||
+            (c->hashes[s] == h && memcmp(c->keys + s * (size_t)c->m, c->key, len) == 0)) {
+            slot = s;
+            break;
+        }
+    }
+
+    memcpy(c->keys + slot * (size_t)c->m, c->key, len);
+    c->hashes[slot] = h;
+    c->values[slot] = f;
+}
+
+/**
+ * @brief Returns the number of slots.
+ *
+ * @param c Cache.
+ * @return Slot count.
+ */
+size_t evalcache_slots(const EvalCache* c)
+{
+    return c->mask + 1;
+}
+
+/**
+ * @brief Returns the memory used by the slots.
+ *
+ * @param c Cache.
+ * @return Size in bytes.
+ */
+size_t evalcache_bytes(const EvalCache* c)
+{
+    return evalcache_slots(c) * slot_bytes(c->m);
+}
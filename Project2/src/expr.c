@@ -0,0 +1,797 @@
+/**
+ * @file expr.c
+ * @brief Compiler for objective= expressions.
+ *
+ * A recursive-descent parser builds a small syntax tree (folding
+ * constant subexpressions as it goes), and a code generator turns the
+ * tree into register bytecode. Registers are allocated as a stack: the
+ * value of a subexpression at depth r lands in register r, so the
+ * register count is the depth of the tree. The interpreter itself is
+ * compiled per ISA in expr_kernels.c; this file only holds the scalar libm
+ * reference interpreter.
+ */
+
+#include "expr.h"
+#include "kernels.h"
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/** Maximum number of syntax tree nodes. */
+#define EXPR_MAX_NODES 512
+
+/** Largest |c| accepted in x[c] and x[i+c]. */
+#define EXPR_MAX_INDEX 1000000
+
+/**
+ * @brief Syntax tree node kinds.
+ */
+typedef enum {
+    NODE_NUM,    /**< Constant (value) */
+    NODE_X,      /**< x[i + imm] */
+    NODE_XAT,    /**< x[imm] */
+    NODE_INDEX,  /**< i */
+    NODE_DIM,    /**< m */
+    NODE_UNARY,  /**< op(a) */
+    NODE_BINARY, /**< a op b */
+    NODE_REDUCE  /**< sum(a) or prod(a); imm = reduction number once generated */
+} NodeKind;
+
+/**
+ * @brief Syntax tree node.
+ */
+typedef struct {
+    NodeKind kind; /**< Node kind */
+    ExprOp op;     /**< Operation of unary/binary nodes */
+    int a;         /**< First child */
+    int b;         /**< Second child */
+    int product;   /**< prod() rather than sum() */
+    int imm;       /**< Offset, coordinate or reduction number */
+    double value;  /**< Value of constants */
+} Node;
+
+/**
+ * @brief Parser and code generator state.
+ */
+typedef struct {
+    const char* src;             /**< Start of the text (for error columns) */
+    const char* pos;             /**< Current position */
+    Node nodes[EXPR_MAX_NODES];  /**< Syntax tree */
+    int nnodes;                  /**< Nodes used */
+    int in_reduce;               /**< Parsing inside sum()/prod() */
+    int failed;                  /**< An error was reported */
+    ExprProgram* prog;           /**< Program being generated */
+    int reduce;                  /**< Reduction being generated, or -1 */
+} Compiler;
+
+/** Message of the last failed expr_compile(). */
+static char expr_msg[160] = "no error";
+
+/** Program evaluated by PROB_EXPR descriptors. */
+static ExprProgram* bound_prog = NULL;
+
+/** Interpreter bound by expr_problem(). */
+static ExprRunFn bound_run = NULL;
+
+/**
+ * @brief Records the first error of a compilation.
+ *
+ * @param c Compiler.
+ * @param msg Message.
+ */
+static void fail(Compiler* c, const char* msg)
+{
+    if (c->failed) return;
+    c->failed = 1;
+    snprintf(expr_msg, sizeof(expr_msg), "column %d: %s",
+             (int)(c->pos - c->src) + 1, msg);
+}
+
+/**
+ * @brief Applies an operation to scalars.
+ *
+ * Used for constant folding and by the reference interpreter.
+ *
+ * @param op Operation (arithmetic or function).
+ * @param a First operand.
+ * @param b Second operand (binary operations).
+ * @return Result.
+ */
+static double apply(ExprOp op, double a, double b)
+{
+    switch (op) {
+        case EXPR_OP_ADD:
+        case EXPR_OP_ADDK:   return a + b;
+        case EXPR_OP_SUB:    return a - b;
+        case EXPR_OP_MUL:
+        case EXPR_OP_MULK:   return a * b;
+        case EXPR_OP_DIV:    return a / b;
+        case EXPR_OP_POW:
+        case EXPR_OP_POWK:   return pow(a, b);
+        case EXPR_OP_SQUARE: return a * a;
+        case EXPR_OP_NEG:    return -a;
+        case EXPR_OP_ABS:    return fabs(a);
+        case EXPR_OP_SQRT:   return sqrt(a);
+        case EXPR_OP_SIN:    return sin(a);
+        case EXPR_OP_COS:    return cos(a);
+        case EXPR_OP_TAN:    return tan(a);
+        case EXPR_OP_EXP:    return exp(a);
+        case EXPR_OP_LOG:    return log(a);
+        default:             return NAN;
+    }
+}
+
+/**
+ * @brief Adds a node to the tree.
+ *
+ * @param c Compiler.
+ * @param kind Node kind.
+ * @return Node index, or -1 if the tree is full.
+ */
+static int new_node(Compiler* c, NodeKind kind)
+{
+    if (c->nnodes >= EXPR_MAX_NODES) {
+        fail(c, "expression too long");
+        return -1;
+    }
+    Node* n = &c->nodes[c->nnodes];
+    memset(n, 0, sizeof(*n));
+    n->kind = kind;
+    n->a = -1;
+    n->b = -1;
+    return c->nnodes++;
+}
+
+/**
+ * @brief Adds a constant node.
+ */
+static int num_node(Compiler* c, double v)
+{
+    int n = new_node(c, NODE_NUM);
+    if (n >= 0) c->nodes[n].value = v;
+    return n;
+}
+
+/**
+ * @brief Adds a unary node, folding it if the operand is constant.
+ */
+static int unary_node(Compiler* c, ExprOp op, int a)
+{
+    if (a < 0) return -1;
+    if (c->nodes[a].kind == NODE_NUM) return num_node(c, apply(op, c->nodes[a].value, 0.0));
+
+    int n = new_node(c, NODE_UNARY);
+    if (n < 0) return -1;
+    c->nodes[n].op = op;
+    c->nodes[n].a = a;
+    return n;
+}
+
+/**
+ * @brief Adds a binary node, folding it if both operands are constant.
+ */
+static int binary_node(Compiler* c, ExprOp op, int a, int b)
+{
+    if (a < 0 || b < 0) return -1;
+    if (c->nodes[a].kind == NODE_NUM && c->nodes[b].kind == NODE_NUM) {
+        return num_node(c, apply(op, c->nodes[a].value, c->nodes[b].value));
+    }
+
+    int n = new_node(c, NODE_BINARY);
+    if (n < 0) return -1;
+    c->nodes[n].op = op;
+    c->nodes[n].a = a;
+    c->nodes[n].b = b;
+    return n;
+}
+
+/**
+ * @brief Skips whitespace.
+ */
+static void skip_space(Compiler* c)
+{
+    while (isspace((unsigned char)*c->pos)) c->pos++;
+}
+
+/**
+ * @brief Consumes character ch (after whitespace) if it is next.
+ *
+ * @return 1 if consumed, 0 otherwise.
+ */
+static int accept(Compiler* c, char ch)
+{
+    skip_space(c);
+    if (*c->pos != ch) return 0;
+    c->pos++;
+    return 1;
+}
+
+/**
+ * @brief Consumes character ch or reports what was expected.
+ */
+static void expect(Compiler* c, char ch, const char* msg)
+{
+    if (!accept(c, ch)) fail(c, msg);
+}
+
+/**
+ * @brief Reads an integer for x[...].
+ *
+ * @param c Compiler.
+ * @param out Output value.
+ * @return 0 on success, -1 on error.
+ */
+static int parse_int(Compiler* c, int* out)
+{
+    skip_space(c);
+    if (!isdigit((unsigned char)*c->pos)) {
+        fail(c, "expected an integer index");
+        return -1;
+    }
+    char* end = NULL;
+    long v = strtol(c->pos, &end, 10);
+    if (v > EXPR_MAX_INDEX) {
+        fail(c, "index too large");
+        return -1;
+    }
+    c->pos = end;
+    *out = (int)v;
+    return 0;
+}
+
+static int parse_expr(Compiler* c);
+
+/**
+ * @brief Parses the index of x[...] after the '['.
+ */
+static int parse_index(Compiler* c)
+{
+    skip_space(c);
+    if (*c->pos == 'i' && !isalnum((unsigned char)c->pos[1]) && c->pos[1] != '_') {
+        if (!c->in_reduce) {
+            fail(c, "x[i] is only defined inside sum() or prod()");
+            return -1;
+        }
+        c->pos++;
+        int off = 0;
+        if (accept(c, '+')) {
+            if (parse_int(c, &off) != 0) return -1;
+        } else if (accept(c, '-')) {
+            if (parse_int(c, &off) != 0) return -1;
+            off = -off;
+        }
+        int n = new_node(c, NODE_X);
+        if (n >= 0) c->nodes[n].imm = off;
+        return n;
+    }
+
+    int idx = 0;
+    if (parse_int(c, &idx) != 0) return -1;
+    int n = new_node(c, NODE_XAT);
+    if (n >= 0) c->nodes[n].imm = idx;
+    return n;
+}
+
+/**
+ * @brief primary := number | '(' expr ')' | name | name '(' expr ')' | 'x' '[' index ']'
+ */
+static int parse_primary(Compiler* c)
+{
+    skip_space(c);
+    const char* start = c->pos;
+
+    if (isdigit((unsigned char)*start) || *start == '.') {
+        char* end = NULL;
+        double v = strtod(start, &end);
+        if (end == start) {
+            fail(c, "malformed number");
+            return -1;
+        }
+        c->pos = end;
+        return num_node(c, v);
+    }
+
+    if (accept(c, '(')) {
+        int n = parse_expr(c);
+        expect(c, ')', "expected ')'");
+        return n;
+    }
+
+    if (!isalpha((unsigned char)*start) && *start != '_') {
+        fail(c, *start ? "unexpected character" : "unexpected end of expression");
+        return -1;
+    }
+
+    while (isalnum((unsigned char)*c->pos) || *c->pos == '_') c->pos++;
+    size_t len = (size_t)(c->pos - start);
+#define NAME_IS(s) (len == sizeof(s) - 1 && strncmp(start, s, len) == 0)
+
+    if (NAME_IS("x")) {
+        expect(c, '[', "expected '[' after x");
+        int n = parse_index(c);
+        expect(c, ']', "expected ']'");
+        return n;
+    }
+    if (NAME_IS("pi")) return num_node(c, M_PI);
+    if (NAME_IS("e")) return num_node(c, exp(1.0));
+    if (NAME_IS("m")) return new_node(c, NODE_DIM);
+    if (NAME_IS("i")) {
+        if (!c->in_reduce) {
+            c->pos = start;
+            fail(c, "i is only defined inside sum() or prod()");
+            return -1;
+        }
+        return new_node(c, NODE_INDEX);
+    }
+
+    if (NAME_IS("sum") || NAME_IS("prod")) {
+        int product = NAME_IS("prod");
+        if (c->in_reduce) {
+            c->pos = start;
+            fail(c, "sum() and prod() cannot be nested");
+            return -1;
+        }
+        expect(c, '(', "expected '(' after sum/prod");
+        c->in_reduce = 1;
+        int body = parse_expr(c);
+        c->in_reduce = 0;
+        expect(c, ')', "expected ')'");
+        if (body < 0) return -1;
+        int n = new_node(c, NODE_REDUCE);
+        if (n >= 0) {
+            c->nodes[n].a = body;
+            c->nodes[n].product = product;
+        }
+        return n;
+    }
+
+    ExprOp op;
+    if (NAME_IS("sin")) op = EXPR_OP_SIN;
+    else if (NAME_IS("cos")) op = EXPR_OP_COS;
+    else if (NAME_IS("tan")) op = EXPR_OP_TAN;
+    else if (NAME_IS("exp")) op = EXPR_OP_EXP;
+    else if (NAME_IS("log")) op = EXPR_OP_LOG;
+    else if (NAME_IS("sqrt")) op = EXPR_OP_SQRT;
+    else if (NAME_IS("abs")) op = EXPR_OP_ABS;
+    else {
+        c->pos = start;
+        fail(c, "unknown name");
+        return -1;
+    }
+#undef NAME_IS
+
+    expect(c, '(', "expected '(' after function name");
+    int a = parse_expr(c);
+    expect(c, ')', "expected ')'");
+    return unary_node(c, op, a);
+}
+
+static int parse_unary(Compiler* c);
+
+/**
+ * @brief power := primary [('^' | '**') unary]
+ */
+static int parse_power(Compiler* c)
+{
+    int a = parse_primary(c);
+    skip_space(c);
+    if (*c->pos == '^' || (c->pos[0] == '*' && c->pos[1] == '*')) {
+        c->pos += (*c->pos == '^') ? 1 : 2;
+        int b = parse_unary(c);
+        return binary_node(c, EXPR_OP_POW, a, b);
+    }
+    return a;
+}
+
+/**
+ * @brief unary := '-' unary | '+' unary | power
+ */
+static int parse_unary(Compiler* c)
+{
+    if (accept(c, '-')) return unary_node(c, EXPR_OP_NEG, parse_unary(c));
+    if (accept(c, '+')) return parse_unary(c);
+    return parse_power(c);
+}
+
+/**
+ * @brief term := unary (('*' | '/') unary)*
+ */
+static int parse_term(Compiler* c)
+{
+    int a = parse_unary(c);
+    for (;;) {
+        skip_space(c);
+        if (c->pos[0] == '*' && c->pos[1] != '*') {
+            c->pos++;
+            a = binary_node(c, EXPR_OP_MUL, a, parse_unary(c));
+        } else if (c->pos[0] == '/') {
+            c->pos++;
+            a = binary_node(c, EXPR_OP_DIV, a, parse_unary(c));
+        } else {
+            return a;
+        }
+    }
+}
+
+/**
+ * @brief expr := term (('+' | '-') term)*
+ */
+static int parse_expr(Compiler* c)
+{
+    int a = parse_term(c);
+    for (;;) {
+        if (accept(c, '+')) a = binary_node(c, EXPR_OP_ADD, a, parse_term(c));
+        else if (accept(c, '-')) a = binary_node(c, EXPR_OP_SUB, a, parse_term(c));
+        else return a;
+    }
+}
+
+/**
+ * @brief Appends an instruction.
+ */
+static void emit(Compiler* c, ExprOp op, int dst, int a, int b, int imm)
+{
+    ExprProgram* p = c->prog;
+    if (p->ncode >= EXPR_MAX_CODE) {
+        fail(c, "expression needs too many instructions");
+        return;
+    }
+    ExprInstr* in = &p->code[p->ncode++];
+    in->op = (uint8_t)op;
+    in->dst = (uint8_t)dst;
+    in->a = (uint8_t)a;
+    in->b = (uint8_t)b;
+    in->imm = imm;
+}
+
+/**
+ * @brief Returns the pool index of a constant, adding it if new.
+ */
+static int add_const(Compiler* c, double v)
+{
+    ExprProgram* p = c->prog;
+    for (int j = 0; j < p->nconsts; j++) {
+        if (memcmp(&p->consts[j], &v, sizeof(v)) == 0) return j;
+    }
+    if (p->nconsts >= EXPR_MAX_CONSTS) {
+        fail(c, "expression has too many constants");
+        return 0;
+    }
+    p->consts[p->nconsts] = v;
+    return p->nconsts++;
+}
+
+/**
+ * @brief Generates code leaving the value of a node in register r.
+ *
+ * A constant operand of +, -, * or ^ becomes an immediate (x - c is
+ * generated as x + (-c), which rounds identically); x^2 is a multiply.
+ */
+static void gen(Compiler* c, int node, int r)
+{
+    if (c->failed) return;
+    if (r >= EXPR_MAX_REGS) {
+        fail(c, "expression nested too deeply");
+        return;
+    }
+    if (r + 1 > c->prog->nregs) c->prog->nregs = r + 1;
+
+    const Node* n = &c->nodes[node];
+    switch (n->kind) {
+        case NODE_NUM:
+            emit(c, EXPR_OP_CONST, r, r, r, add_const(c, n->value));
+            return;
+        case NODE_X: {
+            ExprReduce* red = &c->prog->reduce[c->reduce];
+            if (n->imm < red->lo_off) red->lo_off = n->imm;
+            if (n->imm > red->hi_off) red->hi_off = n->imm;
+            emit(c, EXPR_OP_X, r, r, r, n->imm);
+            return;
+        }
+        case NODE_XAT:
+            emit(c, EXPR_OP_XAT, r, r, r, n->imm);
+            return;
+        case NODE_INDEX:
+            emit(c, EXPR_OP_INDEX, r, r, r, 0);
+            return;
+        case NODE_DIM:
+            emit(c, EXPR_OP_DIM, r, r, r, 0);
+            return;
+        case NODE_REDUCE:
+            emit(c, EXPR_OP_REDUCE, r, r, r, n->imm);
+            return;
+        case NODE_UNARY:
+            gen(c, n->a, r);
+            emit(c, n->op, r, r, r, 0);
+            return;
+        case NODE_BINARY:
+            break;
+    }
+
+    const Node* a = &c->nodes[n->a];
+    const Node* b = &c->nodes[n->b];
+    int commutes = (n->op == EXPR_OP_ADD || n->op == EXPR_OP_MUL);
+    ExprOp k_op = (n->op == EXPR_OP_MUL) ? EXPR_OP_MULK : EXPR_OP_ADDK;
+
+    if (commutes && a->kind == NODE_NUM) {
+        gen(c, n->b, r);
+        emit(c, k_op, r, r, r, add_const(c, a->value));
+    } else if (commutes && b->kind == NODE_NUM) {
+        gen(c, n->a, r);
+        emit(c, k_op, r, r, r, add_const(c, b->value));
+    } else if (n->op == EXPR_OP_SUB && b->kind == NODE_NUM) {
+        gen(c, n->a, r);
+        emit(c, EXPR_OP_ADDK, r, r, r, add_const(c, -b->value));
+    } else if (n->op == EXPR_OP_POW && b->kind == NODE_NUM) {
+        gen(c, n->a, r);
+        if (b->value == 2.0) emit(c, EXPR_OP_SQUARE, r, r, r, 0);
+        else emit(c, EXPR_OP_POWK, r, r, r, add_const(c, b->value));
+    } else {
+        gen(c, n->a, r);
+        gen(c, n->b, r + 1);
+        emit(c, n->op, r, r, r + 1, 0);
+    }
+}
+
+/**
+ * @brief Generates the body of every reduction below a node.
+ *
+ * Bodies are placed before the top-level code and numbered in the
+ * order they appear.
+ */
+static void gen_reductions(Compiler* c, int node)
+{
+    if (node < 0 || c->failed) return;
+
+    Node* n = &c->nodes[node];
+    if (n->kind != NODE_REDUCE) {
+        gen_reductions(c, n->a);
+        gen_reductions(c, n->b);
+        return;
+    }
+
+    ExprProgram* p = c->prog;
+    if (p->nreduce >= EXPR_MAX_REDUCE) {
+        fail(c, "expression has too many sum()/prod() terms");
+        return;
+    }
+    n->imm = p->nreduce++;
+    ExprReduce* red = &p->reduce[n->imm];
+    red->begin = p->ncode;
+    red->product = n->product;
+    red->lo_off = 0;
+    red->hi_off = 0;
+    red->result = 0;
+
+    c->reduce = n->imm;
+    gen(c, n->a, 0);
+    c->reduce = -1;
+    red->end = p->ncode;
+}
+
+/**
+ * @brief Compiles an expression.
+ *
+ * @param src Expression text.
+ * @param out Output program; release with expr_free().
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure,
+ *         3 on a syntax error or an expression over the size limits.
+ */
+int expr_compile(const char* src, ExprProgram** out)
+{
+    if (!src || !out) return 1;
+    *out = NULL;
+
+    ExprProgram* p = (ExprProgram*)calloc(1, sizeof(ExprProgram));
+    Compiler* c = (Compiler*)calloc(1, sizeof(Compiler));
+    if (!p || !c) {
+        free(p);
+        free(c);
+        return 2;
+    }
+
+    strncpy(p->source, src, sizeof(p->source) - 1);
+    c->src = src;
+    c->pos = src;
+    c->prog = p;
+    c->reduce = -1;
+
+    int root = parse_expr(c);
+    skip_space(c);
+    if (*c->pos != '\0') fail(c, "unexpected character");
+    if (root < 0) fail(c, "empty expression");
+
+    if (!c->failed) {
+        gen_reductions(c, root);
+        p->top_begin = p->ncode;
+        p->top_result = 0;
+        gen(c, root, 0);
+    }
+
+    int failed = c->failed;
+    free(c);
+    if (failed) {
+        free(p);
+        return 3;
+    }
+
+    p->regs = (double*)malloc((size_t)(EXPR_MAX_REGS + 1) * EXPR_LANES * sizeof(double));
+    p->acc = (double*)malloc((size_t)EXPR_MAX_REDUCE * EXPR_LANES * sizeof(double));
+    if (!p->regs || !p->acc) {
+        expr_free(p);
+        return 2;
+    }
+
+    *out = p;
+    return 0;
+}
+
+/**
+ * @brief Frees a compiled expression.
+ *
+ * @param prog Program from expr_compile(), or NULL.
+ */
+void expr_free(ExprProgram* prog)
+{
+    if (!prog) return;
+    if (bound_prog == prog) bound_prog = NULL;
+
+    free(prog->regs);
+    free(prog->acc);
+    free(prog);
+}
+
+/**
+ * @brief Returns the message of the last failed expr_compile().
+ *
+ * @return Error text; never NULL.
+ */
+const char* expr_error(void)
+{
+    return expr_msg;
+}
+
+/**
+ * @brief Runs instructions [begin, end) on scalars with libm.
+ *
+ * @param p Program.
+ * @param r Registers.
+ * @param begin First instruction.
+ * @param end One past the last instruction.
+ * @param x Input vector.
+ * @param m Dimension.
+ * @param i Coordinate index of a reduction body.
+ * @param acc Reduction results (top level).
+ */
+static void run_scalar(const ExprProgram* p, double* r, int begin, int end,
+                       const double* x, int m, int i, const double* acc)
+{
+    for (int pc = begin; pc < end; pc++) {
+        const ExprInstr* in = &p->code[pc];
+        switch ((ExprOp)in->op) {
+            case EXPR_OP_CONST:  r[in->dst] = p->consts[in->imm]; break;
+            case EXPR_OP_X:      r[in->dst] = x[i + in->imm]; break;
+            case EXPR_OP_XAT:    r[in->dst] = (in->imm < m) ? x[in->imm] : NAN; break;
+            case EXPR_OP_INDEX:  r[in->dst] = (double)i; break;
+            case EXPR_OP_DIM:    r[in->dst] = (double)m; break;
+            case EXPR_OP_REDUCE: r[in->dst] = acc[in->imm]; break;
+            case EXPR_OP_ADDK:
+            case EXPR_OP_MULK:
+            case EXPR_OP_POWK:
+                r[in->dst] = apply((ExprOp)in->op, r[in->a], p->consts[in->imm]);
+                break;
+            default:
+                r[in->dst] = apply((ExprOp)in->op, r[in->a], r[in->b]);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Evaluates a program with plain libm calls, one value at a time.
+ *
+ * @param prog Compiled program.
+ * @param x Input vector.
+ * @param m Dimension.
+ * @return Fitness value, or NAN if inputs are invalid.
+ */
+double expr_eval_reference(const ExprProgram* prog, const double* x, int m)
+{
+    if (!prog || !x || m <= 0) return NAN;
+
+    double r[EXPR_MAX_REGS];
+    double acc[EXPR_MAX_REDUCE];
+
+    for (int s = 0; s < prog->nreduce; s++) {
+        const ExprReduce* red = &prog->reduce[s];
+        acc[s] = red->product ? 1.0 : 0.0;
+        for (int i = -red->lo_off; i < m - red->hi_off; i++) {
+            run_scalar(prog, r, red->begin, red->end, x, m, i, acc);
+            if (red->product) acc[s] *= r[red->result];
+            else acc[s] += r[red->result];
+        }
+    }
+
+    run_scalar(prog, r, prog->top_begin, prog->ncode, x, m, 0, acc);
+    return r[prog->top_result];
+}
+
+/**
+ * @brief Batch evaluation of the bound program.
+ */
+static void bound_batch(const double* X, int k, int m, double* f_out)
+{
+    if (!bound_prog) {
+        for (int r = 0; r < k; r++) f_out[r] = NAN;
+        return;
+    }
+    bound_run(bound_prog, X, k, m, f_out);
+}
+
+/**
+ * @brief Scalar evaluation of the bound program.
+ */
+static double bound_eval(const double* x, int m)
+{
+    double f;
+    bound_batch(x, 1, m, &f);
+    return f;
+}
+
+/**
+ * @brief Evaluates the bound program with libm.
+ *
+ * @param x Input vector.
+ * @param m Dimension.
+ * @return Fitness value, or NAN if no program is bound.
+ */
+double expr_bound_reference(const double* x, int m)
+{
+    return expr_eval_reference(bound_prog, x, m);
+}
+
+/**
+ * @brief Builds a Problem descriptor that evaluates a program.
+ *
+ * @param prog Compiled program.
+ * @param lower Default lower bound.
+ * @param upper Default upper bound.
+ * @param out Output problem descriptor.
+ * @return 0 on success, 1 on invalid arguments.
+ */
+int expr_problem(ExprProgram* prog, double lower, double upper, Problem* out)
+{
+    if (!prog || !out || !(lower < upper)) return 1;
+
+    bound_prog = prog;
+    bound_run = kernels_active()->expr;
+
+    Problem p;
+    p.type = PROB_EXPR;
+    p.name = prog->source;
+    p.short_name = "Expr";
+    p.lower = lower;
+    p.upper = upper;
+    p.separable = 0;
+    p.optimum = NAN;
+    p.optimum_tol = NAN;
+    /* the fast vecmath bound per function; cancellation can amplify it */
+    p.fast_err = 1e-9;
+    p.eval = bound_eval;
+    p.eval_batch = bound_batch;
+    p.eval_delta = NULL;
+    p.eval_bounded = NULL;
+    p.eval_batch_f32 = NULL;
+    p.eval_grad = NULL;
+    p.transform = NULL;
+    *out = p;
+    return 0;
+}
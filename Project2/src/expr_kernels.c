@@ -0,0 +1,254 @@
+/**
+ * @file expr_kernels.c
+ * @brief Interpreter for objective= expressions (expr.c compiles them).
+ *
+ * Like kernels.c, this file is compiled once per instruction-set
+ * variant and precision; each build exports one interpreter
+ * (EXPR_BATCH_NAME) that the KernelTable of the same build points to.
+ * It is a separate translation unit so the interpreter's vecmath calls
+ * do not change how the problem kernels are inlined.
+ *
+ * Every instruction runs over a whole register of lanes before the
+ * next one starts, so the switch below is taken once per instruction
+ * and block, and each case is a plain loop or vecmath call that
+ * vectorizes for this ISA. The lanes of a reduction body are
+ * consecutive (row, coordinate) pairs of the block, so a register is
+ * filled even when rows are short; the top level then runs with one
+ * lane per row. Terms are accumulated per row in coordinate order, so
+ * the result does not depend on k or the ISA beyond the vecmath error.
+ */
+
+#include "expr.h"
+#if defined(KERNEL_FAST)
+#define VM_FAST
+#endif
+#include "vecmath.h"
+#include <math.h>
+#include <stddef.h>
+
+#ifndef KERNEL_ISA
+#define KERNEL_ISA generic
+#endif
+
+/**
+ * @brief Applies a vecmath routine to one register.
+ *
+ * @param op EXPR_OP_SQRT, _SIN, _COS, _EXP, _LOG or _POWK.
+ * @param x Input register.
+ * @param e Exponent of EXPR_OP_POWK.
+ * @param y Output register (must not alias x).
+ * @param n Number of lanes.
+ */
+static void expr_vecmath(ExprOp op, const double* x, double e, double* y, int n)
+{
+    switch (op) {
+        case EXPR_OP_SQRT: vm_sqrt(x, y, n); break;
+        case EXPR_OP_SIN:  vm_sin(x, y, n); break;
+        case EXPR_OP_COS:  vm_cos(x, y, n); break;
+        case EXPR_OP_EXP:  vm_exp(x, y, n); break;
+        case EXPR_OP_LOG:  vm_log(x, y, n); break;
+        default:           vm_pow(x, e, y, n); break;
+    }
+}
+
+/**
+ * @brief Position of the first lane of a block in the (row, i) walk.
+ *
+ * Lanes run through i = i0..i1-1 of one row, then continue with i0 of
+ * the next row. The top level uses i0 = 0, i1 = 1: one lane per row.
+ */
+typedef struct {
+    int row; /**< Row of the first lane */
+    int col; /**< Coordinate index of the first lane */
+    int i0;  /**< First index of every row */
+    int i1;  /**< One past the last index of every row */
+} LanePos;
+
+/**
+ * @brief Runs instructions [begin, end) of a program over n lanes.
+ *
+ * The lanes of one row form a segment, so coordinate loads are
+ * contiguous copies per segment. vecmath routines need distinct input
+ * and output arrays, so they write to the spare register
+ * R[EXPR_MAX_REGS], which then swaps places with the destination.
+ *
+ * @param p Program.
+ * @param R Register pointers (EXPR_MAX_REGS + 1 blocks of EXPR_LANES).
+ * @param begin First instruction.
+ * @param end One past the last instruction.
+ * @param n Number of lanes.
+ * @param X Block of row-major vectors.
+ * @param m Dimension.
+ * @param pos Position of lane 0.
+ */
+static void expr_exec(ExprProgram* p, double** R, int begin, int end, int n,
+                      const double* X, int m, const LanePos* pos)
+{
+    double* tmp;
+
+    for (int pc = begin; pc < end; pc++) {
+        const ExprInstr* in = &p->code[pc];
+        double* d = R[in->dst];
+        const double* a = R[in->a];
+        const double* b = R[in->b];
+        int swap = 0;
+
+        switch ((ExprOp)in->op) {
+            case EXPR_OP_CONST: {
+                double c = p->consts[in->imm];
+                for (int l = 0; l < n; l++) d[l] = c;
+                break;
+            }
+            case EXPR_OP_X:
+            case EXPR_OP_XAT:
+            case EXPR_OP_INDEX: {
+                int l = 0, row = pos->row, col = pos->col;
+                while (l < n) {
+                    int len = (pos->i1 - col < n - l) ? pos->i1 - col : n - l;
+                    const double* x = X + (size_t)row * (size_t)m;
+                    if (in->op == EXPR_OP_X) {
+                        const double* src = x + col + in->imm;
+                        for (int j = 0; j < len; j++) d[l + j] = src[j];
+                    } else if (in->op == EXPR_OP_XAT) {
+                        double v = (in->imm < m) ? x[in->imm] : NAN;
+                        for (int j = 0; j < len; j++) d[l + j] = v;
+                    } else {
+                        for (int j = 0; j < len; j++) d[l + j] = (double)(col + j);
+                    }
+                    l += len;
+                    col = pos->i0;
+                    row++;
+                }
+                break;
+            }
+            case EXPR_OP_DIM:
+                for (int l = 0; l < n; l++) d[l] = (double)m;
+                break;
+            case EXPR_OP_REDUCE: {
+                const double* acc = p->acc + (size_t)in->imm * EXPR_LANES;
+                for (int l = 0; l < n; l++) d[l] = acc[l];
+                break;
+            }
+            case EXPR_OP_ADD:
+                for (int l = 0; l < n; l++) d[l] = a[l] + b[l];
+                break;
+            case EXPR_OP_SUB:
+                for (int l = 0; l < n; l++) d[l] = a[l] - b[l];
+                break;
+            case EXPR_OP_MUL:
+                for (int l = 0; l < n; l++) d[l] = a[l] * b[l];
+                break;
+            case EXPR_OP_DIV:
+                for (int l = 0; l < n; l++) d[l] = a[l] / b[l];
+                break;
+            case EXPR_OP_POW:
+                for (int l = 0; l < n; l++) d[l] = pow(a[l], b[l]);
+                break;
+            case EXPR_OP_ADDK: {
+                double c = p->consts[in->imm];
+                for (int l = 0; l < n; l++) d[l] = a[l] + c;
+                break;
+            }
+            case EXPR_OP_MULK: {
+                double c = p->consts[in->imm];
+                for (int l = 0; l < n; l++) d[l] = a[l] * c;
+                break;
+            }
+            case EXPR_OP_POWK:
+                expr_vecmath(EXPR_OP_POWK, a, p->consts[in->imm], R[EXPR_MAX_REGS], n);
+                swap = 1;
+                break;
+            case EXPR_OP_SQUARE:
+                for (int l = 0; l < n; l++) d[l] = a[l] * a[l];
+                break;
+            case EXPR_OP_NEG:
+                for (int l = 0; l < n; l++) d[l] = -a[l];
+                break;
+            case EXPR_OP_ABS:
+                for (int l = 0; l < n; l++) d[l] = fabs(a[l]);
+                break;
+            case EXPR_OP_TAN:
+                for (int l = 0; l < n; l++) d[l] = tan(a[l]);
+                break;
+            case EXPR_OP_SQRT:
+            case EXPR_OP_SIN:
+            case EXPR_OP_COS:
+            case EXPR_OP_EXP:
+            case EXPR_OP_LOG:
+                expr_vecmath((ExprOp)in->op, a, 0.0, R[EXPR_MAX_REGS], n);
+                swap = 1;
+                break;
+        }
+
+        if (swap) {
+            tmp = R[in->dst];
+            R[in->dst] = R[EXPR_MAX_REGS];
+            R[EXPR_MAX_REGS] = tmp;
+        }
+    }
+}
+
+/**
+ * @brief Evaluates a compiled expression on k row-major vectors.
+ *
+ * Rows are taken EXPR_LANES at a time: every sum()/prod() is reduced
+ * for all of them first, then the top level combines the results.
+ *
+ * @param p Program (its workspace is overwritten).
+ * @param X Block of k row-major vectors.
+ * @param k Number of vectors.
+ * @param m Dimension of each vector.
+ * @param f_out Output fitness values (k values).
+ */
+void EXPR_BATCH_NAME(KERNEL_ISA)(ExprProgram* p, const double* X, int k, int m, double* f_out)
+{
+    double* R[EXPR_MAX_REGS + 1];
+    for (int r = 0; r <= EXPR_MAX_REGS; r++) R[r] = p->regs + (size_t)r * EXPR_LANES;
+
+    for (int row0 = 0; row0 < k; row0 += EXPR_LANES) {
+        int nr = (k - row0 < EXPR_LANES) ? k - row0 : EXPR_LANES;
+
+        for (int s = 0; s < p->nreduce; s++) {
+            const ExprReduce* red = &p->reduce[s];
+            double* acc = p->acc + (size_t)s * EXPR_LANES;
+            for (int l = 0; l < nr; l++) acc[l] = red->product ? 1.0 : 0.0;
+
+            LanePos pos = { row0, -red->lo_off, -red->lo_off, m - red->hi_off };
+            if (pos.i1 <= pos.i0) continue;
+
+            /* walk the (row, i) pairs of these rows a register at a time */
+            size_t left = (size_t)nr * (size_t)(pos.i1 - pos.i0);
+            while (left > 0) {
+                int n = (left < EXPR_LANES) ? (int)left : EXPR_LANES;
+                expr_exec(p, R, red->begin, red->end, n, X, m, &pos);
+
+                /* fold each row's segment into its total, in index order */
+                const double* t = R[red->result];
+                int l = 0;
+                while (l < n) {
+                    int len = (pos.i1 - pos.col < n - l) ? pos.i1 - pos.col : n - l;
+                    double v = acc[pos.row - row0];
+                    if (red->product) {
+                        for (int j = 0; j < len; j++) v *= t[l + j];
+                    } else {
+                        for (int j = 0; j < len; j++) v += t[l + j];
+                    }
+                    acc[pos.row - row0] = v;
+                    l += len;
+                    pos.col += len;
+                    if (pos.col == pos.i1) {
+                        pos.col = pos.i0;
+                        pos.row++;
+                    }
+                }
+                left -= (size_t)n;
+            }
+        }
+
+        LanePos top = { row0, 0, 0, 1 };
+        expr_exec(p, R, p->top_begin, p->ncode, nr, X, m, &top);
+
+        const double* f = R[p->top_result];
+        for (int l = 0; l < nr; l++) f_out[row0 + l] = f[l];
+    }
+}
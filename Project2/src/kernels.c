@@ -0,0 +1,1668 @@
+/**
+ * @file kernels.c
+ * @brief Batch evaluation kernels for the benchmark problems.
+ *
+ * This file is compiled once per instruction-set variant. The Makefile
+ * passes -DKERNEL_ISA=<name> together with the matching -m flags, and
+ * each build exports its own KernelTable (kernels_sse2, kernels_avx2,
+ * ...). All functions below are static, so the variants link side by
+ * side. Floating-point contraction stays off (-std=c11), so every
+ * variant produces bit-identical results; only the vector width differs.
+ *
+ * Built with -DKERNEL_FAST, the file produces the "fast" precision
+ * tables (kernels_fast_<isa>) on the shorter VM_FAST polynomials.
+ *
+ * Rows with at least LARGE_DIM_MIN terms are reduced in fixed blocks
+ * that are spread across OpenMP threads (see sum_row_blocked()).
+ */
+
+#include "kernels.h"
+#include "expr.h"
+#if defined(KERNEL_FAST)
+#define VM_FAST
+#endif
+#include "vecmath.h"
+#include <math.h>
+#include <stddef.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#ifndef KERNEL_ISA
+#define KERNEL_ISA generic
+#endif
+
+#define KERNEL_STR2(x) #x
+#define KERNEL_STR(x) KERNEL_STR2(x)
+#if defined(KERNEL_FAST)
+#define KERNEL_TABLE2(isa) kernels_fast_##isa
+#else
+#define KERNEL_TABLE2(isa) kernels_##isa
+#endif
+#define KERNEL_TABLE(isa) KERNEL_TABLE2(isa)
+
+/** Number of elements processed per pass of the vectorized kernels. */
+#define EVAL_CHUNK 256
+
+/**
+ * Rows with at least this many terms take the blocked (and, with
+ * OpenMP, multi-threaded) reduction instead of the serial one.
+ */
+#define LARGE_DIM_MIN 16384
+
+/** Terms per block of the blocked reduction (64 KiB of coordinates). */
+#define LARGE_BLOCK 8192
+
+/** Maximum number of blocks per row; longer rows use larger blocks. */
+#define LARGE_MAX_BLOCKS 4096
+
+/*
+ * Helpers marked KERNEL_INLINE are always inlined, so a call with a
+ * constant dimension specializes the whole loop nest for it (see
+ * SPECIALIZE_DIMS below).
+ */
+#if defined(__GNUC__)
+#define KERNEL_INLINE static inline __attribute__((always_inline))
+#else
+#define KERNEL_INLINE static inline
+#endif
+
+/**
+ * @brief Computes n consecutive objective terms from a span of coordinates.
+ *
+ * Per-coordinate problems read x[0..n-1]; adjacent-pair problems read
+ * x[0..n] and produce the term for pair (x[j], x[j+1]) in t[j].
+ */
+typedef void (*TermFn)(const double* x, double* t, int n);
+
+/**
+ * @brief Splits nt terms into blocks for the blocked reduction.
+ *
+ * The block size depends only on nt (never on the thread count), so
+ * the partial sums, and therefore the result, are the same however
+ * many threads run them.
+ *
+ * @param nt Number of terms in the row.
+ * @param nb_out Output number of blocks (at most LARGE_MAX_BLOCKS).
+ * @return Terms per block (a multiple of EVAL_CHUNK).
+ */
+static int large_blocks(int nt, int* nb_out)
+{
+    int bs = LARGE_BLOCK;
+    int nb = (nt + bs - 1) / bs;
+    if (nb > LARGE_MAX_BLOCKS) {
+        bs = (nt + LARGE_MAX_BLOCKS - 1) / LARGE_MAX_BLOCKS;
+        bs = (bs + EVAL_CHUNK - 1) / EVAL_CHUNK * EVAL_CHUNK;
+        nb = (nt + bs - 1) / bs;
+    }
+    *nb_out = nb;
+    return bs;
+}
+
+/**
+ * @brief Sums the nt terms of one long row in fixed blocks.
+ *
+ * Each block of terms is summed in coordinate order into its own
+ * partial (one cache-sized pass over the coordinates), the blocks are
+ * distributed over the OpenMP threads, and the partials are added in
+ * block order afterwards. For adjacent-pair problems the term that
+ * straddles two blocks, (x[i1-1], x[i1]), belongs to the block ending
+ * at i1 and reads one coordinate past it, so no pair is lost or
+ * counted twice.
+ *
+ * @param x Row of coordinates (nt terms, nt+1 coordinates for pairs).
+ * @param nt Number of terms.
+ * @param term Term generator.
+ * @return Sum of all terms.
+ */
+static double sum_row_blocked(const double* x, int nt, TermFn term)
+{
+    double part[LARGE_MAX_BLOCKS];
+    int nb;
+    int bs = large_blocks(nt, &nb);
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < nb; b++) {
+        double t[EVAL_CHUNK];
+        int i1 = (b + 1 < nb) ? (b + 1) * bs : nt;
+        double sum = 0.0;
+        for (int i0 = b * bs; i0 < i1; i0 += EVAL_CHUNK) {
+            int n = (i1 - i0 < EVAL_CHUNK) ? i1 - i0 : EVAL_CHUNK;
+            term(x + i0, t, n);
+            for (int i = 0; i < n; i++) sum += t[i];
+        }
+        part[b] = sum;
+    }
+
+    double sum = 0.0;
+    for (int b = 0; b < nb; b++) sum += part[b];
+    return sum;
+}
+
+/**
+ * @brief Sums the objective terms of every row in a block.
+ *
+ * Small rows are packed several to a chunk and processed as one flat
+ * span, so the vectorized math runs over up to EVAL_CHUNK lanes even
+ * for m = 10. For adjacent-pair problems the flat span also produces a
+ * term straddling two rows at each row boundary; those terms are
+ * computed but never summed. Within a row the terms are summed in
+ * coordinate order, except for rows of at least LARGE_DIM_MIN terms,
+ * which go through sum_row_blocked().
+ *
+ * @param X Block of k row-major vectors.
+ * @param k Number of rows.
+ * @param m Dimension of each row.
+ * @param pair 1 for adjacent-pair problems (m-1 terms per row), 0 otherwise.
+ * @param term Term generator.
+ * @param out Output array of per-row sums.
+ */
+KERNEL_INLINE void sum_terms(const double* X, int k, int m, int pair, TermFn term, double* out)
+{
+    double t[EVAL_CHUNK];
+    int nt = m - pair;
+
+    if (m <= EVAL_CHUNK) {
+        int rows = EVAL_CHUNK / m;
+        for (int r0 = 0; r0 < k; r0 += rows) {
+            int nr = (k - r0 < rows) ? k - r0 : rows;
+            term(X + (size_t)r0 * (size_t)m, t, nr * m - pair);
+            for (int r = 0; r < nr; r++) {
+                const double* tr = t + (size_t)r * (size_t)m;
+                double sum = 0.0;
+                for (int i = 0; i < nt; i++) sum += tr[i];
+                out[r0 + r] = sum;
+            }
+        }
+        return;
+    }
+
+    for (int r = 0; r < k; r++) {
+        const double* x = X + (size_t)r * (size_t)m;
+        if (nt >= LARGE_DIM_MIN) {
+            out[r] = sum_row_blocked(x, nt, term);
+            continue;
+        }
+        double sum = 0.0;
+        for (int i0 = 0; i0 < nt; i0 += EVAL_CHUNK) {
+            int n = (nt - i0 < EVAL_CHUNK) ? nt - i0 : EVAL_CHUNK;
+            term(x + i0, t, n);
+            for (int i = 0; i < n; i++) sum += t[i];
+        }
+        out[r] = sum;
+    }
+}
+
+/*
+ * Term generators. Each one stages its transcendental arguments in a
+ * chunk buffer, runs the vecmath routine over the whole chunk and then
+ * combines the results, so every loop below is a plain vectorizable map.
+ *
+ * The adjacent-pair generators start with a per-coordinate pass over
+ * x[0..n] for everything a coordinate contributes to both of its pairs
+ * (x_i^2, cos(2 pi x_i)), then combine neighbouring entries per pair.
+ * The shared values are computed once instead of twice and the
+ * results are bit-identical to computing them per pair.
+ */
+
+KERNEL_INLINE void terms_schwefel(const double* x, double* t, int n)
+{
+    double u[EVAL_CHUNK];
+    for (int i = 0; i < n; i++) u[i] = sqrt(fabs(x[i]));
+    vm_sin(u, t, n);
+    for (int i = 0; i < n; i++) t[i] = (-x[i]) * t[i];
+}
+
+KERNEL_INLINE void terms_dejong1(const double* x, double* t, int n)
+{
+    for (int i = 0; i < n; i++) t[i] = x[i] * x[i];
+}
+
+KERNEL_INLINE void terms_rosenbrock(const double* x, double* t, int n)
+{
+    for (int i = 0; i < n; i++) {
+        double a = (x[i] * x[i] - x[i + 1]);
+        double b = (1.0 - x[i]);
+        t[i] = 100.0 * a * a + b * b;
+    }
+}
+
+KERNEL_INLINE void terms_rastrigin(const double* x, double* t, int n)
+{
+    double u[EVAL_CHUNK];
+    for (int i = 0; i < n; i++) u[i] = 2.0 * M_PI * x[i];
+    vm_cos(u, t, n);
+    for (int i = 0; i < n; i++) t[i] = x[i] * x[i] - 10.0 * t[i];
+}
+
+KERNEL_INLINE void terms_sine_env_sine_wave(const double* x, double* t, int n)
+{
+    double q[EVAL_CHUNK + 1], a[EVAL_CHUNK], u[EVAL_CHUNK];
+    for (int i = 0; i <= n; i++) q[i] = x[i] * x[i];
+    for (int i = 0; i < n; i++) {
+        a[i] = q[i] + q[i + 1];
+        u[i] = a[i] - 0.5;
+    }
+    vm_sin(u, t, n);
+    for (int i = 0; i < n; i++) {
+        double num = t[i] * t[i];
+        double den = (1.0 + 0.001 * a[i]);
+        den = den * den;
+        t[i] = 0.5 + (num / den);
+    }
+}
+
+KERNEL_INLINE void terms_stretch_v_sine_wave(const double* x, double* t, int n)
+{
+    double q[EVAL_CHUNK + 1], a[EVAL_CHUNK], u[EVAL_CHUNK];
+    if (n <= 0) return;    /* lets GCC see a[] is set before the out-of-line vm_pow */
+    for (int i = 0; i <= n; i++) q[i] = x[i] * x[i];
+    for (int i = 0; i < n; i++) a[i] = q[i] + q[i + 1];
+    vm_pow(a, 0.1, u, n);
+    for (int i = 0; i < n; i++) u[i] = 50.0 * u[i];
+    vm_sin(u, t, n);
+    for (int i = 0; i < n; i++) {
+        double ra = sqrt(sqrt(a[i]));      /* a^0.25 */
+        double term = (ra * t[i] * t[i]) + 1.0;
+        t[i] = term * term;
+    }
+}
+
+KERNEL_INLINE void terms_ackley_one(const double* x, double* t, int n)
+{
+    double q[EVAL_CHUNK + 1], u[EVAL_CHUNK], v[EVAL_CHUNK], c[EVAL_CHUNK];
+    for (int i = 0; i <= n; i++) q[i] = x[i] * x[i];
+    for (int i = 0; i < n; i++) {
+        u[i] = 2.0 * x[i];
+        v[i] = 2.0 * x[i + 1];
+    }
+    vm_cos(u, c, n);
+    vm_sin(v, t, n);
+    for (int i = 0; i < n; i++) {
+        double a = sqrt(q[i] + q[i + 1]);
+        t[i] = (1.0 / exp(0.2)) * a + 3.0 * (c[i] + t[i]);
+    }
+}
+
+KERNEL_INLINE void terms_ackley_two(const double* x, double* t, int n)
+{
+    double q[EVAL_CHUNK + 1], c[EVAL_CHUNK + 1], u[EVAL_CHUNK + 1], v[EVAL_CHUNK], e1[EVAL_CHUNK];
+
+    /* per coordinate: x_i^2 and cos(2 pi x_i), each shared by two pairs */
+    for (int i = 0; i <= n; i++) {
+        q[i] = x[i] * x[i];
+        u[i] = 2.0 * M_PI * x[i];
+    }
+    vm_cos(u, c, n + 1);
+
+    /* per pair */
+    for (int i = 0; i < n; i++) {
+        double a = sqrt((q[i] + q[i + 1]) / 2.0);
+        u[i] = 0.2 * a;
+    }
+    vm_exp(u, e1, n);
+    for (int i = 0; i < n; i++) u[i] = 0.5 * (c[i] + c[i + 1]);
+    vm_exp(u, v, n);
+    for (int i = 0; i < n; i++) t[i] = 20.0 + exp(1.0) - 20.0 * e1[i] - v[i];
+}
+
+KERNEL_INLINE void terms_egg_holder(const double* x, double* t, int n)
+{
+    double u[EVAL_CHUNK], v[EVAL_CHUNK], s[EVAL_CHUNK];
+    for (int i = 0; i < n; i++) {
+        double xi = x[i];
+        double xj = x[i + 1];
+        u[i] = sqrt(fabs(xi - xj - 47.0));
+        v[i] = sqrt(fabs(xj + 47.0 + xi / 2.0));
+    }
+    vm_sin(u, s, n);
+    vm_sin(v, t, n);
+    for (int i = 0; i < n; i++) {
+        double xi = x[i];
+        double xj = x[i + 1];
+        t[i] = (-xi * s[i]) + (-(xj + 47.0) * t[i]);
+    }
+}
+
+/*
+ * Batch kernels.
+ *
+ * Each kernel evaluates k row-major vectors of dimension m stored in X
+ * and writes one fitness value per row to out. Keeping the loop over
+ * rows inside the kernel means the problem type is resolved once per
+ * block instead of once per vector.
+ *
+ * The bodies are written once for a generic m and instantiated by
+ * SPECIALIZE_DIMS for the dimensions the experiments use (10, 20 and
+ * 30). In those copies every trip count, chunk split and row offset is
+ * a compile-time constant, so the compiler unrolls the per-row loops and
+ * drops the remainder handling; any other m takes the generic copy. The
+ * arithmetic and summation order are the same in every copy, so the
+ * specialized and generic results are bit-identical.
+ */
+
+/**
+ * @brief Defines batch_<name> dispatching to dimension-specialized copies
+ * of the inline body batch_<name>_body.
+ */
+#define SPECIALIZE_DIMS(name)                                                  \
+    static void batch_##name(const double* X, int k, int m, double* out)       \
+    {                                                                          \
+        switch (m) {                                                           \
+        case 10: batch_##name##_body(X, k, 10, out); break;                    \
+        case 20: batch_##name##_body(X, k, 20, out); break;                    \
+        case 30: batch_##name##_body(X, k, 30, out); break;                    \
+        default: batch_##name##_body(X, k, m, out); break;                     \
+        }                                                                      \
+    }
+
+/**
+ * @brief Griewangk for one long row: blocked sum and product.
+ *
+ * Same block layout and ordering as sum_row_blocked(), with a sum and
+ * a product partial per block.
+ */
+static double griewangk_row_blocked(const double* x, int m)
+{
+    double part_sum[LARGE_MAX_BLOCKS], part_prod[LARGE_MAX_BLOCKS];
+    int nb;
+    int bs = large_blocks(m, &nb);
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < nb; b++) {
+        double u[EVAL_CHUNK], c[EVAL_CHUNK];
+        int i1 = (b + 1 < nb) ? (b + 1) * bs : m;
+        double sum = 0.0;
+        double prod = 1.0;
+        for (int i0 = b * bs; i0 < i1; i0 += EVAL_CHUNK) {
+            int n = (i1 - i0 < EVAL_CHUNK) ? i1 - i0 : EVAL_CHUNK;
+            for (int i = 0; i < n; i++) u[i] = x[i0 + i] / sqrt((double)(i0 + i + 1));
+            vm_cos(u, c, n);
+            for (int i = 0; i < n; i++) {
+                double xi = x[i0 + i];
+                sum += (xi * xi) / 4000.0;
+                prod *= c[i];
+            }
+        }
+        part_sum[b] = sum;
+        part_prod[b] = prod;
+    }
+
+    double sum = 0.0;
+    double prod = 1.0;
+    for (int b = 0; b < nb; b++) {
+        sum += part_sum[b];
+        prod *= part_prod[b];
+    }
+    return 1.0 + sum - prod;
+}
+
+KERNEL_INLINE void batch_schwefel_body(const double* X, int k, int m, double* out)
+{
+    sum_terms(X, k, m, 0, terms_schwefel, out);
+    for (int r = 0; r < k; r++) out[r] = 418.9829 * (double)m + out[r];
+}
+
+KERNEL_INLINE void batch_dejong1_body(const double* X, int k, int m, double* out)
+{
+    if (m >= LARGE_DIM_MIN) {
+        sum_terms(X, k, m, 0, terms_dejong1, out);
+        return;
+    }
+    for (int r = 0; r < k; r++) {
+        const double* x = X + (size_t)r * (size_t)m;
+        double sum = 0.0;
+        for (int i = 0; i < m; i++)
+            sum += x[i] * x[i];
+        out[r] = sum;
+    }
+}
+
+KERNEL_INLINE void batch_rosenbrock_body(const double* X, int k, int m, double* out)
+{
+    if (m - 1 >= LARGE_DIM_MIN) {
+        sum_terms(X, k, m, 1, terms_rosenbrock, out);
+        return;
+    }
+    for (int r = 0; r < k; r++) {
+        const double* x = X + (size_t)r * (size_t)m;
+        double sum = 0.0;
+        for (int i = 0; i < m - 1; i++) {
+            double xi = x[i];
+            double xnext = x[i + 1];
+            double a = (xi * xi - xnext);
+            double b = (1.0 - xi);
+            sum += 100.0 * a * a + b * b;
+        }
+        out[r] = sum;
+    }
+}
+
+KERNEL_INLINE void batch_rastrigin_body(const double* X, int k, int m, double* out)
+{
+    sum_terms(X, k, m, 0, terms_rastrigin, out);
+    for (int r = 0; r < k; r++) out[r] = 10.0 * (double)m + out[r];
+}
+
+KERNEL_INLINE void batch_griewangk_body(const double* X, int k, int m, double* out)
+{
+    double u[EVAL_CHUNK], c[EVAL_CHUNK];
+
+    for (int r = 0; r < k; r++) {
+        const double* x = X + (size_t)r * (size_t)m;
+        if (m >= LARGE_DIM_MIN) {
+            out[r] = griewangk_row_blocked(x, m);
+            continue;
+        }
+        double sum = 0.0;
+        double prod = 1.0;
+        for (int i0 = 0; i0 < m; i0 += EVAL_CHUNK) {
+            int n = (m - i0 < EVAL_CHUNK) ? m - i0 : EVAL_CHUNK;
+            for (int i = 0; i < n; i++) u[i] = x[i0 + i] / sqrt((double)(i0 + i + 1));
+            vm_cos(u, c, n);
+            for (int i = 0; i < n; i++) {
+                double xi = x[i0 + i];
+                sum += (xi * xi) / 4000.0;
+                prod *= c[i];
+            }
+        }
+        out[r] = 1.0 + sum - prod;
+    }
+}
+
+KERNEL_INLINE void batch_sine_env_sine_wave_body(const double* X, int k, int m, double* out)
+{
+    sum_terms(X, k, m, 1, terms_sine_env_sine_wave, out);
+    for (int r = 0; r < k; r++) out[r] = -out[r];
+}
+
+KERNEL_INLINE void batch_stretch_v_sine_wave_body(const double* X, int k, int m, double* out)
+{
+    sum_terms(X, k, m, 1, terms_stretch_v_sine_wave, out);
+}
+
+KERNEL_INLINE void batch_ackley_one_body(const double* X, int k, int m, double* out)
+{
+    sum_terms(X, k, m, 1, terms_ackley_one, out);
+}
+
+KERNEL_INLINE void batch_ackley_two_body(const double* X, int k, int m, double* out)
+{
+    sum_terms(X, k, m, 1, terms_ackley_two, out);
+}
+
+KERNEL_INLINE void batch_egg_holder_body(const double* X, int k, int m, double* out)
+{
+    sum_terms(X, k, m, 1, terms_egg_holder, out);
+}
+
+SPECIALIZE_DIMS(schwefel)
+SPECIALIZE_DIMS(dejong1)
+SPECIALIZE_DIMS(rosenbrock)
+SPECIALIZE_DIMS(rastrigin)
+SPECIALIZE_DIMS(griewangk)
+SPECIALIZE_DIMS(sine_env_sine_wave)
+SPECIALIZE_DIMS(stretch_v_sine_wave)
+SPECIALIZE_DIMS(ackley_one)
+SPECIALIZE_DIMS(ackley_two)
+SPECIALIZE_DIMS(egg_holder)
+
+/*
+ * Scalar kernels: one-row calls into the batch kernels, so scalar and
+ * batch evaluation share the same code and give identical values.
+ */
+#define SCALAR_KERNEL(name)                           \
+    static double eval_##name(const double* x, int m) \
+    {                                                 \
+        double f;                                     \
+        batch_##name(x, 1, m, &f);                    \
+        return f;                                     \
+    }
+
+SCALAR_KERNEL(schwefel)
+SCALAR_KERNEL(dejong1)
+SCALAR_KERNEL(rosenbrock)
+SCALAR_KERNEL(rastrigin)
+SCALAR_KERNEL(griewangk)
+SCALAR_KERNEL(sine_env_sine_wave)
+SCALAR_KERNEL(stretch_v_sine_wave)
+SCALAR_KERNEL(ackley_one)
+SCALAR_KERNEL(ackley_two)
+SCALAR_KERNEL(egg_holder)
+
+/*
+ * Delta kernels.
+ *
+ * Every problem is f = c + s * (sum of terms), where a term depends on
+ * one coordinate or on one adjacent pair. Changing x[j] therefore only
+ * changes one term (or two pairs), and the new fitness follows from
+ * f_old in O(1) using the same term generators as the batch kernels.
+ */
+
+/**
+ * @brief Fitness after setting x[j] = xj for a sum of per-coordinate terms.
+ *
+ * @param term Term generator.
+ * @param s Scale applied to the term sum.
+ */
+static double delta_coord(TermFn term, double s, const double* x,
+                          double f_old, int j, double xj)
+{
+    double t_old, t_new;
+    term(&x[j], &t_old, 1);
+    term(&xj, &t_new, 1);
+    return f_old + s * (t_new - t_old);
+}
+
+/**
+ * @brief Fitness after setting x[j] = xj for a sum of adjacent-pair terms.
+ *
+ * Only the pairs (j-1, j) and (j, j+1) that exist are recomputed.
+ *
+ * @param term Term generator.
+ * @param s Scale applied to the term sum.
+ */
+static double delta_pair(TermFn term, double s, const double* x, int m,
+                         double f_old, int j, double xj)
+{
+    int lo = (j > 0) ? j - 1 : j;
+    int hi = (j < m - 1) ? j + 1 : j;
+    int np = hi - lo;
+    double w[3], t_old[2], t_new[2];
+
+    if (np == 0) return f_old;
+
+    for (int i = 0; i <= np; i++) w[i] = x[lo + i];
+    term(w, t_old, np);
+    w[j - lo] = xj;
+    term(w, t_new, np);
+
+    double d = 0.0;
+    for (int i = 0; i < np; i++) d += t_new[i] - t_old[i];
+    return f_old + s * d;
+}
+
+static double delta_schwefel(const double* x, int m, double f_old, int j, double xj)
+{
+    (void)m;
+    return delta_coord(terms_schwefel, 1.0, x, f_old, j, xj);
+}
+
+static double delta_dejong1(const double* x, int m, double f_old, int j, double xj)
+{
+    (void)m;
+    return delta_coord(terms_dejong1, 1.0, x, f_old, j, xj);
+}
+
+static double delta_rosenbrock(const double* x, int m, double f_old, int j, double xj)
+{
+    return delta_pair(terms_rosenbrock, 1.0, x, m, f_old, j, xj);
+}
+
+static double delta_rastrigin(const double* x, int m, double f_old, int j, double xj)
+{
+    (void)m;
+    return delta_coord(terms_rastrigin, 1.0, x, f_old, j, xj);
+}
+
+/** Smallest old cosine factor the Griewangk delta rescales by (else recomputes) */
+#define GRIEWANGK_DELTA_MIN_COS 0.125
+
+/**
+ * @brief Griewangk delta: f = 1 + S - P with S a sum and P a product.
+ *
+ * S is recomputed without any transcendental call (O(m) multiply-adds),
+ * P is recovered as 1 + S - f_old and rescaled by the ratio of the new
+ * and old cosine factor. The recovered P carries the rounding error of
+ * 1 + S, which the ratio multiplies by up to 1 / |old factor|; below
+ * GRIEWANGK_DELTA_MIN_COS (an amplification of 8) the full product is
+ * recomputed instead.
+ */
+static double delta_griewangk(const double* x, int m, double f_old, int j, double xj)
+{
+    double sum = 0.0;
+    for (int i = 0; i < m; i++) sum += (x[i] * x[i]) / 4000.0;
+
+    double u[2], c[2];
+    u[0] = x[j] / sqrt((double)(j + 1));
+    u[1] = xj / sqrt((double)(j + 1));
+    vm_cos(u, c, 2);
+
+    double sum_new = sum - (x[j] * x[j]) / 4000.0 + (xj * xj) / 4000.0;
+
+    if (fabs(c[0]) < GRIEWANGK_DELTA_MIN_COS) {
+        double uu[EVAL_CHUNK], cc[EVAL_CHUNK];
+        double prod = 1.0;
+        for (int i0 = 0; i0 < m; i0 += EVAL_CHUNK) {
+            int n = (m - i0 < EVAL_CHUNK) ? m - i0 : EVAL_CHUNK;
+            for (int i = 0; i < n; i++) uu[i] = x[i0 + i] / sqrt((double)(i0 + i + 1));
+            vm_cos(uu, cc, n);
+            for (int i = 0; i < n; i++) prod *= (i0 + i == j) ? c[1] : cc[i];
+        }
+        return 1.0 + sum_new - prod;
+    }
+
+    double prod = 1.0 + sum - f_old;
+    return 1.0 + sum_new - prod * (c[1] / c[0]);
+}
+
+static double delta_sine_env_sine_wave(const double* x, int m, double f_old, int j, double xj)
+{
+    return delta_pair(terms_sine_env_sine_wave, -1.0, x, m, f_old, j, xj);
+}
+
+static double delta_stretch_v_sine_wave(const double* x, int m, double f_old, int j, double xj)
+{
+    return delta_pair(terms_stretch_v_sine_wave, 1.0, x, m, f_old, j, xj);
+}
+
+static double delta_ackley_one(const double* x, int m, double f_old, int j, double xj)
+{
+    return delta_pair(terms_ackley_one, 1.0, x, m, f_old, j, xj);
+}
+
+static double delta_ackley_two(const double* x, int m, double f_old, int j, double xj)
+{
+    return delta_pair(terms_ackley_two, 1.0, x, m, f_old, j, xj);
+}
+
+static double delta_egg_holder(const double* x, int m, double f_old, int j, double xj)
+{
+    return delta_pair(terms_egg_holder, 1.0, x, m, f_old, j, xj);
+}
+
+/*
+ * Bounded (early-abandon) kernels.
+ *
+ * For problems of the form f = c + (sum of terms) where every term has
+ * a known lower bound lb, the terms not summed yet contribute at least
+ * lb each. Once c + partial + lb * remaining reaches the cutoff the row
+ * cannot beat it and the sum is abandoned. Terms are summed in the same
+ * order as the batch kernels (including the block order for long rows),
+ * so a row that is not abandoned gets exactly the batch value.
+ */
+
+/** Terms summed between two cutoff checks. */
+#define BOUND_CHUNK 16
+
+/**
+ * @brief Early-abandon evaluation of f = c + sum of terms.
+ *
+ * @param x Input vector.
+ * @param m Dimension of x.
+ * @param pair 1 for adjacent-pair problems, 0 otherwise.
+ * @param term Term generator.
+ * @param c Constant added to the term sum.
+ * @param lb Lower bound of a single term (slightly below the exact
+ *           bound so rounding in the term cannot cross it).
+ * @param cutoff Fitness the row has to beat.
+ * @return f, or PROBLEM_EVAL_ABANDONED once f >= cutoff is certain.
+ */
+KERNEL_INLINE double bounded_sum(const double* x, int m, int pair, TermFn term,
+                                 double c, double lb, double cutoff)
+{
+    double t[BOUND_CHUNK];
+    int nt = m - pair;
+    int nb = 1;
+    int bs = nt;
+    double total = 0.0;
+
+    if (nt >= LARGE_DIM_MIN) bs = large_blocks(nt, &nb);
+
+    for (int b = 0; b < nb; b++) {
+        int i1 = (b + 1 < nb) ? (b + 1) * bs : nt;
+        double sum = 0.0;
+        for (int i0 = b * bs; i0 < i1; i0 += BOUND_CHUNK) {
+            int n = (i1 - i0 < BOUND_CHUNK) ? i1 - i0 : BOUND_CHUNK;
+            term(x + i0, t, n);
+            for (int i = 0; i < n; i++) sum += t[i];
+            int rest = nt - (i0 + n);
+            if (rest > 0 && c + (total + sum) + lb * (double)rest >= cutoff)
+                return PROBLEM_EVAL_ABANDONED;
+        }
+        total += sum;
+    }
+    return c + total;
+}
+
+static double bounded_dejong1(const double* x, int m, double cutoff)
+{
+    return bounded_sum(x, m, 0, terms_dejong1, 0.0, 0.0, cutoff);
+}
+
+static double bounded_rosenbrock(const double* x, int m, double cutoff)
+{
+    return bounded_sum(x, m, 1, terms_rosenbrock, 0.0, 0.0, cutoff);
+}
+
+/* x^2 - 10 cos(2 pi x) >= -10 */
+static double bounded_rastrigin(const double* x, int m, double cutoff)
+{
+    return bounded_sum(x, m, 0, terms_rastrigin, 10.0 * (double)m, -10.000001, cutoff);
+}
+
+static double bounded_stretch_v_sine_wave(const double* x, int m, double cutoff)
+{
+    return bounded_sum(x, m, 1, terms_stretch_v_sine_wave, 0.0, 0.0, cutoff);
+}
+
+/* e^-0.2 sqrt(x^2 + y^2) + 3 (cos 2x + sin 2y) >= -6 */
+static double bounded_ackley_one(const double* x, int m, double cutoff)
+{
+    return bounded_sum(x, m, 1, terms_ackley_one, 0.0, -6.000001, cutoff);
+}
+
+/*
+ * Fused multi-problem kernel.
+ *
+ * Evaluates several problems on the same block in one pass over the
+ * coordinates. Values used by more than one problem are computed once
+ * per chunk: x_i^2 (De Jong, Rosenbrock, Rastrigin, Griewangk and the
+ * pair sums), x_i^2 + x_{i+1}^2 (Sine Envelope, Stretch V, both
+ * Ackleys) and cos(2 pi x_i) (Rastrigin, Ackley Two). Each problem's
+ * terms are then formed from the shared arrays with the same
+ * expressions and summation order as its own batch kernel, so the
+ * results are bit-identical to evaluating the problems one by one.
+ */
+
+/**
+ * @brief Sums the first nt terms of each of nr packed rows of length m.
+ */
+static void row_sums(const double* t, int nr, int m, int nt, double* out)
+{
+    for (int r = 0; r < nr; r++) {
+        const double* tr = t + (size_t)r * (size_t)m;
+        double sum = 0.0;
+        for (int i = 0; i < nt; i++) sum += tr[i];
+        out[r] = sum;
+    }
+}
+
+/**
+ * @brief Evaluates the problems selected by mask on k rows of dimension m.
+ *
+ * Rows longer than EVAL_CHUNK are evaluated with the individual batch
+ * kernels instead (the per-problem work dominates at that size).
+ *
+ * @param X Block of k row-major vectors.
+ * @param k Number of rows.
+ * @param m Dimension of each row.
+ * @param mask Bit PROBLEM_MASK(t) selects problem t.
+ * @param f_out f_out[t] receives the k fitness values of problem t.
+ */
+static void batch_multi(const double* X, int k, int m, unsigned mask, double* const* f_out)
+{
+    static const ProblemBatchFn single[PROB_EGG_HOLDER + 1] = {
+        NULL,
+        batch_schwefel,
+        batch_dejong1,
+        batch_rosenbrock,
+        batch_rastrigin,
+        batch_griewangk,
+        batch_sine_env_sine_wave,
+        batch_stretch_v_sine_wave,
+        batch_ackley_one,
+        batch_ackley_two,
+        batch_egg_holder
+    };
+    double q[EVAL_CHUNK], a[EVAL_CHUNK], c2pi[EVAL_CHUNK];
+    double u[EVAL_CHUNK], v[EVAL_CHUNK], w[EVAL_CHUNK], t[EVAL_CHUNK];
+
+    if (m > EVAL_CHUNK) {
+        for (int p = PROB_SCHWEFEL; p <= PROB_EGG_HOLDER; p++) {
+            if (mask & PROBLEM_MASK(p)) single[p](X, k, m, f_out[p]);
+        }
+        return;
+    }
+
+    int rows = EVAL_CHUNK / m;
+    for (int r0 = 0; r0 < k; r0 += rows) {
+        int nr = (k - r0 < rows) ? k - r0 : rows;
+        int L = nr * m;
+        const double* x = X + (size_t)r0 * (size_t)m;
+
+        /* shared per-coordinate and per-pair values */
+        for (int i = 0; i < L; i++) q[i] = x[i] * x[i];
+        for (int i = 0; i < L - 1; i++) a[i] = q[i] + q[i + 1];
+        if (mask & (PROBLEM_MASK(PROB_RASTRIGIN) | PROBLEM_MASK(PROB_ACKLEY_TWO))) {
+            for (int i = 0; i < L; i++) u[i] = 2.0 * M_PI * x[i];
+            vm_cos(u, c2pi, L);
+        }
+
+        if (mask & PROBLEM_MASK(PROB_SCHWEFEL)) {
+            double* out = f_out[PROB_SCHWEFEL] + r0;
+            for (int i = 0; i < L; i++) u[i] = sqrt(fabs(x[i]));
+            vm_sin(u, t, L);
+            for (int i = 0; i < L; i++) t[i] = (-x[i]) * t[i];
+            row_sums(t, nr, m, m, out);
+            for (int r = 0; r < nr; r++) out[r] = 418.9829 * (double)m + out[r];
+        }
+        if (mask & PROBLEM_MASK(PROB_DEJONG1)) {
+            row_sums(q, nr, m, m, f_out[PROB_DEJONG1] + r0);
+        }
+        if (mask & PROBLEM_MASK(PROB_ROSENBROCK)) {
+            for (int i = 0; i < L - 1; i++) {
+                double d = (q[i] - x[i + 1]);
+                double b = (1.0 - x[i]);
+                t[i] = 100.0 * d * d + b * b;
+            }
+            row_sums(t, nr, m, m - 1, f_out[PROB_ROSENBROCK] + r0);
+        }
+        if (mask & PROBLEM_MASK(PROB_RASTRIGIN)) {
+            double* out = f_out[PROB_RASTRIGIN] + r0;
+            for (int i = 0; i < L; i++) t[i] = q[i] - 10.0 * c2pi[i];
+            row_sums(t, nr, m, m, out);
+            for (int r = 0; r < nr; r++) out[r] = 10.0 * (double)m + out[r];
+        }
+        if (mask & PROBLEM_MASK(PROB_GRIEWANGK)) {
+            double* out = f_out[PROB_GRIEWANGK] + r0;
+            for (int r = 0; r < nr; r++) {
+                for (int i = 0; i < m; i++) {
+                    u[r * m + i] = x[r * m + i] / sqrt((double)(i + 1));
+                }
+            }
+            vm_cos(u, w, L);
+            for (int r = 0; r < nr; r++) {
+                double sum = 0.0;
+                double prod = 1.0;
+                for (int i = 0; i < m; i++) {
+                    sum += q[r * m + i] / 4000.0;
+                    prod *= w[r * m + i];
+                }
+                out[r] = 1.0 + sum - prod;
+            }
+        }
+        if (mask & PROBLEM_MASK(PROB_SINE_ENV_SINE_WAVE)) {
+            double* out = f_out[PROB_SINE_ENV_SINE_WAVE] + r0;
+            for (int i = 0; i < L - 1; i++) u[i] = a[i] - 0.5;
+            vm_sin(u, t, L - 1);
+            for (int i = 0; i < L - 1; i++) {
+                double num = t[i] * t[i];
+                double den = (1.0 + 0.001 * a[i]);
+                den = den * den;
+                t[i] = 0.5 + (num / den);
+            }
+            row_sums(t, nr, m, m - 1, out);
+            for (int r = 0; r < nr; r++) out[r] = -out[r];
+        }
+        if (mask & PROBLEM_MASK(PROB_STRETCH_V_SINE_WAVE)) {
+            vm_pow(a, 0.1, u, L - 1);
+            for (int i = 0; i < L - 1; i++) u[i] = 50.0 * u[i];
+            vm_sin(u, t, L - 1);
+            for (int i = 0; i < L - 1; i++) {
+                double ra = sqrt(sqrt(a[i]));      /* a^0.25 */
+                double term = (ra * t[i] * t[i]) + 1.0;
+                t[i] = term * term;
+            }
+            row_sums(t, nr, m, m - 1, f_out[PROB_STRETCH_V_SINE_WAVE] + r0);
+        }
+        if (mask & PROBLEM_MASK(PROB_ACKLEY_ONE)) {
+            for (int i = 0; i < L; i++) u[i] = 2.0 * x[i];
+            vm_cos(u, w, L);
+            vm_sin(u, v, L);
+            for (int i = 0; i < L - 1; i++) {
+                double s = sqrt(a[i]);
+                t[i] = (1.0 / exp(0.2)) * s + 3.0 * (w[i] + v[i + 1]);
+            }
+            row_sums(t, nr, m, m - 1, f_out[PROB_ACKLEY_ONE] + r0);
+        }
+        if (mask & PROBLEM_MASK(PROB_ACKLEY_TWO)) {
+            for (int i = 0; i < L - 1; i++) {
+                double s = sqrt(a[i] / 2.0);
+                u[i] = 0.2 * s;
+            }
+            vm_exp(u, w, L - 1);
+            for (int i = 0; i < L - 1; i++) u[i] = 0.5 * (c2pi[i] + c2pi[i + 1]);
+            vm_exp(u, v, L - 1);
+            for (int i = 0; i < L - 1; i++) t[i] = 20.0 + exp(1.0) - 20.0 * w[i] - v[i];
+            row_sums(t, nr, m, m - 1, f_out[PROB_ACKLEY_TWO] + r0);
+        }
+        if (mask & PROBLEM_MASK(PROB_EGG_HOLDER)) {
+            terms_egg_holder(x, t, L - 1);
+            row_sums(t, nr, m, m - 1, f_out[PROB_EGG_HOLDER] + r0);
+        }
+    }
+}
+
+/*
+ * Gradient kernels.
+ *
+ * Each grad generator produces, for a span of n terms, the terms
+ * themselves (same expressions as the term generators above) and
+ * their partial derivatives: da[i] = d t[i] / d x[i] and, for
+ * adjacent-pair problems, db[i] = d t[i] / d x[i+1]. Every
+ * transcendental is computed once per chunk and shared between the
+ * value and the derivative. Terms are summed in coordinate order, so
+ * f equals problem_eval() for rows below LARGE_DIM_MIN terms.
+ *
+ * Where a derivative does not exist (|x| terms at 0, a^0.25 and
+ * sqrt(a) at a = 0) the kernels return 0 for that part.
+ */
+
+/**
+ * @brief Computes n terms and their partial derivatives from a span of coordinates.
+ */
+typedef void (*GradTermFn)(const double* x, double* t, double* da, double* db, int n);
+
+/**
+ * @brief Sum of terms and gradient of one row.
+ *
+ * @param x Row of m coordinates.
+ * @param m Dimension.
+ * @param pair 1 for adjacent-pair problems, 0 otherwise.
+ * @param term Grad generator.
+ * @param g Output gradient (m values).
+ * @return Sum of the terms.
+ */
+KERNEL_INLINE double grad_sum_terms(const double* x, int m, int pair, GradTermFn term, double* g)
+{
+    double t[EVAL_CHUNK], da[EVAL_CHUNK], db[EVAL_CHUNK];
+    int nt = m - pair;
+    double sum = 0.0;
+
+    for (int j = 0; j < m; j++) g[j] = 0.0;
+    for (int i0 = 0; i0 < nt; i0 += EVAL_CHUNK) {
+        int n = (nt - i0 < EVAL_CHUNK) ? nt - i0 : EVAL_CHUNK;
+        term(x + i0, t, da, db, n);
+        for (int i = 0; i < n; i++) sum += t[i];
+        for (int i = 0; i < n; i++) g[i0 + i] += da[i];
+        if (pair) {
+            for (int i = 0; i < n; i++) g[i0 + i + 1] += db[i];
+        }
+    }
+    return sum;
+}
+
+KERNEL_INLINE void grad_terms_schwefel(const double* x, double* t, double* da, double* db, int n)
+{
+    double u[EVAL_CHUNK], c[EVAL_CHUNK];
+    (void)db;
+    for (int i = 0; i < n; i++) u[i] = sqrt(fabs(x[i]));
+    vm_sin(u, t, n);
+    vm_cos(u, c, n);
+    for (int i = 0; i < n; i++) {
+        /* d/dx of -x sin(sqrt|x|) = -sin(s) - (s/2) cos(s), s = sqrt|x| */
+        da[i] = -t[i] - 0.5 * u[i] * c[i];
+        t[i] = (-x[i]) * t[i];
+    }
+}
+
+KERNEL_INLINE void grad_terms_dejong1(const double* x, double* t, double* da, double* db, int n)
+{
+    (void)db;
+    for (int i = 0; i < n; i++) {
+        t[i] = x[i] * x[i];
+        da[i] = 2.0 * x[i];
+    }
+}
+
+KERNEL_INLINE void grad_terms_rosenbrock(const double* x, double* t, double* da, double* db, int n)
+{
+    for (int i = 0; i < n; i++) {
+        double a = (x[i] * x[i] - x[i + 1]);
+        double b = (1.0 - x[i]);
+        t[i] = 100.0 * a * a + b * b;
+        da[i] = 400.0 * x[i] * a - 2.0 * b;
+        db[i] = -200.0 * a;
+    }
+}
+
+KERNEL_INLINE void grad_terms_rastrigin(const double* x, double* t, double* da, double* db, int n)
+{
+    double u[EVAL_CHUNK], s[EVAL_CHUNK];
+    (void)db;
+    for (int i = 0; i < n; i++) u[i] = 2.0 * M_PI * x[i];
+    vm_cos(u, t, n);
+    vm_sin(u, s, n);
+    for (int i = 0; i < n; i++) {
+        da[i] = 2.0 * x[i] + 20.0 * M_PI * s[i];
+        t[i] = x[i] * x[i] - 10.0 * t[i];
+    }
+}
+
+KERNEL_INLINE void grad_terms_sine_env_sine_wave(const double* x, double* t, double* da, double* db, int n)
+{
+    double q[EVAL_CHUNK + 1], a[EVAL_CHUNK], u[EVAL_CHUNK], c[EVAL_CHUNK];
+    for (int i = 0; i <= n; i++) q[i] = x[i] * x[i];
+    for (int i = 0; i < n; i++) {
+        a[i] = q[i] + q[i + 1];
+        u[i] = a[i] - 0.5;
+    }
+    vm_sin(u, t, n);
+    vm_cos(u, c, n);
+    for (int i = 0; i < n; i++) {
+        double num = t[i] * t[i];
+        double w = (1.0 + 0.001 * a[i]);
+        double den = w * w;
+        /* dt/da, then da/dx = 2x */
+        double dt = (2.0 * t[i] * c[i]) / den - (0.002 * num) / (den * w);
+        t[i] = 0.5 + (num / den);
+        da[i] = 2.0 * x[i] * dt;
+        db[i] = 2.0 * x[i + 1] * dt;
+    }
+}
+
+KERNEL_INLINE void grad_terms_stretch_v_sine_wave(const double* x, double* t, double* da, double* db, int n)
+{
+    double q[EVAL_CHUNK + 1], a[EVAL_CHUNK], u[EVAL_CHUNK], c[EVAL_CHUNK];
+    for (int i = 0; i <= n; i++) q[i] = x[i] * x[i];
+    for (int i = 0; i < n; i++) a[i] = q[i] + q[i + 1];
+    /* a^0.1 as exp(0.1 log a): vm_pow's own path for every normal a */
+    vm_log(a, c, n);
+    for (int i = 0; i < n; i++) c[i] = 0.1 * c[i];
+    vm_exp(c, u, n);
+    for (int i = 0; i < n; i++) u[i] = 50.0 * u[i];
+    vm_sin(u, t, n);
+    vm_cos(u, c, n);
+    for (int i = 0; i < n; i++) {
+        double ra = sqrt(sqrt(a[i]));      /* a^0.25 */
+        double term = (ra * t[i] * t[i]) + 1.0;
+        /* d(a^0.25)/da = 0.25 ra/a, d(50 a^0.1)/da = 0.1 u/a */
+        double dt = (a[i] > 0.0)
+            ? 2.0 * term * (ra / a[i]) * (0.25 * t[i] * t[i] + 0.2 * u[i] * t[i] * c[i])
+            : 0.0;
+        t[i] = term * term;
+        da[i] = 2.0 * x[i] * dt;
+        db[i] = 2.0 * x[i + 1] * dt;
+    }
+}
+
+KERNEL_INLINE void grad_terms_ackley_one(const double* x, double* t, double* da, double* db, int n)
+{
+    double q[EVAL_CHUNK + 1], u[EVAL_CHUNK], v[EVAL_CHUNK], c[EVAL_CHUNK];
+    double su[EVAL_CHUNK], cv[EVAL_CHUNK];
+    for (int i = 0; i <= n; i++) q[i] = x[i] * x[i];
+    for (int i = 0; i < n; i++) {
+        u[i] = 2.0 * x[i];
+        v[i] = 2.0 * x[i + 1];
+    }
+    vm_cos(u, c, n);
+    vm_sin(v, t, n);
+    vm_sin(u, su, n);
+    vm_cos(v, cv, n);
+    for (int i = 0; i < n; i++) {
+        double a = sqrt(q[i] + q[i + 1]);
+        double k = (a > 0.0) ? (1.0 / exp(0.2)) / a : 0.0;
+        t[i] = (1.0 / exp(0.2)) * a + 3.0 * (c[i] + t[i]);
+        da[i] = k * x[i] - 6.0 * su[i];
+        db[i] = k * x[i + 1] + 6.0 * cv[i];
+    }
+}
+
+KERNEL_INLINE void grad_terms_ackley_two(const double* x, double* t, double* da, double* db, int n)
+{
+    double q[EVAL_CHUNK + 1], c[EVAL_CHUNK + 1], s[EVAL_CHUNK + 1], u[EVAL_CHUNK + 1];
+    double a[EVAL_CHUNK], v[EVAL_CHUNK], e1[EVAL_CHUNK];
+
+    for (int i = 0; i <= n; i++) {
+        q[i] = x[i] * x[i];
+        u[i] = 2.0 * M_PI * x[i];
+    }
+    vm_cos(u, c, n + 1);
+    vm_sin(u, s, n + 1);
+
+    for (int i = 0; i < n; i++) {
+        a[i] = sqrt((q[i] + q[i + 1]) / 2.0);
+        u[i] = 0.2 * a[i];
+    }
+    vm_exp(u, e1, n);
+    for (int i = 0; i < n; i++) u[i] = 0.5 * (c[i] + c[i + 1]);
+    vm_exp(u, v, n);
+    for (int i = 0; i < n; i++) {
+        /* d(-20 e^{0.2a})/dx = -2 e^{0.2a} x / a; d(-e^{...})/dx = pi v sin(2 pi x) */
+        double k = (a[i] > 0.0) ? -2.0 * e1[i] / a[i] : 0.0;
+        t[i] = 20.0 + exp(1.0) - 20.0 * e1[i] - v[i];
+        da[i] = k * x[i] + M_PI * v[i] * s[i];
+        db[i] = k * x[i + 1] + M_PI * v[i] * s[i + 1];
+    }
+}
+
+KERNEL_INLINE void grad_terms_egg_holder(const double* x, double* t, double* da, double* db, int n)
+{
+    double u[EVAL_CHUNK], v[EVAL_CHUNK], s[EVAL_CHUNK], cu[EVAL_CHUNK], cv[EVAL_CHUNK];
+    for (int i = 0; i < n; i++) {
+        double xi = x[i];
+        double xj = x[i + 1];
+        u[i] = sqrt(fabs(xi - xj - 47.0));
+        v[i] = sqrt(fabs(xj + 47.0 + xi / 2.0));
+    }
+    vm_sin(u, s, n);
+    vm_sin(v, t, n);
+    vm_cos(u, cu, n);
+    vm_cos(v, cv, n);
+    for (int i = 0; i < n; i++) {
+        double xi = x[i];
+        double xj = x[i + 1];
+        double p = xi - xj - 47.0;
+        double r = xj + 47.0 + xi / 2.0;
+        /* d sin(sqrt|y|)/dy = cos(sqrt|y|) sign(y) / (2 sqrt|y|) */
+        double dp = (u[i] > 0.0) ? cu[i] / (2.0 * u[i]) : 0.0;
+        double dr = (v[i] > 0.0) ? cv[i] / (2.0 * v[i]) : 0.0;
+        if (p < 0.0) dp = -dp;
+        if (r < 0.0) dr = -dr;
+        da[i] = -s[i] - xi * dp - 0.5 * (xj + 47.0) * dr;
+        db[i] = xi * dp - t[i] - (xj + 47.0) * dr;
+        t[i] = (-xi * s[i]) + (-(xj + 47.0) * t[i]);
+    }
+}
+
+static double grad_schwefel(const double* x, int m, double* g)
+{
+    double sum = grad_sum_terms(x, m, 0, grad_terms_schwefel, g);
+    return 418.9829 * (double)m + sum;
+}
+
+static double grad_dejong1(const double* x, int m, double* g)
+{
+    return grad_sum_terms(x, m, 0, grad_terms_dejong1, g);
+}
+
+static double grad_rosenbrock(const double* x, int m, double* g)
+{
+    return grad_sum_terms(x, m, 1, grad_terms_rosenbrock, g);
+}
+
+static double grad_rastrigin(const double* x, int m, double* g)
+{
+    double sum = grad_sum_terms(x, m, 0, grad_terms_rastrigin, g);
+    return 10.0 * (double)m + sum;
+}
+
+/**
+ * @brief Griewangk value and gradient.
+ *
+ * d/dx_i of -prod cos(x_j / sqrt(j+1)) needs the product over j != i;
+ * it is formed from prefix products (stored in g on the forward pass)
+ * and a running suffix product on the backward pass, so no division
+ * by a cosine is needed.
+ */
+static double grad_griewangk(const double* x, int m, double* g)
+{
+    double u[EVAL_CHUNK], c[EVAL_CHUNK], s[EVAL_CHUNK];
+    double sum = 0.0;
+    double prod = 1.0;
+
+    for (int i0 = 0; i0 < m; i0 += EVAL_CHUNK) {
+        int n = (m - i0 < EVAL_CHUNK) ? m - i0 : EVAL_CHUNK;
+        for (int i = 0; i < n; i++) u[i] = x[i0 + i] / sqrt((double)(i0 + i + 1));
+        vm_cos(u, c, n);
+        for (int i = 0; i < n; i++) {
+            double xi = x[i0 + i];
+            sum += (xi * xi) / 4000.0;
+            g[i0 + i] = prod;          /* product of the cosines before i */
+            prod *= c[i];
+        }
+    }
+
+    double suffix = 1.0;
+    int last = ((m - 1) / EVAL_CHUNK) * EVAL_CHUNK;
+    for (int i0 = last; i0 >= 0; i0 -= EVAL_CHUNK) {
+        int n = (m - i0 < EVAL_CHUNK) ? m - i0 : EVAL_CHUNK;
+        for (int i = 0; i < n; i++) u[i] = x[i0 + i] / sqrt((double)(i0 + i + 1));
+        vm_cos(u, c, n);
+        vm_sin(u, s, n);
+        for (int i = n - 1; i >= 0; i--) {
+            double others = g[i0 + i] * suffix;
+            g[i0 + i] = x[i0 + i] / 2000.0 + s[i] / sqrt((double)(i0 + i + 1)) * others;
+            suffix *= c[i];
+        }
+    }
+
+    return 1.0 + sum - prod;
+}
+
+static double grad_sine_env_sine_wave(const double* x, int m, double* g)
+{
+    double sum = grad_sum_terms(x, m, 1, grad_terms_sine_env_sine_wave, g);
+    for (int j = 0; j < m; j++) g[j] = -g[j];
+    return -sum;
+}
+
+static double grad_stretch_v_sine_wave(const double* x, int m, double* g)
+{
+    return grad_sum_terms(x, m, 1, grad_terms_stretch_v_sine_wave, g);
+}
+
+static double grad_ackley_one(const double* x, int m, double* g)
+{
+    return grad_sum_terms(x, m, 1, grad_terms_ackley_one, g);
+}
+
+static double grad_ackley_two(const double* x, int m, double* g)
+{
+    return grad_sum_terms(x, m, 1, grad_terms_ackley_two, g);
+}
+
+static double grad_egg_holder(const double* x, int m, double* g)
+{
+    return grad_sum_terms(x, m, 1, grad_terms_egg_holder, g);
+}
+
+/*
+ * Float32-storage kernels.
+ *
+ * The coordinates are read as float and widened into a double chunk
+ * buffer right before the term generators run, so a block costs half
+ * the memory traffic of its double copy while all arithmetic stays in
+ * double. Chunks, blocks and summation order are those of the double
+ * kernels, so every result equals problem_eval_batch() on the widened
+ * rows bit for bit. The vecmath routines are double only; evaluating
+ * the terms in float would cost Schwefel and Egg Holder about four
+ * significant digits.
+ */
+
+/**
+ * @brief Widens n float coordinates into a double buffer.
+ */
+KERNEL_INLINE void widen(const float* xf, double* x, int n)
+{
+    for (int i = 0; i < n; i++) x[i] = (double)xf[i];
+}
+
+/**
+ * @brief sum_row_blocked() for a row stored as float.
+ */
+static double sum_row_blocked_f32(const float* x, int nt, int pair, TermFn term)
+{
+    double part[LARGE_MAX_BLOCKS];
+    int nb;
+    int bs = large_blocks(nt, &nb);
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < nb; b++) {
+        double xw[EVAL_CHUNK + 1], t[EVAL_CHUNK];
+        int i1 = (b + 1 < nb) ? (b + 1) * bs : nt;
+        double sum = 0.0;
+        for (int i0 = b * bs; i0 < i1; i0 += EVAL_CHUNK) {
+            int n = (i1 - i0 < EVAL_CHUNK) ? i1 - i0 : EVAL_CHUNK;
+            widen(x + i0, xw, n + pair);
+            term(xw, t, n);
+            for (int i = 0; i < n; i++) sum += t[i];
+        }
+        part[b] = sum;
+    }
+
+    double sum = 0.0;
+    for (int b = 0; b < nb; b++) sum += part[b];
+    return sum;
+}
+
+/**
+ * @brief sum_terms() for rows stored as float.
+ *
+ * Packed small rows are widened a chunk at a time; longer rows one
+ * span (plus the extra coordinate of a pair problem) at a time.
+ */
+static void sum_terms_f32(const float* X, int k, int m, int pair, TermFn term, double* out)
+{
+    double xw[EVAL_CHUNK + 1], t[EVAL_CHUNK];
+    int nt = m - pair;
+
+    if (m <= EVAL_CHUNK) {
+        int rows = EVAL_CHUNK / m;
+        for (int r0 = 0; r0 < k; r0 += rows) {
+            int nr = (k - r0 < rows) ? k - r0 : rows;
+            widen(X + (size_t)r0 * (size_t)m, xw, nr * m);
+            term(xw, t, nr * m - pair);
+            row_sums(t, nr, m, nt, out + r0);
+        }
+        return;
+    }
+
+    for (int r = 0; r < k; r++) {
+        const float* x = X + (size_t)r * (size_t)m;
+        if (nt >= LARGE_DIM_MIN) {
+            out[r] = sum_row_blocked_f32(x, nt, pair, term);
+            continue;
+        }
+        double sum = 0.0;
+        for (int i0 = 0; i0 < nt; i0 += EVAL_CHUNK) {
+            int n = (nt - i0 < EVAL_CHUNK) ? nt - i0 : EVAL_CHUNK;
+            widen(x + i0, xw, n + pair);
+            term(xw, t, n);
+            for (int i = 0; i < n; i++) sum += t[i];
+        }
+        out[r] = sum;
+    }
+}
+
+/**
+ * @brief Griewangk sum and product partials over coordinates [i0, i1) of a float row.
+ */
+static void griewangk_span_f32(const float* x, int i0, int i1, double* sum, double* prod)
+{
+    double xw[EVAL_CHUNK], u[EVAL_CHUNK], c[EVAL_CHUNK];
+
+    for (; i0 < i1; i0 += EVAL_CHUNK) {
+        int n = (i1 - i0 < EVAL_CHUNK) ? i1 - i0 : EVAL_CHUNK;
+        widen(x + i0, xw, n);
+        for (int i = 0; i < n; i++) u[i] = xw[i] / sqrt((double)(i0 + i + 1));
+        vm_cos(u, c, n);
+        for (int i = 0; i < n; i++) {
+            *sum += (xw[i] * xw[i]) / 4000.0;
+            *prod *= c[i];
+        }
+    }
+}
+
+static void batch_f32_griewangk(const float* X, int k, int m, double* out)
+{
+    for (int r = 0; r < k; r++) {
+        const float* x = X + (size_t)r * (size_t)m;
+        double sum = 0.0;
+        double prod = 1.0;
+        if (m < LARGE_DIM_MIN) {
+            griewangk_span_f32(x, 0, m, &sum, &prod);
+            out[r] = 1.0 + sum - prod;
+            continue;
+        }
+
+        /* same blocks as griewangk_row_blocked() */
+        double part_sum[LARGE_MAX_BLOCKS], part_prod[LARGE_MAX_BLOCKS];
+        int nb;
+        int bs = large_blocks(m, &nb);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int b = 0; b < nb; b++) {
+            double s = 0.0;
+            double p = 1.0;
+            griewangk_span_f32(x, b * bs, (b + 1 < nb) ? (b + 1) * bs : m, &s, &p);
+            part_sum[b] = s;
+            part_prod[b] = p;
+        }
+        for (int b = 0; b < nb; b++) {
+            sum += part_sum[b];
+            prod *= part_prod[b];
+        }
+        out[r] = 1.0 + sum - prod;
+    }
+}
+
+static void batch_f32_schwefel(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 0, terms_schwefel, out);
+    for (int r = 0; r < k; r++) out[r] = 418.9829 * (double)m + out[r];
+}
+
+static void batch_f32_dejong1(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 0, terms_dejong1, out);
+}
+
+static void batch_f32_rosenbrock(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 1, terms_rosenbrock, out);
+}
+
+static void batch_f32_rastrigin(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 0, terms_rastrigin, out);
+    for (int r = 0; r < k; r++) out[r] = 10.0 * (double)m + out[r];
+}
+
+static void batch_f32_sine_env_sine_wave(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 1, terms_sine_env_sine_wave, out);
+    for (int r = 0; r < k; r++) out[r] = -out[r];
+}
+
+static void batch_f32_stretch_v_sine_wave(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 1, terms_stretch_v_sine_wave, out);
+}
+
+static void batch_f32_ackley_one(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 1, terms_ackley_one, out);
+}
+
+static void batch_f32_ackley_two(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 1, terms_ackley_two, out);
+}
+
+static void batch_f32_egg_holder(const float* X, int k, int m, double* out)
+{
+    sum_terms_f32(X, k, m, 1, terms_egg_holder, out);
+}
+
+/*
+ * Input transformation for shifted/rotated problems (transform.c).
+ *
+ * The rotation itself is built once per run by orthogonalize_rows();
+ * it is O(m^3), so it lives here to get the vector width too.
+ *
+ * Z = (X - 1 o^T) R^T for a block of k rows is one matrix-matrix
+ * product. It is blocked so a KB x NB tile of R^T stays in L2 while
+ * every row of the block streams past it, and the inner loop folds
+ * four rows of R^T into each pass over an NB-wide slice of Z (kept in
+ * L1). Every z_i still accumulates its products in increasing j, so
+ * the result does not depend on k, the blocking or the ISA.
+ */
+
+/** Rows of R^T (the inner dimension) per tile. */
+#define GEMM_KB 64
+
+/** Columns of R^T (entries of z) per tile. */
+#define GEMM_NB 256
+
+/**
+ * @brief Computes Z = (X - 1 o^T) R^T for k rows of dimension m.
+ *
+ * @param X Block of k row-major vectors.
+ * @param k Number of rows.
+ * @param m Dimension of each row.
+ * @param shift Shift vector o (m values), or NULL for none.
+ * @param rot_t R^T (m*m, row-major), or NULL for no rotation.
+ * @param Z Output block (k*m values, must not alias X).
+ */
+static void gemm_transform(const double* X, int k, int m, const double* shift,
+                           const double* rot_t, double* Z)
+{
+    if (!rot_t) {
+        for (int r = 0; r < k; r++) {
+            const double* x = X + (size_t)r * (size_t)m;
+            double* z = Z + (size_t)r * (size_t)m;
+            for (int j = 0; j < m; j++) z[j] = shift ? x[j] - shift[j] : x[j];
+        }
+        return;
+    }
+
+    size_t len = (size_t)k * (size_t)m;
+    for (size_t j = 0; j < len; j++) Z[j] = 0.0;
+
+    for (int i0 = 0; i0 < m; i0 += GEMM_NB) {
+        int ni = (m - i0 < GEMM_NB) ? m - i0 : GEMM_NB;
+        for (int j0 = 0; j0 < m; j0 += GEMM_KB) {
+            int j1 = (m - j0 < GEMM_KB) ? m : j0 + GEMM_KB;
+            for (int r = 0; r < k; r++) {
+                const double* x = X + (size_t)r * (size_t)m;
+                double* z = Z + (size_t)r * (size_t)m + i0;
+                int j = j0;
+                for (; j + 4 <= j1; j += 4) {
+                    double d0 = shift ? x[j] - shift[j] : x[j];
+                    double d1 = shift ? x[j + 1] - shift[j + 1] : x[j + 1];
+                    double d2 = shift ? x[j + 2] - shift[j + 2] : x[j + 2];
+                    double d3 = shift ? x[j + 3] - shift[j + 3] : x[j + 3];
+                    const double* r0 = rot_t + (size_t)j * (size_t)m + i0;
+                    const double* r1 = r0 + m;
+                    const double* r2 = r1 + m;
+                    const double* r3 = r2 + m;
+                    for (int i = 0; i < ni; i++) {
+                        z[i] = (((z[i] + d0 * r0[i]) + d1 * r1[i]) + d2 * r2[i]) + d3 * r3[i];
+                    }
+                }
+                for (; j < j1; j++) {
+                    double d = shift ? x[j] - shift[j] : x[j];
+                    const double* rj = rot_t + (size_t)j * (size_t)m + i0;
+                    for (int i = 0; i < ni; i++) z[i] = z[i] + d * rj[i];
+                }
+            }
+        }
+    }
+}
+
+/** Rows orthogonalized together by orthogonalize_rows(). */
+#define ORTHO_BLOCK 32
+
+/**
+ * @brief Dot product with four independent partial sums, so it
+ *        vectorizes without reassociating anything.
+ */
+KERNEL_INLINE double dot_product(const double* a, const double* b, int n)
+{
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    int j = 0;
+    for (; j + 4 <= n; j += 4) {
+        s0 += a[j] * b[j];
+        s1 += a[j + 1] * b[j + 1];
+        s2 += a[j + 2] * b[j + 2];
+        s3 += a[j + 3] * b[j + 3];
+    }
+    for (; j < n; j++) s0 += a[j] * b[j];
+    return (s0 + s1) + (s2 + s3);
+}
+
+/**
+ * @brief Removes the component along the unit vector qp from qi.
+ */
+KERNEL_INLINE void project_out(double* qi, const double* qp, int m)
+{
+    double dot = dot_product(qi, qp, m);
+    for (int j = 0; j < m; j++) qi[j] -= dot * qp[j];
+}
+
+/**
+ * @brief Orthonormalizes the rows of q in place (modified Gram-Schmidt).
+ *
+ * Every row sees the same projections in the same order as in the
+ * textbook loop, but ORTHO_BLOCK rows are swept together so each
+ * finished row is read once per block rather than once per row. The
+ * operation order is fixed, so every ISA builds the same matrix.
+ *
+ * @param q Matrix (m*m, row-major) with linearly independent rows.
+ * @param m Dimension.
+ */
+static void orthogonalize_rows(double* q, int m)
+{
+    for (int i0 = 0; i0 < m; i0 += ORTHO_BLOCK) {
+        int i1 = (m - i0 < ORTHO_BLOCK) ? m : i0 + ORTHO_BLOCK;
+
+        /* finished rows, each read once for the whole block */
+        for (int p = 0; p < i0; p++) {
+            const double* qp = q + (size_t)p * (size_t)m;
+            for (int i = i0; i < i1; i++) project_out(q + (size_t)i * (size_t)m, qp, m);
+        }
+
+        /* rows inside the block */
+        for (int i = i0; i < i1; i++) {
+            double* qi = q + (size_t)i * (size_t)m;
+            for (int p = i0; p < i; p++) project_out(qi, q + (size_t)p * (size_t)m, m);
+            double norm = sqrt(dot_product(qi, qi, m));
+            for (int j = 0; j < m; j++) qi[j] /= norm;
+        }
+    }
+}
+
+/** Expression interpreter of this build, compiled from expr_kernels.c. */
+void EXPR_BATCH_NAME(KERNEL_ISA)(ExprProgram* p, const double* X, int k, int m, double* f_out);
+
+/** Kernel table exported by this ISA build. */
+const KernelTable KERNEL_TABLE(KERNEL_ISA) = {
+    KERNEL_STR(KERNEL_ISA),
+#if defined(KERNEL_FAST)
+    PRECISION_FAST,
+#else
+    PRECISION_EXACT,
+#endif
+    {
+        NULL,
+        batch_schwefel,
+        batch_dejong1,
+        batch_rosenbrock,
+        batch_rastrigin,
+        batch_griewangk,
+        batch_sine_env_sine_wave,
+        batch_stretch_v_sine_wave,
+        batch_ackley_one,
+        batch_ackley_two,
+        batch_egg_holder
+    },
+    {
+        NULL,
+        eval_schwefel,
+        eval_dejong1,
+        eval_rosenbrock,
+        eval_rastrigin,
+        eval_griewangk,
+        eval_sine_env_sine_wave,
+        eval_stretch_v_sine_wave,
+        eval_ackley_one,
+        eval_ackley_two,
+        eval_egg_holder
+    },
+    {
+        NULL,
+        delta_schwefel,
+        delta_dejong1,
+        delta_rosenbrock,
+        delta_rastrigin,
+        delta_griewangk,
+        delta_sine_env_sine_wave,
+        delta_stretch_v_sine_wave,
+        delta_ackley_one,
+        delta_ackley_two,
+        delta_egg_holder
+    },
+    {
+        NULL,
+        NULL,
+        bounded_dejong1,
+        bounded_rosenbrock,
+        bounded_rastrigin,
+        NULL,
+        NULL,
+        bounded_stretch_v_sine_wave,
+        bounded_ackley_one,
+        NULL,
+        NULL
+    },
+    {
+        NULL,
+        batch_f32_schwefel,
+        batch_f32_dejong1,
+        batch_f32_rosenbrock,
+        batch_f32_rastrigin,
+        batch_f32_griewangk,
+        batch_f32_sine_env_sine_wave,
+        batch_f32_stretch_v_sine_wave,
+        batch_f32_ackley_one,
+        batch_f32_ackley_two,
+        batch_f32_egg_holder
+    },
+    batch_multi,
+    gemm_transform,
+    orthogonalize_rows,
+    {
+        NULL,
+        grad_schwefel,
+        grad_dejong1,
+        grad_rosenbrock,
+        grad_rastrigin,
+        grad_griewangk,
+        grad_sine_env_sine_wave,
+        grad_stretch_v_sine_wave,
+        grad_ackley_one,
+        grad_ackley_two,
+        grad_egg_holder
+    },
+    EXPR_BATCH_NAME(KERNEL_ISA)
+};
@@ -0,0 +1,235 @@
+/**
+ * @file lbfgs.c
+ * @brief Bound-constrained L-BFGS local search.
+ *
+ * Projected L-BFGS on problem_eval_grad(): the two-loop recursion
+ * gives the quasi-Newton direction over the free coordinates and a
+ * backtracking line search keeps every trial point inside the bounds.
+ */
+
+#include "lbfgs.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Sufficient-decrease constant of the Armijo condition. */
+#define LBFGS_ARMIJO 1e-4
+
+/** Maximum step halvings per line search. */
+#define LBFGS_MAX_BACKTRACK 40
+
+/** Relative improvement below which the search is considered converged. */
+#define LBFGS_FTOL 1e-10
+
+/** Projected-gradient infinity norm below which x is a stationary point. */
+#define LBFGS_PGTOL 1e-10
+
+/**
+ * @brief Dot product of two vectors.
+ */
+static double dot(const double* a, const double* b, int m)
+{
+    double s = 0.0;
+    for (int j = 0; j < m; j++) s += a[j] * b[j];
+    return s;
+}
+
+/**
+ * @brief Tells whether coordinate j is held at a bound by the gradient.
+ *
+ * @return 1 if moving against the gradient would leave [lower, upper].
+ */
+static int at_active_bound(double xj, double gj, double lower, double upper)
+{
+    return (xj <= lower && gj > 0.0) || (xj >= upper && gj < 0.0);
+}
+
+/**
+ * @brief Two-loop recursion: d = -H g over the free coordinates.
+ *
+ * Active coordinates get a zero direction; H is the L-BFGS inverse
+ * Hessian built from the stored pairs, scaled by s.y / y.y of the
+ * newest pair.
+ *
+ * @param m Dimension.
+ * @param x Current point.
+ * @param g Gradient at x.
+ * @param lower Lower bound.
+ * @param upper Upper bound.
+ * @param S Correction pairs s (LBFGS_MEMORY rows of m).
+ * @param Y Correction pairs y (LBFGS_MEMORY rows of m).
+ * @param rho 1 / (s.y) per pair.
+ * @param count Number of stored pairs.
+ * @param newest Row of the newest pair.
+ * @param d Output direction (m values).
+ */
+static void lbfgs_direction(int m, const double* x, const double* g,
+                            double lower, double upper,
+                            const double* S, const double* Y, const double* rho,
+                            int count, int newest, double* d)
+{
+    double a[LBFGS_MEMORY];
+
+    for (int j = 0; j < m; j++) {
+        d[j] = at_active_bound(x[j], g[j], lower, upper) ? 0.0 : g[j];
+    }
+
+    int k = newest;
+    for (int i = 0; i < count; i++) {
+        const double* s = S + (size_t)k * (size_t)m;
+        const double* y = Y + (size_t)k * (size_t)m;
+        a[k] = rho[k] * dot(s, d, m);
+        for (int j = 0; j < m; j++) d[j] -= a[k] * y[j];
+        k = (k + LBFGS_MEMORY - 1) % LBFGS_MEMORY;
+    }
+
+    if (count > 0) {
+        const double* y = Y + (size_t)newest * (size_t)m;
+        double gamma = 1.0 / (rho[newest] * dot(y, y, m));
+        for (int j = 0; j < m; j++) d[j] *= gamma;
+    }
+
+    for (int i = 0; i < count; i++) {
+        k = (k + 1) % LBFGS_MEMORY;
+        const double* s = S + (size_t)k * (size_t)m;
+        const double* y = Y + (size_t)k * (size_t)m;
+        double b = rho[k] * dot(y, d, m);
+        for (int j = 0; j < m; j++) d[j] += (a[k] - b) * s[j];
+    }
+
+    for (int j = 0; j < m; j++) {
+        d[j] = at_active_bound(x[j], g[j], lower, upper) ? 0.0 : -d[j];
+    }
+}
+
+/**
+ * @brief Minimizes a problem from a starting point inside [lower, upper]^m.
+ *
+ * @param p Pointer to the optimization problem.
+ * @param m Dimension of the problem.
+ * @param x Starting point on input, final point on output (m values).
+ * @param lower Lower bound for each dimension.
+ * @param upper Upper bound for each dimension.
+ * @param max_iter Maximum number of iterations.
+ * @param target Stop once f <= target (NAN to never stop early).
+ * @param f_out Output parameter for the fitness of the final point.
+ * @param iters_out Optional output for the iterations performed, or NULL.
+ * @param evals_out Optional output for the number of evaluations, or NULL.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure.
+ */
+int lbfgs_minimize(const Problem* p, int m, double* x,
+                   double lower, double upper, int max_iter, double target,
+                   double* f_out, int* iters_out, double* evals_out)
+{
+    if (!p || !x || m <= 0 || max_iter < 0 || !(lower < upper) || !f_out) return 1;
+
+    /* g, g_new, x_new, d, the candidate pair s, y, then the S and Y histories */
+    size_t len = (size_t)(6 + 2 * LBFGS_MEMORY) * (size_t)m;
+    double* work = (double*)malloc(len * sizeof(double));
+    if (!work) return 2;
+
+    double* g = work;
+    double* g_new = g + m;
+    double* x_new = g_new + m;
+    double* d = x_new + m;
+    double* s = d + m;
+    double* y = s + m;
+    double* S = y + m;
+    double* Y = S + (size_t)LBFGS_MEMORY * (size_t)m;
+    double rho[LBFGS_MEMORY];
+    int count = 0;
+    int newest = LBFGS_MEMORY - 1;
+
+    for (int j = 0; j < m; j++) {
+        if (x[j] < lower) x[j] = lower;
+        else if (x[j] > upper) x[j] = upper;
+    }
+
+    double f = problem_eval_grad(p, x, m, g);
+    double evals = 1.0;
+    int iter = 0;
+
+    while (iter < max_iter && isfinite(f)) {
+        double pg = 0.0;
+        for (int j = 0; j < m; j++) {
+            if (!at_active_bound(x[j], g[j], lower, upper) && fabs(g[j]) > pg) pg = fabs(g[j]);
+        }
+        if (pg <= LBFGS_PGTOL) break;
+
+        lbfgs_direction(m, x, g, lower, upper, S, Y, rho, count, newest, d);
+        if (!(dot(g, d, m) < 0.0)) {
+            /* H lost positive curvature on the free set: restart */
+            count = 0;
+            for (int j = 0; j < m; j++) {
+                d[j] = at_active_bound(x[j], g[j], lower, upper) ? 0.0 : -g[j];
+            }
+        }
+
+        /* without curvature pairs, cap the first step at 10% of the range */
+        double alpha = 1.0;
+        if (count == 0) {
+            double dmax = 0.0;
+            for (int j = 0; j < m; j++) if (fabs(d[j]) > dmax) dmax = fabs(d[j]);
+            double cap = 0.1 * (upper - lower) / dmax;
+            if (cap < alpha) alpha = cap;
+        }
+
+        double f_new = f;
+        int accepted = 0;
+        for (int ls = 0; ls < LBFGS_MAX_BACKTRACK; ls++) {
+            double gs = 0.0;
+            for (int j = 0; j < m; j++) {
+                double v = x[j] + alpha * d[j];
+                if (v < lower) v = lower;
+                else if (v > upper) v = upper;
+                x_new[j] = v;
+                gs += g[j] * (v - x[j]);
+            }
+            f_new = problem_eval_grad(p, x_new, m, g_new);
+            evals += 1.0;
+            if (f_new <= f + LBFGS_ARMIJO * gs && gs < 0.0) {
+                accepted = 1;
+                break;
+            }
+            alpha *= 0.5;
+        }
+        if (!accepted) break;
+        iter++;
+
+        /* store s = x_new - x, y = g_new - g if the curvature is positive;
+           the slot may hold the oldest live pair, so it is only overwritten then */
+        for (int j = 0; j < m; j++) {
+            s[j] = x_new[j] - x[j];
+            y[j] = g_new[j] - g[j];
+        }
+        double sy = dot(s, y, m);
+        if (sy > 1e-10 * dot(y, y, m)) {
+            int slot = (newest + 1) % LBFGS_MEMORY;
+            memcpy(S + (size_t)slot * (size_t)m, s, (size_t)m * sizeof(double));
+            memcpy(Y + (size_t)slot * (size_t)m, y, (size_t)m * sizeof(double));
+            rho[slot] = 1.0 / sy;
+            newest = slot;
+            if (count < LBFGS_MEMORY) count++;
+        }
+
+        double scale = fmax(fmax(fabs(f), fabs(f_new)), 1.0);
+        int converged = (f - f_new) <= LBFGS_FTOL * scale;
+
+        memcpy(x, x_new, (size_t)m * sizeof(double));
+        memcpy(g, g_new, (size_t)m * sizeof(double));
+        f = f_new;
+        if (converged || f <= target) break;
+    }
+
+    /* the gradient kernels match problem_eval() only up to rounding for large m */
+    *f_out = problem_eval(p, x, m);
+    evals += 1.0;
+
+    if (iters_out) *iters_out = iter;
+    if (evals_out) *evals_out = evals;
+
+    free(work);
+    return 0;
+}
@@ -9,12 +9,18 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+#include <string.h>
 
 #include "config.h"
-#include "mt19937ar.h"
+#include "rng.h"
 #include "problem.h"
 #include "algorithms.h"
+#include "kernels.h"
 #include "csv.h"
+#include "plugin.h"
+#include "expr.h"
+#include "autotune.h"
 
 /**
  * @brief Prints program usage instructions.
@@ -24,115 +30,646 @@
 static void print_usage(const char* exe)
 {
     printf("Usage: %s <config_file>\n", exe);
+    printf("       %s --autotune <config_file> (time the kernel variants, write profile=)\n", exe);
     printf("Required config keys:\n");
-    printf("  m=10|20|30\n");
+    printf("  m=10|20|30 (any m > 0; m >= 16384 uses the threaded blocked path)\n");
     printf("  n=<iterations> (default 30)\n");
-    printf("  problem=1..10\n");
+    printf("  problem=1..10|0|plugin:<path> (0 = all problems; blind search shares samples;\n");
+    printf("          plugin: loads an objective from a shared library, see objective_plugin.h)\n");
+    printf("  objective=<expression> (instead of problem=; e.g. sum(x[i]^2 - 10*cos(2*pi*x[i])) + 10*m,\n");
+    printf("          needs lower= and upper=, see expr.h for the syntax)\n");
     printf("  algorithm=blind|rls\n");
     printf("  neighbors=<k>\n");
     printf("  step=<fraction>\n");
     printf("  max_ls_steps=<cap>\n");
+    printf("  neighborhood=full|coordinate (optional, default full)\n");
+    printf("  local=sampling|lbfgs (optional, default sampling; lbfgs uses the analytic gradient)\n");
     printf("  seed=<number>|SYS_TIME\n");
+    printf("  lower=<bound> upper=<bound> (optional, default problem range)\n");
+    printf("  isa=auto|sse2|avx2|avx512 (optional, default auto)\n");
+    printf("  threads=<count> (optional, default 0 = all cores)\n");
+    printf("  precision=exact|fast (optional, default exact; fast re-checks the best with libm)\n");
+    printf("  transform=none|shift|rotate|shift_rotate (optional; transform_<problem>= per problem)\n");
+    printf("  transform_seed=<number> (optional, default 1)\n");
+    printf("  target=none|optimum|<fitness> (optional; stop once reached and report evaluations/time to it)\n");
+    printf("  storage=double|float32 (optional, default double; float32 halves candidate block memory)\n");
+    printf("  cache=off|exact|<resolution> (optional, default off; memoizes (R)LS evaluations,\n");
+    printf("          <resolution> shares one value per grid cell), cache_mb=<MiB> (default 64)\n");
+    printf("  profile=<path>|none (optional, default project2.profile; --autotune results used for isa=auto,\n");
+    printf("          threads=0 and the evaluation block size)\n");
     printf("  output=<csv path>\n");
 }
 
+/**
+ * @brief Resolves the search bounds for a problem.
+ *
+ * Bounds set to "default" in the config fall back to the problem's own
+ * range.
+ *
+ * @param cfg Loaded configuration.
+ * @param prob Problem descriptor.
+ * @param lower Output lower bound.
+ * @param upper Output upper bound.
+ * @return 0 on success, 4 if lower >= upper.
+ */
+static int resolve_bounds(const Config* cfg, const Problem* prob, double* lower, double* upper)
+{
+    *lower = isnan(cfg->lower) ? prob->lower : cfg->lower;
+    *upper = isnan(cfg->upper) ? prob->upper : cfg->upper;
+    if (*lower >= *upper) {
+        fprintf(stderr,
+                "Invalid range: lower (%.6f) must be < upper (%.6f)\n",
+                *lower, *upper);
+        return 4;
+    }
+    return 0;
+}
+
+/**
+ * @brief Resolves the early-stop fitness for a problem.
+ *
+ * @param cfg Loaded configuration.
+ * @param prob Problem descriptor.
+ * @return Fitness to reach, or NAN if the run should not stop early
+ *         (no target, or target=optimum on a problem without one).
+ */
+static double resolve_target(const Config* cfg, const Problem* prob)
+{
+    if (cfg->target == TARGET_VALUE) return cfg->target_value;
+    if (cfg->target == TARGET_OPTIMUM) return prob->optimum + prob->optimum_tol;
+    return NAN;
+}
+
+/**
+ * @brief Appends the per-iteration fitness values of one run to the CSV.
+ *
+ * A replay= run writes its single row under the replayed iteration.
+ *
+ * @param cfg Loaded configuration.
+ * @param prob Problem that was run.
+ * @param values Fitness per iteration.
+ * @param count Number of iterations run (cfg->n unless the target was reached).
+ * @param time_ms Runtime of the run in milliseconds.
+ */
+static void write_results(const Config* cfg, const Problem* prob, const double* values, int count,
+                          double time_ms)
+{
+    int first = (cfg->replay >= 0) ? cfg->replay : 0;
+
+    for (int i = 0; i < count; i++) {
+        csv_append_result(
+            cfg->output_csv,
+            cfg->alg,
+            prob,
+            cfg->m,
+            first + i,
+            values[i],
+            time_ms,
+            cfg->rng
+        );
+    }
+}
+
+/**
+ * @brief Prints the one-line summary of a run.
+ *
+ * @param cfg Loaded configuration.
+ * @param opt Search options the run used.
+ * @param prob Problem that was run.
+ * @param best Best fitness found.
+ * @param time_ms Runtime of the run in milliseconds.
+ */
+static void print_summary(const Config* cfg, const SearchOptions* opt, const Problem* prob,
+                          double best, double time_ms)
+{
+    char block[32] = "";
+    if (opt->block > 0) snprintf(block, sizeof(block), " block=%d", opt->block);
+
+    printf("[ALG=%d] %s%s%s (m=%d): best=%.6g time=%.3f ms isa=%s%s%s%s%s%s threads=%d%s\n",
+           cfg->alg,
+           problem_name(prob),
+           prob->transform ? " " : "",
+           prob->transform ? transform_name(prob->transform->kind) : "",
+           cfg->m,
+           best,
+           time_ms,
+           kernels_active()->isa,
+           kernels_active()->precision == PRECISION_FAST ? " precision=fast" : "",
+           opt->storage == STORAGE_F32 ? " storage=float32" : "",
+           (cfg->alg == ALG_RLS && opt->local == LS_LBFGS) ? " local=lbfgs" : "",
+           cfg->rng != RNG_MT19937 ? " rng=" : "",
+           cfg->rng != RNG_MT19937 ? rng_name(cfg->rng) : "",
+           kernels_threads(),
+           block);
+}
+
+/**
+ * @brief Prints the time-to-target line of a run with target= set.
+ *
+ * @param prob Problem that was run.
+ * @param alg Algorithm that was run.
+ * @param target Resolved target (NAN if the problem has no known optimum).
+ * @param stats Counters of the run.
+ */
+static void print_target(const Problem* prob, AlgorithmType alg, double target,
+                         const SearchStats* stats)
+{
+    const char* unit = (alg == ALG_RLS) ? "restarts" : "samples";
+
+    if (isnan(target)) {
+        printf("  target: %s has no known optimum, ran all %d %s\n",
+               problem_name(prob), stats->iterations, unit);
+    } else if (!isnan(stats->target_evals)) {
+        printf("  target=%.6g reached after %d %s, %.0f evaluations, %.3f ms\n",
+               target, stats->iterations, unit, stats->target_evals, stats->target_ms);
+    } else {
+        printf("  target=%.6g not reached in %d %s, %.0f evaluations\n",
+               target, stats->iterations, unit, stats->evals);
+    }
+}
+
+/**
+ * @brief Prints the hit statistics of the evaluation cache.
+ *
+ * @param cache Cache used by the run.
+ */
+static void print_cache(const EvalCache* cache)
+{
+    double lookups = cache->hits + cache->misses;
+
+    printf("  cache: %.0f hits, %.0f misses (%.1f%% hit rate), %zu slots, %.1f MiB\n",
+           cache->hits, cache->misses,
+           lookups > 0.0 ? 100.0 * cache->hits / lookups : 0.0,
+           evalcache_slots(cache), (double)evalcache_bytes(cache) / (1024.0 * 1024.0));
+}
+
+/**
+ * @brief precision=fast self-check: re-evaluates the best vector with libm.
+ *
+ * Prints the kernel and reference values and warns if their difference
+ * exceeds the problem's documented fast-mode error bound.
+ *
+ * @param prob Problem that was run.
+ * @param best_x Best vector found.
+ * @param m Dimension of best_x.
+ * @param best Fitness the fast kernels reported for best_x.
+ * @return Reference fitness of best_x, reported instead of @p best.
+ */
+static double check_fast_best(const Problem* prob, const double* best_x, int m, double best)
+{
+    double exact = problem_eval_reference(prob, best_x, m);
+    double err = fabs(best - exact) / fmax(fabs(exact), 1.0);
+
+    printf("  precision=fast check (%s): kernel=%.17g libm=%.17g err=%.2e bound=%.0e\n",
+           problem_name(prob), best, exact, err, prob->fast_err);
+    if (!(err <= prob->fast_err)) {
+        fprintf(stderr, "WARNING: %s fast-mode error %.2e exceeds documented bound %.0e\n",
+                problem_name(prob), err, prob->fast_err);
+    }
+    return exact;
+}
+
+/**
+ * @brief Runs the configured algorithm on a problem descriptor and records it.
+ *
+ * A configured shift/rotation is built first (it draws from the RNG
+ * with its own seed), then the run's stream starts as a copy of
+ * @p seeded, so every problem starts from the same search sequence
+ * (and the seed_stream= jumps are done once per process). Plugins and
+ * expressions are never transformed; options they cannot serve
+ * (storage=float32 without a float kernel, local=lbfgs without a
+ * gradient) fall back with a note on stderr. A profile entry sets the
+ * evaluation block size, and the thread count if threads= is not set.
+ *
+ * @param cfg Loaded configuration.
+ * @param prob Problem to run (built-in, plugin or expression).
+ * @param values Workspace for the per-iteration fitness (cfg->n values).
+ * @param tune Autotune profile entry for this run, or NULL.
+ * @param seeded Stream seeded from cfg->seed and cfg->seed_stream.
+ * @return 0 on success, 4 on an invalid range, 5 for an unsupported
+ *         algorithm, 6 if the algorithm fails.
+ */
+static int run_search(const Config* cfg, Problem* prob, double* values, const TuneEntry* tune,
+                      const Rng* seeded)
+{
+    ProblemType t = prob->type;
+
+    double lower, upper;
+    int rc = resolve_bounds(cfg, prob, &lower, &upper);
+    if (rc != 0) return rc;
+
+    Transform tr;
+    TransformKind kind = (t > PROB_EGG_HOLDER) ? TRANSFORM_NONE : cfg->transform[t];
+    if (kind != TRANSFORM_NONE) {
+        rc = transform_init(&tr, cfg->m, kind, lower, upper, cfg->transform_seed + (uint32_t)t);
+        if (rc != 0) {
+            fprintf(stderr, "Failed to build the %s transform for m=%d (code %d)\n",
+                    transform_name(kind), cfg->m, rc);
+            return 6;
+        }
+        problem_set_transform(prob, &tr);
+    }
+
+    /* every problem run starts its own stream from the configured seed */
+    Rng rng = *seeded;
+
+    double best = 0.0;
+    double time_ms = 0.0;
+
+    /* the fast-precision self-check needs the best vector */
+    double* best_x = NULL;
+    if (cfg->precision == PRECISION_FAST) {
+        best_x = malloc(sizeof(double) * (size_t)cfg->m);
+        if (!best_x) {
+            if (kind != TRANSFORM_NONE) transform_free(&tr);
+            return 6;
+        }
+    }
+
+    SearchOptions opt;
+    search_options_default(&opt);
+    opt.neighborhood = cfg->neighborhood;
+    opt.storage = cfg->storage;
+    opt.local = cfg->local;
+    opt.target = resolve_target(cfg, prob);
+    opt.block = tune ? tune->block : 0;
+    opt.rng = &rng;
+    opt.first = (cfg->replay >= 0) ? cfg->replay : 0;
+    if (opt.storage == STORAGE_F32 && !prob->eval_batch_f32) {
+        fprintf(stderr, "%s has no float32 kernel, using storage=double\n", problem_name(prob));
+        opt.storage = STORAGE_F64;
+    }
+    if (cfg->alg == ALG_RLS && opt.local == LS_LBFGS && !prob->eval_grad) {
+        fprintf(stderr, "%s has no gradient, using local=sampling\n", problem_name(prob));
+        opt.local = LS_SAMPLING;
+    }
+
+    /* one cache per problem run; it lives across the restarts */
+    EvalCache cache;
+    if (cfg->alg == ALG_RLS && !isnan(cfg->cache_resolution)) {
+        if (evalcache_init(&cache, cfg->m, cfg->cache_resolution,
+                           (size_t)cfg->cache_mb << 20) != 0) {
+            fprintf(stderr, "Failed to allocate the evaluation cache (%d MiB)\n", cfg->cache_mb);
+            free(best_x);
+            if (kind != TRANSFORM_NONE) transform_free(&tr);
+            return 6;
+        }
+        opt.cache = &cache;
+    }
+
+    SearchStats stats;
+
+    /* tuned threads only where the config leaves the count open */
+    int threads = kernels_threads();
+    if (tune && tune->threads > 0 && cfg->threads == 0) kernels_set_threads(tune->threads);
+
+    /* execute selected algorithm */
+    if (cfg->alg == ALG_BLIND) {
+        rc = blind_search(prob, cfg->m, cfg->n,
+                          lower, upper, &opt,
+                          values, &best, best_x, &time_ms, &stats);
+    }
+    else if (cfg->alg == ALG_RLS) {
+        rc = repeated_local_search(
+            prob, cfg->m, cfg->n,
+            cfg->neighbors, cfg->step_frac, cfg->max_ls_steps,
+            lower, upper, &opt,
+            values, &best, best_x, &time_ms, &stats
+        );
+    }
+    else {
+        fprintf(stderr, "Unsupported algorithm for Project 2\n");
+        rc = 5;
+    }
+
+    if (rc == 0) {
+        /* write per-iteration fitness values */
+        write_results(cfg, prob, values, stats.iterations, time_ms);
+        if (best_x) best = check_fast_best(prob, best_x, cfg->m, best);
+        print_summary(cfg, &opt, prob, best, time_ms);
+        if (cfg->target != TARGET_NONE) print_target(prob, cfg->alg, opt.target, &stats);
+        if (opt.cache) print_cache(opt.cache);
+    } else if (rc != 5) {
+        fprintf(stderr, "Algorithm failed\n");
+        rc = 6;
+    }
+
+    kernels_set_threads(threads);
+    if (opt.cache) evalcache_free(opt.cache);
+    free(best_x);
+    if (kind != TRANSFORM_NONE) {
+        problem_set_transform(prob, NULL);
+        transform_free(&tr);
+    }
+    return rc;
+}
+
+/**
+ * @brief Runs the configured algorithm on one problem and records it.
+ *
+ * problem=plugin:<path> loads the plugin library for the run and
+ * unloads it afterwards; objective=<expr> compiles the expression.
+ * Built-in problems use their autotune profile entry, if any; its
+ * kernel variant replaces isa=auto for this problem only.
+ *
+ * @param cfg Loaded configuration.
+ * @param t Problem to run (1..10, PROB_PLUGIN or PROB_EXPR).
+ * @param values Workspace for the per-iteration fitness (cfg->n values).
+ * @param prof Autotune profile (possibly empty).
+ * @param seeded Stream seeded from cfg->seed and cfg->seed_stream.
+ * @return 0 on success, 4 on an invalid range, 5 for an unsupported
+ *         algorithm, 6 if the algorithm fails, 7 if the plugin cannot
+ *         be loaded or the expression does not compile.
+ */
+static int run_problem(const Config* cfg, ProblemType t, double* values,
+                       const TuneProfile* prof, const Rng* seeded)
+{
+    Problem prob;
+
+    if (t == PROB_EXPR) {
+        /* an expression has no natural range, so the config must give one */
+        if (isnan(cfg->lower) || isnan(cfg->upper)) {
+            fprintf(stderr, "objective= needs numeric lower= and upper=\n");
+            return 4;
+        }
+        ExprProgram* prog = NULL;
+        int rc = expr_compile(cfg->objective, &prog);
+        if (rc != 0) {
+            fprintf(stderr, "Invalid objective '%s' (code %d): %s\n",
+                    cfg->objective, rc, rc == 3 ? expr_error() : "out of memory");
+            return 7;
+        }
+        expr_problem(prog, cfg->lower, cfg->upper, &prob);
+        rc = run_search(cfg, &prob, values, NULL, seeded);
+        expr_free(prog);
+        return rc;
+    }
+
+    if (t != PROB_PLUGIN) {
+        const TuneEntry* tune = autotune_find(prof, t, cfg->m, cfg->precision);
+        int tuned_isa = tune && strcmp(cfg->isa, "auto") == 0;
+        if (tuned_isa) kernels_select(tune->isa);
+        prob = problem_create(t);
+        int rc = run_search(cfg, &prob, values, tune, seeded);
+        if (tuned_isa) kernels_select(cfg->isa);
+        return rc;
+    }
+
+    PluginHandle plugin;
+    int rc = plugin_load(cfg->plugin_path, &plugin, &prob);
+    if (rc != 0) {
+        fprintf(stderr, "Failed to load plugin '%s' (code %d): %s\n",
+                cfg->plugin_path, rc, plugin_error());
+        return 7;
+    }
+    rc = run_search(cfg, &prob, values, NULL, seeded);
+    plugin_unload(&plugin);
+    return rc;
+}
+
+/**
+ * @brief Blind search over all ten problems on shared samples.
+ *
+ * All problems see the same sample sequence (the same one a single
+ * problem run with this seed would see) and are evaluated by the fused
+ * kernel. The reported time is that of the whole sweep.
+ *
+ * @param cfg Loaded configuration.
+ * @param seeded Stream seeded from cfg->seed and cfg->seed_stream.
+ * @return 0 on success, 4 on an invalid range, 6 if the search fails.
+ */
+static int run_blind_sweep(const Config* cfg, const Rng* seeded)
+{
+    Problem probs[PROB_EGG_HOLDER + 1];
+    double lower[PROB_EGG_HOLDER + 1], upper[PROB_EGG_HOLDER + 1];
+    double best[PROB_EGG_HOLDER + 1];
+    double* values[PROB_EGG_HOLDER + 1] = { NULL };
+    double* best_x[PROB_EGG_HOLDER + 1] = { NULL };
+    int fast = (cfg->precision == PRECISION_FAST);
+    int rc = 0;
+
+    /* the sweep always runs double blocks with no target */
+    SearchOptions opt;
+    search_options_default(&opt);
+
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+        probs[t] = problem_create((ProblemType)t);
+        rc = resolve_bounds(cfg, &probs[t], &lower[t], &upper[t]);
+        if (rc == 0) {
+            values[t] = malloc(sizeof(double) * cfg->n);
+            if (fast) best_x[t] = malloc(sizeof(double) * (size_t)cfg->m);
+            if (!values[t] || (fast && !best_x[t])) rc = 4;
+        }
+        if (rc != 0) break;
+    }
+
+    double time_ms = 0.0;
+    if (rc == 0) {
+        Rng rng = *seeded;
+        if (blind_search_multi(cfg->m, cfg->n, PROBLEM_MASK_ALL, lower, upper, &rng,
+                               values, best, fast ? best_x : NULL, &time_ms) != 0) {
+            fprintf(stderr, "Algorithm failed\n");
+            rc = 6;
+        }
+    }
+
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER && rc == 0; t++) {
+        write_results(cfg, &probs[t], values[t], cfg->n, time_ms);
+        if (fast) best[t] = check_fast_best(&probs[t], best_x[t], cfg->m, best[t]);
+        print_summary(cfg, &opt, &probs[t], best[t], time_ms);
+    }
+
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+        free(values[t]);
+        free(best_x[t]);
+    }
+    return rc;
+}
+
+/**
+ * @brief Loads the autotune profile named by profile=.
+ *
+ * A missing file is silent (the program simply runs untuned); a
+ * malformed profile or one from another machine is ignored with a note.
+ *
+ * @param cfg Loaded configuration.
+ * @param prof Output profile (empty unless loaded).
+ */
+static void load_profile(const Config* cfg, TuneProfile* prof)
+{
+    if (cfg->profile[0] == '\0') {
+        autotune_init(prof);
+        return;
+    }
+
+    int rc = autotune_load(cfg->profile, prof);
+    if (rc == 3) {
+        fprintf(stderr, "Ignoring malformed profile '%s'\n", cfg->profile);
+    } else if (rc == 4) {
+        fprintf(stderr, "Ignoring profile '%s' from another machine (re-run --autotune)\n",
+                cfg->profile);
+    }
+}
+
+/**
+ * @brief --autotune: times the kernel variants and writes the profile.
+ *
+ * Covers problem= (every built-in problem for 0) at m= (10, 20 and 30
+ * without m=), with the configured bounds and precision. Entries of an
+ * existing profile for this machine that are not re-measured are kept.
+ *
+ * @param cfg Loaded configuration.
+ * @return 0 on success, 4 on an invalid range, 5 for plugins and
+ *         expressions, 6 if timing fails, 8 if the profile cannot be
+ *         written.
+ */
+static int run_autotune(const Config* cfg)
+{
+    if (cfg->problem_type > PROB_EGG_HOLDER) {
+        fprintf(stderr, "--autotune covers the built-in problems (problem=0..10)\n");
+        return 5;
+    }
+    if (cfg->profile[0] == '\0') {
+        fprintf(stderr, "--autotune needs a profile= path\n");
+        return 8;
+    }
+
+    static const int default_dims[] = { 10, 20, 30 };
+    const int* dims = (cfg->m > 0) ? &cfg->m : default_dims;
+    int ndims = (cfg->m > 0) ? 1 : 3;
+    int first = cfg->problem_type ? cfg->problem_type : PROB_SCHWEFEL;
+    int last = cfg->problem_type ? cfg->problem_type : PROB_EGG_HOLDER;
+
+    TuneProfile prof;
+    load_profile(cfg, &prof);
+
+    int rc = 0;
+    for (int t = first; t <= last && rc == 0; t++) {
+        Problem prob = problem_create((ProblemType)t);
+        double lower, upper;
+        rc = resolve_bounds(cfg, &prob, &lower, &upper);
+
+        for (int d = 0; d < ndims && rc == 0; d++) {
+            TuneEntry e;
+            if (autotune_measure((ProblemType)t, dims[d], lower, upper, &e) != 0 ||
+                autotune_put(&prof, &e) != 0) {
+                fprintf(stderr, "Autotuning %s (m=%d) failed\n", problem_name(&prob), dims[d]);
+                rc = 6;
+                break;
+            }
+            printf("%s (m=%d): isa=%s block=%d threads=%d %.1f ns/eval\n",
+                   problem_name(&prob), dims[d], e.isa, e.block, e.threads, e.ns_per_eval);
+        }
+    }
+
+    if (rc == 0 && autotune_save(cfg->profile, &prof) != 0) {
+        fprintf(stderr, "Failed to write profile '%s'\n", cfg->profile);
+        rc = 8;
+    }
+    if (rc == 0) printf("Wrote %s\n", cfg->profile);
+    autotune_free(&prof);
+    return rc;
+}
+
 /**
  * @brief Program entry point.
  *
  * The program performs the following steps:
  * - Loads configuration values from file
+ * - Selects the evaluation kernel variant for the CPU
  * - Initializes the random number generator
  * - Creates the selected optimization problem
  * - Runs the chosen algorithm
  * - Writes results to a CSV file
  *
+ * `--autotune <config>` instead times the kernel variants for the
+ * configured problems and dimensions and writes the profile (see
+ * run_autotune()); normal runs load it (see load_profile()).
+ *
+ * With problem=0 every problem is run: blind search as one fused sweep
+ * over shared samples, RLS one problem after another (each restarting
+ * from the configured seed). The fused kernel reads double,
+ * untransformed rows, so storage=float32 or any transform runs blind
+ * search one problem after another too, as does target= (each problem
+ * stops at its own sample).
+ *
  * @param argc Argument count.
  * @param argv Argument vector.
  * @return Exit status code (0 on success).
  */
 int main(int argc, char** argv)
 {
-    if (argc != 2) {
+    int autotune = (argc == 3 && strcmp(argv[1], "--autotune") == 0);
+    if (argc != 2 && !autotune) {
         print_usage(argv[0]);
         return 1;
     }
 
     Config cfg;
-    if (config_load(argv[1], &cfg) != 0) {
+    int rc = 0;
+    if (config_load(argv[argc - 1], &cfg) != 0) {
         fprintf(stderr, "Failed to load config\n");
         return 2;
     }
 
-    if (cfg.lower >= cfg.upper) {
-        fprintf(stderr,
-                "Invalid range: lower (%.6f) must be < upper (%.6f)\n",
-                cfg.lower, cfg.upper);
-        return 4;
+    /* pick the evaluation kernels for this CPU once, before any timing */
+    int isa_rc = kernels_select(cfg.isa);
+    if (isa_rc == 1) {
+        fprintf(stderr, "Unknown isa '%s', using %s\n", cfg.isa, kernels_active()->isa);
+    } else if (isa_rc == 2) {
+        fprintf(stderr, "CPU does not support isa '%s', using %s\n", cfg.isa, kernels_active()->isa);
     }
+    kernels_set_threads(cfg.threads);
+    kernels_set_precision(cfg.precision);
 
-    /* initialize RNG */
-    init_genrand(cfg.seed);
+    if (autotune) return run_autotune(&cfg);
+
+    /* replaying one sample or restart needs substreams to address it */
+    if (cfg.replay >= 0 && cfg.rng != RNG_PHILOX) {
+        fprintf(stderr, "replay= needs rng=philox, running all %d iterations\n", cfg.n);
+        cfg.replay = -1;
+    }
+    if (cfg.replay >= 0) cfg.n = 1;
+    if (cfg.seed_stream != 0 && cfg.rng == RNG_DSFMT) {
+        fprintf(stderr, "seed_stream= is not supported by rng=dsfmt, using stream 0\n");
+        cfg.seed_stream = 0;
+    }
 
     if (csv_init_results(cfg.output_csv) != 0) {
         fprintf(stderr, "Failed to open output CSV\n");
         return 3;
     }
 
-    Problem prob = problem_create((ProblemType)cfg.problem_type);
-
-    double* values = malloc(sizeof(double) * cfg.n);
-    if (!values) return 4;
+    /* the fused sweep reads double, untransformed rows and runs every sample */
+    int fused = (cfg.problem_type == 0 && cfg.alg == ALG_BLIND && cfg.storage == STORAGE_F64 &&
+                 cfg.target == TARGET_NONE && cfg.replay < 0);
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+        if (cfg.transform[t] != TRANSFORM_NONE) fused = 0;
+    }
 
-    double best = 0.0;
-    double time_ms = 0.0;
-    int rc = 0;
+    /* seed (and jump to seed_stream=) once; every run starts from a copy */
+    Rng seeded;
+    rng_init(&seeded, cfg.rng, cfg.seed, cfg.seed_stream);
 
-    /* execute selected algorithm */
-    if (cfg.alg == ALG_BLIND) {
-        rc = blind_search(&prob, cfg.m, cfg.n,
-                          cfg.lower, cfg.upper,
-                          values, &best, &time_ms);
-    }
-    else if (cfg.alg == ALG_RLS) {
-        rc = repeated_local_search(
-            &prob, cfg.m, cfg.n,
-            cfg.neighbors, cfg.step_frac, cfg.max_ls_steps,
-            cfg.lower, cfg.upper,
-            values, &best, &time_ms
-        );
-    }
-    else {
-        fprintf(stderr, "Unsupported algorithm for Project 2\n");
-        free(values);
-        return 5;
+    if (fused) {
+        return run_blind_sweep(&cfg, &seeded);
     }
 
-    if (rc != 0) {
-        fprintf(stderr, "Algorithm failed\n");
-        free(values);
-        return 6;
-    }
+    double* values = malloc(sizeof(double) * cfg.n);
+    if (!values) return 4;
 
-    /* write per-iteration fitness values */
-    for (int i = 0; i < cfg.n; i++) {
-        csv_append_result(
-            cfg.output_csv,
-            cfg.alg,
-            (ProblemType)cfg.problem_type,
-            cfg.m,
-            i,
-            values[i],
-            time_ms
-        );
-    }
+    TuneProfile prof;
+    load_profile(&cfg, &prof);
 
-    printf("[ALG=%d] %s (m=%d): best=%.6g time=%.3f ms\n",
-           cfg.alg,
-           problem_name(&prob),
-           cfg.m,
-           best,
-           time_ms);
+    if (cfg.problem_type == 0) {
+        for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER && rc == 0; t++) {
+            rc = run_problem(&cfg, (ProblemType)t, values, &prof, &seeded);
+        }
+    } else {
+        rc = run_problem(&cfg, (ProblemType)cfg.problem_type, values, &prof, &seeded);
+    }
 
+    autotune_free(&prof);
     free(values);
-    return 0;
+    return rc;
 }
@@ -5,98 +5,283 @@
  * This file provides an implementation of the MT19937 pseudorandom
  * number generator. It supports initialization with a seed and
  * generation of 32-bit integers and double-precision floating-point
- * values in the range [0,1).
+ * values in the range [0,1). All state lives in an MTState; the
+ * classic global functions run on one static instance. mt_jump()
+ * advances a state by multiples of 2^128 draws with the polynomial
+ * jump of Haramoto et al. (tables in mt_jump_table.c).
  *
  * Based on the original MT19937 reference implementation.
  */
 
 #include "mt19937ar.h"
+#include <stddef.h>
+#include <string.h>
 
-#define N 624
+#define N MT_N
 #define M 397
 #define MATRIX_A 0x9908b0dfUL
 #define UPPER_MASK 0x80000000UL
 #define LOWER_MASK 0x7fffffffUL
 
-/** Internal state vector */
-static uint32_t mt[N];
+/** Degree of the MT19937 characteristic polynomial phi (the period is 2^19937 - 1) */
+#define MT_DEGREE 19937
 
-/** Index into the state vector */
-static int mti = N + 1;
+/** State behind init_genrand() and genrand_*() (unseeded until first use) */
+static MTState global_state = { { 0 }, N + 1 };
 
 /**
- * @brief Initializes the generator with a seed.
- *
- * This function must be called before using the random
- * number generator unless a default seed is acceptable.
+ * @brief Seeds a generator state.
  *
+ * @param st State to initialize.
  * @param s Seed value.
  */
-void init_genrand(uint32_t s)
+void mt_init(MTState* st, uint32_t s)
 {
+    uint32_t* mt = st->mt;
+
     mt[0] = s;
-    for (mti = 1; mti < N; mti++) {
-        mt[mti] = (uint32_t)(
+    for (int i = 1; i < N; i++) {
+        mt[i] = (uint32_t)(
             1812433253UL *
-            (mt[mti - 1] ^ (mt[mti - 1] >> 30)) +
-            (uint32_t)mti
+            (mt[i - 1] ^ (mt[i - 1] >> 30)) +
+            (uint32_t)i
         );
     }
+    st->mti = N;
 }
 
 /**
- * @brief Generates a 32-bit unsigned random integer.
+ * @brief Regenerates the whole state vector (the MT19937 twist).
  *
- * If the generator state has been exhausted, the state
- * is regenerated automatically.
+ * The twist matrix is applied as (y & 1) * MATRIX_A rather than a table
+ * lookup so the loops vectorize.
  *
- * @return Random 32-bit unsigned integer.
+ * @param st Generator state (seeded with the default if it never was).
  */
-uint32_t genrand_int32(void)
+static void mt_twist(MTState* st)
 {
+    uint32_t* mt = st->mt;
     uint32_t y;
-    static const uint32_t mag01[2] = {0x0UL, MATRIX_A};
+    int kk;
 
-    if (mti >= N) {
-        int kk;
+    /* If mt_init() has not been called, use default seed */
+    if (st->mti == N + 1)
+        mt_init(st, 5489UL);
 
-        /* If init_genrand() has not been called, use default seed */
-        if (mti == N + 1)
-            init_genrand(5489UL);
-
-        for (kk = 0; kk < N - M; kk++) {
-            y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-            mt[kk] = mt[kk + M] ^ (y >> 1) ^ mag01[y & 0x1UL];
-        }
-        for (; kk < N - 1; kk++) {
-            y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-            mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ mag01[y & 0x1UL];
-        }
-        y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ mag01[y & 0x1UL];
-
-        mti = 0;
+    for (kk = 0; kk < N - M; kk++) {
+        y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+        mt[kk] = mt[kk + M] ^ (y >> 1) ^ ((y & 0x1UL) * MATRIX_A);
+    }
+    for (; kk < N - 1; kk++) {
+        y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+        mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ ((y & 0x1UL) * MATRIX_A);
     }
+    y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ ((y & 0x1UL) * MATRIX_A);
 
-    y = mt[mti++];
+    st->mti = 0;
+}
 
-    /* Tempering */
+/**
+ * @brief Applies the MT19937 output tempering to one state word.
+ *
+ * @param y State word.
+ * @return Tempered output.
+ */
+static inline uint32_t mt_temper(uint32_t y)
+{
     y ^= (y >> 11);
     y ^= (y << 7) & 0x9d2c5680UL;
     y ^= (y << 15) & 0xefc60000UL;
     y ^= (y >> 18);
-
     return y;
 }
 
 /**
- * @brief Generates a floating-point random number in [0, 1).
+ * @brief Draws a 32-bit unsigned random integer from a state.
+ *
+ * If the state vector has been exhausted, it is regenerated
+ * automatically.
+ *
+ * @param st Generator state.
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t mt_next(MTState* st)
+{
+    if (st->mti >= N) mt_twist(st);
+    return mt_temper(st->mt[st->mti++]);
+}
+
+/**
+ * @brief Draws a floating-point random number in [0, 1) from a state.
  *
  * Uses a 32-bit integer random value scaled to the unit interval.
  *
+ * @param st Generator state.
+ * @return Random double in the range [0,1).
+ */
+double mt_real(MTState* st)
+{
+    return mt_next(st) * (1.0 / 4294967296.0);
+}
+
+/**
+ * @brief Fills an array with uniform random values in [lo, hi).
+ *
+ * Works through the state vector a run of words at a time: one bounds
+ * check and (at most) one twist per run, then a loop without branches
+ * or calls that tempers each word and scales it. The 32-bit word is
+ * converted through a signed int (bias flipped, 2^31 added back),
+ * which gives the same exact value as the unsigned conversion but has
+ * a vector instruction on every x86 level.
+ *
+ * @param st Generator state.
+ * @param out Output array.
+ * @param n Number of values.
+ * @param lo Lower bound.
+ * @param hi Upper bound.
+ */
+void mt_fill_real(MTState* st, double* out, size_t n, double lo, double hi)
+{
+    const double width = hi - lo;
+
+    while (n > 0) {
+        if (st->mti >= N) mt_twist(st);
+
+        size_t k = (size_t)(N - st->mti);
+        if (k > n) k = n;
+        const uint32_t* w = st->mt + st->mti;
+        for (size_t i = 0; i < k; i++) {
+            int32_t s = (int32_t)(mt_temper(w[i]) ^ 0x80000000u);
+            double u = ((double)s + 2147483648.0) * (1.0 / 4294967296.0);
+            out[i] = lo + width * u;
+        }
+        st->mti += (int)k;
+        out += k;
+        n -= k;
+    }
+}
+
+/**
+ * @brief Advances a window of N consecutive words by one word.
+ *
+ * The window is circular, starting at *start: its oldest word is
+ * replaced by the word the recurrence generates next.
+ *
+ * @param w Window.
+ * @param start Index of the oldest word (advanced).
+ */
+static void mt_window_step(uint32_t* w, int* start)
+{
+    int a = *start;
+    int a1 = (a + 1 < N) ? a + 1 : 0;
+    int am = (a + M < N) ? a + M : a + M - N;
+    uint32_t y = (w[a] & UPPER_MASK) | (w[a1] & LOWER_MASK);
+
+    w[a] = w[am] ^ (y >> 1) ^ ((y & 0x1UL) * MATRIX_A);
+    *start = a1;
+}
+
+/**
+ * @brief Advances a state by the jump a polynomial encodes.
+ *
+ * The state vector holds N consecutive words of the sequence, mti of
+ * them already drawn; the jump moves that window J words ahead and
+ * keeps mti. With F the one-word step of the window, F^J is p(F)
+ * after one step, p = x^(J - 1) mod phi (the step first drops the low
+ * bits of the oldest word, which phi does not describe). p(F) is
+ * evaluated by Horner's rule: 19937 steps and about half as many
+ * additions of the stepped state, a few milliseconds.
+ *
+ * @param st Generator state (seeded with the default if it never was).
+ * @param poly Jump polynomial (see scripts/mt_jump.py).
+ */
+void mt_jump_poly(MTState* st, const uint32_t poly[MT_N])
+{
+    uint32_t base[N];
+    uint32_t acc[N] = { 0 };
+    int b = 0;
+    int a = 0;
+
+    if (st->mti == N + 1)
+        mt_init(st, 5489UL);
+
+    memcpy(base, st->mt, sizeof(base));
+    mt_window_step(base, &b);
+
+    for (int j = MT_DEGREE - 1; j >= 0; j--) {
+        mt_window_step(acc, &a);
+        if (!((poly[j / 32] >> (j % 32)) & 1u)) continue;
+
+        /* acc[a + k] ^= base[b + k], both windows circular */
+        int k = 0;
+        while (k < N) {
+            int i = (a + k) % N;
+            int s = (b + k) % N;
+            int run = N - (i > s ? i : s);
+            if (run > N - k) run = N - k;
+            for (int r = 0; r < run; r++) acc[i + r] ^= base[s + r];
+            k += run;
+        }
+    }
+
+    for (int k = 0; k < N; k++) st->mt[k] = acc[(a + k) % N];
+}
+
+/**
+ * @brief Advances a state by n * 2^128 draws.
+ *
+ * One table jump per set bit of n, so at most MT_JUMP_TABLES of them.
+ *
+ * @param st Generator state.
+ * @param n Multiple of 2^128 to advance by.
+ */
+void mt_jump(MTState* st, uint32_t n)
+{
+    for (int k = 0; k < MT_JUMP_TABLES; k++) {
+        if ((n >> k) & 1u) mt_jump_poly(st, mt_jump_table[k]);
+    }
+}
+
+/**
+ * @brief Returns the process-wide state behind the genrand_*() functions.
+ *
+ * @return Global generator state.
+ */
+MTState* mt_global(void)
+{
+    return &global_state;
+}
+
+/**
+ * @brief Initializes the generator with a seed.
+ *
+ * This function must be called before using the random
+ * number generator unless a default seed is acceptable.
+ *
+ * @param s Seed value.
+ */
+void init_genrand(uint32_t s)
+{
+    mt_init(&global_state, s);
+}
+
+/**
+ * @brief Generates a 32-bit unsigned random integer.
+ *
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t genrand_int32(void)
+{
+    return mt_next(&global_state);
+}
+
+/**
+ * @brief Generates a floating-point random number in [0, 1).
+ *
  * @return Random double in the range [0,1).
  */
 double genrand_real2(void)
 {
-    return genrand_int32() * (1.0 / 4294967296.0);
+    return mt_real(&global_state);
 }
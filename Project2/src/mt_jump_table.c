@@ -0,0 +1,2571 @@
+/**
+ * @file mt_jump_table.c
+ * @brief MT19937 jump polynomials for 2^128 .. 2^159 steps.
+ *
+ * Generated by scripts/mt_jump.py --log2 128 --count 32 --name mt_jump_table; do not edit.
+ */
+
+#include "mt19937ar.h"
+
+const uint32_t mt_jump_table[32][MT_N] = {
+    { /* 2^128 */
+        0x396f1cb1u, 0x5ab84f62u, 0xc413cddbu, 0xd411fc72u, 0x936c1f2cu, 0x820f912cu, 0xf3fedd8au, 0x45a90bbbu,
+        0xa45af3abu, 0xdf94096au, 0x725856dcu, 0x85a424d5u, 0x1f4945c1u, 0xf4b69ce7u, 0x57b098e9u, 0x04f57974u,
+        0x99aa422bu, 0xe0c0a63du, 0x449d3e41u, 0xff5e83deu, 0x80dec133u, 0x28a3ee5fu, 0x71533ef3u, 0xcd7f7abau,
+        0x5c19a684u, 0x7869ef65u, 0xaab0feacu, 0xec42381du, 0x77ae401du, 0xd9cdc7a1u, 0x906fdbb0u, 0xeb0e7f69u,
+        0xe7af9f2du, 0xa3a0b0bbu, 0xc7422174u, 0x4754e7d5u, 0xac2e8760u, 0x306efbd6u, 0x164dc294u, 0x787beb07u,
+        0xd95d9dfeu, 0xe51f71beu, 0xc0e4f32cu, 0x43876cb4u, 0xcab9d0efu, 0x67292428u, 0xbbb41dcau, 0x39e6d2f6u,
+        0x2b5e7e5eu, 0x7a1ccab6u, 0x0fc8ef0au, 0xdf825e00u, 0xca1c6240u, 0x0ec2cc18u, 0xe5357051u, 0x4ecbd76au,
+        0xcf23210cu, 0x73ae4a8cu, 0x129e0a43u, 0x66a1a2aeu, 0x39dae66cu, 0x3fc1416au, 0xe46566a2u, 0x0c96efccu,
+        0xeb5f42a3u, 0xa9445ac4u, 0xda793653u, 0xcc0caabfu, 0x1002b875u, 0x01f39e94u, 0x93256602u, 0xbc508a64u,
+        0xcaf87dbdu, 0x2177744bu, 0x55e64061u, 0xb3f3a8f4u, 0x89986642u, 0x1a0743f7u, 0x489dcd4bu, 0xe9fc292fu,
+        0x9f71e902u, 0x8dd08ac7u, 0x96266dc4u, 0x0fb5543eu, 0xcdaf4d1du, 0xc3c59911u, 0x525c61f6u, 0x52463bbcu,
+        0xcba56033u, 0x0e84782au, 0xe4504121u, 0x6b6f4074u, 0x50e785a0u, 0x94c96726u, 0x421398e3u, 0xb020b457u,
+        0x6e91f736u, 0xdf67fc59u, 0xefd63943u, 0xd21b4ba8u, 0xd945e44eu, 0x252c206cu, 0xd3d2c2c1u, 0xfa9dedf6u,
+        0x67dd24cbu, 0xd20a4e8eu, 0xeae337e1u, 0xd9639482u, 0x6734569cu, 0xd726c74bu, 0x7909d4dau, 0xe2c479cbu,
+        0x4eb08b5du, 0x9630c6a7u, 0xd9a21068u, 0xf5fdb0f8u, 0x1db8176bu, 0x65ee5379u, 0xbe5bc0b3u, 0x5f1419cau,
+        0x01d121b5u, 0x9060684bu, 0xf0c8553fu, 0xdfa4dc0au, 0xa4ebc6e1u, 0x4da2dc81u, 0x85526264u, 0x33f5c871u,
+        0xf99589f8u, 0x3fae7518u, 0xe662414au, 0x320f576du, 0x36b557dbu, 0x405aa9acu, 0x395aac19u, 0x78fd3bcdu,
+        0x9db055bau, 0x44c9577eu, 0x27d304f9u, 0x941aca39u, 0xb0f3d578u, 0xa93ee0d4u, 0xc1a74043u, 0x5e56b49fu,
+        0x64e51dfbu, 0x4a8b8bcbu, 0xcfa08b25u, 0xdbe9b3bau, 0xe791679du, 0xae3bb3bdu, 0xfa3b2d80u, 0xa3efeb4fu,
+        0xec86b70au, 0xeb84123fu, 0x2ff4a889u, 0x56bccb14u, 0x6313fcf9u, 0x7e7d8671u, 0x079220e7u, 0x258019c0u,
+        0xb90b0880u, 0x287d3c05u, 0x8fb9588du, 0xdb8e545bu, 0x7fd5a17eu, 0xaa3add67u, 0x48e1459cu, 0x9ab777bcu,
+        0x8a20e4e1u, 0xee400436u, 0xcb623a48u, 0xdae18764u, 0xd12a7216u, 0x54990d6eu, 0xcb1d1b09u, 0xe185f72du,
+        0xa1ae3ae3u, 0x6f8a0991u, 0x9c1847acu, 0x449371c7u, 0x38db4ac9u, 0x44bbaa6cu, 0x1e6eef2fu, 0x2de030bau,
+        0xd6a90482u, 0x5f5dc053u, 0xae61426au, 0x6c8eae99u, 0xc635d3a4u, 0x88848720u, 0x19ddcc94u, 0x23167fdeu,
+        0xe2152847u, 0x77e34302u, 0xb0151d0au, 0x1187366cu, 0x93637cfau, 0xa4dc7598u, 0x28de9ac6u, 0xbe24f3d2u,
+        0xa3dac965u, 0x8c885d9cu, 0x1e76b52du, 0xd686528cu, 0xc9a30ee5u, 0x6cc653bcu, 0xca934a47u, 0xf662e5b2u,
+        0xfe8d218du, 0x05eee43eu, 0x2eb4a012u, 0x3ecc1056u, 0xfff5aa9cu, 0xb8b60d70u, 0x09e7fd97u, 0x827c76c3u,
+        0xebbbf81cu, 0x8d9975cbu, 0x43e0d4afu, 0x449ed277u, 0x611af8b6u, 0x4b288c6au, 0x753cca5du, 0xfcc811f1u,
+        0xddc622a2u, 0x44893452u, 0xf3e7a35au, 0xa68b1c30u, 0x05962b40u, 0xe5344607u, 0x9b38172fu, 0xdc31a35au,
+        0xaaf188ddu, 0x3943009bu, 0x8a17ee2eu, 0xa3e88719u, 0x11a67065u, 0x56044618u, 0x47ca81ffu, 0xa6bcd174u,
+        0xc9bb3863u, 0x015a604au, 0x107c7a70u, 0x040299e0u, 0xc0ff4799u, 0xd58e8612u, 0x0247bbb6u, 0xdb00dd94u,
+        0x4b002523u, 0xfc5c74b7u, 0x343157bdu, 0x254fd021u, 0x585b7b31u, 0x2a1c256au, 0xd1a86077u, 0xc0b3852bu,
+        0x13032ee0u, 0x9d161410u, 0xdabafc4cu, 0x5cba4b33u, 0x39c6fe15u, 0x55429c1cu, 0x00666221u, 0x529d4952u,
+        0x67d7ad1fu, 0xdee467d1u, 0x84c42132u, 0xa94ff74eu, 0x526bfc27u, 0x4b36384fu, 0x26405e21u, 0xe8a132eau,
+        0xfaf5f3f9u, 0xd91e1576u, 0x402291f8u, 0xdbea3e21u, 0x53e58554u, 0xb99b82b4u, 0x036c8562u, 0xb30ac50fu,
+        0x4c02e3d6u, 0x6251c4c6u, 0x3c4856efu, 0x3fe29b48u, 0x42e1cd90u, 0x62a13f04u, 0xe064327cu, 0x17dd02f6u,
+        0xe1b280bdu, 0x1085695fu, 0xc7fdcaf5u, 0x304e5001u, 0x473627b9u, 0x427331e2u, 0x1e0882b1u, 0xba9e0e54u,
+        0x43805b91u, 0x2432157fu, 0x0a564a96u, 0x6778891fu, 0x76c24b9eu, 0xf83adc5cu, 0x067562e4u, 0x780512adu,
+        0x6fe6a43eu, 0x3f3bf06du, 0xc5f2ba86u, 0x0038e5cbu, 0xab0413ffu, 0x14620c37u, 0x57a024f8u, 0xdfb49d6bu,
+        0xd488d56eu, 0x17180368u, 0xaf5addbau, 0x974244fcu, 0x61b75c1eu, 0xc213c0b2u, 0x411815a3u, 0x30f0735fu,
+        0x02111307u, 0x08dace2bu, 0x7279064eu, 0x4e6af655u, 0xfc33716du, 0xcde39291u, 0x29620b33u, 0x40b7a99eu,
+        0x23d191afu, 0x506dffcfu, 0x863153abu, 0x754e52d1u, 0xef03b0d3u, 0x628933f4u, 0x1f76956bu, 0xf945c433u,
+        0xb4af690fu, 0x7ebb4b31u, 0xc832d7a7u, 0xde23fe6fu, 0x6fe5312cu, 0xa1271cceu, 0x0b36160du, 0xdd8199afu,
+        0x9539d0d0u, 0x625f19eeu, 0x7349682cu, 0xa2ba35e1u, 0xca4a1e03u, 0x83e9c6bfu, 0x3042e7d9u, 0x3a5c28f2u,
+        0xed9e9561u, 0xedcefa83u, 0x4369991du, 0x2e3632a6u, 0x415fd611u, 0xda6e9819u, 0xc93f011du, 0xdb930d2fu,
+        0x9a7f40bcu, 0x2079b0dfu, 0x324f3c2cu, 0x738b2807u, 0xb2c39d83u, 0x1ae37705u, 0x7d943263u, 0x7262ea7eu,
+        0x140c80e3u, 0xe2c77142u, 0xf2fe51e6u, 0x22401c32u, 0xfc287bfbu, 0xfcfa0fa0u, 0xa2f5aa9cu, 0x43e5f9e4u,
+        0x5f17c03au, 0xd702b209u, 0x9e2e5caau, 0xec7f48b7u, 0x576144efu, 0xe8c665afu, 0x0777c0dfu, 0x2220abf9u,
+        0xa3481b25u, 0x6f4c50bau, 0xe0acbf50u, 0xe84a2d8du, 0x58f69f0bu, 0xbcb3b73du, 0x72caf5e0u, 0x5141defbu,
+        0x32461ab8u, 0x3503592eu, 0x1cc58ac0u, 0x86f589c6u, 0x72888477u, 0xa31e84b5u, 0x8eed3a0bu, 0xd7ff0095u,
+        0x3917818bu, 0xe5800c49u, 0x11c3ae7bu, 0x416baa69u, 0x44c88a6fu, 0x1048e726u, 0xe923abdau, 0x454a277cu,
+        0xc2ca0a2du, 0xf6fc7895u, 0xccc7257fu, 0x79860674u, 0x4e7300f1u, 0xd932bd2cu, 0x9b5428eeu, 0x4a637646u,
+        0x76a35c9cu, 0xc356d238u, 0xa04da83eu, 0x23638a54u, 0x02e43154u, 0x5b14021fu, 0x2de250c4u, 0x46bb1d46u,
+        0x856e0c5bu, 0xbfadd3cbu, 0xb4839a8cu, 0xaeda5e35u, 0x2226ace8u, 0x1e843f11u, 0xf4e02744u, 0x30b337a8u,
+        0xaa455273u, 0x8a8fe802u, 0xc8aaa9c4u, 0xb0482b30u, 0xaf46ab0cu, 0x1f1e42b0u, 0x1ce35c0eu, 0x12488ab6u,
+        0x7e17fa53u, 0x8bda6a16u, 0xc164de3cu, 0x15eb8267u, 0x3d92b477u, 0x82a01920u, 0xae91346cu, 0x3f113db5u,
+        0xec35f63du, 0x118f8873u, 0xdd00b418u, 0xcb27c288u, 0xd1db990fu, 0xcc39e190u, 0x9a01616eu, 0xd2d12870u,
+        0x932bd1c2u, 0x639c6923u, 0x0092a0e5u, 0xe699c39eu, 0x62c83f8du, 0x6c46e416u, 0x2e15aa05u, 0xab2b6652u,
+        0x0fc43ee8u, 0x51ecc3dcu, 0x41f3ff24u, 0x8351433cu, 0x6b2b416du, 0xa32f96fcu, 0x4da0a670u, 0xfd647fdeu,
+        0xacc78ce6u, 0xd8956412u, 0x7d4c918du, 0x172e10bfu, 0x1d96c5d1u, 0x72a87eddu, 0xc7288003u, 0x4225b399u,
+        0x1f2b98cau, 0xf7245493u, 0x6e669b5eu, 0x20e1ca64u, 0x0953cb10u, 0x50cdb3f9u, 0x451fe953u, 0xc5142e03u,
+        0x1d0bdbecu, 0x9b1b8285u, 0x31efe501u, 0x394ab23fu, 0xbd3d9dddu, 0xdf473b00u, 0x753302a4u, 0x1e0f288du,
+        0xe3d0c98du, 0x03620602u, 0x5bcb67b8u, 0x3e8c4332u, 0xe76cfd1cu, 0xdcfb8018u, 0xb00f163au, 0x43ff4b9au,
+        0x7c66a4d8u, 0xf7b22eebu, 0x3e82d991u, 0xa1aeb89cu, 0x2e017a3fu, 0x48193d13u, 0xb1f669d9u, 0xd5ea7112u,
+        0x80b12192u, 0x98160b30u, 0x6dfdf5c9u, 0x0e6fd35eu, 0xc2328cd1u, 0xd8acc3f6u, 0x089d6b78u, 0x0618f642u,
+        0x11951ad9u, 0xda099048u, 0xc96861e2u, 0xa9a8b971u, 0x84affe65u, 0x7e335054u, 0x499601c7u, 0x92a31d37u,
+        0x6660af23u, 0x0ddd7e3au, 0x1e79541cu, 0xd4243318u, 0x0823f012u, 0xc202da57u, 0xed1b39c6u, 0x0f762639u,
+        0x44598748u, 0x27cff882u, 0x42f753c0u, 0x3715bed4u, 0xa06cfedfu, 0x37f5ac9eu, 0x1e42869eu, 0xb2b03606u,
+        0x583c5118u, 0xb818450au, 0x33ad7cdeu, 0x36cd3e5fu, 0xf6b9f719u, 0xb1b3028cu, 0x8b80eec6u, 0x87314aafu,
+        0x8c06d874u, 0x5e5b3509u, 0x69e1669fu, 0x3c3dc455u, 0x42fedf24u, 0x5143ce29u, 0xcabcfc7cu, 0xc817fea0u,
+        0xa5be353du, 0x8faf0245u, 0xc71316c4u, 0x3836924au, 0x75d5ec3cu, 0xc0b6bfa1u, 0x4466fdf8u, 0x9f3662c5u,
+        0xbaa53251u, 0x453efd7eu, 0xf4c68501u, 0x5b1e697bu, 0x9c64642eu, 0x3962dabfu, 0x5cbf9585u, 0xf23ced3au,
+        0x2a9f19fbu, 0x3e431195u, 0xd9ae647cu, 0x76e31336u, 0x6533f3ffu, 0x8a5bfb44u, 0x8396cdbdu, 0x59e9eb37u,
+        0xa9463525u, 0x090802dcu, 0x86f95b11u, 0x43e98f9cu, 0x89672feau, 0x76d7659bu, 0xa4ef617au, 0x4729ff92u,
+        0x73cf21adu, 0x3b2020d5u, 0x14d1f738u, 0xd9acdeafu, 0x2d511823u, 0x981d6682u, 0x5c151683u, 0x8b2bcae1u,
+        0xd3255b99u, 0xca87d560u, 0xefd1430fu, 0xff8eaf01u, 0x466b7432u, 0xaf59b076u, 0xb1ce5831u, 0x0cf0d3a6u,
+        0x3f609294u, 0xbbae106bu, 0xd22626efu, 0x043916bfu, 0x58649699u, 0x41e8a2deu, 0x1d9103f4u, 0xb9ed3072u,
+        0xd09e8494u, 0xcb1409dcu, 0x39c7a105u, 0x75b2b96bu, 0x8a8d2965u, 0xc0525077u, 0x11f7722bu, 0x00000001u,
+    },
+    { /* 2^129 */
+        0x710aeee6u, 0x6bd30cb5u, 0x680bcd01u, 0x94764f26u, 0x06bf801du, 0x06cc5e71u, 0x34538226u, 0x2015aa93u,
+        0x3070d6b0u, 0xf5dbe540u, 0xc5dad306u, 0x85501ce4u, 0xcbaf2a49u, 0xaa0eb9cbu, 0x504b4fceu, 0xacffa663u,
+        0xc3c2beb8u, 0xac27d34du, 0x4e650606u, 0xd698c795u, 0x146093d1u, 0xd80428cau, 0x46899893u, 0xadfec79du,
+        0x6f46fbaau, 0xf97ad324u, 0xd602126au, 0x25897e0bu, 0x5983d927u, 0xd96d8fe8u, 0x8710cb51u, 0x92d39999u,
+        0x9d9860f4u, 0x88923d71u, 0x47826f1bu, 0x9fe4d6b4u, 0xdb2418d7u, 0x2a2d5017u, 0xaf3d217au, 0x58e69f0cu,
+        0xb6e6007du, 0x78c0dafau, 0x033590a0u, 0x1dfcea9bu, 0x5cc92009u, 0x80b36961u, 0xfb409a73u, 0x08ad405au,
+        0xae2c14f7u, 0x5292c20au, 0x9db6b5dbu, 0x6e3d9d2eu, 0xdedc5eb7u, 0xc61731bcu, 0x1855335du, 0x64c3e4dfu,
+        0xa70515f9u, 0xb1a819f2u, 0x9a26aec2u, 0xf8f82468u, 0x610bc2c9u, 0x0b302431u, 0xd761e50cu, 0x361fff54u,
+        0x359a2451u, 0xe004a24au, 0x9651355eu, 0x657a1b10u, 0x6cbec189u, 0x6fbf7817u, 0x4bf9dfbeu, 0xeb1d2665u,
+        0x5db94b84u, 0xe461ec48u, 0xb55c37bdu, 0x4f2951d9u, 0x49cc4772u, 0x1e88b136u, 0x91e00989u, 0x453a084eu,
+        0xc5202f67u, 0xc011dfe5u, 0x5d593197u, 0x6caab5f9u, 0x22a9a1f8u, 0xc0ed8697u, 0x8d0a7001u, 0x4565efa6u,
+        0xc613ef34u, 0xbcefd2e7u, 0xdd5d93a5u, 0xd396e8e7u, 0xace3ea80u, 0x8b7285efu, 0xc09f9c98u, 0x83e5c00bu,
+        0x43efb73bu, 0x99214b2fu, 0x70c3e36du, 0x20e654c8u, 0xf56e8108u, 0x9e7c0bfdu, 0xda775e35u, 0x763ac0a9u,
+        0x4b88f80cu, 0xdb40fd8bu, 0x74707853u, 0x928716e1u, 0xebb46c18u, 0x5d1839aeu, 0xcce94d47u, 0x8961453fu,
+        0xbb9d8b64u, 0x5f0dfe6eu, 0xa4885365u, 0x50bacb8du, 0x180965e6u, 0x2d3a3e5eu, 0x55760fd6u, 0xcb450b8fu,
+        0xc8b82eaeu, 0xbd994cb0u, 0x14bc6d5cu, 0x63125cb4u, 0xedbfad2bu, 0x5ee10f16u, 0xf2c17c62u, 0xb3404f55u,
+        0xab218968u, 0x0131eefbu, 0x9ff9a546u, 0x3932e960u, 0xb4e7da8cu, 0xf117a0e1u, 0x5354c324u, 0x21b02491u,
+        0xdd548b48u, 0x7a537de4u, 0x6a5fd7afu, 0x6222fee7u, 0x6adedf95u, 0x351aae94u, 0x3f747b12u, 0x67ea52d7u,
+        0x1f6fa3d5u, 0x962beb50u, 0xb2e1bec3u, 0xd278204au, 0xe674bf0eu, 0xe7810cffu, 0xe65f7143u, 0x31dcbcd6u,
+        0xb86e0a3cu, 0xce1113e8u, 0x17cbe030u, 0x80092743u, 0x495e136au, 0xfb23755du, 0x3544033du, 0x4fac4b4au,
+        0x860b25e7u, 0xdea96a19u, 0xa864185du, 0xae936080u, 0x2e8754eau, 0x7bc6be8cu, 0xe0820468u, 0xe2b90eb6u,
+        0x2812d754u, 0x29ab15bcu, 0x37d06a3du, 0xd41cbee5u, 0xf92b82dfu, 0x17687accu, 0xcc91af18u, 0x163cef70u,
+        0x13ecc168u, 0xcf688381u, 0xd2a0b823u, 0xaefca5b7u, 0x83f41623u, 0x9fafe9f7u, 0xbb689e64u, 0x264da58bu,
+        0x88cee77cu, 0xb39d8549u, 0x8dc04c9cu, 0x92c6ceddu, 0x1fd373e1u, 0x1f9994f2u, 0x1d8e552du, 0x0e7d54bbu,
+        0xe5b25f60u, 0xe20df5cau, 0x36ee5b2bu, 0x42f5f69au, 0x7bdc424bu, 0x15a004bau, 0x6b7ecdaau, 0xa0861cd5u,
+        0x0d193e8bu, 0x865382a8u, 0x7aa7607fu, 0x3f06c369u, 0x28654e1au, 0xd657e635u, 0x777ca599u, 0xffca73cau,
+        0xc718ba49u, 0x718b371fu, 0xd4b89d10u, 0x21725938u, 0xa9f4552fu, 0x96eed686u, 0x5ff3a879u, 0x623abaf5u,
+        0x97e7640fu, 0x8f080de5u, 0x50eb08f0u, 0x8a5b6ec9u, 0xe410e608u, 0x488bcd8bu, 0x3c44eebau, 0x16e2b1a6u,
+        0xf3bc25f0u, 0x2e64950fu, 0x2b7df9b0u, 0x5411f025u, 0x118c72d3u, 0x9e3e8502u, 0xd294ca7bu, 0xc644460cu,
+        0xad64149cu, 0x0e88a916u, 0xb0fdc1a4u, 0xfb57f4d5u, 0x69c77288u, 0xd0feb44eu, 0x16bc440eu, 0x0255ef8bu,
+        0x4923ece8u, 0x8d44d4b9u, 0x97d3dcdbu, 0x2fa37bdbu, 0x4492ff4du, 0x8daab454u, 0xbbf7dbaau, 0xa99ec377u,
+        0x860ffec3u, 0x4652a5b3u, 0x81696f69u, 0x2b8b5410u, 0x544f3b03u, 0xb42969edu, 0x9191f533u, 0x279d660cu,
+        0x4119ac34u, 0x9b267fc8u, 0x96c078e9u, 0xce7782fcu, 0xe22d2e67u, 0xfd3a32a8u, 0x3de482a5u, 0x2d56252bu,
+        0x45bba213u, 0x53f61f51u, 0xcbf19818u, 0x5005c71fu, 0x8d007492u, 0xc6e42054u, 0xd8c4a66au, 0x8cdc70c1u,
+        0xff3ef2ecu, 0x1a60be5fu, 0x9f3a8465u, 0xbad75e46u, 0xe0fa9326u, 0x0a92f5b7u, 0x43594fdau, 0xa72c98d8u,
+        0x6fea7c94u, 0x9832c5e1u, 0xb72ebddeu, 0xf272d5beu, 0x7809103au, 0x240e8661u, 0x5c427378u, 0x2c3afd01u,
+        0xb4ec5ba0u, 0x5a97af13u, 0x4bb3db41u, 0x192274ceu, 0x0089a84cu, 0xa1760690u, 0xea2f360cu, 0xeb56e0a0u,
+        0x8f7bef7du, 0x49e1626au, 0x4914cca1u, 0x355788b6u, 0xe198d329u, 0xc0572fb2u, 0xb0cc15bbu, 0x59b95025u,
+        0x8f9374c7u, 0xb271bd2eu, 0x6405b8ceu, 0xfa86f6ccu, 0x128dea95u, 0x06cad3eau, 0xca76371fu, 0xac24fa94u,
+        0x9f37f07fu, 0xa970f4f1u, 0xb8516d3eu, 0x25174f7du, 0x3478424fu, 0x4867d87bu, 0x5c033800u, 0x61d82feau,
+        0x0527e4c8u, 0xb314ed1cu, 0xaeafdc7fu, 0xb8418f01u, 0xdbefa2ecu, 0x55eb3310u, 0x56371f2fu, 0xe07e02a4u,
+        0xfa7120a6u, 0xfd4bb388u, 0x913d9827u, 0xe6b318e5u, 0x9d73fbc2u, 0x57368b30u, 0x41922babu, 0xfbd0ac86u,
+        0xb3cd1328u, 0x7e81d2b0u, 0x536a9655u, 0xf938ce3au, 0x15927e48u, 0x58f1ebaau, 0x41fbecbdu, 0x8bb9ec18u,
+        0x4932a3c0u, 0xa22498f8u, 0x4bf5423bu, 0x7418a94au, 0x67c4cab0u, 0x93e2981du, 0xfdb47bf6u, 0xb74fbfbdu,
+        0x468cc2e0u, 0x5506dbbfu, 0xf3a71f0au, 0xe4c4daeau, 0x355cc86cu, 0xdd2b3089u, 0xb982a63au, 0xf70f7019u,
+        0x4e5f9be4u, 0x26c0e8ceu, 0xfd6fd63fu, 0xb5d4d3d3u, 0xec1ac636u, 0xe392db05u, 0xaa2c40e9u, 0x28bf4737u,
+        0x46d306d8u, 0x185dcf18u, 0x8340462au, 0xbb276536u, 0x949310f2u, 0xd6921023u, 0x72a35aebu, 0x0cdfc9cfu,
+        0x70e0d791u, 0xe520a7d7u, 0x2879f104u, 0x73f485bdu, 0xe2d8925fu, 0xdf686ec6u, 0x78c19c9cu, 0xbb87c72bu,
+        0xccdc0279u, 0xdaa8f666u, 0x9acad8beu, 0x70398bc1u, 0x670020b2u, 0x48ea69dfu, 0x1d8431a7u, 0x963a1bd1u,
+        0x8e99057au, 0x631f0057u, 0x0480e3fcu, 0x4861a2afu, 0xbd6eaec2u, 0x12b5ec8au, 0xa837d03bu, 0xaffbf830u,
+        0x0ff7f55bu, 0x3a021716u, 0x4114a844u, 0x79a119e4u, 0xf929bde6u, 0x38ba0dd6u, 0x838ae1fdu, 0xe1e4b521u,
+        0x16318d93u, 0xb4f140ffu, 0x7e135176u, 0xfe4f5d3eu, 0x6182f1e0u, 0x6ba406e2u, 0xc57d6ffau, 0xc8636580u,
+        0x9f89dd14u, 0x7e5daa83u, 0xf2529465u, 0xba1f365eu, 0x67d8bab4u, 0x2b3164cdu, 0xda401492u, 0xa801348eu,
+        0xe24f53ecu, 0x053498e7u, 0x257b8367u, 0xc41f4af7u, 0x7ebebefbu, 0x9fa42fb3u, 0x229efa6bu, 0x281c4b43u,
+        0x88a65e10u, 0xef17c645u, 0xc2a63693u, 0x1c4202d4u, 0x5485dec6u, 0x584030f2u, 0x3801b288u, 0x6154d0f8u,
+        0x3b129a02u, 0x0fd941d0u, 0x7b18afbdu, 0x067e583cu, 0xc1cb842cu, 0xb89fd249u, 0x741126adu, 0x80d2a4c6u,
+        0x04707156u, 0x525dc4bcu, 0x44bab5d5u, 0x0b258de9u, 0x876302bfu, 0xdc0027bfu, 0xdbd10b0au, 0x7fc8cbe3u,
+        0x40cfe10au, 0x233bd3e9u, 0xbafa3c1fu, 0xfd1de296u, 0xc10da172u, 0x7cc882a9u, 0x11d01247u, 0x622c008bu,
+        0x2a292a5fu, 0x4dd96e7du, 0xf7fddf95u, 0x5dfa80e4u, 0xe859cdffu, 0x2eb9c2aeu, 0x0a2c05b8u, 0xc05ebb94u,
+        0x5fe6fefbu, 0xef55fee2u, 0xc4ebb93eu, 0xe152b888u, 0x7b22f943u, 0xd8224e8cu, 0x5b34912eu, 0x6003870fu,
+        0x633fb413u, 0x9b3cfb20u, 0x2fbd4702u, 0x273ad1bau, 0x02f9f6ddu, 0x08c6f205u, 0xc2e32c9cu, 0xa7486304u,
+        0x8250a506u, 0xfbae6695u, 0x43b256f3u, 0x57e153d8u, 0x26464c08u, 0x4499dd23u, 0xadc5817cu, 0xa4be61a9u,
+        0x1ae6ec16u, 0x5e736f5du, 0xb1a5ce1eu, 0x892587a0u, 0x47609b1bu, 0x839b4291u, 0x5e4bca48u, 0x42eecbb1u,
+        0xc942f309u, 0x509a84f4u, 0xa7722493u, 0xff937f86u, 0xbcc7bb6fu, 0x7383f328u, 0x04cd8e8au, 0xcbd8b616u,
+        0x5f677f5au, 0x837efa2au, 0xd9e94f28u, 0x8e5293f8u, 0x045ba992u, 0x0c921064u, 0xc4e99698u, 0x11a4bcedu,
+        0x5121a706u, 0xf39af2e8u, 0xf5ee7b65u, 0x4e0dd68cu, 0xf5c80842u, 0x03b9b21bu, 0xc0886dc5u, 0x57bd6325u,
+        0x9da539ffu, 0x4a56344cu, 0x43353234u, 0x26da0649u, 0x7576d05bu, 0x3623a9d6u, 0x45985ce9u, 0xe1042a65u,
+        0xaa656a6du, 0xe4e2a5c4u, 0x32ceaeadu, 0xec3011a9u, 0x36cd909au, 0xe803adedu, 0x1c85619du, 0x00322c0fu,
+        0x40f37285u, 0x15d91550u, 0xd9571666u, 0x584aeb84u, 0x9c51c515u, 0xedf02c29u, 0x9dd1c9eeu, 0xfb446f9du,
+        0xbffe4e84u, 0x72174b81u, 0x167ef6acu, 0x06714724u, 0xb9a4f6bfu, 0x5a10f3b9u, 0xd77d90a1u, 0xbae84063u,
+        0xa2b6914cu, 0x0152ae4cu, 0x07c96c66u, 0x95029132u, 0x208236cfu, 0x835ddeaeu, 0xaec7fdd1u, 0x01a80465u,
+        0x8a72a2aau, 0x7d093628u, 0x7fa14080u, 0x9c499ac1u, 0x03b88079u, 0x08604103u, 0xb6fb556eu, 0x163444d0u,
+        0x5f9847d5u, 0xe420c575u, 0x5e40dac9u, 0x080d6b0bu, 0xe1b16973u, 0x9fc78277u, 0xfbf8c792u, 0x195b0bb8u,
+        0x2c70894du, 0x0531515eu, 0xe89586f5u, 0xfee7959cu, 0x60b44992u, 0x3615f88du, 0x444ddd4au, 0x01e71a6cu,
+        0x6cb18134u, 0x8232c21au, 0xaeccbb9fu, 0x377cc9f6u, 0xf060b2f5u, 0xfde05b3eu, 0x71a3c8d5u, 0x2f264eddu,
+        0x819ea951u, 0x68a452ecu, 0xfb812739u, 0x28279f7bu, 0xae046405u, 0x5b44d2fau, 0xc4ee9eb9u, 0x94885eb5u,
+        0x2419a269u, 0x765be8e0u, 0xecef77c3u, 0x13ca35b5u, 0x2a73ea2bu, 0x87af17d5u, 0x5dfd6aefu, 0x64c028f2u,
+        0xdc76ed2eu, 0x40477b3bu, 0xb50eb2a4u, 0xeae08a52u, 0xb88873beu, 0x458374d6u, 0x411ba4c3u, 0x00000000u,
+    },
+    { /* 2^130 */
+        0x8c1e030fu, 0x87731b46u, 0xd8168bf1u, 0x52b44e2bu, 0x5042084fu, 0x4efd905du, 0xa324a7f4u, 0xf680933au,
+        0x6a436871u, 0x5ed6987cu, 0xa15ad099u, 0x64d9a78eu, 0x364683e9u, 0x2e9c8e5eu, 0xe909e39bu, 0xd5f2b1dfu,
+        0x11651522u, 0xa5391939u, 0xcdb8f40eu, 0x5d40534bu, 0xb087d8a8u, 0x61ffbd08u, 0x9a2476a4u, 0x10fa01ecu,
+        0xb5c6d025u, 0xc0776055u, 0x198436b7u, 0xeae8c3bcu, 0xd5d0dc6au, 0x1f312aa0u, 0xe0839621u, 0xfd0fccd2u,
+        0x3d2b75b3u, 0xac42e26au, 0x022a3a97u, 0x1fe7601au, 0xb2badd97u, 0x4cfb8622u, 0xb98162a4u, 0x4153f0a5u,
+        0x1a2d6fd2u, 0xff27be9cu, 0x9b417ea7u, 0x5f2a2995u, 0xdb3039a9u, 0xbd7af4e9u, 0xec1b057au, 0x20a21623u,
+        0x9c921081u, 0x19cb4bafu, 0xd7b3e33bu, 0x040a4e6au, 0x730504feu, 0xbec2a6e6u, 0x8ce81b13u, 0x7c97efb1u,
+        0x018bc5e8u, 0x383ddb46u, 0x76091805u, 0xc7d72ce4u, 0x99356e85u, 0x4490f235u, 0xc8873b8bu, 0xdb03e477u,
+        0x9aee90a2u, 0xda3ffe18u, 0xd456632du, 0x418f5c7cu, 0x28c5200eu, 0x1deaafe2u, 0x156a4f19u, 0xb4241dbfu,
+        0xf1fe3aa8u, 0xc743dc20u, 0x5dd2c069u, 0xb2a49e4du, 0xecfd93d3u, 0x29279965u, 0xd3aa5baeu, 0xec48fc28u,
+        0x83fba8fau, 0x440d717du, 0x784afff7u, 0x279c6db0u, 0x716bc760u, 0x888648e3u, 0x702cd64du, 0xd26b5d0au,
+        0x00d96605u, 0x85d7a708u, 0x47f1ad92u, 0xf57aa1d6u, 0x14e0ad7fu, 0x71f38a2du, 0x1f64401au, 0xfcc92bf8u,
+        0x0f13fe96u, 0x010d1ca6u, 0x17998428u, 0xef8b7aa5u, 0xeddea934u, 0x4c52319eu, 0x89684d00u, 0xb2bf4fc2u,
+        0xcaf6a884u, 0xfe539fbfu, 0x6181a836u, 0x74c3185fu, 0x41a235dbu, 0x08118720u, 0x113de984u, 0xfe6b7938u,
+        0x56d02eb6u, 0x2508159fu, 0x57da361du, 0x32648f8eu, 0x77b9813du, 0xbded3555u, 0x716ec626u, 0x5c778311u,
+        0x4f3dcb26u, 0x9f9f6890u, 0x3923d433u, 0x3a80a8fbu, 0x2c508414u, 0xced62b7bu, 0xa373eb2fu, 0xad2f2f12u,
+        0x144232c5u, 0x42aea879u, 0xb7b011e1u, 0x443e2fe2u, 0xa07913ecu, 0x2b2afe06u, 0x956d7ba9u, 0xc6b12291u,
+        0x514ce50bu, 0xc8e50c0au, 0x86d135f2u, 0xe7db097bu, 0xe802b4bau, 0x14d7b4b2u, 0x3bf7e603u, 0x23c46b44u,
+        0x878c7d78u, 0x3210ca3bu, 0x0c46f49fu, 0x60119251u, 0x0c9b86bau, 0xe974f600u, 0xbb426856u, 0xfcea36eau,
+        0xfb10e74du, 0x30e1aa79u, 0xa6d62b15u, 0x73ad2455u, 0x6af13f04u, 0xb7261d2bu, 0x5bacb6c8u, 0xc12a7f56u,
+        0x93257dceu, 0x1f7de654u, 0x54be6e5du, 0xdac244e2u, 0x7e7ae546u, 0x92bcc0ddu, 0x240fbf4eu, 0xd29b4543u,
+        0x2da50e8fu, 0x9e46f50au, 0xd4e06276u, 0xabf396e8u, 0xdaf7d7ccu, 0x47f9cdcbu, 0x9c531c64u, 0x15b0d1d7u,
+        0xd4859b8au, 0x6f58c595u, 0xf53c21a3u, 0x5e76b073u, 0x4fb1d149u, 0x3d63dcdcu, 0xe2f8ec5bu, 0x2a4696e2u,
+        0xb7852b55u, 0x0a60eb45u, 0xf74b3a43u, 0x90b14d10u, 0xcec1dcb7u, 0x0a5d7726u, 0x42526417u, 0x0be40895u,
+        0x7ed0c6d1u, 0x96d956b7u, 0xdbc26193u, 0x7724af3au, 0xd77c7440u, 0x57ff637fu, 0xc223f160u, 0xb4101483u,
+        0x65fac075u, 0xe51368bcu, 0xffb6ac3bu, 0xd546cb6au, 0xd7feabf9u, 0xca28c249u, 0xd96bb081u, 0x4fba7770u,
+        0x1cb01639u, 0x9b82f00cu, 0xb2c78711u, 0xd1d1ea86u, 0xf358bd09u, 0x09e45af0u, 0xfa0136a7u, 0x889610f1u,
+        0x690692bcu, 0x807eb5ebu, 0x7b68368cu, 0xa70e05c7u, 0xee54eea1u, 0x4f2076d0u, 0x6aaf0dd8u, 0x79d57e27u,
+        0x7ab0ddbeu, 0x4575ec69u, 0x6dc0c3c5u, 0xb0ac2b30u, 0xba302055u, 0xb96cf22du, 0x2427fbd5u, 0x5f400b2bu,
+        0xe5c0cc6bu, 0x4d1e9777u, 0x59666649u, 0xc11947f3u, 0x57ee5db5u, 0xfdea8932u, 0x34a870cdu, 0x15461778u,
+        0xecfa902fu, 0xce2d28b3u, 0x161aba1bu, 0x03461bdcu, 0xd87c0126u, 0x9847e5b9u, 0xfb2a45f7u, 0x12bdc3e2u,
+        0x11e85b14u, 0x0706df4eu, 0x8a519221u, 0x37c9058eu, 0xe95d2a5du, 0xbca22490u, 0x586b3876u, 0x503072fdu,
+        0xaac32d1bu, 0xe29d18a7u, 0x17d95122u, 0x6ca3e287u, 0x3e3fed01u, 0xe985e7b0u, 0x0c41d35eu, 0x2388261cu,
+        0x7d257b1bu, 0xf0c4f8c8u, 0x9f4fe393u, 0xe2266491u, 0xe8faca46u, 0xdf90fe31u, 0xd3c41e6eu, 0xafbd8e2bu,
+        0xae2c0d39u, 0x5719e30du, 0x5e8dd865u, 0x6f5eb205u, 0xcfbd2cfcu, 0x62a521aau, 0xb5942c1eu, 0xbe83098du,
+        0x52a43dafu, 0xa5e9a12bu, 0x4375b0f4u, 0x97a6a350u, 0xa73cbe5du, 0x4965d67du, 0xce38b0bdu, 0x2c0e9c79u,
+        0xd19a732cu, 0x69d95024u, 0x2dfc393fu, 0xfb62015cu, 0xcea7a956u, 0xd136cb8fu, 0x00fc72afu, 0xae4c04dcu,
+        0x5785b428u, 0x08e2e57fu, 0xd866a53eu, 0x8ba168e5u, 0x8ff6302bu, 0x3f3a9a7du, 0x4417e2c6u, 0x525d0015u,
+        0x86fa4936u, 0xd4861085u, 0xa5c17b96u, 0xbf8fcb20u, 0xbe5f9a89u, 0xe4eb3085u, 0x58d97c5bu, 0x2bf1e946u,
+        0xb8cbbf2fu, 0x2da9627du, 0x07024130u, 0x0dd4c39eu, 0x1423526au, 0x76159a17u, 0xc02c4884u, 0xb2a27687u,
+        0x46db93acu, 0x23f0d9c8u, 0xd3965177u, 0x0eebc984u, 0x44c355a5u, 0xb65dbb21u, 0x594c611bu, 0x5e543b22u,
+        0xc685c95du, 0xe08cd5ddu, 0x877eaacdu, 0xfd145a1du, 0x01172bb7u, 0xfa58c430u, 0xb580b34du, 0x3581ca1bu,
+        0xa7bc2c96u, 0x00a7eaf8u, 0x71f93806u, 0xe1901bfau, 0xa5d01d41u, 0x2f7b19e0u, 0xdcd59911u, 0x6d26e95au,
+        0x24ce79f7u, 0x9c48b71du, 0x7b92d4f4u, 0xf3567648u, 0xcca94b77u, 0x5a33d030u, 0x534b1b72u, 0xe64ecd01u,
+        0x3c69c4bfu, 0x99686314u, 0x58ad387bu, 0x70390ca6u, 0x6553b689u, 0x594e8825u, 0xc6c7efbbu, 0xfc0eaf98u,
+        0x0db26b2cu, 0xb7d8238bu, 0x1a1f3473u, 0x0daa09deu, 0x38d17164u, 0xf99a187du, 0x488fff87u, 0x2a7109bbu,
+        0xb3777397u, 0xec469d7bu, 0x73f4b316u, 0xa105a1b4u, 0xc59f74a5u, 0x7b2b3bc1u, 0xabc9b5ceu, 0x39522211u,
+        0xfc834e24u, 0x328d64e0u, 0xc22d4b0du, 0x0ac2e226u, 0xa9419aaau, 0x03566406u, 0x728731b3u, 0xec647106u,
+        0x39f4f3e3u, 0xa1387263u, 0x0df946ccu, 0x470c9f94u, 0x79aca6ddu, 0x037e9241u, 0xd9ec8a01u, 0x1407fec5u,
+        0xcf564fc6u, 0x303d94efu, 0xceea572au, 0x82a611b9u, 0x968f19e2u, 0x970c7fd2u, 0x9f3271eeu, 0x170e7e06u,
+        0xefa768dau, 0x54e6a352u, 0x6914e6aeu, 0xd7e667cfu, 0x6353e458u, 0x208f0b1eu, 0x586337d2u, 0xb952e431u,
+        0xbc418612u, 0x629ae832u, 0x74ad5eacu, 0x25e78d11u, 0x2652bfe1u, 0x50b7469bu, 0xf939638du, 0x8e07ddedu,
+        0xfc92e389u, 0x0f4fc685u, 0x77c49eceu, 0xa9cb3b7fu, 0xf03c4aabu, 0x4a1231e4u, 0x811c5010u, 0x6d6e4aa7u,
+        0x76e74a99u, 0x71d0a82du, 0xf52f5abfu, 0x21ad1e48u, 0xba693a79u, 0x5226161cu, 0x689a5b8eu, 0xae2d67f3u,
+        0xab86d837u, 0xda50c9bdu, 0x88bd2d34u, 0x043c425au, 0xb9762371u, 0xea6d57fdu, 0x29276a44u, 0x2ad9ffb7u,
+        0xd2ad7cd9u, 0x7a53f8fdu, 0x030a4bc5u, 0x63769c41u, 0x62998ebeu, 0x9e1e672bu, 0xf0f183b8u, 0x7d80aec6u,
+        0x37e2923fu, 0x64c1fed6u, 0xca65d55bu, 0xf26c881fu, 0x28ac3c21u, 0xb08a3881u, 0x859b6bdau, 0x708e748au,
+        0x932c43b7u, 0xaba7db37u, 0xba89765fu, 0x43a4ca96u, 0xa0ff348du, 0xedc5ad8cu, 0xd99bf14du, 0x5e0b662cu,
+        0x988d0fffu, 0xc4acb015u, 0xa76fdc31u, 0xafd4ae62u, 0xc89e3500u, 0xc3dfabefu, 0x2f2d43e7u, 0x9755024bu,
+        0x72b547f3u, 0x2520bd6cu, 0x4a12cf94u, 0x10fc3fa3u, 0x137e1cefu, 0x706c0d6au, 0xeb7cf26fu, 0x875afa20u,
+        0x7b9056a3u, 0x30302702u, 0x007a8ce3u, 0x8224548cu, 0x05422ebeu, 0xc807fb23u, 0x68291e1fu, 0xe9f99898u,
+        0x1bb9aceeu, 0xd67ad248u, 0x6b3b0e85u, 0x20d7c5f6u, 0xd83ac742u, 0x91590680u, 0x99544a0cu, 0xf2432345u,
+        0x23ee53d0u, 0xa4f6031cu, 0x5ad9fd17u, 0x6379a301u, 0x74c6b869u, 0x7755e221u, 0xfcb4a617u, 0x25329b4fu,
+        0x464100cbu, 0x62e6bd87u, 0x8c663b94u, 0x080b62b4u, 0x9369ec88u, 0x8a32df62u, 0xaf501bceu, 0x140b0445u,
+        0x321954d6u, 0x66672a8au, 0xf427e143u, 0xc693cd39u, 0x2a9a958au, 0xcce0a30bu, 0x719bc09au, 0xb98a9464u,
+        0x91be9a8cu, 0x4028dde4u, 0xcfbfb27fu, 0x2dd22d83u, 0x79230a64u, 0xb8cdb446u, 0xd1c4617du, 0xa103a1e9u,
+        0x13fe420du, 0x117af3ddu, 0x317fa06cu, 0xa628044bu, 0xdf538df3u, 0xd9f07280u, 0xee11a02eu, 0xb1779b2bu,
+        0x5a749776u, 0xd1da09bdu, 0x6cd4c862u, 0xf7ba6815u, 0xfb915a87u, 0x6bd9ee35u, 0x4dd478aau, 0xb664f995u,
+        0x9b66b8e3u, 0x59857ec9u, 0xbd3eb278u, 0x8a6b5f0eu, 0x16725b73u, 0x21a713f3u, 0xe150c550u, 0xa472db70u,
+        0x30954314u, 0x4ed12914u, 0x36d1b4bdu, 0x1cfb7f09u, 0x0740d4fcu, 0xdeaaaa47u, 0x3e15732du, 0xe02eb1bbu,
+        0x70f4f926u, 0x2a78a7ffu, 0x3877c44fu, 0x15c13b38u, 0x3be2c9f6u, 0xa8ae689eu, 0x5cc55a98u, 0x00ce9971u,
+        0x79676657u, 0xc96e2b0du, 0x35d3e4d9u, 0xb8bc7cb8u, 0xdc221f96u, 0xc4cf2788u, 0xa954d3cfu, 0x1a536805u,
+        0x9a518c2cu, 0x7e64e471u, 0x61c0414cu, 0x99b724f6u, 0xac3eb941u, 0x27361627u, 0x10fb6772u, 0x24ecf761u,
+        0x603746d6u, 0x50f80c89u, 0x6b5dabd1u, 0xb406aa67u, 0xe77bbe87u, 0x616409c4u, 0xccd27b68u, 0xc5fb746du,
+        0x059224b4u, 0x46e970f1u, 0x016eafebu, 0x862ced0cu, 0x8c3f935eu, 0x5e97c249u, 0x052ba05bu, 0x8a266b53u,
+        0x8925402bu, 0x5a689dfau, 0x24bc13a9u, 0x9712c5bdu, 0x024c4419u, 0xc539b28fu, 0x70e0ccf1u, 0xd06accadu,
+        0x74b87406u, 0x4efed65bu, 0x781c5c62u, 0xdc0fc3a1u, 0xb84d34cdu, 0x11643607u, 0xf63c66d3u, 0xe6d7c0c6u,
+        0x3f3775d5u, 0x3e95f4e7u, 0x5a9f43b6u, 0xd053545cu, 0xca48b69du, 0xf786a2bdu, 0xd673fb26u, 0x00000001u,
+    },
+    { /* 2^131 */
+        0x0d1c4788u, 0xa13d0a23u, 0x308d6ed9u, 0x23fc278fu, 0x468cbe0cu, 0xc764612au, 0x86084cb4u, 0x53ed005eu,
+        0x3e30aff1u, 0xcf36b6c1u, 0x53ca36f3u, 0x6817be97u, 0xaaacdb12u, 0xb06ce5c1u, 0xa4b77bacu, 0x04901f84u,
+        0x05cf13e4u, 0xe60db62du, 0xa6235045u, 0x38cf4751u, 0xa1ad3894u, 0xab192971u, 0x24676fa5u, 0x93e529c8u,
+        0xf1b518bcu, 0xc3ecb01cu, 0x010f5b18u, 0xf1dfb371u, 0xc5214608u, 0xe336e88fu, 0xccd4e904u, 0x91940360u,
+        0x295a4235u, 0xa06ff9d7u, 0x40e82ea9u, 0x8a034c27u, 0xf5baa7efu, 0xdfbee2f7u, 0x0819b7fcu, 0x5aa8e1a0u,
+        0x426be3c7u, 0x97e8b002u, 0xc7064367u, 0x2243720bu, 0xe0324ff6u, 0xb2b88b58u, 0x27510f1fu, 0x587c4affu,
+        0xa2398fbcu, 0x31622aabu, 0xb552a26cu, 0xc04a6975u, 0x8d7e2c1cu, 0x5da331b4u, 0xc900c73bu, 0xe13dfd75u,
+        0xf371855du, 0x52076bfdu, 0xe8657629u, 0xc6abf5cau, 0x9fda815cu, 0x85c6bc8au, 0x7538de28u, 0xa1349843u,
+        0xc1248e59u, 0xe6378e8du, 0xa428e979u, 0x8cfe6f1au, 0xf0cb6288u, 0x2f6497b3u, 0x9a11c49cu, 0xf5c81822u,
+        0xc7c45092u, 0x9568955bu, 0xc5546936u, 0x028fa89bu, 0xefd9a821u, 0x5055bb0cu, 0x21501d99u, 0x7f0bf623u,
+        0xd6f699a6u, 0x7e116364u, 0xf040551bu, 0x7ba62ecfu, 0xc9d80b46u, 0x390b8232u, 0x4efe0f00u, 0x6ab12545u,
+        0xe7d727e6u, 0x11817594u, 0x1b9040c4u, 0xaca100c8u, 0x2a01ff84u, 0xcfcb6ba5u, 0xb63f5fb5u, 0xb0da800fu,
+        0x27b6c873u, 0xb1c50ff1u, 0x0e6c447bu, 0x58384d4cu, 0x35fd2499u, 0x5d8c059du, 0x6f774170u, 0x8c4ed5e1u,
+        0x7d106609u, 0x628175d4u, 0xcb740e50u, 0xcddd38bbu, 0x0e07efdbu, 0x2e4f1b19u, 0xf9bbe560u, 0x7ec6b67eu,
+        0x593f39e0u, 0xb55456d0u, 0x457673a8u, 0xd2a62737u, 0xd0e47c96u, 0x26361fb5u, 0x9958514bu, 0x057d777au,
+        0x660de4bbu, 0xeefb2c0eu, 0x70802139u, 0x45894b18u, 0xdf57689au, 0x19f0a56fu, 0x12f606beu, 0x1fcfbe55u,
+        0xe9d1170bu, 0x8a636a8bu, 0x4732243bu, 0xfe3839a5u, 0x85ed0799u, 0x71781f36u, 0x6606e1b5u, 0xbc566532u,
+        0x8de7cb3bu, 0xdaff4e40u, 0xc2fceb5du, 0xe69f502eu, 0xab661bacu, 0x92575c4au, 0x89c45ddau, 0xe08bf108u,
+        0xdb8600d0u, 0xc008af08u, 0x761d33feu, 0x5e050db7u, 0xde12cc86u, 0x87343000u, 0xe9313688u, 0xffe1e353u,
+        0xa6868bb7u, 0xbfc1ef2bu, 0x96a2fb1cu, 0x8ee8a886u, 0x249cb352u, 0xac58fa8cu, 0xc9bdd0adu, 0xc850ba81u,
+        0x59ed6618u, 0x84448c5cu, 0xb442fa38u, 0xa15c5bdeu, 0x0d25cc82u, 0xb9d40c42u, 0xaf411c9eu, 0xb81ec1c4u,
+        0xe7b6c684u, 0x4a5606d1u, 0x50924d2fu, 0x6c2836a7u, 0x21c1400bu, 0x9c8609cdu, 0xedc2a7e1u, 0xae607155u,
+        0x43ffe8feu, 0xbd4f4a6eu, 0x8a81f737u, 0xbfcdf9d6u, 0x94a21180u, 0x28464a8eu, 0x8d15586au, 0x2377fcefu,
+        0x50ca4024u, 0xc8beda62u, 0xc2ba365fu, 0xcaa8d7ddu, 0x5f6a10fau, 0x933a0dc1u, 0xfd41f92cu, 0xff313507u,
+        0x6f9f4d7fu, 0x7af5f406u, 0x9c7cfc04u, 0xf829eb8bu, 0x7e22dcc2u, 0xea9cce6du, 0x8d53a824u, 0x1d90d9b9u,
+        0xd31d3ecau, 0xb57a031bu, 0x950c9ca8u, 0x78f4ff23u, 0x0c07d747u, 0xd8dfd4fbu, 0x99a097d3u, 0x6071845du,
+        0x8f4c6c9fu, 0xf66a9ec3u, 0xc6681f4bu, 0x4819c29cu, 0x8362d4b4u, 0xe0e08cf0u, 0xdf7eb25au, 0x4374bdf0u,
+        0x1b983077u, 0xacace925u, 0x57cb6cfdu, 0xe9ed9eb1u, 0x848eab75u, 0x908c5859u, 0xb94c8dd9u, 0x28a32eb7u,
+        0xdaeab4e0u, 0xf4a1db80u, 0x6bdc1c85u, 0xc85203e5u, 0xd8cb75adu, 0xfea58127u, 0xf41815adu, 0x2db768f2u,
+        0x5be5c602u, 0x8c9caec6u, 0x7d966f97u, 0xb8e5bf65u, 0x1f7b6abeu, 0x13b845d6u, 0x1b31b1a2u, 0xb771eaeeu,
+        0x5d396bb6u, 0xf01a1b43u, 0x24de37b0u, 0x8f4374b2u, 0xfe22c677u, 0x584fc895u, 0x57186e6au, 0x1fc7e95cu,
+        0xb50ac575u, 0xf22b329eu, 0x0e6c325eu, 0xa6ed5c8fu, 0xde4bfa1eu, 0x4ee94c0au, 0x2f8565dcu, 0x7acdbf89u,
+        0x735211e8u, 0x17718d59u, 0xe6772163u, 0x3aa783fcu, 0xdf1e32a7u, 0x4bbdebb6u, 0x216b25eeu, 0xa31bebdau,
+        0x22cb64e1u, 0x6ce238d6u, 0x675954f0u, 0xf28672f3u, 0x226dc52cu, 0xe8b91cceu, 0x04840beau, 0x2d0e48e1u,
+        0x6d45df50u, 0x5c654eb8u, 0x0ca29fc4u, 0xcc1dad1fu, 0xb157a3b4u, 0x8f1fc6f9u, 0xd97ee2c8u, 0xea76bf5du,
+        0x9836c4bbu, 0xc7566aaau, 0xfef75bebu, 0x8e8cde01u, 0x400d68b9u, 0x092fec1cu, 0x811f6bd0u, 0x2438decau,
+        0x43f9cf8bu, 0x1eb0248fu, 0xe0e2d6bfu, 0x825108f4u, 0xa622b229u, 0x3d4d47c8u, 0xd967fb95u, 0xab80b73au,
+        0x7bb576e9u, 0x02c446f3u, 0xd357f5b3u, 0xdd59e870u, 0x55c8bb96u, 0x4155262bu, 0x97c2be5au, 0xc5d86fcfu,
+        0x67c3357au, 0x5a2c220bu, 0x2180c2e1u, 0xece32a13u, 0x2b66b6e4u, 0x7059b0a8u, 0xcc8414adu, 0xeb483c59u,
+        0x87bf2f50u, 0xb73361f9u, 0x47bf6650u, 0x349e5346u, 0x912e8686u, 0xd96f8757u, 0x83d166feu, 0x6d5ddb8au,
+        0xab09e2ceu, 0xd37df7ceu, 0xdd0d2a1au, 0x1f40f938u, 0x7d009668u, 0x057aac48u, 0x79620c53u, 0x534e663bu,
+        0x8858bd1au, 0xff8b32abu, 0x1a007b32u, 0x866e5343u, 0x3d7e0e2cu, 0xca0b6738u, 0x4910d018u, 0xb9285522u,
+        0x546b5006u, 0xcbcbdf8au, 0x9d155a05u, 0xfca32917u, 0x07d48eb3u, 0x0a724faau, 0xcf64949du, 0x4e95dd61u,
+        0xdef02f11u, 0x0ecac748u, 0xa8fc587fu, 0x2ed0ab79u, 0x1a1ed0c8u, 0xb403660cu, 0xbb75a250u, 0x39718968u,
+        0x8f685b7du, 0x8a30a6eeu, 0xecdfc90au, 0x1187b91fu, 0xfd0d2453u, 0x5efce842u, 0x7bba762bu, 0xeb1ebaadu,
+        0x7f7d7420u, 0x443132c5u, 0xa382ba03u, 0x540e86acu, 0x9ea6fd7du, 0x9ceb53fbu, 0x2142c4f6u, 0xfe86c88du,
+        0x4a92b28du, 0xc6de0a3au, 0x956c715bu, 0xfea1ece9u, 0x1a1c8293u, 0x1895236eu, 0x76bcb6c0u, 0xec015beau,
+        0x24e89250u, 0xf0f498bcu, 0xd0afcd7bu, 0x330eb32au, 0x265ddfc8u, 0x2af32c49u, 0x14a7941bu, 0x19766801u,
+        0x64a223c6u, 0xd2c1fa10u, 0xe91076eeu, 0x86bc2139u, 0x5fc48631u, 0xd26ee9dfu, 0xeefcd12au, 0xf1ceb558u,
+        0xcd0c29f9u, 0x8bfa495bu, 0x0b141595u, 0xf95fb384u, 0x891d05fbu, 0xc88d9a85u, 0x01912fd4u, 0x3395deaau,
+        0x078edcabu, 0x70e59ce7u, 0x7d5d8afdu, 0x3a306574u, 0x5ecd16e7u, 0x2ee591a5u, 0x4088404au, 0x8b22f43au,
+        0xd3746516u, 0x57e6a11fu, 0x534f5c26u, 0x2abee94du, 0x5d5e63f6u, 0x4d494857u, 0x94076c33u, 0x7c372fbbu,
+        0x2617c245u, 0xc20f54d3u, 0x1583da65u, 0xa1a4a122u, 0x47ae5333u, 0xdbbce0cau, 0xbea5d46au, 0xd561ce1au,
+        0x1e070ce5u, 0x3aecf0a8u, 0x031de9ecu, 0x906b2ffau, 0x377f4e8au, 0x799bf4b8u, 0x7adc8d40u, 0x2952c2a4u,
+        0x0a137da4u, 0x299e337eu, 0x6eaa57ddu, 0x77b3c3f1u, 0x0fb0046fu, 0x9aa74d5fu, 0x58521008u, 0x85d894bdu,
+        0x8434918au, 0x72530f0cu, 0x0a035f79u, 0xa24afe3du, 0x8603c115u, 0xc3da0206u, 0xd0ac16e1u, 0xa1032b56u,
+        0x824ea4e8u, 0xd380a3fdu, 0x0bb27a5eu, 0x41c5e93fu, 0xb7c7177fu, 0x9d06ca38u, 0x11b6ed5cu, 0x28bd4010u,
+        0xb93e6cf5u, 0x155e60a4u, 0x1cbc3116u, 0xd9ec1e9du, 0x33cd86bfu, 0xfd1759cdu, 0x96c6c2bau, 0x28c35d3au,
+        0x0adb1766u, 0x259a4030u, 0xbd6437a2u, 0xe3c6c7c2u, 0xde724813u, 0xffbc6efau, 0x483b89a2u, 0xc7f40ecdu,
+        0x9f73ff85u, 0x8f1bea12u, 0xa6e3d1ccu, 0x038394bcu, 0xfcd5aca4u, 0xda215f2du, 0xcb81ad84u, 0xff162e62u,
+        0x31cf0ce0u, 0x769d5399u, 0x88c57b31u, 0xd0ca7bdbu, 0xf8c03667u, 0x2a26e727u, 0xc8a38265u, 0x4561d212u,
+        0x941175cbu, 0xaa306c77u, 0x4d24d6b4u, 0xd4e175fdu, 0x81acda8eu, 0x5276321bu, 0xc41b0996u, 0x51de7e83u,
+        0xe8730091u, 0x8db1e095u, 0xedb0de3eu, 0xc81a6a6fu, 0x749467fdu, 0xfe865b1cu, 0xb06f6283u, 0x1c9c298bu,
+        0x72646c13u, 0x40cd1c0fu, 0x922e045du, 0xcce1b307u, 0x1d5c9235u, 0xc5aa531au, 0x96f20ca0u, 0xf4b3c58fu,
+        0x5f1b8471u, 0x7b2dc794u, 0x09c73503u, 0xb8823f79u, 0x40a5bacfu, 0x4e8a000eu, 0xcd570317u, 0xae7902fbu,
+        0x7418c9b9u, 0x4af9a832u, 0xe71e23f6u, 0x9b726638u, 0x67e6bd26u, 0x20b48c35u, 0xc49b7736u, 0x93e36f8au,
+        0xd20b6f86u, 0xa6788633u, 0xb6d0648eu, 0xc5546a79u, 0xfdb3e355u, 0xe60510d1u, 0xa73b73b6u, 0x2e6df245u,
+        0x018a6657u, 0xfe3dab4cu, 0x84580d21u, 0xad8e72d4u, 0x7058a9f6u, 0x0ed3dbfcu, 0xad6e1923u, 0xfb6d6743u,
+        0x8cbd62edu, 0x802ec042u, 0x0a11ebfdu, 0x0f5269aeu, 0x2fa77d60u, 0xf452f08du, 0x67761fdeu, 0x19383410u,
+        0xbe43fc4eu, 0x21c26961u, 0x983b061eu, 0xf28bd7a5u, 0x9c4f490fu, 0x286f5f61u, 0xf152d367u, 0x34ca71c2u,
+        0xa1e1563cu, 0x9e82be24u, 0xe2bd8a95u, 0x8c7e0221u, 0x0f4adf60u, 0x652657e3u, 0x3409b8f9u, 0x5861b386u,
+        0xc0c915eeu, 0xc54f4f73u, 0x70ac718eu, 0xde4d6971u, 0x3e759b3du, 0x3f90999eu, 0x48f33f5fu, 0xecb2bb58u,
+        0x28e052e8u, 0x922afadbu, 0xaa193651u, 0xaa008d02u, 0xe9311046u, 0xbc067ab7u, 0x3fc74416u, 0x24d63bcdu,
+        0x2b01410du, 0x20e1fcb4u, 0x3469d76fu, 0x3b0d4804u, 0x897c80a0u, 0x718fbdbfu, 0x554a4fc6u, 0x7eb5b537u,
+        0x45c85b74u, 0x69386f7fu, 0x6494fb0du, 0x3d6aff23u, 0xa18e39dcu, 0x9badcdbbu, 0x18b043c9u, 0xe8e44cadu,
+        0x62d15b09u, 0xeed60c98u, 0x046bb64bu, 0xa6f8369au, 0x9b74f1adu, 0x8c3eb657u, 0xa91acb82u, 0xed9dd908u,
+        0x9a4c459cu, 0x9d4080e7u, 0xa5b96cdcu, 0xe1b73efau, 0xc736de7au, 0x1e5e139cu, 0x13a0a0e5u, 0xb4b36db0u,
+        0xb888913du, 0x341603a9u, 0xfd128d47u, 0x824027d0u, 0x33aac1e0u, 0x8883b8ceu, 0x5fd30282u, 0x00000001u,
+    },
+    { /* 2^132 */
+        0xa9b92207u, 0xf8d8ab3au, 0x90976744u, 0xecb42235u, 0x30da34d7u, 0x19fbf617u, 0x0bae9164u, 0x5597a4bdu,
+        0xce81b1a1u, 0x06f19df8u, 0xec1b453eu, 0x8e54ff89u, 0xf9d74066u, 0xc4a4e16cu, 0x396faa4eu, 0x32dbd6e3u,
+        0xc677dec7u, 0x6572b974u, 0x1b72de9fu, 0xdfb10b27u, 0x628cf2c6u, 0xbaeb7379u, 0xed86fda7u, 0x2a288bdau,
+        0x19a97559u, 0xf738c035u, 0xaa82f9dau, 0xe58b9942u, 0xdf0c3436u, 0x9b3f5160u, 0x21ed9c8eu, 0x9baf9c68u,
+        0x28a06ff9u, 0x5763feb7u, 0x57b380f4u, 0x143947b4u, 0xc85c0930u, 0xca7a4466u, 0x0dcf46e7u, 0xf07c1162u,
+        0x360e9b0fu, 0x2bee9556u, 0x3a9dd2fdu, 0x59b95d9eu, 0x3c1ab4a6u, 0xd655df9eu, 0xf8603dbfu, 0x25f60324u,
+        0x54e3dc51u, 0x583157d6u, 0x1301e019u, 0x1d5b3a90u, 0x17ae5a13u, 0xe1fe9d1cu, 0x78032f98u, 0xf6000bbeu,
+        0x2dd775c2u, 0x839abb7au, 0xd4574d10u, 0x6f0971ddu, 0x47f75cfeu, 0x9f00a445u, 0xbc938232u, 0x918af361u,
+        0xf258b37eu, 0x85ff7c56u, 0xe0332172u, 0x6b8e66ccu, 0x95286766u, 0x6b32095du, 0x0b62e50au, 0x7b098e14u,
+        0xf1382a00u, 0xc717939cu, 0x981a891bu, 0x7275ae84u, 0x11446b42u, 0x068e4a44u, 0x69a107a8u, 0xb3acd928u,
+        0xbd0f0060u, 0x53d31afbu, 0xbad2455bu, 0x1ce74257u, 0x029b432au, 0x6c3db24fu, 0xcf334b9cu, 0x5f72a1a3u,
+        0x0f08e64cu, 0x39e95e1du, 0x6ba4fa95u, 0x8e6d4de5u, 0x7e24ac48u, 0x4e5bdc25u, 0x06cd393cu, 0x66d48a22u,
+        0xfaaa04e0u, 0x4deee7f2u, 0xb329075fu, 0x918a2a1eu, 0x6cbf5c04u, 0x328c0ac1u, 0x785fc16du, 0xb90258b4u,
+        0x9e710695u, 0xf8043b0fu, 0x55a6ca05u, 0xad78b4f8u, 0xc9878fc8u, 0x8b3551dau, 0xe7000ab4u, 0xbc766047u,
+        0x30a6e8e0u, 0x8247625du, 0xac6cd358u, 0x97b4ea18u, 0xcb26ca26u, 0xb4c96226u, 0x52a2d907u, 0x5f72b229u,
+        0xa72b5d1du, 0x8ce3fc4fu, 0x0b178147u, 0xee4b4b0du, 0xa9f61c58u, 0xa2823313u, 0x49ecf748u, 0xcd109920u,
+        0x2380f73bu, 0x54b8221cu, 0x07f64580u, 0xfdf17184u, 0xefd0f13du, 0x33c5e3c7u, 0x79d6a280u, 0x61d2c2d8u,
+        0xd9e64436u, 0x7cf89359u, 0x829bac93u, 0xb27d9bc1u, 0x62bfe67du, 0x47180479u, 0xec165bb4u, 0xf5654627u,
+        0x9b968b69u, 0xecfbd96fu, 0x34ad15d7u, 0x474b9465u, 0x18bacf31u, 0xd88b6aefu, 0xb272841cu, 0x119ba714u,
+        0xb35de3a7u, 0xa7da4925u, 0xec7e2dbcu, 0x64560892u, 0x7719d141u, 0x2d3f6231u, 0xffc78439u, 0x62b457f4u,
+        0x6c72de81u, 0xbc4e75c0u, 0xf9420e4cu, 0x411c651au, 0xb974fe70u, 0x8db8132du, 0x1c5f0d4eu, 0xc54276feu,
+        0x7cc131a8u, 0x7d939272u, 0x6214e3cbu, 0xb6ff9a7bu, 0x0d60ae42u, 0xfe29be6au, 0x58101b3au, 0xda99f8cbu,
+        0x5745fc25u, 0xf33ea3cfu, 0xe4a35cb9u, 0x7fe9debfu, 0xf2a51113u, 0xc56a1182u, 0xa827ba68u, 0x91ca2669u,
+        0x68cbbddfu, 0x00f6c0c1u, 0xa8433b75u, 0x075b2f23u, 0x78ea4031u, 0xbdc96b3fu, 0x6b3d7ea5u, 0x72566293u,
+        0x5aa34645u, 0xcd990de7u, 0x2d420a36u, 0xf786c65fu, 0x2d157020u, 0x8f2ceca7u, 0x39e84d33u, 0x0117c609u,
+        0x201639afu, 0xe10b4bd4u, 0x5c675ae2u, 0x7e9aa53bu, 0x1929a222u, 0xc0b008f4u, 0x5578b979u, 0x57c29b47u,
+        0x012f2b3eu, 0xbf82f3b9u, 0xe8d1fc63u, 0x0fa63bfeu, 0xc6797179u, 0x2a2874e4u, 0xc8254b5du, 0x6c8e230bu,
+        0x2b351e93u, 0x759e971du, 0x6473dc8du, 0xe79bd9d1u, 0xe7e3515bu, 0xb5fa9299u, 0xbf70707eu, 0x787fde29u,
+        0x5270c992u, 0x9689fb7fu, 0xf9b96614u, 0x36f43c5fu, 0xdb61b42cu, 0xb8e78fbau, 0x6def6c5fu, 0x8f5d7a37u,
+        0x76f7cfbeu, 0xaf14106du, 0x2838a1e8u, 0x61e0bf14u, 0x70ad8b00u, 0x13c4e55fu, 0x439cde0au, 0x7e085701u,
+        0x87c16009u, 0x9dd5b445u, 0x3aa045d5u, 0xc8334113u, 0xe62958f5u, 0xd95bb53eu, 0xfd69397bu, 0xdafa5099u,
+        0x0a508344u, 0x94d80995u, 0x03451487u, 0xd3a899ecu, 0x9c3d999cu, 0x67a14c65u, 0xa70e7df2u, 0x83fb44d4u,
+        0xdfbe0e46u, 0x16d04741u, 0x2a6921bau, 0x4a6e528bu, 0x119a895au, 0x0ae21ccfu, 0x9bb49c34u, 0x04ecfd88u,
+        0x7a96f686u, 0xad7cf580u, 0x697b2d10u, 0x0f894064u, 0x55de2bb7u, 0xceeba5abu, 0x0a433d58u, 0xbe29f5ceu,
+        0xc6636f68u, 0x928e967bu, 0x93307d65u, 0xbecdc3ddu, 0x056a8cf9u, 0x684f6299u, 0xacc36efcu, 0xf7154e1cu,
+        0xb54833bau, 0x2ec661eeu, 0x509584f3u, 0xb1815372u, 0xc1a22e24u, 0x0f4ecdbbu, 0x0e0ba14eu, 0xfcf86f9bu,
+        0x0f3baeb9u, 0x1f9de79cu, 0x9a19a0e6u, 0x69135f0cu, 0x0a590f07u, 0xcdccb780u, 0x392b2127u, 0xff36dbd7u,
+        0x9d9e6496u, 0xb6fefd4du, 0xcffc127bu, 0x9466c74au, 0xf4ce0a02u, 0xdf3dba89u, 0xaf4e162au, 0x3b1b3ebdu,
+        0xa458f332u, 0x0e27cdd9u, 0xff5a81edu, 0x139c4219u, 0xd45b2b3cu, 0xfcba3d40u, 0x81599e56u, 0x78116155u,
+        0xbc5e6e89u, 0xf03b001bu, 0xba0ba45eu, 0xe8ef5bb7u, 0x9090a90du, 0xc43fef6cu, 0x895c0fa6u, 0x49c6491du,
+        0xd364dd1fu, 0xcb24345eu, 0x878bc5c2u, 0xf037e270u, 0x932f4625u, 0x14169c17u, 0xb9115620u, 0xe92a83e4u,
+        0x9f380c22u, 0x1fb768d2u, 0xf496d936u, 0xacac4de2u, 0xfb13300fu, 0xaca68c53u, 0xba014027u, 0x5a24836au,
+        0xbb235d00u, 0x5c5eff1du, 0x2ce98a01u, 0x2f611d38u, 0x1e151bddu, 0x8b3d58b4u, 0xc4c26eadu, 0xf3999831u,
+        0xf7154c4bu, 0x29caa91au, 0x10a8960cu, 0x8f9a3467u, 0xe83bdf27u, 0x4a49f33du, 0xe0128fa9u, 0x624af6e2u,
+        0xf262bd27u, 0x5bdaec4fu, 0x82b6b973u, 0xc6a23f89u, 0xb7992d49u, 0x15898caau, 0x8a16634eu, 0xe28a4749u,
+        0xc7d95a23u, 0x37a12e2du, 0x4c984cccu, 0xc9a4f203u, 0x2aa9c863u, 0x6e523cc7u, 0xe8e37b4au, 0xa018357eu,
+        0xb24cba42u, 0x3a8633d8u, 0xfcc71fc6u, 0x5ebed6aau, 0xadbbfb78u, 0x4ef247ffu, 0x977fae0du, 0x7082a82au,
+        0x9989082du, 0x01379861u, 0x2ed9aabeu, 0x9f944b89u, 0x4541f7ffu, 0x831f4fbfu, 0xf87e5bd5u, 0x3bef2363u,
+        0xe00d4ffdu, 0x2ce32762u, 0xd3a7d9abu, 0x59d7dc55u, 0x1de36406u, 0x4b71cef0u, 0x0e6b8dc3u, 0x776e58cau,
+        0x608d45d3u, 0xcdecab84u, 0x024493bfu, 0x2c19da62u, 0xc934eb63u, 0x1a2acf91u, 0xe1e501cbu, 0xa2081559u,
+        0x83beb7f7u, 0xc8088a00u, 0x7550e87cu, 0x2720d9d8u, 0x972aa827u, 0xa4a903bfu, 0x6b25bc8du, 0x8d553aecu,
+        0xfce876e3u, 0x8147cb4eu, 0x93df1f94u, 0x16b8b523u, 0x36704d75u, 0xc8888e21u, 0x01324132u, 0xe025e529u,
+        0xe4126055u, 0xe01fd53cu, 0xeaaa3806u, 0xeeac4510u, 0xf002f4d6u, 0x5d2bb920u, 0x381dad68u, 0xab16dc09u,
+        0x4fbf9a84u, 0x017bd2fau, 0x5deac73du, 0x38a3dde2u, 0x4e0fe230u, 0x628e1b35u, 0xf3649365u, 0x89d64ec4u,
+        0xc975434fu, 0x1d39a405u, 0xce0b1daau, 0x23d7b6fau, 0xb338d725u, 0x9889ba2fu, 0xc28aab6cu, 0x0625d1e6u,
+        0x387afb42u, 0x5442ae58u, 0x84cc8b66u, 0x4a3f663cu, 0x9a652e84u, 0x171a9ad1u, 0x12e72fb0u, 0x2ce4b497u,
+        0xde940896u, 0xb1279d8fu, 0x1d0f6a25u, 0xe497ed69u, 0x6df53ffbu, 0x08266f36u, 0xc2c9255eu, 0x3adfcdcdu,
+        0x578b6e17u, 0x0fd7ed93u, 0x184e898au, 0x3e9566f6u, 0x2c2edbd6u, 0x388e776cu, 0x51756e7du, 0x8421a8deu,
+        0x2695dc1bu, 0xca229ad0u, 0x9dfb0444u, 0x2d6a83e7u, 0x17cc470bu, 0x7476cd80u, 0xe01f3149u, 0xa88512f2u,
+        0xaea3e55au, 0xfcbdb6cau, 0x4b7c3e70u, 0xc1c8b91bu, 0xee29190fu, 0xd9b4fc0du, 0x90467758u, 0xdf707ae2u,
+        0x05975409u, 0x341cd4a3u, 0x6e312cb2u, 0xe3e89d5bu, 0xd2a9771du, 0x0753a19du, 0x9e15804au, 0xdf863852u,
+        0x639e96e0u, 0xe3828058u, 0x0f7c41f3u, 0x59fcf2c5u, 0x0e1b21c3u, 0x9fc51cdcu, 0xb272e9c0u, 0x744ae3cau,
+        0x6768537du, 0xf9ebb39au, 0x1ed859f8u, 0xec72fca5u, 0xff060606u, 0xa08aa2d5u, 0x77cdb4d2u, 0x2991f553u,
+        0x2c922091u, 0xc3892b8eu, 0x1cad4ef1u, 0x8992a806u, 0x79a036acu, 0x43350582u, 0x661951a9u, 0x0e34bb6du,
+        0xd89c181au, 0x689dcc1bu, 0x3f935006u, 0xe4ce16b6u, 0x9fd92c1du, 0xf2d67ee0u, 0x04047f2eu, 0x3077de29u,
+        0x929f4a43u, 0x36bfa0f3u, 0x0aabecbbu, 0x1542f94cu, 0x07ee2a57u, 0x0d4a36b9u, 0x473f5c2du, 0x0df9b48bu,
+        0x85fc43ebu, 0x07d2fca9u, 0xf542059fu, 0x885a5e33u, 0xae2d1b8cu, 0x080f39fcu, 0x3296148fu, 0x4cd0d904u,
+        0xd7829e6au, 0x4add1d2eu, 0xe4d8af61u, 0x64a2d460u, 0x75282065u, 0x4326074du, 0x11ea1b4bu, 0x373ae0d1u,
+        0xa193e750u, 0x1a650c01u, 0x89383965u, 0xf52dad57u, 0xc108cf6bu, 0xed39d6bbu, 0xfe14bd8fu, 0x417d2665u,
+        0x1a29ee63u, 0xd6f11c18u, 0x087f9129u, 0xaa8a7076u, 0x4fde873au, 0x7a0d0730u, 0xdeef0c7fu, 0x844d31a8u,
+        0x956ca471u, 0x173a8f76u, 0xaba95af1u, 0x123aad32u, 0xb14b3827u, 0xd73270deu, 0x718c4a8bu, 0x08ab4b54u,
+        0xd8a9a218u, 0x1c2e1667u, 0xdca848c8u, 0x1a876d00u, 0xe8efefdfu, 0x5a2cef11u, 0xf10ffaa3u, 0x0d5dbd46u,
+        0xa2320a28u, 0x80ef9d17u, 0xb5c8986au, 0x8ab03b54u, 0x87131ad6u, 0x1af4bdd6u, 0x03e5747eu, 0x78cac6f5u,
+        0x3e5558b3u, 0x31c716b3u, 0x8c125bf3u, 0x869e1398u, 0x5693ef65u, 0xd5ce6b45u, 0x7d85edcbu, 0xb648f1c0u,
+        0x93652ae6u, 0xa9b0e76eu, 0xa5562b0bu, 0x813450eau, 0x8a285c84u, 0x21bfc82du, 0xe31d2d39u, 0x897c3dafu,
+        0x18738148u, 0x234ac308u, 0x36842ad6u, 0xfdcc5a06u, 0x84f7aafbu, 0x6526c244u, 0xd1c48d12u, 0x9fd758ddu,
+        0x2f3b77f3u, 0x7a26f493u, 0x75b7e111u, 0x91874076u, 0xe7fa0408u, 0x12f1b516u, 0x9dcca445u, 0x13a13460u,
+        0x627a7b95u, 0xa619510du, 0x4f18771fu, 0x23647257u, 0x8c88549du, 0xf41a8393u, 0xa8f8f176u, 0x00000000u,
+    },
+    { /* 2^133 */
+        0x2f8bc04fu, 0xebf5335bu, 0x2b27b3aeu, 0xa74fe1c9u, 0xd483b5a5u, 0xc8136780u, 0x2f4e1bf1u, 0x4a42c8e1u,
+        0x4e2d4be4u, 0x3a553187u, 0xe220dcdcu, 0xae7d2ce1u, 0xafff66e8u, 0x7b145edeu, 0x0948d0eeu, 0x1d84ee6bu,
+        0xb765632bu, 0x911b34beu, 0xe9c4edd0u, 0xf9c97032u, 0x7962e344u, 0x1a2ce8d0u, 0x3619e06cu, 0x91db37ccu,
+        0x2ff77a23u, 0xa5bbf2b9u, 0xd4fe9e91u, 0x888c26c4u, 0x39deaa22u, 0x63eca3b8u, 0x5240ad5du, 0x54cf9e14u,
+        0x98fd3ee1u, 0x190b8253u, 0x3c9e10b6u, 0x31d1abcfu, 0x9888a9edu, 0xe0cb5a8fu, 0x2302d0c1u, 0xf6c55fdeu,
+        0x433c26e6u, 0x84646e32u, 0x63f6a06au, 0x94f4680au, 0xf834c067u, 0x4595071au, 0x0d42afebu, 0xa98221bdu,
+        0x06a443e4u, 0x479b83b9u, 0x67fb4615u, 0xb1e0af4bu, 0x37b3d5c8u, 0x33921f22u, 0xe2eaef41u, 0x01a855d5u,
+        0x81d2d4bcu, 0x549267bbu, 0x8dcb5b12u, 0x333450eeu, 0x32f78c12u, 0x5c461c37u, 0xc9ae8f1au, 0x83cc070du,
+        0x9180eb65u, 0x6d07ec1eu, 0xaf410420u, 0xff2533fcu, 0xb046d6d8u, 0x9c140c00u, 0x0d27e594u, 0xffc0b28du,
+        0xe8d50ecbu, 0x6d88f72fu, 0xb826cdf1u, 0x75da0e32u, 0x5220942cu, 0x566b9d25u, 0x87529156u, 0x95b71fdeu,
+        0x9ff674b9u, 0xf6c32e48u, 0xa537968fu, 0xffebd5a5u, 0x293d8743u, 0x72538d76u, 0x7550ea63u, 0x7ac4ade5u,
+        0x5f2a17fcu, 0x759881e4u, 0xf719bea4u, 0xc2059e72u, 0x569f536au, 0xf4b52db7u, 0x8b1d977eu, 0x13a0f018u,
+        0x03e516acu, 0x38570d24u, 0x80369453u, 0x9024de2bu, 0xefb13fc5u, 0x6ae35671u, 0x90d85a7cu, 0xe2f07420u,
+        0x15768cc9u, 0x00f52765u, 0x7cf45065u, 0xff22a2a3u, 0xbea7f8cfu, 0xd757d823u, 0x9aa8e216u, 0x42cb0285u,
+        0x8bbf8df1u, 0x2590322eu, 0x8e981c55u, 0x3cc7e5e0u, 0xc67b5582u, 0x5326f572u, 0xae7ceea0u, 0x9804c35eu,
+        0xc2b1f93cu, 0xdf86bd55u, 0x434b3546u, 0x921139c0u, 0x0a9cae5cu, 0x61dd1f56u, 0x048da7d1u, 0xf8fea521u,
+        0xcaad5232u, 0x4010cd0du, 0x5d88eb2au, 0x0cdf0778u, 0xe8788affu, 0x0ddb6247u, 0x4e63718du, 0xdb51b621u,
+        0x146e3b54u, 0xb2370f73u, 0xc32b28a8u, 0x268b2098u, 0x7790c9d9u, 0x97221125u, 0xd3828290u, 0x4a04dee4u,
+        0x58d55b08u, 0x0c9bb450u, 0x5f34244fu, 0x5be39a98u, 0x02262a34u, 0x7e32066eu, 0x881c9f76u, 0x1837560du,
+        0x0d64de35u, 0x94a52656u, 0x47e438d3u, 0x6cd43e67u, 0x20263db0u, 0xd3b22786u, 0x90956f45u, 0x0f95ce53u,
+        0x1438b79au, 0xb98b9a90u, 0xc2dde4e2u, 0x2d93172bu, 0xc6cbab17u, 0x383c9d72u, 0x909d2653u, 0x8e336c83u,
+        0x6c5d051bu, 0x0154aff5u, 0x8066cd19u, 0x369ae5bcu, 0xf7cb547eu, 0x5f8042a4u, 0x819cf895u, 0x04b4a586u,
+        0x342eafcbu, 0xb2a95961u, 0xa04e6417u, 0x32e9a9cdu, 0x0392335fu, 0xaf72f1cau, 0xd007dce7u, 0x8a190e8fu,
+        0xe7cca95cu, 0x2fa8cba3u, 0x6d1bd698u, 0xe3059e84u, 0x40acdd4fu, 0x97c95dd7u, 0x0f995c13u, 0x676e3016u,
+        0x09d69959u, 0x5b697abau, 0x88c3c545u, 0x04fa6f27u, 0x6d39db42u, 0xf1b1c0b8u, 0x058d37d3u, 0x8b5b6d85u,
+        0xea094464u, 0x8a162515u, 0xe373996du, 0xa78f9f0au, 0x48e2fc96u, 0x9fe872e1u, 0xaff38aadu, 0xd04c617bu,
+        0x621b9c56u, 0xd17c9755u, 0xa84ef89bu, 0xda3f79b0u, 0x864119cau, 0x6eede27fu, 0xb428bbcdu, 0x09db46dbu,
+        0xfcf332beu, 0xab436c85u, 0x7527e7a6u, 0xe55f166du, 0xa0940da3u, 0xb8760d50u, 0x66e1ca24u, 0x2bfd60ceu,
+        0xde3969bbu, 0xa25885cbu, 0xed8e1c4bu, 0x77f76e9cu, 0x9f94c706u, 0x02055d48u, 0x9662af64u, 0xf12d360au,
+        0xb68780ffu, 0x5f8406e0u, 0x89fd1dc0u, 0x7b508ff1u, 0x627c8020u, 0x589a8cc1u, 0xde897aa9u, 0xbe993353u,
+        0x98c2b21au, 0x3b8a4522u, 0x4587adbeu, 0x6a4c9823u, 0xbed9f7f1u, 0x06da030bu, 0x678c6318u, 0xd1400b97u,
+        0x31ffe665u, 0x81172afbu, 0x4c0672fau, 0xaad84738u, 0xab92a195u, 0x8f696882u, 0x5bd36dcdu, 0xd575c35cu,
+        0x0285a7bdu, 0x4e28738eu, 0xba38caa8u, 0xc5e1321fu, 0x90a289c4u, 0x04be646eu, 0x3cc37d5bu, 0x3122acd9u,
+        0x28108c7bu, 0x8b2a4a43u, 0x9479955bu, 0x00281a3bu, 0xadf07626u, 0xac2aa0dfu, 0x98dd5da5u, 0x564e634bu,
+        0x92da8bb5u, 0x6d831611u, 0x63477debu, 0x3e365286u, 0xd5238229u, 0xc290e33du, 0x201299b8u, 0x3e6ce710u,
+        0x1adf8927u, 0x07681d3fu, 0x0b354b5fu, 0x1c63e2beu, 0x833adfdfu, 0xf67cbac0u, 0x3f8afd43u, 0xc62082e1u,
+        0xa26788d2u, 0x721bb38eu, 0xc48946d8u, 0x02919b17u, 0xfd0619ffu, 0xbea88edeu, 0x7daf4599u, 0xe321e7fbu,
+        0xf3781a2fu, 0x6dc9e734u, 0x9c226121u, 0x7cd625bbu, 0x35e2d1dau, 0xaab46c7fu, 0xf45fdfa7u, 0x2713ec68u,
+        0x00c18ca2u, 0xdd958db4u, 0xc51ff12cu, 0x29cdadb5u, 0x69117753u, 0xda55874du, 0xba925dddu, 0x0d1b24d9u,
+        0x24dd6c7du, 0x5c9659c2u, 0xfb5bc68cu, 0x38865615u, 0x6d05996du, 0x0358b18bu, 0xd8f79fc1u, 0x0c91757bu,
+        0xf98dd3a7u, 0x62735831u, 0x1593e399u, 0x22676d24u, 0x00f39142u, 0x2f5c285bu, 0xebaf9376u, 0xdb86945fu,
+        0x53355e18u, 0x5e275af5u, 0x94a305cfu, 0xf72634d5u, 0xd58adee3u, 0x4e3317b5u, 0x59a1177du, 0x05ba8264u,
+        0xa7e12ae1u, 0x17d2d296u, 0x878b0293u, 0x60ddd38bu, 0x9dd85b66u, 0x9d0729feu, 0x3f3b6f25u, 0x8e0c0870u,
+        0xb3c3fd1eu, 0xb4b60b88u, 0x5afc44e8u, 0x89028e3cu, 0xd3cc097fu, 0x497318b8u, 0x52103b66u, 0xe73a172du,
+        0x266b42cau, 0x938d5db1u, 0xc1ac1db9u, 0xb2b93f04u, 0x6e012ae3u, 0xda66f9c8u, 0x037f8fd0u, 0x4bf08d72u,
+        0x10ef4007u, 0xf3d2c273u, 0x3acc76bfu, 0xb91f366fu, 0xfc9ddf79u, 0xc7b96147u, 0xd7bb195fu, 0x0671f594u,
+        0xf17c1fd7u, 0x50edb259u, 0xd40c55c5u, 0x038f5ccdu, 0xce6364d0u, 0x21ba265eu, 0x7313f69au, 0x8ac6c3f6u,
+        0xbb047902u, 0x7fb48793u, 0x612de3dau, 0x2aa4f446u, 0x310de8eau, 0xbdbec49fu, 0xc79d88fbu, 0x81dbf1a1u,
+        0xc70a1168u, 0x760e4a4au, 0xc95483f0u, 0x994e6b7au, 0xbc8141ceu, 0xddd41e63u, 0x216fcfdbu, 0x631b16e2u,
+        0x405d5b92u, 0x52f04863u, 0xde10292du, 0x381aa83eu, 0x92ff3660u, 0x05a5c0d5u, 0xd2902522u, 0xfa6df35au,
+        0x9b285d13u, 0xe1b8e36du, 0xbd981a31u, 0xbc58b308u, 0xf8141563u, 0x9985208cu, 0x4059497du, 0x933c0071u,
+        0xd7dec99cu, 0x36e8ca06u, 0xe8d027dbu, 0xfb637e13u, 0xecb64c04u, 0xceffa68bu, 0x3f6b72dbu, 0x6e048f18u,
+        0x2910c888u, 0x096d5059u, 0xdda12f36u, 0x42668bacu, 0x9c922bd4u, 0x8f06ea78u, 0xde098d7fu, 0x7f9e25d6u,
+        0x6852cd0eu, 0x54ec508au, 0x48f42179u, 0x4016e255u, 0xa8728473u, 0x19b6d873u, 0x57153d8au, 0x3d38870eu,
+        0xd61be964u, 0x8cbe0fbau, 0xb8c7633du, 0xcc6c5d13u, 0x604baedbu, 0x9be3ec5du, 0x13c23bc2u, 0x08d98076u,
+        0x76897b84u, 0x255fae6eu, 0x09456ea4u, 0x648eb712u, 0x622b6bc3u, 0x49b0385du, 0xb9567bddu, 0x7b467afeu,
+        0xd97f4313u, 0xb1e83be3u, 0xc9663513u, 0x1f64a554u, 0x2e686ea2u, 0xd41503c8u, 0xf167fb2cu, 0xbd261a8du,
+        0xf13a9a35u, 0xddd24e13u, 0x96c9273fu, 0x479dd526u, 0xeaf2aa63u, 0xbf68bcc8u, 0xd5a8cd8cu, 0x1d4bb0b3u,
+        0x9c506d42u, 0x45940abau, 0x3fac60a4u, 0x2935552du, 0xca7d3fb3u, 0xe78c4951u, 0x2eb7d846u, 0xc69a4023u,
+        0x77860b05u, 0xef5867b5u, 0x71194977u, 0x7134bc76u, 0x18745149u, 0x41aab942u, 0xb67e26c0u, 0x46ac6782u,
+        0xdba5dbcfu, 0xae2c81c4u, 0x3b0892ebu, 0x7877dd3eu, 0x315a9674u, 0xb8b39904u, 0x11551e7du, 0xd2d64866u,
+        0xd84133a2u, 0x255b2f81u, 0x288290dfu, 0x8ab17911u, 0x8d108180u, 0x35093fc3u, 0x67159310u, 0x031ccb17u,
+        0x6caa7baeu, 0xeff451c9u, 0x8997e800u, 0x88cc4421u, 0x7ba7bf6cu, 0x94addaf2u, 0xedc1cf79u, 0xf474046eu,
+        0x583a0641u, 0xbaa79778u, 0x399de4cau, 0x504a52e3u, 0xccf17cfeu, 0x26715827u, 0x4e231ee8u, 0x185b6eabu,
+        0x827b8548u, 0xd0b7eeb5u, 0x0ed51b76u, 0xe0566064u, 0x3469d8edu, 0x0c8e2eb3u, 0x46253cb2u, 0x9300ef80u,
+        0x434b0dc2u, 0x3b28140bu, 0xa4d1d7abu, 0x81641c5du, 0xe67317adu, 0x90662e63u, 0x01d1db73u, 0x8b88b55au,
+        0x52b5e987u, 0xaf03489eu, 0xc278a99du, 0x63baa967u, 0x25279ea8u, 0x7ce99247u, 0xda8fb15bu, 0xe4464f74u,
+        0xbbf3e3c5u, 0x63b9e46au, 0x812d17d4u, 0x053b9e3au, 0x7efe828bu, 0x28e71161u, 0xc9a263e7u, 0xf04eafa5u,
+        0x91e9bb3fu, 0x0b71b69au, 0x3f60ea69u, 0x958288a2u, 0x81d1e77cu, 0xfbc7b7c1u, 0x532b696du, 0x6124c4e2u,
+        0x468f5094u, 0xca3bda86u, 0x772d94fdu, 0x2673c5e0u, 0x6ebd7179u, 0x596f625bu, 0x85206e61u, 0xd790918eu,
+        0x4c7f1fdbu, 0xca0d0276u, 0x3a1a8750u, 0xd57fb33bu, 0xff5e6d0bu, 0x1da1cc1au, 0xf101d901u, 0x617d6f54u,
+        0x732829bfu, 0xfa684448u, 0xdfa3391du, 0x835225a0u, 0xf6c7e80fu, 0xe8e95e39u, 0xd1eff685u, 0xe366034bu,
+        0x1c26ec38u, 0xef5fbf48u, 0x98434a2eu, 0x8bddce86u, 0x34ef4affu, 0x6cc8a37bu, 0xa2013be3u, 0xdf0488ceu,
+        0xb3a10011u, 0x37fa435bu, 0x676b9055u, 0x048f821du, 0xc704ceb5u, 0x75001fe9u, 0x7517b69au, 0x3851be16u,
+        0x2f5946c6u, 0x30048d2fu, 0x8b88fad7u, 0x077b539cu, 0xf619bce5u, 0x70f5f91cu, 0x83ccf782u, 0x4588fd32u,
+        0xa45bc289u, 0xec8b630du, 0xbd9dc415u, 0x5d422129u, 0x05337ba4u, 0x25d30a8du, 0x67bd30e7u, 0x4075819bu,
+        0xf630b17fu, 0xe61a24a0u, 0x040a8374u, 0x6d3add1du, 0x43c2d09fu, 0xe8a56dc7u, 0x69c509cau, 0xd2b7fb5eu,
+        0xd90f6bd4u, 0x212162c9u, 0x6922cbc1u, 0x3d08cbb6u, 0x76414a63u, 0x3b07f2a2u, 0x28b445b8u, 0x00000000u,
+    },
+    { /* 2^134 */
+        0x853bd01eu, 0xf3e7159eu, 0xd45244eeu, 0xa34b1594u, 0x17adf52cu, 0xc2671ac4u, 0x26987072u, 0x0fc26533u,
+        0x3eb71ec2u, 0x9eb04111u, 0xd4178cffu, 0x13a6a16du, 0xd0263f9fu, 0xfbfedf03u, 0x5dbd77adu, 0x65444bb0u,
+        0x47dc3594u, 0x3cc47716u, 0x506990ceu, 0xc895d613u, 0x6b11f12cu, 0x74966d04u, 0x91207d7bu, 0xe54911e1u,
+        0xf5aae056u, 0xc356a8e7u, 0xa67d1881u, 0x421ac464u, 0xf9823f54u, 0xf2cbd6f6u, 0xd268c587u, 0x33cdd5ccu,
+        0xc89bb169u, 0xc723ffb8u, 0xf325c49bu, 0xf5dd9dafu, 0x03951830u, 0x5912ca24u, 0x6ae18938u, 0x8ed8baafu,
+        0xd27f305fu, 0x1b4c5639u, 0x03e222bdu, 0x627d525eu, 0xae26d35fu, 0x86d6091eu, 0xa0e4e455u, 0xeb506782u,
+        0xeb07aa32u, 0x5c2cad2du, 0xbcf26434u, 0x89f48227u, 0x4ce52229u, 0xf1508484u, 0xeb7f9911u, 0x486cbdb6u,
+        0x7f3dac79u, 0x51d5d0a5u, 0x1f95e560u, 0x24071668u, 0x76658f92u, 0x80dbd677u, 0xce5d50c0u, 0xf4902775u,
+        0x68ef9ff9u, 0xe66949d9u, 0x658cb37eu, 0x38a05cf4u, 0x02f6e38bu, 0x64d64ac9u, 0x73758059u, 0xcbac8ffau,
+        0x2f4c3cf5u, 0x10507185u, 0x40e3444cu, 0x8b54034eu, 0x2386c3dau, 0xadaeb403u, 0xa806adc6u, 0x5ba31a22u,
+        0xdcefac4cu, 0x1dea2973u, 0xbd0d8a2bu, 0x9c51e0c3u, 0xdab2c65bu, 0x6f6fdf15u, 0x81082b3bu, 0x6d4a33b1u,
+        0xa6cae9beu, 0x17c55354u, 0x3af23ae3u, 0x164124e5u, 0xcb71730cu, 0x1b3346fau, 0x4b0a0522u, 0x896a2f08u,
+        0xcee7fa02u, 0xa0440e53u, 0x61ea27ccu, 0xcc5ab6c7u, 0x63882262u, 0xb4107492u, 0x1487243fu, 0x4fd259b0u,
+        0x6cd5b4e4u, 0x053c94b8u, 0x60418fbcu, 0xa613384du, 0x9dac2d6fu, 0xab6f591du, 0xd26d71fdu, 0x55ccaf3fu,
+        0x6379151au, 0x5630001du, 0xe619bcceu, 0xd2e9970fu, 0xbad03df5u, 0xa2af7258u, 0xd4ea1692u, 0x76806befu,
+        0xd8d010dcu, 0x499df8c0u, 0xce45578cu, 0x105f1f50u, 0x346be616u, 0xb93d1f65u, 0x0815fe3fu, 0x26214276u,
+        0x0db4df13u, 0x61c2d67eu, 0x37644f25u, 0x06fce3b1u, 0x0a72604du, 0x9dbd46abu, 0xdef2ff0bu, 0x920025c3u,
+        0x9a2d9924u, 0x9dfcf60fu, 0x378548f5u, 0xaa1b1f4du, 0x526508deu, 0xbb1bc955u, 0x909c95b3u, 0x5a640c83u,
+        0x4b914f7eu, 0x628e77f1u, 0x2f1e6facu, 0xbcab1476u, 0x92ec240fu, 0x5ecc2f9eu, 0x0eadfc99u, 0xe1cef56au,
+        0xd802794du, 0x4bd6d180u, 0x61e9bbe1u, 0x6d4629a8u, 0xe63070f3u, 0x5e7c92fcu, 0xb4609aeeu, 0x73b13052u,
+        0x8f0eb26fu, 0x799fc640u, 0xcc0464b9u, 0x0a7501e1u, 0x752300d7u, 0xc72a2ff2u, 0x86d8a948u, 0xaf1364ccu,
+        0xad9a3e00u, 0x11fa6173u, 0x48e5d642u, 0xd3d039dcu, 0x6d684542u, 0xadf82704u, 0x31b1ec1eu, 0xcf5a7862u,
+        0x8a2f6fc6u, 0x8e4bc2adu, 0x4af83104u, 0xe3e62c43u, 0x03d8c0f8u, 0xff964811u, 0xd35b6140u, 0x7370639cu,
+        0x60e4040du, 0x760c7243u, 0x66f2b020u, 0xf8b7aa25u, 0x95cd2bb2u, 0x29a876f6u, 0x1727135cu, 0x746a1784u,
+        0xee1e8a67u, 0x462def5fu, 0x303f7115u, 0x25d08053u, 0xb71e9041u, 0xd042a4bbu, 0xafba979bu, 0xef16ffe8u,
+        0x0aed6d33u, 0x9ef1209eu, 0x04650d1au, 0x35afda1au, 0x0409fb56u, 0xc4a5348au, 0x48cf1fbeu, 0x1940b2d8u,
+        0x320294aeu, 0x7f0f13beu, 0xc3c01af6u, 0xdcf17449u, 0x68d02dcdu, 0x42fd2acfu, 0x1acc68d1u, 0x0e030346u,
+        0x97466169u, 0x586fa91fu, 0x77dd0d7cu, 0x40d6ec5au, 0x1939f8d1u, 0x5c7c8cc4u, 0xbaad75adu, 0x990e0d7fu,
+        0xc499ed83u, 0x77d5b9e5u, 0x2ae6ef41u, 0xe43a7812u, 0xa12ccd3bu, 0x8de95954u, 0x95cda502u, 0x7c3abae6u,
+        0xa0bbbd56u, 0x0a7ea314u, 0xa7833c03u, 0xd236ea5fu, 0x367f8cbcu, 0xa82b7485u, 0x3a4a6794u, 0xe40dd232u,
+        0x3b87138fu, 0xf05e0006u, 0x55bcdd4eu, 0x900739b7u, 0x943a21c9u, 0x3b8ffefbu, 0x71263a51u, 0x8d047e99u,
+        0x562a2bc0u, 0xfc09b6f5u, 0x134e694cu, 0x47f5bf57u, 0xd7b96f27u, 0xa5b33510u, 0x1d3da928u, 0x950687d4u,
+        0x97f0cb04u, 0xf6828f1fu, 0xb2a01adeu, 0xf6a0b935u, 0x0b3cc43cu, 0xa0ab00c5u, 0xb334628eu, 0x021e7030u,
+        0x241f5f79u, 0xad163e8fu, 0xd5cb1492u, 0x05c1dc02u, 0x0307b6c3u, 0x1380a059u, 0xe5879df6u, 0x0801a6a7u,
+        0x0cddadaau, 0x4b14788cu, 0xcca8bb41u, 0x65bd7a81u, 0x51636d45u, 0xce3b4172u, 0xd22b95f8u, 0xa6d2e34cu,
+        0x4ff1ffcfu, 0x7bfe5edcu, 0xd403c17cu, 0x6b4a5200u, 0xa2164649u, 0xb5228621u, 0xd0a2b1cfu, 0x2d3b081bu,
+        0x1db54d56u, 0xafbaee21u, 0x2bcf56e3u, 0xdfe6fe23u, 0xed2e6ef4u, 0xf8fd832bu, 0xf9fb7a2eu, 0x40c83a3eu,
+        0xf13bf422u, 0xd3217b0cu, 0xf3512bfbu, 0x20a83562u, 0xb4dd0239u, 0x615dfb77u, 0xa8a6b4fbu, 0x37fd63dfu,
+        0xcf1c0cd0u, 0x96d3475cu, 0x4bcee691u, 0x2d79d4cau, 0x39dff358u, 0x7051b0b0u, 0x38096400u, 0x90ef5074u,
+        0xfdfa6b8bu, 0xc245bfc7u, 0x951d0c2cu, 0xd42f6c25u, 0x0892457du, 0x03de7e52u, 0x7aa1f007u, 0x140ac7c4u,
+        0xa94e1761u, 0xccd2f961u, 0xed74e03cu, 0xbd12e0b9u, 0x9c43ebd9u, 0x9a69a655u, 0x95f77cf0u, 0x7c234c83u,
+        0x7f2cf6b7u, 0xf82a190cu, 0x0f4fb289u, 0xa6b35b0bu, 0x565ec876u, 0xbf34381au, 0xc4193a25u, 0x161d6df1u,
+        0xd34f102bu, 0x553f957du, 0x582041fcu, 0xd6496e17u, 0x5bc38584u, 0x93b861e1u, 0x0c549a63u, 0x9c36c367u,
+        0xa4ce7ec7u, 0xbab8afb0u, 0x3202d8ebu, 0x883bf5f8u, 0x99b04f77u, 0x201196e5u, 0x19ecc1ccu, 0x033e1bf7u,
+        0x0363cc93u, 0x62a1c5c2u, 0xfdd360ddu, 0xb08dc2b5u, 0x0068bac9u, 0x9b4bdd76u, 0x1d984447u, 0x3806e8edu,
+        0x42d91895u, 0x2a801467u, 0x039b4a26u, 0x23c59825u, 0xa610d5a2u, 0x0c79a93au, 0x427cdb04u, 0xe6af46b8u,
+        0x8e08aaffu, 0xc5ce6e7eu, 0x6032b29au, 0x8a7d6a0fu, 0xb08f35d5u, 0x0afe1750u, 0x8959861eu, 0x15a64d38u,
+        0x1e78c1f3u, 0x86bab62cu, 0x4deb2423u, 0x9e4a2606u, 0x62fb3cdau, 0x2d11aff0u, 0x2051870cu, 0xf741e181u,
+        0xf54c53d8u, 0xbc207679u, 0xf7fe3e87u, 0x522993dbu, 0xbf0da2beu, 0x8b91ea6bu, 0xf3a26873u, 0x9dc1d50fu,
+        0x582aba68u, 0x40bfcbcbu, 0xf98ef93bu, 0xeb5ce1aau, 0xabf6ce17u, 0xa4f66b7au, 0x248c89cau, 0x0b942f68u,
+        0x8d06c707u, 0x24d0c3adu, 0x064f3027u, 0xeb755558u, 0x1672d758u, 0xb5e32720u, 0x2bd818bdu, 0xa992f6e4u,
+        0x905b3f9cu, 0x38659368u, 0x5c74e94bu, 0xf71a7efcu, 0xb31b7e45u, 0x7fda8636u, 0x2e787d9fu, 0x81d81b1fu,
+        0xcbc8a3c3u, 0x6dfc09eau, 0xd68a1596u, 0x6ea807f4u, 0xfefe03ceu, 0xda8c2638u, 0x9c082b05u, 0x93084fcfu,
+        0x67ca1e67u, 0x724d6681u, 0x4dc8b4beu, 0xd71095c4u, 0x4d2753c9u, 0xd597bc93u, 0x90cd4822u, 0xf0714168u,
+        0xa975d32du, 0xa75c27d2u, 0x3693d40cu, 0xa5162c87u, 0xbd1e1ed8u, 0x6fb5357cu, 0x70c85ab0u, 0x938dee46u,
+        0xa6c315a0u, 0xf2d8a2e4u, 0x03864f63u, 0x68f42341u, 0x906d4a6cu, 0x0c68b02eu, 0x668ffc69u, 0xb7f02b2bu,
+        0x1b61a06eu, 0x9316afceu, 0x7e79c712u, 0xe0cfafa4u, 0x333670ddu, 0xaf6d8fa5u, 0x07abc17fu, 0x7f1b96c9u,
+        0xb92002beu, 0xa3209f61u, 0x85e13b9au, 0x3a1ccd61u, 0x25e3fd77u, 0x62098a3cu, 0xe0550ca9u, 0x98871605u,
+        0x73d1b2d6u, 0x1a6a30a5u, 0x85f7a58bu, 0x8d81afddu, 0x5cd93fbbu, 0xa051fc62u, 0x682c5799u, 0x8baa3e52u,
+        0xc70359bdu, 0xa44427d3u, 0x06788bbeu, 0x5bb2e79eu, 0x440459d8u, 0x50315795u, 0x1a56e57au, 0x74a72359u,
+        0x11766791u, 0x832da57au, 0xcbe1944cu, 0xb142dae3u, 0xf5e292c0u, 0xccbe424bu, 0xc75e684fu, 0x29772f16u,
+        0xf4117e8fu, 0x04ac63fcu, 0x28277df9u, 0xa0bf081eu, 0x106e774eu, 0x20d6b397u, 0x1c24eae2u, 0xc2b978cbu,
+        0xb588f38fu, 0x9734a2c9u, 0xf82add56u, 0xa623b5c1u, 0x1d04d10eu, 0xd4c82ae2u, 0x98f37396u, 0xc876ddf3u,
+        0xfc05d93au, 0x4a0903adu, 0x42a78e96u, 0xdfb0081fu, 0x9511281cu, 0x28aca302u, 0xdfa74542u, 0x8d0295fbu,
+        0x9097c99fu, 0xd84d73e3u, 0xc585d382u, 0xfac73270u, 0xa694cdb0u, 0x9e4c1a64u, 0xba5f88ddu, 0xd8e302a4u,
+        0x48365773u, 0x41195ca8u, 0x8b925945u, 0x5039135fu, 0x48a72b6au, 0x7a79d20bu, 0x9dd8b0a0u, 0x79dd82f6u,
+        0x2db4263bu, 0xbcc4b653u, 0x3d63dcf0u, 0x1ee022a9u, 0x853600e5u, 0x3803ebe0u, 0xbc970858u, 0x8ffc53d4u,
+        0x6495bb26u, 0xcaa68aefu, 0xefdf14cau, 0x433c5c70u, 0x9a1ec240u, 0x7755e996u, 0x5ed83f1cu, 0xd8308be4u,
+        0xd9b00254u, 0x22d3196au, 0xaef273c8u, 0x46ae542eu, 0x779c60fcu, 0xc41c81c4u, 0xbf46578cu, 0x8448e9c2u,
+        0xd9c13d3cu, 0x79d7363eu, 0xd985386du, 0x39766f57u, 0x0dfb34bau, 0x2dfa4bf6u, 0xb1339fa6u, 0xf222f471u,
+        0x4965de2du, 0x9b880f81u, 0xe6ee291du, 0xd8cd0cf6u, 0x93560f9bu, 0x9d31e031u, 0xa0b95455u, 0x04f92fdbu,
+        0x8f56b9cdu, 0x39ff7957u, 0x3542adfdu, 0xe8c39bc4u, 0x8ff7423au, 0xba1ef653u, 0xa610e1b8u, 0x88e0a304u,
+        0x03a8d774u, 0xaa06d480u, 0xa57d5338u, 0xde3cb786u, 0x4d238ef4u, 0x760c5281u, 0xb3aa3aa4u, 0x4c6cb42au,
+        0x3da4d890u, 0xe373a70eu, 0x6f4ca328u, 0xce5aa7d6u, 0x63350b6fu, 0x5da66eb4u, 0x73437382u, 0x22040d84u,
+        0xedd0604bu, 0xcd8925e0u, 0x8fc198fau, 0x7a58a3d4u, 0xb2beaabeu, 0x3fe36da4u, 0x3a7a47dfu, 0x8b80ea12u,
+        0x8d1b6fc7u, 0x4c21ab22u, 0xec83bb05u, 0x63551032u, 0xce9ee82eu, 0x6fafdf32u, 0x852ea6cfu, 0x293e0a4du,
+        0x60a715b6u, 0x417b4245u, 0xb4ca2a77u, 0x95163c03u, 0x4e245062u, 0x139ebfbcu, 0x092f7c87u, 0x62d90b1fu,
+        0x5e3c6b5cu, 0x3a4f2daeu, 0x41002d1bu, 0x0f0ce2e6u, 0x91c183e6u, 0x42fd3a9fu, 0xd1cca1b9u, 0x00000001u,
+    },
+    { /* 2^135 */
+        0x6df4c00fu, 0x2803880au, 0xe028730du, 0x9a32503fu, 0x6338439du, 0xc3efb28eu, 0xdf5f41a8u, 0xb852cea4u,
+        0x884be39fu, 0x7b5b76c7u, 0x1f90549eu, 0xd79a821cu, 0x77d04a65u, 0x6b4389d7u, 0xbab7071eu, 0x10edf029u,
+        0x4744b4e2u, 0xc6cd2e5au, 0x6e423753u, 0xd5e470a1u, 0x58536df7u, 0x3665de81u, 0xa6d3c224u, 0xbf0a6703u,
+        0xa2168f7eu, 0xeb96858fu, 0xb07b2a7du, 0xdefd14dau, 0x0e1c924cu, 0x1b1afa56u, 0xe179a439u, 0x4a962c4fu,
+        0xc008bc2cu, 0xeba0d3c3u, 0xa47134a6u, 0x26b320dbu, 0x7f8a98e4u, 0xf32835ffu, 0x5600dcaau, 0x0b3e8e68u,
+        0xd37558d3u, 0x421d13e9u, 0xcec6db57u, 0x30231bc9u, 0x97b9c552u, 0x00ba8563u, 0x7e8e489du, 0x8cf6eef4u,
+        0xa40edfe9u, 0x6e3a5b1cu, 0xdba9a342u, 0x73e674b8u, 0x77a65c59u, 0x4b45cdedu, 0xab9ae078u, 0xa9b7a8b1u,
+        0x3a86f82au, 0xf958b2f9u, 0x08baa5d6u, 0xa07ac593u, 0xbc520812u, 0x379cc061u, 0xd2d60083u, 0x99caf022u,
+        0x5ec29b1fu, 0x5e980e3au, 0x786ce627u, 0x69bbc01au, 0x5bfb82f3u, 0x6e4b0032u, 0x552e3a73u, 0x8439fdb3u,
+        0xdd6b50e9u, 0x02542315u, 0x2b0e70e8u, 0xae498d39u, 0x6ba534b6u, 0x8c93efa5u, 0x57c6cf16u, 0x44c196bbu,
+        0x2f56bf41u, 0xcb4bc6e0u, 0xa9a4391eu, 0x05b01a83u, 0x11c61217u, 0xba8cc08du, 0x1158862du, 0xb97a866cu,
+        0x2e651039u, 0xd7a43d6du, 0x792d4bf3u, 0xe9de666fu, 0x507cc3ebu, 0xbb337c4fu, 0x505278e6u, 0x49c00802u,
+        0x76df9fb0u, 0xc9a95464u, 0xca1c400bu, 0x8ef9774cu, 0xe6cc3b0eu, 0x27b7d48cu, 0x02b776f2u, 0x73238d02u,
+        0xf1254fc3u, 0x11ef11dbu, 0xc4d41a82u, 0x8d716a01u, 0xbcfc33cfu, 0x0dd6cb5du, 0x2e18bdd3u, 0x7777125cu,
+        0x0dfce496u, 0x496c774cu, 0x94be4075u, 0x7531c601u, 0x97aa6d7fu, 0x4dd123a6u, 0x95ab981au, 0x57a2c88au,
+        0xf4f46d17u, 0x48ac6f47u, 0xc6c54347u, 0x0d485b28u, 0x5a94076bu, 0x1cf3cbd4u, 0x156bab1bu, 0x53ebd1e0u,
+        0xff53d541u, 0xe27502b8u, 0x46a909ebu, 0xf60ca266u, 0xb9d6ae92u, 0x93abf781u, 0x4bd1c283u, 0x56c23cecu,
+        0xf985777eu, 0x8b4d9ad9u, 0x6e3d2201u, 0x11db05ccu, 0x8e76ed12u, 0x2bf4826cu, 0x258141c5u, 0xe82a389du,
+        0x7c57625au, 0xaef13138u, 0x39ba54e9u, 0x4009bae1u, 0x15825072u, 0xf71ee7d8u, 0x0c66d74du, 0xdbc37100u,
+        0xa4076a7cu, 0x3b078f92u, 0xf446399bu, 0x23113725u, 0x8f426e8fu, 0x3a816021u, 0x1696f835u, 0xc3a787f4u,
+        0xd4f08047u, 0xa96d2736u, 0xe51e32c4u, 0x4ab1c497u, 0x409d4a4du, 0x89a19d87u, 0x8ff98a24u, 0xc7e591beu,
+        0x768c2110u, 0x2ef1d58cu, 0x07c1c77du, 0x9d5b9be0u, 0x601076a4u, 0x26d89614u, 0x9e39a10du, 0xddf9b58fu,
+        0x7e011ba6u, 0xaa1f4be9u, 0x3d36f569u, 0x7d1d3c60u, 0xf06b19adu, 0xd828f774u, 0x8b265601u, 0xaf6e67f5u,
+        0x2a2aa4d8u, 0xbb151314u, 0x5d434833u, 0x7c4a51ebu, 0x9563f6dau, 0x70997e82u, 0x3cfb6416u, 0xe3e0f4fcu,
+        0x32f18731u, 0x6da5d3aau, 0x75eab5c5u, 0xc0238e7du, 0x950f18d8u, 0xe3c115b8u, 0x5ef12402u, 0x143189bfu,
+        0x036ac22au, 0x4a76eb49u, 0x2cea02e1u, 0x04eae38au, 0xbba0d5cfu, 0xabce970eu, 0x278fe722u, 0x6255b86eu,
+        0x1d17ea7fu, 0x1383eff4u, 0x102536dfu, 0x935cea88u, 0x1e2c0812u, 0x77af110cu, 0x98cca6c1u, 0xad9cb200u,
+        0xeab0be3fu, 0xff2f29d5u, 0x48a90f95u, 0x65e0ad7du, 0x8484dbe9u, 0x16024abfu, 0x54cbfc9cu, 0xc13a399au,
+        0x5c32c860u, 0x27fff8f9u, 0x54951188u, 0x8c96fb76u, 0x72093af1u, 0x6aacfcc8u, 0x8a27c322u, 0x223caa88u,
+        0x8f4085edu, 0x86d860d8u, 0xe9513ac2u, 0x2fd5c106u, 0x900b647fu, 0xc17b29cau, 0xf13adc5au, 0x55a8d1fbu,
+        0x7ee5ed54u, 0xb6eaf723u, 0x16f907ceu, 0x6f264129u, 0x416c72a4u, 0xc5050dbbu, 0xcc556f5du, 0xc556154eu,
+        0x6dfb9dfau, 0x2b3b9a21u, 0x360dc691u, 0xcc1a7a7eu, 0x204e9045u, 0x73554685u, 0x53cf6fdbu, 0x966838cau,
+        0xe104ae54u, 0x80dd890du, 0xd88b3c58u, 0xfe5123eau, 0xcd64e00du, 0xaa685283u, 0x4e2de313u, 0x2b2f2f65u,
+        0xae0c15dfu, 0x05478b19u, 0x209725cau, 0x3e804747u, 0xc0b90fa3u, 0xb4884912u, 0xfeddb996u, 0x4ae7ec04u,
+        0x05f7cf10u, 0x33b1d362u, 0xb56608cau, 0x79d206b3u, 0x9579726au, 0xa682f46du, 0xf0240e38u, 0x6af8e658u,
+        0x0d2f0b61u, 0x983a72b3u, 0xd963ad4au, 0x3ca930a7u, 0x0e144198u, 0x5bfd7fbau, 0xc7bad243u, 0x06c1f6d3u,
+        0x52abfc7eu, 0x37b6f330u, 0x09ab5789u, 0xba0e4ed9u, 0x56851b3du, 0x13b8a413u, 0xd69919b4u, 0xf3055b35u,
+        0xbb49c3b8u, 0xbd8f2d7du, 0x5a2bba83u, 0x2f370cd6u, 0x79ef84b8u, 0x9ee202e6u, 0x7add80fcu, 0xedc7816bu,
+        0xba7187ebu, 0xa6ffcf03u, 0x5194558du, 0x14c93e4au, 0x71ff620au, 0x6e3f91eau, 0x784d1b7bu, 0xdc2fa79cu,
+        0x0591f88cu, 0xeafce71bu, 0x3e2a3732u, 0xb7951616u, 0x58db68f3u, 0x898ae1e4u, 0x6cc3bcf0u, 0xab4c3c53u,
+        0x09d3a41fu, 0x66cd7c6du, 0xe24f3630u, 0x3657ca6cu, 0x28f08540u, 0x3434e661u, 0x7324227eu, 0xd2b9c570u,
+        0x0cf43180u, 0xa7b31b3au, 0x5f2ff90eu, 0x401b7a07u, 0x33b5190fu, 0x08ded3b6u, 0x9dded764u, 0x1c0ad6b4u,
+        0x31a2c3ffu, 0x5ac8bf85u, 0x85f23a8cu, 0x9ce34cf2u, 0x3f5d3b77u, 0x7286d831u, 0x44baaa46u, 0xd98907beu,
+        0x3618ea6du, 0xe25ce804u, 0x26bd068fu, 0x2d0d0aa4u, 0x6177d979u, 0xb1d46b59u, 0x489f26c5u, 0xa8970e1fu,
+        0x35f42d09u, 0x9ec85cf6u, 0x423fd6cbu, 0x26e97df7u, 0xb7e92e5du, 0x54dc7c1fu, 0x84b9f638u, 0xd84dfc9fu,
+        0xe312b8a9u, 0xe51f9c5bu, 0xafc499abu, 0xcd41d267u, 0xf614cc1du, 0x5653c655u, 0xeee54d80u, 0x925d36f5u,
+        0x0169bfb9u, 0x5ea728e8u, 0x624b7f74u, 0xb6df8d2bu, 0x511b3a47u, 0xe80fd79du, 0x902cc209u, 0xf88c36e2u,
+        0x33ab632cu, 0xd1c44f23u, 0x9f5e5c40u, 0xc9083298u, 0x484982acu, 0x77d7a8e4u, 0x2b544abeu, 0x78b4a978u,
+        0xf003c8ceu, 0xd3a40637u, 0x234d6a0fu, 0x6db6ebaau, 0x006bcf92u, 0xea52a1c5u, 0xb7f07016u, 0x62929820u,
+        0x4e5abfb2u, 0x969636b2u, 0x8f36befeu, 0x552f6858u, 0xb8784734u, 0xcfae9f70u, 0x27207f17u, 0x89bfe3beu,
+        0xa7005ff5u, 0xea9bd088u, 0x6a422fdeu, 0xcdacf7bau, 0x58b81a67u, 0x194bc077u, 0xbc310cb4u, 0xe0318b4bu,
+        0x176dd476u, 0xc804154eu, 0x85384c89u, 0xe49c33c8u, 0x938bad7bu, 0x8693ded3u, 0x8f5229a4u, 0xb2c77e5cu,
+        0x3c756f31u, 0x8723ea89u, 0xf84669c5u, 0x12484f98u, 0xfa110ab9u, 0x40d0d738u, 0x0c90eefcu, 0x94647c3bu,
+        0xae005649u, 0xe99b6d68u, 0x0fe4cb1au, 0xaf93ac59u, 0x37df7950u, 0x2894d277u, 0xd313eed9u, 0x535e67f8u,
+        0xa825d5bbu, 0x17552a98u, 0x23694837u, 0xd4fb9254u, 0x9dfb551du, 0x63740fc1u, 0x25ca12d2u, 0x5b1a01efu,
+        0x8b39fb34u, 0x59611360u, 0x3c332c96u, 0xc0bf757fu, 0x4554a5a4u, 0x5361f488u, 0x480eca00u, 0xf701d9d9u,
+        0xc4489021u, 0x901fa243u, 0xa069633eu, 0x4a5a333fu, 0x0b1afeeau, 0x74b04f70u, 0xa4c45fd1u, 0x64a8296eu,
+        0x59075680u, 0xda571177u, 0x236fe5ffu, 0x15419775u, 0x9f2df75bu, 0x560d26e6u, 0x68f3f396u, 0xb57364d3u,
+        0xb11c862bu, 0x9d0e50d1u, 0xc3d2971cu, 0x171ff1d7u, 0x6ab0165cu, 0x8db317bfu, 0x969f0755u, 0x8f387fbeu,
+        0x9cea09c5u, 0xf290205fu, 0xe620fd14u, 0x2225269fu, 0xa10f39adu, 0x12b07d9au, 0x2ca239acu, 0x3d797a1au,
+        0xb0998725u, 0xd335d5b8u, 0x7470fac8u, 0x2254cb1du, 0xac03d655u, 0x9e1de6a7u, 0x514f9629u, 0xdcde6657u,
+        0xe5c03b80u, 0xd6de1ae3u, 0x1f5ceb1du, 0xc6b6afe4u, 0xdeea39c2u, 0xfc4f5c1eu, 0xb40ba23cu, 0xa7296519u,
+        0x81ee9752u, 0x6f32029bu, 0x3a9610e0u, 0xb9bb4082u, 0xadea8a79u, 0x48192460u, 0xa6c2eb96u, 0xdf2247feu,
+        0xfae23756u, 0x9795890eu, 0x14f569bcu, 0xddc99514u, 0x9ad19917u, 0x1811cabcu, 0x199d27e0u, 0x3cf09e46u,
+        0xfa2a6d24u, 0x13e4a418u, 0x7b83eb6eu, 0x186b1c50u, 0xfaf959f2u, 0x50a7d385u, 0x01b8e4cau, 0x667d091du,
+        0xc1c52d64u, 0xbe25c42eu, 0x3d11be21u, 0xe42c93b5u, 0x916374f9u, 0x5aa9cfd7u, 0x3e1f5577u, 0xd0cdf4ccu,
+        0xbcb2f266u, 0xc9cf7c2au, 0x84a5b99du, 0x68ef6521u, 0x3e743825u, 0x60166a79u, 0x7618594du, 0x42a57ac0u,
+        0xa3210f6fu, 0x7829e289u, 0xabbbc21cu, 0x6f06f858u, 0xd0b146cau, 0xcf59af7au, 0xc4a6621cu, 0xc72d7810u,
+        0x8cc0ffc4u, 0xddc1458au, 0x62ac98f5u, 0x314b1236u, 0xd8845b10u, 0x05cb4d2du, 0x147ce0bfu, 0xcdb4ca46u,
+        0x08924801u, 0xbe93cc5fu, 0x6b83e15bu, 0x1f96319au, 0xdaa349ceu, 0x9e89562du, 0xd3333500u, 0x1fb1982cu,
+        0x4212909au, 0xedcaa1ddu, 0xd5575b02u, 0x66a24ca4u, 0x3c8ca17fu, 0xdf1d148bu, 0x7b335b95u, 0x66b15a3bu,
+        0xea9aad32u, 0xcc4e5470u, 0xa5db05bcu, 0x0c4c584fu, 0x2bb89741u, 0x8f8e329eu, 0x6b65171au, 0x540f05aeu,
+        0x21ecf753u, 0x39e47ebeu, 0x418a3e0fu, 0x19f3aae6u, 0xbc5b79d2u, 0x2419b6adu, 0xb804a5deu, 0x418ef796u,
+        0x4bd28bbdu, 0xa39af3dbu, 0xee53f05cu, 0x0ceed50fu, 0xed83a6d9u, 0x330fdc37u, 0xde54f892u, 0x09fcb0cfu,
+        0xc5f0dc45u, 0x2a6ddbbdu, 0x17398124u, 0xd613f6f5u, 0xc8feb1e4u, 0x83f39ce2u, 0xe8e7abacu, 0x59970736u,
+        0x0ced0c51u, 0x318bcddcu, 0x8ddd6288u, 0x96856a3fu, 0x2c495591u, 0x78543a17u, 0xc40a6e69u, 0xe5c521e3u,
+        0x6c313a75u, 0xeef69400u, 0x6ac345f3u, 0x1831ac79u, 0xcbb31afbu, 0x1151f126u, 0x5b7c0243u, 0x521f1d09u,
+        0x11548bbeu, 0xa3e94b42u, 0x1662157cu, 0xb9f89f7eu, 0x3827e53au, 0x2b0ace05u, 0x70eac6d9u, 0x00000000u,
+    },
+    { /* 2^136 */
+        0xbe5059afu, 0xe997ec89u, 0xfec69582u, 0xe4950b1au, 0x77143744u, 0x0f46316bu, 0xe9f95b4du, 0x1d5ad4aau,
+        0x63377226u, 0xe4ff699au, 0x52417c53u, 0x671538c7u, 0xf43cb8e2u, 0x38dfae3eu, 0x87a4d454u, 0x5619e080u,
+        0x113e31ccu, 0x3d3ed9bau, 0x94cb035du, 0x08f08a3au, 0x0c9a6ad3u, 0x2dd657f3u, 0xfa67126du, 0x1d9aa82cu,
+        0x8aef93e6u, 0x984f08b8u, 0x44e7c59bu, 0x568b10a8u, 0xf143635cu, 0x1e358390u, 0x7becf20cu, 0xaa5be17cu,
+        0x61af45c4u, 0x1aff39a0u, 0xf8c35933u, 0x9654991bu, 0x0cb8b6e8u, 0x8b4ad7dau, 0x7b7f181au, 0x5f646e93u,
+        0x7daa9fccu, 0xebfbbaadu, 0xfa853a17u, 0x62b88d7cu, 0xc73fc4d7u, 0xfa9b163eu, 0xa67400cau, 0x949bd88du,
+        0x07403585u, 0x594e0ad4u, 0x137d5811u, 0x931304d7u, 0x58121976u, 0x26c9fcacu, 0x7b906cd7u, 0x1c45d588u,
+        0x8ef141bdu, 0x2a3643f8u, 0x856b162bu, 0x7bcb3ef5u, 0x940f24e4u, 0x3a1ff2ecu, 0xb31ab852u, 0x0aaf3649u,
+        0x017e4540u, 0x825c3fc2u, 0x8030eb1cu, 0xc6e527afu, 0xe297db3du, 0x162041aeu, 0x28d28a26u, 0xd40fc96eu,
+        0xb5909d3fu, 0x314def29u, 0x5f78e4a1u, 0xcb66420fu, 0x1be42346u, 0xc455e1b5u, 0x01e87c4bu, 0xb52b56c7u,
+        0xf1e92518u, 0x5d11ff5fu, 0x66758dd5u, 0x53117c52u, 0x4b72f27du, 0xd65c87d6u, 0xed709949u, 0xf8e89d94u,
+        0x5a9aa5b7u, 0x88c22b32u, 0xbe992920u, 0xde4b443fu, 0x7c7d14f6u, 0x89c84c1bu, 0xd3ad1419u, 0x810a277eu,
+        0x74491d1du, 0xbfdd4570u, 0x9cdfbe1du, 0x8f190dddu, 0x5c614341u, 0x7bbad426u, 0x3396e632u, 0x9f80265cu,
+        0x562017bcu, 0x767b151du, 0x3c5c09f1u, 0xfb9ec80eu, 0x6c1f4eddu, 0xb0f0ca8du, 0xb086b83du, 0x28e7fd05u,
+        0x9911660eu, 0xb42532c6u, 0x922a2b15u, 0xd157045eu, 0x78af8199u, 0xd72682aau, 0x823a9effu, 0xc4358db2u,
+        0x013f473du, 0x79c6db48u, 0x8d5e46ffu, 0xa71c487cu, 0x88d92abeu, 0xd6fd7f58u, 0x307bdc11u, 0x20b5c2e4u,
+        0xd94a01eeu, 0xe637e6eau, 0x3a5c175du, 0x54cb2255u, 0x7fa57a59u, 0xd3167b32u, 0xe0ee6939u, 0x6af11e0eu,
+        0xbe7fb707u, 0x32fd5177u, 0x3fafaacfu, 0x020c25dbu, 0x6d87a737u, 0x6499af6cu, 0xa47af95cu, 0xa0afcd25u,
+        0x06398b21u, 0xab3cfe35u, 0x42d685a0u, 0x68e9b080u, 0x6c98204eu, 0x65d238e3u, 0x63535782u, 0x9225025bu,
+        0x30aaf7a9u, 0xfcc091c2u, 0x9ad0a7acu, 0xb1083d8au, 0xdc32257au, 0x3df71c2au, 0x4f436428u, 0x642d304bu,
+        0xed7f3623u, 0x624bb2e4u, 0xcf632b6bu, 0xfe34545au, 0x34326192u, 0x02f76e68u, 0x31726df4u, 0x21746098u,
+        0xbfb600b0u, 0x300a19f5u, 0x71ad8283u, 0xe3e6fbd3u, 0xe4dce59du, 0xdeb833d6u, 0x28fde990u, 0xc46f0b51u,
+        0x36ed70d9u, 0x3856f745u, 0xdd7fd2dbu, 0x8d061a01u, 0x8fcff5a9u, 0xba22330fu, 0x097c7703u, 0x3cb2ec9cu,
+        0x862919feu, 0x3088c45cu, 0xa64fc0adu, 0x63739400u, 0x76919683u, 0x30c53343u, 0x8a048728u, 0x591104f0u,
+        0xa725c729u, 0x131ca1f2u, 0xcc81e2ffu, 0x6ccc5e7bu, 0xd71f4a73u, 0x2ed79f4du, 0x0de0284fu, 0x29f25942u,
+        0x3cdfafbdu, 0x70b3cc8du, 0xc0984684u, 0x70dbe670u, 0x02542e9au, 0x7d685bb1u, 0x4fcd757eu, 0x7528c59cu,
+        0x403cff08u, 0x0b291006u, 0x06c7c687u, 0xc67ff672u, 0xdae07dbdu, 0xc5c0f323u, 0xca7dffb1u, 0xdb65afb8u,
+        0xb6f10ea7u, 0xe719b107u, 0x7da7699bu, 0xb560f56au, 0xa23b5b5au, 0xe0c960f7u, 0x85babe09u, 0xe6ed0010u,
+        0xf6412c12u, 0x26745842u, 0xeb308f5fu, 0xa92a8336u, 0x0435480fu, 0x010ebde9u, 0x5a67e01cu, 0x97b439bcu,
+        0x463f9a00u, 0xcc8f9593u, 0x617fec09u, 0x3c2e5f94u, 0xdd73b859u, 0x13b582a6u, 0x01d39d39u, 0x3cc07d8du,
+        0x41d5425eu, 0xd50123ccu, 0x49024c40u, 0xf2bc672eu, 0x63c91306u, 0xfe5e5c49u, 0x624029e1u, 0xf53c6bb5u,
+        0x1a69f694u, 0x5da9be4au, 0xe9a3cb10u, 0xa091c9cfu, 0x400b5919u, 0x2e258569u, 0x1c162f6fu, 0x3c2b33b2u,
+        0x10e71c86u, 0xbf6e07bfu, 0xec50b435u, 0xba7249aeu, 0x8c1d336du, 0xadf7b27bu, 0x6dd37a45u, 0x121a00afu,
+        0x42a0995au, 0x51b1d2c4u, 0x69c8c92cu, 0x55e87844u, 0x8c209094u, 0xcf6de31au, 0x8a4df1d6u, 0x51a42564u,
+        0xa184a1bfu, 0xff102324u, 0x740cd387u, 0x59773560u, 0x11bbc471u, 0x5903d24bu, 0xbae5eec0u, 0x1375b5cfu,
+        0xab8d8624u, 0xab4c076bu, 0xe34d57c7u, 0x18fe2a4du, 0x328521fcu, 0x9009672fu, 0x96f7c348u, 0x193eef07u,
+        0x3b9cce78u, 0x5272f9abu, 0xd5b47971u, 0x96f5ade7u, 0x9cd08dc0u, 0x94252d8au, 0x714265eau, 0x916cae47u,
+        0xc6b3cdecu, 0xb5175c15u, 0xc0778713u, 0xa2495fc3u, 0xf32ecd08u, 0x9db39386u, 0x02604babu, 0x408aeef1u,
+        0xbf033491u, 0xd7223414u, 0xc4b57879u, 0x5ccf36e2u, 0x11ddd104u, 0xa8da7501u, 0x6bbf5a75u, 0x11419524u,
+        0xbfc6a48au, 0x387d212eu, 0xe351d3fbu, 0xa7a1c1dcu, 0x042330dbu, 0x5b377ab7u, 0x34bafa4au, 0x9a067670u,
+        0x98879e20u, 0xdd8171c9u, 0xab8791feu, 0xdb7b8ab3u, 0x87ebad78u, 0x319599c5u, 0x5aac4ff5u, 0x6e5f016au,
+        0xfd30efc9u, 0x493ce782u, 0xbdd821d9u, 0x3b625acdu, 0xb9a13006u, 0xda6829c5u, 0xeeb39fc9u, 0x567bf77eu,
+        0x2d75d1dbu, 0x6177192bu, 0xd07edca5u, 0xb1720a5cu, 0xcab7c34du, 0x69184ef9u, 0x6f5d7376u, 0x824608ecu,
+        0x8832dc46u, 0x30d26c53u, 0x740f08a2u, 0xdf4a6a2du, 0x931bef9cu, 0x7d789ea3u, 0xb18e7e5cu, 0x7dfaca2au,
+        0x682c4d5au, 0xf9d57a20u, 0xc3f38ab5u, 0x83417615u, 0x7859f597u, 0x5c7221b4u, 0xc34eb21du, 0xfe48b1f0u,
+        0x30ddc32au, 0x6a9c4d53u, 0xebbcec7au, 0x6c3e5755u, 0xb2e69e13u, 0xbae57fd7u, 0xff090280u, 0x4833b2f9u,
+        0x74c3b661u, 0xc9436d8cu, 0xf63c1a5du, 0xd9b9cd60u, 0x8a0841e4u, 0xc5859706u, 0xc268065cu, 0xeb2cecf9u,
+        0x35801625u, 0xc027edf3u, 0xaf276f93u, 0x79c3c50bu, 0x56f086c3u, 0x0871fcc8u, 0x0c599f4cu, 0x60fa4507u,
+        0xf42678e4u, 0x40c1ef65u, 0xfd64d7cau, 0x1344e514u, 0x1357b72bu, 0xef871bd7u, 0xb8c50dd0u, 0x0a81e237u,
+        0x38b13b6cu, 0x3a608c48u, 0x4fc68f59u, 0xe2e93570u, 0xe3caef06u, 0x88c76cb6u, 0x065bad58u, 0x2d26adf9u,
+        0xc994d635u, 0x601cccf6u, 0xeb583242u, 0xbcd3e071u, 0xc918e761u, 0xf33ac689u, 0xdfe36c84u, 0x2628376fu,
+        0x5f3c3ba0u, 0x9a0debc8u, 0x794d7022u, 0xe0aa4bcau, 0xc0feb8cbu, 0x3b876369u, 0xcb19c26fu, 0x1f969260u,
+        0xecfff403u, 0x8cb2346du, 0xcd415d56u, 0xb481b2f2u, 0xebc4aa35u, 0xcc12f700u, 0x3cd57167u, 0x2323a92au,
+        0xec33331du, 0x5a33a47du, 0x43e41636u, 0x115f76fcu, 0x4fccbf19u, 0xe59d4820u, 0xdb7038c8u, 0x183c47b3u,
+        0xbec62b05u, 0xa716d7e4u, 0x949e5e42u, 0xc095ceabu, 0x79d6a10au, 0xa215f0e5u, 0x594a5f8eu, 0x75a68f13u,
+        0x0446763du, 0xd9b888a4u, 0x02e8fa5eu, 0x75284974u, 0x4fc10c69u, 0xa36a2272u, 0x4fbc0458u, 0x3f722b3cu,
+        0x7432daccu, 0xd1058629u, 0xc4bec594u, 0xc146322bu, 0xf05caf35u, 0xeb75d3b3u, 0xba57bd8fu, 0x256449acu,
+        0xa9222d57u, 0xafa02557u, 0x1b1e7405u, 0xc163ea47u, 0xb22f69f5u, 0xda3d7237u, 0x553909c6u, 0xe35f198eu,
+        0x2885a180u, 0x331b2317u, 0xc2ef6316u, 0xd03104a9u, 0xd5cc48a2u, 0x1f43efd3u, 0x14e0198au, 0x5ab6012eu,
+        0x06d3ac93u, 0x11134e24u, 0x771cb412u, 0xa229652au, 0x34e1d2a0u, 0x13301b3du, 0xc9f7034eu, 0x2c58dbeeu,
+        0xb41ccb7cu, 0x52972d7cu, 0xf7d384a1u, 0xf7e404b4u, 0x55ddc8dau, 0x4cddaf8du, 0x2915f9cau, 0x41e3c674u,
+        0x5af92b33u, 0xa5523c1bu, 0x3570f110u, 0x6dfc62eeu, 0x7a191d77u, 0x6f847545u, 0x49c88973u, 0xeee6d7d5u,
+        0x15d2e218u, 0x01f6a2f5u, 0xb0e6811eu, 0xaf845f32u, 0x5be9652du, 0x29bacd81u, 0xe1a7d332u, 0xeb184d4fu,
+        0x7c335771u, 0xef7e4823u, 0x0514703au, 0x35b12268u, 0x08758e1au, 0xb231abf2u, 0x22345e5au, 0x950981dau,
+        0xaa1196e8u, 0x6045e29eu, 0x688f5a0eu, 0x274a56dfu, 0xc547e949u, 0x66c732c0u, 0x70e4751fu, 0x9e5ac60fu,
+        0x0334dc60u, 0xe4a8b54eu, 0x5fb11625u, 0xb25af7f1u, 0x2d133dabu, 0x22cf43e5u, 0x75b9a10du, 0xbb46634fu,
+        0x1259d651u, 0x00e38b12u, 0xfe858e07u, 0x15132456u, 0xb4be29f7u, 0xab3841f8u, 0x1d183558u, 0x06d017ecu,
+        0xac91563eu, 0x1baa8453u, 0xe048d766u, 0x8946f9d4u, 0x2c6f208bu, 0xce385f83u, 0xaa014f20u, 0x69c663c1u,
+        0x2b1fd006u, 0xe9d9384eu, 0x9620503du, 0x260f1595u, 0xa7bc1be6u, 0x01d0b9c8u, 0x43f63545u, 0x49bbeaceu,
+        0x6c17d590u, 0xbeb295b5u, 0xc318b40fu, 0x96ae04e2u, 0x30a2f64fu, 0x4ef32860u, 0xbe21c9cfu, 0x8561d10bu,
+        0x6d2b53a2u, 0x73d46718u, 0x2ef9ce70u, 0xe1317f6eu, 0xf1cc4c1eu, 0xb5c718c4u, 0x6c522ad8u, 0x315b3bb3u,
+        0x12e4aa25u, 0xb3c1dfbau, 0x665eb5f2u, 0x085107c8u, 0xfeab4984u, 0x57588f67u, 0x11350961u, 0xf0f00fefu,
+        0xd43e68e9u, 0xeef41b7au, 0xd1b0173au, 0x5c34551fu, 0x5cbd9f49u, 0xdf9232edu, 0x50e68701u, 0xc367778fu,
+        0x768bef04u, 0x00ed5512u, 0xa1c336beu, 0xa890e6adu, 0x7113f145u, 0x1e753fddu, 0x98c7f5f7u, 0x2592473cu,
+        0xe9ac9c4eu, 0x7b9bd19bu, 0x907a682fu, 0xcb1de83eu, 0xf740209bu, 0x107ba9e6u, 0x3c21f6d6u, 0x86af1031u,
+        0xb0c9e9a9u, 0x242b4fa2u, 0x4aa4c896u, 0x03c63d80u, 0xa6dca269u, 0x6b901028u, 0xa856034cu, 0x9506d145u,
+        0xaccaa624u, 0x4cb393a0u, 0x39f3e6b9u, 0x901a342eu, 0x8eee0aa1u, 0x0eb84e40u, 0x47ee5603u, 0xa5ca93fbu,
+        0xcfb47ecfu, 0x1e895a99u, 0x50fbb62au, 0xc7be5cb4u, 0x72d404a1u, 0xf82cd997u, 0x25addb22u, 0x00000000u,
+    },
+    { /* 2^137 */
+        0x722914f4u, 0x22321a73u, 0x2db4e238u, 0xbf496621u, 0x3c3388d0u, 0x6d81ac8bu, 0xc09cee08u, 0x9edf43e9u,
+        0x19977c2fu, 0xf368b7d7u, 0xbd0d5232u, 0x10514a73u, 0x2966c172u, 0x86e83cd0u, 0x7b905fe0u, 0x0f72260cu,
+        0x2fbddb4fu, 0xa0689257u, 0xa5547afdu, 0xeb99d650u, 0x850b5d9au, 0xdf410817u, 0x5daff657u, 0x4c3ed039u,
+        0xba284cc9u, 0x097d3d55u, 0xf20ba293u, 0x6182f690u, 0x4c68a9fdu, 0x719c85d2u, 0x481144ebu, 0x008f18a6u,
+        0x476ab84au, 0x1d8df6a1u, 0x66ba9a9bu, 0x279a7ff7u, 0xb637f815u, 0x55c35905u, 0xda0ef41eu, 0xad7e6104u,
+        0xea230ecau, 0xb2e935a8u, 0x95528ccbu, 0xf423586au, 0x80c06226u, 0x3877a657u, 0x6172c7b0u, 0x19d59308u,
+        0x74c2e71cu, 0xd87ec77du, 0x13061e59u, 0x1ccdaf34u, 0x44fbca63u, 0x342eb035u, 0x3c6acebdu, 0xa16b2ef8u,
+        0x93ea21a5u, 0x2960dfb1u, 0x329d3a16u, 0x39272875u, 0x28c81e7au, 0xcf06e7b5u, 0x5a402e1bu, 0x1759966cu,
+        0x6bbdd3b8u, 0x1702759cu, 0x06f796c1u, 0x96ff4e2au, 0x38642aceu, 0x85b716abu, 0x95a5423du, 0x56142cc6u,
+        0x486df95bu, 0x53e09216u, 0x7619dd2bu, 0xa8cc9f3du, 0x14a0c1a3u, 0x2d4d26e3u, 0x394a37d2u, 0x111890f0u,
+        0x8b5052cbu, 0x35daa815u, 0x3943933bu, 0x6f4d39d3u, 0xcfb9372au, 0x01fdc642u, 0xfa3fd605u, 0x5b8dca1eu,
+        0x73e5790cu, 0x63654a6eu, 0x5ddf1dd9u, 0x8104fc88u, 0xb327284cu, 0x4dc426eeu, 0x9ab5012cu, 0xfb99e730u,
+        0xa51f124fu, 0x9fa6cbc6u, 0x5e3e32e1u, 0x6e4fb342u, 0x7b04a0feu, 0x56e83ce6u, 0xa9b4dfd8u, 0x45ed7babu,
+        0x987f8b68u, 0x22d38995u, 0x54af2cbbu, 0x975e7620u, 0x74c22ab1u, 0x96f2e002u, 0x35517be3u, 0x117154ddu,
+        0x2810f37du, 0xa7d44b3au, 0xec79b6bfu, 0xa7f93aabu, 0xe504b562u, 0x537f9460u, 0x21236e57u, 0xacac8cd0u,
+        0x08ce51d7u, 0x59c9af3du, 0x9a25a7d2u, 0x19932904u, 0x2030d1ddu, 0xb62af7bfu, 0xf8b1d5e4u, 0x7219ea6bu,
+        0x02a22063u, 0x98d4145bu, 0xe6b45d6fu, 0xf5fdb8c9u, 0x40b180eeu, 0xf5522dbfu, 0x36b361b6u, 0xad23f8c1u,
+        0xa57d1ff6u, 0x9bee5e24u, 0xb823d559u, 0x6c967635u, 0xbf9dc6c1u, 0x08c01ca2u, 0x5ff8bb1eu, 0xdea64fe5u,
+        0xc4439004u, 0xbb87a3edu, 0x9e29f4d2u, 0x2ddff70fu, 0xe12fea27u, 0xe1268afbu, 0xdb311c18u, 0x2e89be86u,
+        0x8200924fu, 0x5a8d0a6bu, 0x10becf79u, 0x0ebef1d9u, 0x4c4b1a49u, 0x1cf30136u, 0x5d9b148cu, 0x6584c972u,
+        0x7daaaecfu, 0xc8ea5f92u, 0x06216480u, 0xee16dfc8u, 0xd007d966u, 0x752cd0f1u, 0x908d5b19u, 0xf34ff62bu,
+        0x97c27d76u, 0x56d97e80u, 0x9e9335c8u, 0x1e77f237u, 0x2982e72au, 0xfcbe2367u, 0x2cc853a2u, 0xb9aa0924u,
+        0x73aaef11u, 0x3ba5631cu, 0x89010558u, 0x9de74703u, 0x0bf9ad9bu, 0x556273bcu, 0xa9bc751eu, 0x4e643b19u,
+        0x1cd4f6a5u, 0x600a3998u, 0x27e655e5u, 0x0bc5c208u, 0x94ec69f8u, 0xd0e85c93u, 0x7ebcb594u, 0x0f6b9aecu,
+        0x101ba51eu, 0x527e83f6u, 0xfd662740u, 0xc3f66469u, 0x265f9314u, 0x8002b92eu, 0x84ad3cceu, 0x896c4121u,
+        0x4c7df683u, 0x05c97ac9u, 0x0c333b32u, 0xcb8b2e38u, 0x81f4e98bu, 0x1dce7172u, 0x60452d24u, 0x21eb2be8u,
+        0xd0759dc2u, 0xfafcb319u, 0x31ea40c2u, 0x4ed3479du, 0x1bef76b1u, 0xda2fddc2u, 0xd2db27a2u, 0x94039ea8u,
+        0xbb1cf845u, 0x86cfb1ceu, 0x36238f16u, 0xc62cbf75u, 0x7d72bb43u, 0x69400418u, 0xf57ac5e2u, 0xd9161579u,
+        0x40ab4e6au, 0x46508b01u, 0xd1519423u, 0x2d36da49u, 0xb8e609adu, 0x094b7d2bu, 0x4624014cu, 0xbfd2ac8du,
+        0x9520cb89u, 0x5efaa712u, 0xedbb2ec2u, 0x1d51d6a4u, 0xb962ebebu, 0x7e322feau, 0x6e94d82fu, 0xda3c6941u,
+        0x932c20feu, 0x99cc2719u, 0xf167f0f6u, 0xd7189799u, 0x692c1d18u, 0x2dd85aaeu, 0xbe12fd1fu, 0xa10c7c94u,
+        0x16a7ec7fu, 0x1c91952eu, 0x55b04ebbu, 0x2a28e64fu, 0x65e7e964u, 0x83b0686fu, 0xb5d5b94eu, 0xb3b5bfaeu,
+        0x0d4116bfu, 0x28ea9e4eu, 0x3b8f9671u, 0x1122b47eu, 0x6fdf2243u, 0xd4307722u, 0x8f1ae468u, 0x93e39f5cu,
+        0xe811902eu, 0x058b82dfu, 0xf18fd0f4u, 0x657e09c3u, 0xc5d42144u, 0x2b29eacau, 0x3ceccb11u, 0x351244e9u,
+        0x25a6f732u, 0x72384e97u, 0x4fed65cbu, 0x908d5c28u, 0xee423179u, 0x5ba838d1u, 0x5d34a024u, 0x788ce5a0u,
+        0xde66cdb9u, 0xb04ea5dbu, 0x5f4add10u, 0x130cb9a2u, 0x41a8b4edu, 0x0992df59u, 0xec2826d5u, 0x7a966813u,
+        0x16a8d18au, 0xaecba8a7u, 0x63169b3bu, 0x90cd2236u, 0x5efc635du, 0x89b4f5ecu, 0xfc8f2c0bu, 0xd0306b31u,
+        0xa7feee7du, 0x30099371u, 0xc7bd965bu, 0xc332a0d3u, 0x8e062d7fu, 0x74608e1cu, 0x6ff50be4u, 0x33d6595eu,
+        0x1c1edf18u, 0xce1700e8u, 0xfb071ae7u, 0xd245b59du, 0xca6b69e6u, 0x4988309bu, 0xa33a4984u, 0x44e39b44u,
+        0x7020487cu, 0x4914f68au, 0x43bfc98eu, 0x111eefe6u, 0xcc306f97u, 0x2e20062du, 0x17f689feu, 0xed7c3149u,
+        0x049d8b09u, 0x8c06d99du, 0x2fa4a33du, 0xbceeda61u, 0x12b01a36u, 0x9d9d9858u, 0x3f7460b3u, 0xd8c474a7u,
+        0x7b0899d5u, 0x964c4c84u, 0xcfb67ccdu, 0xb0f7650eu, 0x3f6d4caeu, 0x67e9760fu, 0xfd054a50u, 0x1d71183fu,
+        0xfe817825u, 0x2aef5344u, 0xf1fc8dc1u, 0x5fb8e238u, 0xf65847f3u, 0x8dd6de63u, 0x75a1adddu, 0x4a4a303du,
+        0x6e5dad01u, 0xa1b445a9u, 0x89a7fb88u, 0x04c2de2fu, 0x67b336e3u, 0x102989b5u, 0x0cd2f123u, 0x1e63116bu,
+        0x0aec0617u, 0x565883f0u, 0x9d3018a3u, 0xc44bd424u, 0x0efd5717u, 0x4824760fu, 0xaf16bf93u, 0x9c3e11fcu,
+        0x8f3cf0a8u, 0x06a7444eu, 0x2d18751au, 0x7e698de4u, 0xe0ad261du, 0xc44fa19fu, 0x7c2faa16u, 0x1ebf4215u,
+        0xc4f36706u, 0x31cb5f0eu, 0xf9fd0ffdu, 0xbadd695bu, 0x4d68bc51u, 0x4522d040u, 0xac1e9cb7u, 0x1c98da1du,
+        0xc31290d5u, 0xb08e7688u, 0xb7ee5126u, 0x2b33ee5fu, 0xd6fd6a41u, 0x0fdd7664u, 0x96965037u, 0xfc37337du,
+        0xd4c50345u, 0xfb7dabdcu, 0x52e514fcu, 0x6bbf9be8u, 0x712503beu, 0x4a0ecbb7u, 0x308c3996u, 0xb35e91b0u,
+        0xa8ac4b50u, 0x2ec802e8u, 0xaffdc4d7u, 0xa075f5ddu, 0x5c1e4f8cu, 0x68dec8ceu, 0x5448b36du, 0xbd5cd8c8u,
+        0x81b6f487u, 0xf37285e4u, 0xcba43fd1u, 0x6aae247eu, 0x8270cd9fu, 0x59cedf38u, 0xa6db248du, 0x7a51d413u,
+        0x1c616e62u, 0x466bb3adu, 0x094a381eu, 0x3f0575afu, 0xd70d4850u, 0xd3023a31u, 0x83c84ad5u, 0x4463a668u,
+        0xb80343abu, 0x3050cd5bu, 0x96810cbcu, 0x2f24b85fu, 0x843f5f55u, 0xaed6b2edu, 0x7ce7de10u, 0xa4279a2eu,
+        0xcab21b84u, 0x21008318u, 0xde24fb9cu, 0xe1d7f469u, 0x517cc4adu, 0x574efacbu, 0xc6a143d7u, 0xcd38992fu,
+        0xaeca8f40u, 0xa0a2811cu, 0xf50faad8u, 0x7d6ecfbeu, 0x980c7190u, 0xc89a686fu, 0xd4291371u, 0x14659f7au,
+        0x24eb9344u, 0x9f7eac5bu, 0x6aecd2f9u, 0x3d1171c9u, 0x2c671e9cu, 0x256b3aa1u, 0x81af9c3cu, 0x963fb0b3u,
+        0x93cb6d05u, 0xbaf82bcbu, 0xa6e515bau, 0x2c6b49cbu, 0x1afd9f69u, 0x48d517b0u, 0x6b4c1a76u, 0x8f00d003u,
+        0xef8899d0u, 0xe99f1747u, 0xab0d1370u, 0xefecd8d8u, 0x2006c5b7u, 0x7f0c3932u, 0xe1205856u, 0xb0c24904u,
+        0x579ff059u, 0x4c2e40c9u, 0x384e70d7u, 0xfff9c990u, 0x881ef1b8u, 0x15a98dc0u, 0x32cf6313u, 0xf07e9a90u,
+        0xdf5a22a8u, 0x77a51e26u, 0x0444ec54u, 0xff24b64fu, 0x0bcd9c94u, 0xc608c32cu, 0x9a1e3407u, 0x0984e839u,
+        0x9b47fa5du, 0x8b7d4467u, 0x6d7c923du, 0x9a794258u, 0xc0b5ca0au, 0xb3a7b5a1u, 0x3599ae2au, 0x402558bdu,
+        0x65eee359u, 0x462444b9u, 0x0319cb60u, 0xfb4a39e8u, 0x5c076f9eu, 0x2df02b7au, 0x0f793ce5u, 0x13bb20f0u,
+        0xe48e8508u, 0xc0ce2e7eu, 0x88b9e6e4u, 0xca270ac2u, 0xd6e262c4u, 0x64acb029u, 0x5aeb7cebu, 0x3634a724u,
+        0x5ab310ccu, 0x31a1f44fu, 0x08ff296bu, 0xf68b46c5u, 0x22b9a77fu, 0x9101e781u, 0x6d638ce5u, 0xfd50b857u,
+        0x00792475u, 0x70958f08u, 0xac54e35du, 0x33d51a18u, 0x26afef23u, 0x10bb4966u, 0xb02bcacdu, 0xaace01fdu,
+        0xee184715u, 0x047fe10bu, 0xcdc8d6fbu, 0x958044dcu, 0xae2cbcf1u, 0xc0e2d054u, 0x72f7cd0bu, 0x18785972u,
+        0x99762288u, 0x0fb55effu, 0xbbac254eu, 0x4c3c7ce8u, 0x1ab76e49u, 0x624cec5bu, 0x721e547fu, 0x6736ea66u,
+        0x47e6cb8au, 0xe7872ecdu, 0x1ccae3e5u, 0x9fb2ce5cu, 0x045a1450u, 0x515923ceu, 0x05ace557u, 0xf1f4ece1u,
+        0x097b7204u, 0x3ce8737au, 0x0b04a414u, 0xaa73645fu, 0x2bd0f662u, 0xa1035cdfu, 0x34aa34e0u, 0x4a32b84du,
+        0x147c2479u, 0x15f20246u, 0x20251aceu, 0x2beaa831u, 0x005c1881u, 0x1efd1e5cu, 0xc84221aau, 0x9b9792f0u,
+        0xadfb7ec8u, 0x238c488bu, 0x556a72acu, 0x2b26624fu, 0x186387c6u, 0x03427f58u, 0x45a7d01eu, 0xac262b2bu,
+        0x9015d614u, 0xf22ed880u, 0x5367fcc3u, 0x9a83f505u, 0x6f7e97e4u, 0x80532528u, 0x6ed042f9u, 0x81a7b421u,
+        0x2eac0662u, 0x4904d0b1u, 0xdd2c5d3eu, 0xae6741feu, 0xf7f776dfu, 0xed8848fbu, 0x16aa3409u, 0xda424749u,
+        0x8f4bce48u, 0xf3392fe9u, 0xfa5675aeu, 0x3a679ec2u, 0x6ee26b75u, 0xa394dd37u, 0xb426c97cu, 0x5dc81835u,
+        0x3a4c77b0u, 0x1cc17702u, 0xce290eddu, 0x3eba3ebau, 0xb570e838u, 0xef710395u, 0x62e8fe47u, 0x9f7600c1u,
+        0xf6e11153u, 0x9e36e440u, 0x77a0e3abu, 0x66ae1fcau, 0x1e93795fu, 0x2b263a7fu, 0xcde44e09u, 0x28f8a563u,
+        0x8754bbc0u, 0xa7aff04au, 0xa149c150u, 0xc8544aeau, 0x8eae6466u, 0x48fc8a7au, 0xe0047746u, 0x8b7a8698u,
+        0x276c197au, 0x32edb04cu, 0x7a1f57fbu, 0x5882e29eu, 0xa27a6217u, 0xe2a12d05u, 0x9a3654cau, 0x00000001u,
+    },
+    { /* 2^138 */
+        0x8182bed8u, 0x507ce881u, 0xc17e9871u, 0x4ce5b0f9u, 0x565ce46bu, 0x92053f5fu, 0x5f8d8643u, 0x84e60928u,
+        0x5c1b89bau, 0xd86c1ec2u, 0x5fca406du, 0xe765c679u, 0xfd8a747au, 0xab383af1u, 0xbb64f68cu, 0xa348b4e1u,
+        0x3aa334bcu, 0x9b4171c5u, 0xf4debae1u, 0xec2ff203u, 0x4bc78a20u, 0x05c1b838u, 0x35b64738u, 0xa4ac2a77u,
+        0x6c41e0f7u, 0x5cc705cbu, 0x345cdf3cu, 0x4baf537eu, 0x99ccea65u, 0xc6afad41u, 0x020d2e12u, 0x596cf3e1u,
+        0xf9852ef9u, 0x64436db7u, 0x47e2f4e5u, 0x8b49ec28u, 0xf4be1eecu, 0xf60a18d3u, 0xa39f94c1u, 0xb6725ff8u,
+        0xc8b6e1aau, 0x5d180591u, 0xd14d12a9u, 0x211ee78eu, 0xeb546436u, 0xecdedab9u, 0xe39b05f3u, 0xa03a3bc2u,
+        0x34fa859du, 0xb65a1c00u, 0xf22fc53eu, 0xc96b2bbau, 0xb1b37bc7u, 0x6313b247u, 0x35d468dcu, 0xe2cabe1au,
+        0x59862f9fu, 0x0979576au, 0xc7e32aceu, 0xc5a21b45u, 0xbfd729c1u, 0x78c663aau, 0xdab90ec2u, 0xe73f3872u,
+        0x57bac4b8u, 0x0296c4fcu, 0x73339220u, 0x1a694c93u, 0x65ddba26u, 0x9b864993u, 0xb28a5081u, 0xbf088b02u,
+        0x3d9ad25bu, 0x1bdae653u, 0x10a57314u, 0x77b49adcu, 0x08709abeu, 0xd6e21e79u, 0x1fa3b3a7u, 0xb97607e6u,
+        0x1fd2331bu, 0xad257d4du, 0x455ed2bfu, 0x765a9b0cu, 0xbefc185eu, 0x8d6daecdu, 0xcd83a401u, 0x199b9b71u,
+        0x6178984bu, 0x914ef1cau, 0x52fba247u, 0xa7535be5u, 0x555b2a6du, 0x2ddd41f4u, 0x9df0c614u, 0xbec94425u,
+        0x23916c13u, 0x87cd6568u, 0x0fff8aedu, 0xef7a60dfu, 0x064929b5u, 0x3ca0af1au, 0xf719c51du, 0x097696fau,
+        0x63d5f695u, 0x51c90c14u, 0x0752a55du, 0x807e9c05u, 0x69d02697u, 0xa4df86d0u, 0x3b0624aau, 0x702360bfu,
+        0x133e98c6u, 0x3da0b755u, 0xca2e62beu, 0x8b027dbeu, 0x3c0cc54cu, 0xb6eed25du, 0xdd9f6f3fu, 0x6e9d2070u,
+        0x1acab0e1u, 0xc8070efau, 0x641e038eu, 0x23db5ccdu, 0x537c816cu, 0xfffb30cfu, 0x1d83664au, 0x77250ce4u,
+        0x08cf0f70u, 0x3fbf6cacu, 0xbc1e90d5u, 0xcf177318u, 0x11f6c732u, 0x482b8b90u, 0x6ddc7197u, 0x93637a07u,
+        0x52170837u, 0xbc943433u, 0x24626052u, 0x23a453e3u, 0x87695d28u, 0xdf7bf88eu, 0x5c374692u, 0x88d4a341u,
+        0x9d3870f6u, 0x649f9499u, 0x49816974u, 0x5b5300b3u, 0x155efca6u, 0xb15f5857u, 0x0a297efdu, 0x8822530du,
+        0x008925d9u, 0xbcbd21d9u, 0xd2813282u, 0x4a78309au, 0x39e9c223u, 0x666d15e0u, 0xa8f6f6b7u, 0xdd419c55u,
+        0xd38bdbfcu, 0x103e87efu, 0x64a40a6fu, 0xbd48f845u, 0x434a678cu, 0x48b80cdeu, 0xb8378c42u, 0x8fd848c1u,
+        0x901d6969u, 0x874abcc3u, 0x0c74f505u, 0x85955f71u, 0xb0a1ba56u, 0x5113504au, 0x80136c95u, 0x0e3f3462u,
+        0x4a08ec91u, 0x3bc2075fu, 0xe994d610u, 0x64cd0c38u, 0xc9d43cc4u, 0xef84d416u, 0xa1e70ee4u, 0x6a6f7547u,
+        0x4b5d03dau, 0x5f943f7fu, 0xe38fc7eeu, 0x5102c164u, 0x4d6e3641u, 0xb91956abu, 0x69c8ca69u, 0x79dc0b2eu,
+        0x3b9b5d51u, 0x4a01e01cu, 0xb86d0b62u, 0x95ecc296u, 0x56e2bf92u, 0x183e899du, 0xd95eadfcu, 0xe5f5c306u,
+        0x23213d4au, 0xd4c9b191u, 0x017fd9fbu, 0x9bfc8a2fu, 0x4149e8f5u, 0xe91c129cu, 0x98cdd1b6u, 0x428de5c0u,
+        0xb90c230cu, 0x4125a7b0u, 0xa2e151c1u, 0xd5c2c186u, 0x37b563a6u, 0x2af153e4u, 0xca7726c5u, 0x9bf5b23au,
+        0x155137d5u, 0xf3cf944eu, 0x5d5d7e3fu, 0x2fbb965cu, 0x3cf54731u, 0xd3ca5319u, 0x8c849873u, 0xd550ef1au,
+        0xcc1adf81u, 0x5dff4468u, 0x11dab259u, 0x74db4740u, 0x7159f8b4u, 0x42e4d6a3u, 0xb3696778u, 0x78826da0u,
+        0x6f593ad0u, 0x9bbe0455u, 0x2b356892u, 0x26dd822au, 0x8b93406du, 0x4fcbf0a6u, 0xe0d0427eu, 0xb8c72f2bu,
+        0x1ce565ecu, 0x9668c744u, 0x38f2d71eu, 0x6d168444u, 0xaa20417fu, 0xceb7b65au, 0xbd71c900u, 0x49f092afu,
+        0xcf2eb1d1u, 0x600794b3u, 0x3571e05cu, 0x1932a619u, 0xa5679a44u, 0x1b6ceeaeu, 0xa8bd9cd8u, 0x7a31ff12u,
+        0xf4df8689u, 0xfff8059cu, 0x24bd4801u, 0x050243c2u, 0x777445e0u, 0x5200579cu, 0x787e5c4bu, 0xe37f48a6u,
+        0xab43974eu, 0xe2493d43u, 0xd08bfdf0u, 0xdeb64f71u, 0xf1fa9520u, 0x71a13b04u, 0x1436aed0u, 0x6bdecf44u,
+        0xbf279843u, 0x83d3a768u, 0xf115c1b8u, 0xfd2bc715u, 0x4d9562dcu, 0x9a061c63u, 0x8c4cd284u, 0xd85ddde6u,
+        0xfcd87a8du, 0x200c087cu, 0x4193ed6bu, 0x2459bfacu, 0x363549ceu, 0x4e2acda1u, 0xd77860f0u, 0x5b46d311u,
+        0xe03f6f32u, 0xe1a4a9e3u, 0x6974244du, 0x554ebf6cu, 0x31877dc7u, 0x85a4366au, 0x7e304860u, 0x8a428295u,
+        0xce33f480u, 0xdb1196c4u, 0x05424b5fu, 0xb433a53fu, 0xaf20657eu, 0x3ca36c1fu, 0xb2ac8aeau, 0x5057eeacu,
+        0x95c027f8u, 0xfdddf47fu, 0x396d52ebu, 0x3b0d7e13u, 0x6d1c37e1u, 0xe10c689bu, 0xe5d0ac45u, 0xd6cde4cau,
+        0x53c84664u, 0x20bda065u, 0x9bdc5b97u, 0x518178e0u, 0x095250b8u, 0x4c58e582u, 0xb1ddb70cu, 0x16473c78u,
+        0x98817203u, 0x8cdce564u, 0x03b98184u, 0xd4938b0eu, 0xe1822b66u, 0x483c2dc6u, 0xacc9901cu, 0x0537ce6cu,
+        0xdc5bd88au, 0x16998283u, 0x5af91020u, 0x857fae9fu, 0x6dc2cc30u, 0x8c057117u, 0x34cee091u, 0x94c21c01u,
+        0x198797acu, 0x12165371u, 0xc6a9dcd4u, 0x766dc06cu, 0x4976a6b9u, 0xaf5ccc08u, 0xdd40b133u, 0x3563b380u,
+        0x016158ffu, 0x2910de44u, 0x5e48c27au, 0x022527e9u, 0x2d4b8f59u, 0x9f1f614cu, 0x1d63ee36u, 0x45b6ae96u,
+        0x820e338cu, 0x3d5defd4u, 0x669b3948u, 0x826beeceu, 0x12de7fd8u, 0x515d2648u, 0x08b56bd9u, 0x33d8e375u,
+        0x9932ca17u, 0x0425a1f5u, 0x9ed31971u, 0x72e26c5cu, 0x6b5f4dd9u, 0x4fb788e1u, 0xf91fd1c5u, 0x8c077c4bu,
+        0x6a438632u, 0xb29429bbu, 0xb64c8ff4u, 0x9757777cu, 0xc08a1ba8u, 0x715f7343u, 0x0775c99cu, 0x35323c29u,
+        0xa8c76f57u, 0xb76c8fd3u, 0xb4d4614du, 0xbd1a9382u, 0xb4130194u, 0x91cbf643u, 0x2526acf8u, 0x720fc123u,
+        0xa97fc1b2u, 0xe3619074u, 0x2512e3fcu, 0xbfb6eb92u, 0xa6c5577cu, 0x8a8df1abu, 0x7b3a1f4du, 0x370fc2e2u,
+        0x329789b7u, 0x8e409c3au, 0xb26d250au, 0x6faa9a88u, 0x3da64a4bu, 0x63c3a27bu, 0x4a515013u, 0xd197cc3fu,
+        0x473139e9u, 0xa8a5c8b9u, 0x01e4f3e1u, 0x8d98edf6u, 0xdf826262u, 0xbcfc0172u, 0xb29323f0u, 0x4abfebc7u,
+        0x374a8fb9u, 0x626e6c25u, 0x74907798u, 0x7805e6fbu, 0x0c5d1b96u, 0xb3ec5b86u, 0x9520f495u, 0x887c8de4u,
+        0x1eaae33du, 0x4901a910u, 0xff3089b1u, 0x5d434963u, 0xbf76c9c4u, 0xb29b083bu, 0x2828baa2u, 0x1460c544u,
+        0xfb89ef86u, 0x4e1d9a2du, 0x43cba663u, 0x75650e04u, 0x5912b7aeu, 0x6a2e210cu, 0x2ec13ef2u, 0x622e3d6bu,
+        0xf6ace000u, 0xd444cbcbu, 0xc921cd5du, 0x1b0355b6u, 0x64d1bcf2u, 0xf4b4e207u, 0xfa72adb5u, 0x773e9f26u,
+        0x80d5753eu, 0xc598aeefu, 0x0c7e082cu, 0x5884c768u, 0x437a4a5bu, 0x21fcd839u, 0x09f39b8au, 0xda8019a2u,
+        0xd6e5bd12u, 0x40aa491au, 0x83b14cf3u, 0x255c093fu, 0x1b181c09u, 0x8067c693u, 0x161ff317u, 0xa62fa24du,
+        0x145c457eu, 0xfece2f70u, 0x1243f679u, 0x9c5c046bu, 0x4a7a1e3au, 0xb03d2b09u, 0x5fbac0b3u, 0xf37c8838u,
+        0x309ec6bau, 0xcb19079fu, 0x992415f2u, 0x86126a7fu, 0x8da9f937u, 0xfae4393au, 0x09d91e8eu, 0x01ac8174u,
+        0x914752c4u, 0xd0019dbau, 0x71ce514cu, 0x477025acu, 0x369825f6u, 0x3f33e97eu, 0xd34d32c5u, 0x743c40cbu,
+        0x5f76bd44u, 0xefcd1f73u, 0x10bff985u, 0x7845b2f7u, 0xa3c7e7b8u, 0xee58001cu, 0x85d4d83fu, 0x9c4de9cau,
+        0x2512d16fu, 0xbac72501u, 0xd76e4d96u, 0x21a77a6du, 0xb23893fcu, 0xe1b4cae9u, 0x62ded298u, 0x125663e7u,
+        0xcd94aa80u, 0x94ff6ae9u, 0x5a9d3967u, 0x9f434463u, 0xb681a5bcu, 0x5c66688cu, 0xbcb15934u, 0xd080b69cu,
+        0x8811a838u, 0xb061b91cu, 0x5b2a99f4u, 0x24d071feu, 0x5870727fu, 0xad397a9cu, 0xf5842383u, 0xb265b136u,
+        0x28c66beeu, 0x2c1da397u, 0x3d4bec87u, 0x29c2a56cu, 0x21067e23u, 0xcee2c27bu, 0xb5cbc04cu, 0x51f5f820u,
+        0x4cea79c8u, 0xdb4f2260u, 0x9a8d34a4u, 0x0e084017u, 0x67c7b68au, 0x2fc0a879u, 0x11513e59u, 0x88fd179au,
+        0x488e1e4bu, 0xc81d93ceu, 0xc15fc5bcu, 0x403b7386u, 0x8db71584u, 0xc1cabd88u, 0xf4580e9du, 0xdcf80a6du,
+        0x669e311au, 0x8ba17f4cu, 0x9a780f4du, 0x901d0b47u, 0xc2c76906u, 0xa8b5544bu, 0x7b3fcc82u, 0xcd421c0au,
+        0xb02176b4u, 0x9f0000fbu, 0xa266f0d5u, 0xfa9d2b95u, 0xe8a6bf08u, 0x12632558u, 0x5e3569c4u, 0x54327080u,
+        0x1de153a9u, 0x283a1832u, 0x954f2c10u, 0x106bd97bu, 0x7fb6dce2u, 0xa32104c4u, 0xa1be6644u, 0x6dd57661u,
+        0x7dc94cdbu, 0x2742db5eu, 0x809d48ccu, 0x6ebf67e4u, 0x0ffbda70u, 0xaa970188u, 0x4c73778au, 0x154deaecu,
+        0x49097762u, 0x0d0d6c17u, 0xd380a151u, 0x22f4716bu, 0xd264cc91u, 0x92532c74u, 0xd22c26a2u, 0xe0706395u,
+        0xedc50a12u, 0x827f36e1u, 0x4f77472au, 0x09b8515eu, 0x6d5ae9b2u, 0x0534be3bu, 0xcee6e34cu, 0xf8264997u,
+        0xa06a5d60u, 0x82e86ef0u, 0xb4d46e54u, 0x453edb3bu, 0x30a0833au, 0x1c041a83u, 0x1ad44859u, 0xb8db5ffcu,
+        0x1ba66994u, 0x4ca3e9ffu, 0xcff1768fu, 0x7ab44082u, 0x0c768bf4u, 0xeda5a555u, 0x66c7474du, 0xced4201eu,
+        0xeae56d04u, 0x7969f21du, 0x66228ccdu, 0x72246789u, 0x21da276du, 0x1c80120cu, 0xafd3c1fau, 0x6235045au,
+        0xccba13d0u, 0x95ef83f3u, 0x434ee117u, 0x26a9a7ecu, 0x819e0c6au, 0xca6b0e72u, 0x38b7a446u, 0xbca12889u,
+        0xc09b77e9u, 0x094cb666u, 0x20beee65u, 0x7af8dfa1u, 0xeb183d65u, 0xdd6b531fu, 0xc6e423fbu, 0x00000001u,
+    },
+    { /* 2^139 */
+        0x9608fc91u, 0x5b9ea301u, 0x978105aeu, 0xcbdec00du, 0x1727fe3du, 0x76fd38e0u, 0x5741c99eu, 0x163809f5u,
+        0xe7a83853u, 0x04a58c03u, 0x1a69273du, 0x4f27149au, 0xbc3e45fcu, 0xcdc03392u, 0x72f93f1bu, 0xe2ee510du,
+        0x7fed4d7fu, 0x94c02898u, 0xa837a93bu, 0xb0126db3u, 0x16104b16u, 0x74a49aa7u, 0x44832661u, 0xbeaccc70u,
+        0x19a82856u, 0xfabf7c09u, 0x0a1d6a9fu, 0xa5e43cbfu, 0x0c209fb1u, 0xd87facd9u, 0x7924ed2eu, 0x3894d617u,
+        0x6aeae5e8u, 0xd23b6e0bu, 0xd0fea0aeu, 0xccf28a35u, 0x13181353u, 0xb58fe633u, 0x8108fcd3u, 0x4853b39bu,
+        0x7ec7a39au, 0xc6598a7eu, 0x72cf19f3u, 0x9d5693f3u, 0x0458f3afu, 0xe1818960u, 0xbb384c96u, 0x12e92d03u,
+        0x30a15350u, 0x3069c8a8u, 0x85875891u, 0x380f7c9cu, 0x6181fd2au, 0xf581f3e1u, 0x3c7fcaf8u, 0x100a8f25u,
+        0xc83c1566u, 0x0a3cb37bu, 0x2ccf48deu, 0xc565b24au, 0x1df5febeu, 0x02bed591u, 0x05f0eb0au, 0x9b746742u,
+        0x34e80e4du, 0xccd22f13u, 0x0ae2e546u, 0xbd3ec852u, 0xeafd96f3u, 0xe7c616c6u, 0x51583dd7u, 0x7c5417dau,
+        0x05374823u, 0xde9abe7fu, 0x2e452a9bu, 0x5b864ba5u, 0xdd569fbdu, 0xb095a837u, 0xeeaab927u, 0x95957c02u,
+        0x05f5645bu, 0x186c81a1u, 0xcfecec15u, 0x3f854d28u, 0x23d2b9d6u, 0x5831ba98u, 0x699115b2u, 0x17acfc2bu,
+        0xf20ee983u, 0xa8dec369u, 0x1efad22cu, 0x2763a1f7u, 0x6ffb4108u, 0xa187bac0u, 0x3544bdd8u, 0x19711ff3u,
+        0xb67632cdu, 0xb8f383bau, 0x15ed391du, 0x9a9171b8u, 0x26f6d8f5u, 0x35a07fdbu, 0x3989ef36u, 0x03c60de1u,
+        0x38a1e9cau, 0xec5cc43fu, 0xf6e77f75u, 0x2d365c41u, 0xf62f4885u, 0x2470b056u, 0x56ff532cu, 0x2f143c7au,
+        0xc8d508a5u, 0x31b6d3beu, 0x6be55ebdu, 0xc8867fc3u, 0xe1792090u, 0xefa8f926u, 0x0aab1a63u, 0xb34e7224u,
+        0x9635b550u, 0x61057cf0u, 0xe5a0eba4u, 0xc65a9d7bu, 0x617ae8ecu, 0xd02457c1u, 0xc89b36cdu, 0x0a12f9beu,
+        0xae173b8fu, 0x087b0f1cu, 0xe9e3296au, 0x68f5e243u, 0x4a4e8443u, 0x01851ab1u, 0xbf3d5de8u, 0x33378a27u,
+        0x87af1b6bu, 0x58597ce3u, 0x6c14047au, 0x525710e5u, 0x8b1c8cd4u, 0x389749c3u, 0x9cbe1b7bu, 0xeb24c051u,
+        0x5b8e0a4bu, 0xb8471de3u, 0x56c1b9e1u, 0xf173695cu, 0xd349a947u, 0x99edfb6au, 0x22a0af1fu, 0x4c5771f2u,
+        0x10ad95f3u, 0x36e5a621u, 0x3c5e8affu, 0x5ab75340u, 0x0be470f8u, 0xe5375ea1u, 0xe16f15c5u, 0x40f8ea31u,
+        0x739fef36u, 0x30a16c30u, 0x9791f02eu, 0xea4de356u, 0x4bd59319u, 0xd2c21cd5u, 0x5448c33cu, 0xdf3cc7fdu,
+        0x4d5675d9u, 0x1c4bb6e1u, 0xa6635437u, 0x52538178u, 0xc0b420dcu, 0x04394687u, 0xf38d82d9u, 0x39be8686u,
+        0xf211b615u, 0xdafa1425u, 0xf8fe3f99u, 0x18428b93u, 0x56a2471bu, 0x4986502cu, 0x52729df7u, 0x95bbc1d1u,
+        0x5b49fdc1u, 0xe645ebb0u, 0x9681b89bu, 0xb76c491fu, 0xe6a59476u, 0x2a392c50u, 0x72256a0du, 0xc8f154deu,
+        0xa08e6465u, 0x81460839u, 0x4ce80174u, 0xc57ebc39u, 0x18712fd3u, 0x0d8d31c0u, 0x461c7e4du, 0x12da59f2u,
+        0x9bc592ccu, 0xa57006deu, 0x0522ca92u, 0x2ab19b19u, 0x4936b7ecu, 0x8a76eb8du, 0xad2ee355u, 0x1d877a3au,
+        0x30da6735u, 0xefca0122u, 0x51efc633u, 0x34612c3cu, 0x04e8e4ddu, 0x0f3a3fdau, 0x916a1147u, 0x06c71dfbu,
+        0xdf509406u, 0x6f808ff3u, 0xbb322773u, 0x150b9f6au, 0x3c4a12cdu, 0x9e5773c9u, 0x897c3ac2u, 0x79b7af4cu,
+        0x802f248au, 0xad7ef9dcu, 0xaedbcc38u, 0x5e78d62fu, 0x683d9933u, 0x6c66602au, 0xd3df0927u, 0x852ff212u,
+        0x60ab5912u, 0xee0b50e7u, 0x7e309168u, 0x86878b3cu, 0xcdf49a86u, 0x766b0c7du, 0x6eecb0bcu, 0xdff93331u,
+        0xef37c7ffu, 0x47108869u, 0x7d1a161du, 0x4ea3ee51u, 0x0fced090u, 0xe93b669fu, 0x85db1234u, 0x6d4d1792u,
+        0xca936993u, 0xaa17a5f4u, 0xc2a84740u, 0xda558f06u, 0x539bfa70u, 0x65020dbcu, 0xb5780d77u, 0x8288fad1u,
+        0x72c57a14u, 0x2b5222d6u, 0x86be01cfu, 0xdf72a566u, 0xd02d059fu, 0x358e8145u, 0x76011fd3u, 0xf73f50ffu,
+        0x8840df7eu, 0x089ae2e6u, 0x4895c9b2u, 0x0c13e8c5u, 0x1e43f71du, 0xf36f5caeu, 0x3b7c5f1fu, 0xd62c2eafu,
+        0x8b61ab23u, 0x49789f81u, 0x7815e2b6u, 0xfebd9dc5u, 0x83ee2af4u, 0x91fde4b9u, 0xc271d277u, 0x5c5fd869u,
+        0x160077e2u, 0x8f3d13bcu, 0x5b947b55u, 0xa625b725u, 0x2c8c9bf2u, 0x4d8142ccu, 0x63ab61ffu, 0xf040b714u,
+        0x8ff6a0e1u, 0xa3283aabu, 0xd56a5196u, 0xb23d8cacu, 0xb16e13e5u, 0x309bf3bbu, 0x42d05727u, 0xb8953ff5u,
+        0x429f5a73u, 0x105ba07fu, 0x01889cd1u, 0xd19eaa42u, 0x7ca344acu, 0xc90af081u, 0x056f5232u, 0x46d0924au,
+        0x605396b0u, 0xfb39e6f8u, 0xcad9b63eu, 0x8d42b470u, 0x0b0fca12u, 0xc85dd8b9u, 0x6a7b7ef4u, 0x2a88fcf8u,
+        0x065b1b61u, 0x3d1b4f21u, 0xe16f43e1u, 0x5bec9581u, 0x02e8e813u, 0x61dc799du, 0x8178d6dbu, 0x8cd9a558u,
+        0x21377ef2u, 0x1e7ff438u, 0x3978bad3u, 0xd9d9aeb5u, 0x808b5f7bu, 0xe6c868a7u, 0x80624e43u, 0xeb93f0aeu,
+        0xb056f659u, 0x7e5aea7cu, 0x7cb12ce7u, 0xf95fa742u, 0x01f54e2bu, 0xf657c0c0u, 0x46c89b2du, 0xa8908127u,
+        0x06e48c1cu, 0x39a46ac9u, 0x7479c75au, 0x67d6e3deu, 0xa9a27bf0u, 0x805f7356u, 0x15078265u, 0x4cd9f7abu,
+        0xe728e024u, 0x83b8d4ebu, 0x44039628u, 0x05b1b282u, 0xc3d66247u, 0x0db84bacu, 0x23af6abdu, 0x68e177b9u,
+        0x04e1a340u, 0x01b27d35u, 0x5b0ae413u, 0x31c16316u, 0xbda80c9fu, 0x83d5e2ceu, 0x1999664fu, 0xeb2622b7u,
+        0x7fe75c25u, 0xf2b1202bu, 0xa836fb86u, 0x0bba93a5u, 0xf6d25684u, 0xe430ecc5u, 0xdd38cf6eu, 0xf8f0b81du,
+        0x994e44c2u, 0x0ee55e57u, 0x24c7a418u, 0x78ff719fu, 0x87743355u, 0xeeb489b6u, 0xc74feafbu, 0x4e96401fu,
+        0x2e68e30du, 0xe33b3a2au, 0x23204fb3u, 0xf9190a79u, 0x6ea77e5cu, 0x8766e8b3u, 0x847ee832u, 0xc25a623eu,
+        0xb1a1ad47u, 0x2ea5aaceu, 0x7706cbd0u, 0x35e1bc3eu, 0x9977f846u, 0xde8cc718u, 0x755e4e61u, 0x82eb8575u,
+        0xeb73fffeu, 0xf16ce6e4u, 0xf9d6656fu, 0x9ba5200eu, 0xd4a55e9fu, 0x0f66ddccu, 0xe38ebee3u, 0xaee9c3cbu,
+        0x57ddfbf5u, 0x1a58e2b5u, 0x56e43cf7u, 0xd1fbf1ccu, 0xf9f47e9au, 0xe87fe2dbu, 0x3a4cac7cu, 0x65fd58f4u,
+        0xfa855145u, 0xa3cff31du, 0x2924b405u, 0xd8caf97fu, 0x95a6f92eu, 0xb1a93573u, 0x58413817u, 0x980de74fu,
+        0xcf58a70eu, 0x52ad6fe6u, 0xe67d79a5u, 0xda69e66bu, 0x76f58a84u, 0x3a9bd46au, 0x8e7543f3u, 0x68b2246cu,
+        0x829d342cu, 0x045f16f2u, 0x8422c9feu, 0x63b4caaau, 0xecd9dc72u, 0x32ecb8bdu, 0x299e9b89u, 0x1e815c35u,
+        0xdb771f0fu, 0x49d6f50au, 0x38f12d8fu, 0x66aa3587u, 0xe3a885bbu, 0xc0a13965u, 0x39eb3873u, 0x6e937256u,
+        0x64808570u, 0x6afda34cu, 0x5de34158u, 0x4aa08142u, 0x0fd2b004u, 0x8844180bu, 0x460c9aebu, 0xdb47a3fdu,
+        0xf14c8e3bu, 0x9ed0ad8du, 0x47e33eddu, 0x9812ecfbu, 0xc2014beau, 0xb0155bb9u, 0xb377bdcau, 0xce9f1423u,
+        0xc934e849u, 0xd773a003u, 0x94a8aec8u, 0x1ca55f5eu, 0xbc0f5e36u, 0xa07cc840u, 0x4eef20cfu, 0x1f528030u,
+        0xb74736d9u, 0x433e7306u, 0x4d1a2484u, 0x99ba28efu, 0x2ed00bf0u, 0x8027616au, 0x96ea38e8u, 0x487a149cu,
+        0x2b90e3e0u, 0x71bba23cu, 0xd0de4fd2u, 0x8e4c73cbu, 0x9b252768u, 0x692535cdu, 0xeac5f4fcu, 0x31ccc2d8u,
+        0x0fd7dbcfu, 0x5465dd54u, 0xb0fa4e1cu, 0xabdbbe2cu, 0x7d48be45u, 0xb290b18fu, 0x8d63f9c4u, 0xe6da95a2u,
+        0xae431e7au, 0x8a678e02u, 0x96b85d7fu, 0xdd1be5b4u, 0xe0c472cau, 0x65307dd6u, 0x3dfa0e9cu, 0x2cc8f6c0u,
+        0xb55fc95cu, 0x91f4d506u, 0xf8837ec2u, 0xdf8a5d05u, 0x6e9652e0u, 0x00f8165bu, 0xa01c4ca0u, 0x2a7c7939u,
+        0xce2b7c5au, 0xce9ae61bu, 0x0a4b2cd9u, 0x3947334fu, 0xaaaa6f7fu, 0x6d70c085u, 0x158ee9d0u, 0x422545c0u,
+        0xf40da04eu, 0xeb832343u, 0x7c8c231eu, 0xd9a8b080u, 0xc3199985u, 0xd5d447ffu, 0x29be9414u, 0x72aa5098u,
+        0x67e48c3au, 0x03ef14e2u, 0xae32169fu, 0x390e7124u, 0x38c9c969u, 0xf6549936u, 0xca875933u, 0xcdce82b1u,
+        0xf8cbd385u, 0x1c5cc41au, 0xb6167e9cu, 0xe465db03u, 0x287db779u, 0x1d4041ddu, 0xbcdbff50u, 0x58bc5ce1u,
+        0xca793d97u, 0x4b0b7b54u, 0x50c49c51u, 0xf8472910u, 0x83c95048u, 0x46d0a4b1u, 0x8ba8ee7du, 0xa731ed61u,
+        0x381f42cau, 0xd9dd9a07u, 0x9db64181u, 0xa37a6bfcu, 0x3bb3cd2du, 0x0f165d00u, 0xd8bb13a6u, 0x10ca9a62u,
+        0x1b340c17u, 0x743d5b63u, 0x4c2cc99bu, 0xb7e034abu, 0xd8870ed0u, 0xe2091d3eu, 0xb0bde0afu, 0x435fe64bu,
+        0x137de38au, 0x220c3d9au, 0x2c1130b0u, 0xde11d945u, 0xccb1ab54u, 0x6b71b622u, 0xa774a755u, 0xa917d77au,
+        0xcd010ceeu, 0x12673666u, 0x1bbe72c4u, 0xd8f453eau, 0x2bbd4ccbu, 0x57b45543u, 0x721d2575u, 0x206d466bu,
+        0x2bcdca65u, 0x0603d1eeu, 0x62cfb811u, 0x22011131u, 0x8ba6be43u, 0x3f5a3eb6u, 0x6a575a79u, 0x6619bd31u,
+        0x55943424u, 0x726cd56au, 0x74fdcbe2u, 0x01a394f7u, 0xb98ff2b0u, 0x428af06au, 0xe5fe6f73u, 0xd0f7a6d8u,
+        0x33a7f282u, 0xa68c57a1u, 0x012e277au, 0xad16a7a4u, 0xf49c1057u, 0x887d6213u, 0xc0fed5b5u, 0x901ec086u,
+        0xcf5106f0u, 0x2191a725u, 0x291b8fd3u, 0x2ace4d49u, 0x76730c7bu, 0xd6f00379u, 0xfd9d764cu, 0x61a809e7u,
+        0x38bc6150u, 0xe361efd5u, 0xcadba839u, 0x69ea047eu, 0xd3184542u, 0x23d21a2du, 0x13e8c60fu, 0x1ad65cadu,
+        0x3b888bd6u, 0xd967510eu, 0x6863398fu, 0xe4decb98u, 0xce66547au, 0x2a04e563u, 0x3621cbc2u, 0x00000000u,
+    },
+    { /* 2^140 */
+        0x7e64c057u, 0x7d143f44u, 0x95c4d5a1u, 0xd0d43eb8u, 0xa6aae5afu, 0x88ae69beu, 0x87b9f041u, 0x5746731bu,
+        0x29d3c2a4u, 0x65f72a22u, 0x7fe82869u, 0x7f6e27b1u, 0x50f13552u, 0xccde12adu, 0xe587e48eu, 0x76f29214u,
+        0x04993d63u, 0xd0b3c585u, 0x9a3ea429u, 0xa9321c34u, 0xa3388b98u, 0x6f5a2659u, 0xee07ec34u, 0x4333eed6u,
+        0x68b51bfbu, 0x44fbe541u, 0xbfb9fcfcu, 0xdbbae6d3u, 0x666a02c4u, 0xc8c58865u, 0x1af47b96u, 0xc3c13c61u,
+        0x496de9f9u, 0x514c7493u, 0xdcb7a531u, 0x71f09faeu, 0x2a7c9682u, 0x6f64c45au, 0x2fb2eb76u, 0xabcf8684u,
+        0xb4eab7dcu, 0x3f1297aeu, 0xe8203e83u, 0x938bdbfbu, 0x19d183f8u, 0xc4a6c13fu, 0x716293b1u, 0xc4a473b9u,
+        0xd943d8c0u, 0xa1a52c70u, 0xdca619d5u, 0xac21fc1fu, 0x17fb30bdu, 0xe92678e1u, 0x5b15eec3u, 0xd3dce264u,
+        0x784dd582u, 0x00cf2f41u, 0x89df68b6u, 0x13ddfd88u, 0xb5a8eb37u, 0x4db7ad1fu, 0xc30cd0ebu, 0xa4a238e3u,
+        0xb7f04913u, 0xc263f7a2u, 0xb6fa39d6u, 0x750abf6cu, 0xda7d5264u, 0x4b71dbceu, 0xc4ec068bu, 0x31cdf2b2u,
+        0xc12c3a48u, 0x4d046078u, 0xb38a1d42u, 0x1596d449u, 0x00c22a15u, 0x3bbeba01u, 0x5f973771u, 0x92289fd6u,
+        0x01ea75bcu, 0x16dcd416u, 0x3e2fbf75u, 0x134f2807u, 0x266ee130u, 0xb5031643u, 0x85629b70u, 0xfbc75072u,
+        0xae61516bu, 0xa15cc9deu, 0x01e2125cu, 0xc91b4dbcu, 0x397df667u, 0x3a2546a9u, 0xaaee0fbdu, 0x20d9ed8cu,
+        0x131ca43bu, 0x44a7537bu, 0xc40a5b99u, 0x00ff897du, 0xa0be1d4eu, 0x53633d14u, 0x7a331eebu, 0x5eb0466eu,
+        0x80ffd87cu, 0x27a21ca5u, 0x228bc62bu, 0x529853cbu, 0xff679d8fu, 0x83c82147u, 0x1ba9ec70u, 0x471f64bcu,
+        0x7a66ec51u, 0xbcf03d44u, 0xbd89253au, 0xbedad3c7u, 0x58e5529cu, 0xa258b57eu, 0x911310c0u, 0xff6aa804u,
+        0x9fe9a215u, 0x9c67e269u, 0x2819329fu, 0x88e2c19du, 0x90098a8bu, 0x7cbbee18u, 0x2167f8ddu, 0x4c6bda04u,
+        0x901458dcu, 0x280530a2u, 0x3216baa0u, 0xf5589583u, 0x86780fc3u, 0xacb9eab8u, 0x5a500e23u, 0x584a4de1u,
+        0x2849abc4u, 0x17589f7fu, 0xb4d39ad3u, 0x8f72cd15u, 0x8483681cu, 0x7de571e4u, 0x03a6dec0u, 0x05c52291u,
+        0x9435adffu, 0xce3c04beu, 0x414dd9edu, 0x454ce02cu, 0xc3e1f66au, 0xbe654710u, 0x40768ff5u, 0x3fc18ac7u,
+        0x76dbeaeeu, 0x71a7b6c3u, 0x202eaa39u, 0x69926170u, 0x293b27b3u, 0xeab786e1u, 0xdee82eb1u, 0xbcb2a457u,
+        0xc0e9bfedu, 0x48d665a1u, 0xad12f206u, 0xb0651963u, 0x1329cbdfu, 0x04d7a65eu, 0x8b05da20u, 0xbfa39b62u,
+        0xce0dc702u, 0x44ef7f9eu, 0xd2f68f96u, 0x9537f1c1u, 0x943a86ffu, 0xbc7e8de8u, 0x0fbff69eu, 0x694d74ffu,
+        0x436563bbu, 0x1a955c0du, 0xc17d7edau, 0x1ac20b72u, 0xbc2ee863u, 0x361cc460u, 0xb27153dbu, 0xfcc580dfu,
+        0x99650255u, 0xd57b1b02u, 0xad850790u, 0xf549fc86u, 0xb72c3af7u, 0xbbd9b31bu, 0x7dc775b2u, 0xcae47f87u,
+        0x3c90cff3u, 0xd508c7bdu, 0x56b8bea0u, 0x1d9df9eau, 0x2e33a7e5u, 0x225b916fu, 0xf4288cbdu, 0xa5fcf93du,
+        0xcd2c25b0u, 0x175e8bdcu, 0xf27087aeu, 0x62f2673au, 0x5d98bee5u, 0x8e387c27u, 0xd7c73b0eu, 0x7893f7bdu,
+        0x59064735u, 0x0cdfdcaeu, 0xf095ba8au, 0xfa1f5c51u, 0xa0dea28au, 0xc5af3449u, 0xbbe8d3c7u, 0x8cd7a5dfu,
+        0x733634a5u, 0x9d298c1eu, 0xe5eb9043u, 0x8ede7693u, 0x49955c2bu, 0x67844f29u, 0x5b1679a8u, 0x18a8b473u,
+        0x376f9e9du, 0x65c99ceau, 0x3c975415u, 0x41481546u, 0x067b12a0u, 0xbe9bc243u, 0x57269be4u, 0x3c8b6064u,
+        0x0994f80bu, 0x79cf82ecu, 0x09d7e778u, 0x5b148b97u, 0x4a67c5ffu, 0xe01b24afu, 0x08f8e3a1u, 0x78a9ae19u,
+        0xc3cbdc22u, 0x91a57873u, 0x4d190700u, 0x17f6f59au, 0x3e57c83du, 0xef064dbfu, 0x443d6811u, 0x0961954du,
+        0x494ce3abu, 0xf7797ccfu, 0xc7ffa17cu, 0xdc61d244u, 0x111c96ccu, 0xec3abef3u, 0x03ee4e72u, 0xada92c51u,
+        0xef16d178u, 0x0bfef7b4u, 0x86fa27d9u, 0x83af11cbu, 0x0c7326b0u, 0xb58ab3f0u, 0xb7cf1e90u, 0xa07d7c70u,
+        0xb5bf945au, 0xec8c4747u, 0x887e3565u, 0xc47e9a0au, 0x4c482f27u, 0x8333c122u, 0x7b2f1b11u, 0x066603bbu,
+        0xc20f01b7u, 0x73fe02c1u, 0xb53e5440u, 0x16038e15u, 0xbef8cd40u, 0x5a7a8fe5u, 0xd07b774fu, 0xdab00b28u,
+        0x85f2fbcfu, 0x773a6e96u, 0x036a5a78u, 0x26b44abcu, 0xeebbb669u, 0xc4aa0946u, 0xbc7b7106u, 0x73705991u,
+        0xc987791du, 0xbeabf3cfu, 0x5ecf5436u, 0xa0a62a77u, 0xd1bf379du, 0x1d49df9au, 0x27e9db71u, 0x50225d2au,
+        0x33362a33u, 0x7c978db9u, 0x3e7cb24au, 0x4ea1ce50u, 0x9c51c902u, 0xeab87b65u, 0xe0b0acbau, 0x37aadc73u,
+        0xa512cae7u, 0xae6cafe0u, 0x0a6b714bu, 0xb688b24eu, 0x5f64ad09u, 0x75e6112au, 0xed7b0ea8u, 0x52b2396cu,
+        0xa70a19dbu, 0x706335d5u, 0xb61c5744u, 0xab949aebu, 0x6e68a264u, 0x12943cc7u, 0x42a13381u, 0x71e99390u,
+        0x43aa28f1u, 0xd85c2193u, 0x0dd5a5e5u, 0x16ccbf98u, 0x07dfd722u, 0xeab59340u, 0xa27431f8u, 0x4ca419e9u,
+        0x04555669u, 0xc6824f71u, 0x1b3cb652u, 0x4b725bd4u, 0x63b34fc1u, 0x6efbce63u, 0x5178fd82u, 0xcc7d843cu,
+        0xa968fbfbu, 0x8ae76d1du, 0xa6969269u, 0xe43080efu, 0xa6754a75u, 0xac2c9fc1u, 0xb5a3de7au, 0xd603ca39u,
+        0x5c898223u, 0xf3d633ecu, 0xe641c597u, 0xafb7eedeu, 0x33edffc1u, 0x91795bc1u, 0x2730bc84u, 0x72a440a8u,
+        0xf4b60a39u, 0x2c72c98fu, 0x7e438e5au, 0x556eb02au, 0xeb552bb9u, 0x6482ebf6u, 0x9df570fdu, 0xc672359fu,
+        0x69d5a391u, 0x08c7d467u, 0x96741bb4u, 0x32a34107u, 0xf4a24ccdu, 0xfa728ce9u, 0x29375942u, 0xac2dc60au,
+        0xe7cd6e40u, 0x740a3230u, 0xf8915b12u, 0x1f7d0ed2u, 0xa493f246u, 0x3a2a89e5u, 0x05034552u, 0x23fced46u,
+        0x62d57ed3u, 0x0afdc33cu, 0x1e0e807au, 0x62d3064eu, 0x259857c9u, 0xab187679u, 0x2d565833u, 0xe4392a65u,
+        0x57bc879bu, 0x76111d03u, 0xa2e6a2eeu, 0x5e83eb17u, 0x556840c6u, 0x4d80daedu, 0x7999fd21u, 0x61a6e49bu,
+        0x15b99efeu, 0xf8690117u, 0x500fd0d6u, 0x7519458fu, 0xd9c0420du, 0xf6e138d1u, 0xa8870256u, 0x2f0a1076u,
+        0xe8c92e12u, 0x9bd59cbau, 0xa76b0a14u, 0x8e3d5656u, 0xe703b514u, 0xed819eedu, 0x140b8727u, 0x40433003u,
+        0xa4fe1659u, 0x86036fe5u, 0x6d0c15e9u, 0x526f9f48u, 0x3fbb3c33u, 0x7326d203u, 0xb93598ccu, 0x2753387au,
+        0xc659e5e9u, 0x812228d0u, 0x4dfd7391u, 0x86c37b85u, 0x1478e9b3u, 0xa565d389u, 0x096afd33u, 0x9d8e6945u,
+        0x9cda7bf8u, 0x54bfa1e4u, 0x9c83c91du, 0xf1c252d1u, 0x0c25e9d4u, 0x9714b24bu, 0x71dc02c1u, 0x45d4de64u,
+        0xd8c0db6du, 0xc46e3001u, 0x4931d703u, 0xc3e559f5u, 0x43b34923u, 0x264e7e84u, 0x98beaf1fu, 0x2f46b726u,
+        0x31c7629bu, 0x09d37194u, 0xe5571f89u, 0x965f97f1u, 0xd67dc363u, 0xa3e1ad7du, 0xe618aa65u, 0x1b253755u,
+        0x107c1fd6u, 0x96b15cf5u, 0x9d95b952u, 0x4d6ea1d8u, 0xe822e95du, 0xa4bf634au, 0x632c8f93u, 0x62e824f2u,
+        0xc192c244u, 0x087560d8u, 0x488e5adeu, 0xb7b42d6du, 0x2e7c49fau, 0xafee6c6fu, 0x3eeb1588u, 0xd67fa1a2u,
+        0x4a00744fu, 0x3b35b920u, 0x95be6da0u, 0x81a8b221u, 0x78c741bdu, 0x9891b397u, 0xf1ff8347u, 0xf77e0db3u,
+        0xb9cc519du, 0xec3be764u, 0x62c36adbu, 0x9a02e8b6u, 0xa564a62au, 0x4c11c835u, 0x70194cdeu, 0x5c4ba336u,
+        0xa24b0cbau, 0x6a246337u, 0x39949b92u, 0xbd04aa6fu, 0xf3a496e7u, 0x83467a16u, 0xae594361u, 0x0c162198u,
+        0x47e275dfu, 0x94e16020u, 0x4b9ea5afu, 0x98b87581u, 0x1f509466u, 0x52529859u, 0xd3aab44bu, 0x4d5a51bau,
+        0xe11283f3u, 0x633f170bu, 0xe23d0e04u, 0x0352022du, 0x592577a5u, 0x9b158681u, 0x2983d01du, 0xd6fa47e8u,
+        0xd52adb8au, 0xdacaff23u, 0x8f3db259u, 0x0a528984u, 0x8bfa53a6u, 0x130e6ab1u, 0xe9272153u, 0x1416397fu,
+        0xc7a20199u, 0x0e2db4a8u, 0x5f9aeaa1u, 0x8f1402c4u, 0xa0b49854u, 0xd67c89f1u, 0xbd860347u, 0x27d9dc7eu,
+        0x8c995e19u, 0x60b35794u, 0xbe998c8bu, 0xffe1e7c7u, 0xc43f670du, 0x664a12d8u, 0x38c5ab81u, 0x7f7b8122u,
+        0x6a892449u, 0xdf62c898u, 0xae2887a3u, 0x1d454db6u, 0x35e4f296u, 0xcc072c0bu, 0x937dc812u, 0x27f614e4u,
+        0x165be47du, 0x433a9defu, 0x38ac381au, 0xf997d0f8u, 0x3096a0d9u, 0x36a867e7u, 0xf8bb855du, 0x48895546u,
+        0x35ea2dcfu, 0x2b5b59b3u, 0x4d96cd01u, 0xa5bd03f6u, 0x3641ed39u, 0x63fbb2e9u, 0xd1c9f6f6u, 0x72e91983u,
+        0xbfd99773u, 0xb7a0e0d2u, 0x2b817cbcu, 0xeaad1730u, 0x9d7851e5u, 0xfd4a189fu, 0x2a071f34u, 0x25f98024u,
+        0x1f9b6043u, 0xc3835ef4u, 0x5844118bu, 0xf01b8fc0u, 0xff62372eu, 0x9c612b30u, 0x662ec618u, 0xb61623b9u,
+        0x620427cbu, 0x71e0f556u, 0xd626d89bu, 0xaf403e0fu, 0xf931de3bu, 0x9c4a0d2eu, 0xb1f7ab0du, 0xbcc378eau,
+        0x44285a9au, 0xe4d08630u, 0xfda8b81bu, 0x43988a0fu, 0x27c5dae6u, 0xc2ae92ddu, 0x6e22e360u, 0xdfd9b334u,
+        0x9938f394u, 0x2f87b206u, 0x548de443u, 0x785fffb4u, 0x2c10d23du, 0x77679f56u, 0x1c750d3au, 0xf689fcc8u,
+        0xbb44fb75u, 0xf0e2621cu, 0xd2acfeddu, 0x2d926f3fu, 0x08f0dbfbu, 0xd7278ecau, 0x32f84d1fu, 0x50fd8a2cu,
+        0xbff195d2u, 0x33dda25fu, 0x2cd6fe81u, 0x08b8e02eu, 0xce9279aau, 0xcdc48e71u, 0x9966ef71u, 0x4ce1f147u,
+        0x8f96226au, 0x83ef0555u, 0xc23a41feu, 0x0a007d28u, 0x8622b8d5u, 0x2dc97fa1u, 0xf559e576u, 0x832e171du,
+        0x56cfbfc0u, 0x1f0a770fu, 0x08a22fe7u, 0x6a58b905u, 0x987be687u, 0xe110fa0fu, 0x883248d1u, 0x00000001u,
+    },
+    { /* 2^141 */
+        0x734e0535u, 0xe3f67aa9u, 0x6aea54ddu, 0x57d2f81fu, 0x376886a1u, 0xadf1b5f2u, 0x5fac90b1u, 0xe78a6d3au,
+        0xcc6ff6a5u, 0xb1d921c6u, 0x36c0110cu, 0x32b933a5u, 0x03fae8fbu, 0xf743d647u, 0xb758b71cu, 0x34e21a9au,
+        0x2f546a49u, 0x6696a32du, 0xbbc1591bu, 0x14006a4eu, 0x6244e8b4u, 0x74740315u, 0xa9e154a8u, 0x06ac1368u,
+        0x3f6c32d8u, 0x3450cad7u, 0x25963179u, 0x6b162be1u, 0x4f7d81d6u, 0xc330dc68u, 0xf01b5e9fu, 0x85578336u,
+        0x9dc80569u, 0x89e985efu, 0x7084f30au, 0xec3d743bu, 0x88b4036au, 0x09248e37u, 0xa7e50998u, 0x92ab1500u,
+        0x60248d4eu, 0xa372f986u, 0xc2395a9cu, 0x3c79d3c2u, 0x7802a5a4u, 0xa3a62cdau, 0x1c366cb0u, 0x18464f11u,
+        0xacfc7a2au, 0x19dd498eu, 0xe8bf6ed5u, 0x4038bc74u, 0x3db222adu, 0xb4d41efeu, 0xb22fed4du, 0x6821163au,
+        0x0f6bf1aeu, 0xb9593b72u, 0xdddeb31du, 0x1bff8594u, 0x6c4daa3eu, 0x21753b4du, 0xe109cd5du, 0xbdcfc0b9u,
+        0x2d593a4du, 0xa3b7c3f8u, 0x6c20490eu, 0xb23d9fd9u, 0x5b232b12u, 0x9234dfaau, 0x332fff3cu, 0x6b7bf672u,
+        0xfc7465acu, 0xa95e137fu, 0x7602d678u, 0xa386749eu, 0x61c15442u, 0x2f1d3063u, 0x2ae4695bu, 0x4335c065u,
+        0x61d887afu, 0xafe2dbb0u, 0x8dc3fb07u, 0x1dae0d0fu, 0x0d9754c6u, 0x5a2f07f4u, 0x9b0522f3u, 0xc1c6e20cu,
+        0x4423303cu, 0x8b83be65u, 0xb983cd5au, 0xc350500bu, 0x2da6210du, 0x3c424e6fu, 0xe30872c2u, 0x9e8e82d8u,
+        0xb72b4c09u, 0xdec93ef4u, 0x7dec6137u, 0x14fda7e3u, 0xceb7d643u, 0xf1c45245u, 0xda383d50u, 0x22c560cfu,
+        0xba4a8ebfu, 0xc4b8f7a8u, 0xc6fefd3eu, 0x1fb72af1u, 0xeb5da930u, 0xdf6a945cu, 0x2ed6eeacu, 0x359895d6u,
+        0xb381de5cu, 0xa67e26d4u, 0x0605d009u, 0x28a68fd3u, 0x4cda131du, 0x99a3393fu, 0xc892ff21u, 0x7c01c7f3u,
+        0x8ac0afe3u, 0xa404e247u, 0xc8e6abbdu, 0x9da11070u, 0x23a531cbu, 0x3d9467ceu, 0x6e637091u, 0x70c5795cu,
+        0x02ed9893u, 0x3cc3c849u, 0xf07f9b68u, 0xd1a3c124u, 0xc4640377u, 0xd8570b6au, 0x3327dc5fu, 0x3594097cu,
+        0x59f4fd77u, 0xc2b1cc68u, 0x9d8798e2u, 0x279fd192u, 0xd9b2e9d3u, 0xf78b4163u, 0x903a12abu, 0x8c42ea48u,
+        0x7fd6426bu, 0x8da38798u, 0x3f4cfcf1u, 0x7d9b47dau, 0x0f3a91bcu, 0x343d32a0u, 0xd8b97eecu, 0x2d41e0ddu,
+        0xb5779043u, 0xadc3c12cu, 0xd3c8778eu, 0xa0a83006u, 0x64e3a4f0u, 0x3c05a625u, 0xcd92d6cbu, 0x0ddfaf90u,
+        0xdf0d6c1fu, 0x34d96f21u, 0x933d52bbu, 0xcaabeb30u, 0x3640f950u, 0xe13e2444u, 0xb387eab2u, 0x11b1c775u,
+        0xa4064e7cu, 0x0617c0d2u, 0x9aa0b412u, 0xf7cf1373u, 0x6e7487bau, 0xcde5b76eu, 0x8f44ce02u, 0xefaf7c70u,
+        0xb5490b61u, 0x28faf835u, 0x9ca7f98bu, 0xa7261519u, 0xa95ea0cdu, 0x477ad28bu, 0xc9dfcb3cu, 0x47c20346u,
+        0xfe6d4d9au, 0x1bf8ee44u, 0xa1583889u, 0x119cc8fdu, 0x4c21c9c1u, 0xd7830842u, 0x58c13caeu, 0x41fd4fa2u,
+        0x0d1e92d9u, 0xd6003889u, 0x5a6f33f5u, 0x32c08ed1u, 0x2b367307u, 0xd0a3276eu, 0xc4965c25u, 0x1c68b5ceu,
+        0xac562f32u, 0xd55dcf4bu, 0xa4122ab7u, 0xd35e1d45u, 0x0aaea9bbu, 0xd00a08a9u, 0xb4936253u, 0x7dad301du,
+        0x0a7b21eeu, 0xbd1ff55au, 0x16415b42u, 0x52e93408u, 0x2def6893u, 0x516c0b50u, 0x0c364a1au, 0x1df8dd8eu,
+        0xa12885d4u, 0x6298ce91u, 0x287e2cecu, 0x2414f031u, 0x0f35f046u, 0x41c50525u, 0x7401f325u, 0x0390554bu,
+        0xa68ed4ebu, 0x0ae5c156u, 0x66718be0u, 0xc1a9ea38u, 0x49321a6au, 0x44b43eb6u, 0x16cf6101u, 0x0f04ee5du,
+        0xbda5874bu, 0xdefa8312u, 0xc45fb0c2u, 0x7d8ca000u, 0x6858c354u, 0xfa78a9d9u, 0x289587a6u, 0xeaab3ef1u,
+        0xb7a97813u, 0x4580fc24u, 0xf3631dc8u, 0x9f547240u, 0xabbe61c0u, 0xe4ed25a2u, 0x6d2386c2u, 0x66ba5c98u,
+        0xeac3e528u, 0x5a3f5194u, 0xbe608a31u, 0x609d848au, 0xf1c592c8u, 0x318c229eu, 0x89c7366cu, 0x6c895d64u,
+        0xdb55cfb3u, 0x1adbeabeu, 0x32b97792u, 0xb3aed7f1u, 0x2664eb92u, 0x860ad68eu, 0x73ba7ba5u, 0x4e51bd44u,
+        0xbfda0c0cu, 0x7550d201u, 0xd76c6e43u, 0x1ae925fcu, 0xfb4c8802u, 0x44605c9bu, 0xa4ae70bcu, 0xd665dccdu,
+        0x461b76d6u, 0xe3c8c128u, 0xb956b64fu, 0x11946a87u, 0xd2e25f3cu, 0x2bab5c72u, 0xb2866061u, 0x19ccdaafu,
+        0x295662ddu, 0xde5c47efu, 0xf1c5d8e7u, 0xc7280d8du, 0x218dcaaau, 0x6c23af26u, 0xce0acd04u, 0x842e2b64u,
+        0x2c0c7372u, 0x56053edcu, 0x54c8f006u, 0x001e75c9u, 0x14d03932u, 0x2da70119u, 0xe6522375u, 0xd6a48eccu,
+        0xac9a683au, 0xf7190e7fu, 0x4fe70a1fu, 0xc33516e2u, 0x9b17c1f5u, 0x4c5173bfu, 0xbe7ad5c2u, 0x931a52efu,
+        0x3a8af021u, 0xa37fdaccu, 0x505858dcu, 0x6fdc25ceu, 0x5eaea52bu, 0xac0bfa0au, 0x3538e296u, 0xd116c4b9u,
+        0xee08e9a8u, 0x230af2eau, 0x2872dc33u, 0x5a0224a1u, 0xb8288495u, 0xe4c4ecf7u, 0xaf774f82u, 0x385b5fdbu,
+        0xed7d6d9eu, 0x34190048u, 0x6f0d9d05u, 0xf76c23b6u, 0x6dda398au, 0xe6685fa4u, 0xdd7f6f9fu, 0xc205675fu,
+        0x860f1876u, 0x1336fdecu, 0xe2ba36c9u, 0x3d361244u, 0x06e718f8u, 0xe48af623u, 0x5c9ade56u, 0x0921edc8u,
+        0xa84d077bu, 0xdb2bc5b2u, 0x45657b20u, 0x1bedcae1u, 0x72bcc319u, 0x0177436au, 0x61615a6fu, 0x1e982268u,
+        0x2de855b1u, 0x239e908fu, 0x086d0262u, 0x266ee09cu, 0x68523949u, 0xc4654b1eu, 0x8f821a62u, 0xd5c0086cu,
+        0x401e7f4au, 0x47ba421bu, 0x7ff32981u, 0x7ba2fa6cu, 0x973dcbe5u, 0xa84e3019u, 0xeea2c7b8u, 0xb2ab3088u,
+        0xfce4ba21u, 0x62767cf4u, 0xbedfa273u, 0xd4052734u, 0x16aa730au, 0xdea60d16u, 0x48f8c02au, 0xd9d2974du,
+        0x4d0f1d63u, 0xe122c572u, 0xa92932f2u, 0x0517a566u, 0x4a770444u, 0xc65494deu, 0x4dce7018u, 0x65a06418u,
+        0x63fd855cu, 0xde80a684u, 0x8d80db3eu, 0xf73be0e8u, 0xa5be0d3au, 0x744b5801u, 0x6f74a2fdu, 0xb25cc718u,
+        0x9e050c3du, 0x64ce4a67u, 0x6fa2ce38u, 0x624543adu, 0xc6ca5287u, 0xa272f49eu, 0xdff7ce30u, 0x9e36882fu,
+        0x70e0ccf8u, 0x7e5e6c09u, 0x65e7730du, 0xb7a6c1afu, 0x7e9df438u, 0x326af274u, 0x39447816u, 0x11aee160u,
+        0xbae518c6u, 0xc53f589du, 0xc6cde1f0u, 0xe6b011a0u, 0xb984cc2fu, 0x1e28a89eu, 0x0c6f7ff4u, 0x1392cb67u,
+        0xc4842710u, 0xece5f083u, 0xa54c5773u, 0xe35bfc05u, 0xa00937c7u, 0x014a0559u, 0x37120303u, 0x3806e4ccu,
+        0x3003dc5cu, 0x2666e679u, 0x579ec4efu, 0x9aa5f7f4u, 0x01b2865du, 0xeaee1f29u, 0xd231aa16u, 0x3f1b75b0u,
+        0x3f65e825u, 0x96d40d48u, 0x092e20dfu, 0xd1b31c5au, 0xe8843474u, 0x51131bf0u, 0xdef2acd0u, 0x55b98a06u,
+        0x48003c4au, 0xedbb1564u, 0x7b9e9d63u, 0x3f2bb26au, 0x06319b89u, 0x6e60f980u, 0x4be18736u, 0x61cb6473u,
+        0x7e1dc242u, 0xf61a30b7u, 0xf7cbffbau, 0x181a22e3u, 0xb39cbce9u, 0xc17e6bdcu, 0xecdd064fu, 0xf55a015cu,
+        0xd07f38b6u, 0x2b92138eu, 0x149f481bu, 0x9905c335u, 0x62042296u, 0x5a3fb8a9u, 0x208c94cdu, 0x81ebe0a3u,
+        0x22c311ceu, 0xd562e243u, 0x4e8881a4u, 0x1fd49912u, 0x338d2a02u, 0xba9cd461u, 0x607e8d22u, 0x515d2364u,
+        0xf2dc9d25u, 0xffb0eb18u, 0x17c4a3e0u, 0x959a308au, 0xac861704u, 0x08dcec91u, 0x05ce26fdu, 0x2b71507cu,
+        0xb7563018u, 0xabe2f355u, 0x62ee0c16u, 0x8f800adau, 0x7991a58cu, 0xd0ceae19u, 0xbbc08df4u, 0x2e887901u,
+        0x25211b67u, 0x05db3a2eu, 0x0e092b78u, 0x962b07a2u, 0x797b9a12u, 0xd81cb3ceu, 0xabc11242u, 0x55275444u,
+        0x61123bd9u, 0xa8ee4fadu, 0x95e5c516u, 0xd1408aafu, 0x4dc7698eu, 0x5953e800u, 0xa956e5f9u, 0xaa4780deu,
+        0x05a233bbu, 0xd712fbe7u, 0x19ed090fu, 0x4291a660u, 0x05bd148bu, 0x45ae917fu, 0x10d9ef1eu, 0xaf56c135u,
+        0x2660d4d5u, 0x6f589b84u, 0xb0063badu, 0x6a5304e7u, 0xb933faf6u, 0x4b4db95cu, 0xfeafb73fu, 0x88d303d8u,
+        0xabc9b956u, 0x9b0fb6b6u, 0x448cd7a4u, 0xe97d3425u, 0x622876a7u, 0x9f0a0d84u, 0x3fe5c284u, 0x25ead7e5u,
+        0xec22a0bau, 0x27057052u, 0x6b7d8b89u, 0x669f42d3u, 0x89c84c53u, 0x8c79d872u, 0x2bb58be5u, 0xbbc55736u,
+        0x2104b38du, 0xfcb50427u, 0xe7e1dbc4u, 0x206cc078u, 0xfa84fa8fu, 0x60627658u, 0xdbc58396u, 0xe165585au,
+        0x2c6e8ccdu, 0xb3d3acd4u, 0xd4122674u, 0x887da965u, 0xa87062f1u, 0xa0d9a090u, 0x5bc8f2a5u, 0x3449928cu,
+        0xe48afbacu, 0x24f19922u, 0x88ba98d4u, 0x8494c15eu, 0xa6b58e83u, 0x06fc26e3u, 0xeb1be134u, 0x9b5ef1fau,
+        0x0c029d50u, 0xa359f1beu, 0x285096b1u, 0x22758059u, 0xe8cd8b62u, 0x3aa621c7u, 0x4543bf28u, 0xec813edeu,
+        0x11b3934du, 0x38cd0594u, 0xcf9ef366u, 0xc2b9456eu, 0x6ff6338fu, 0xdf4a5a2cu, 0x1f5d5945u, 0x3d54f3e1u,
+        0x975b99bcu, 0x7029f233u, 0xe4a60308u, 0x1d0d911du, 0xd631e8b1u, 0xb0260ebdu, 0x6cd29791u, 0xa15962c2u,
+        0xff6e6240u, 0xf76985e8u, 0x097722f3u, 0x12288396u, 0x06fdbb0du, 0xb2088539u, 0xec004a5eu, 0x4b4a25fau,
+        0x7ff61c70u, 0x63b4c5a3u, 0xc0eaabf4u, 0x8fcddcedu, 0x475797b8u, 0xa748f51au, 0x8c95af0du, 0x42fbd6b9u,
+        0xe374d681u, 0x78282516u, 0x6c38ffecu, 0xb79c9a5cu, 0xcd14cc02u, 0x108207d3u, 0x246163a3u, 0xdfa16905u,
+        0x2d043f37u, 0x202cb60eu, 0xd3a44ae9u, 0xbee4685bu, 0x4a78897bu, 0xf00db5e4u, 0x2f42b5adu, 0xd8f0ef27u,
+        0x65bae694u, 0xd68cc7cbu, 0x2928e830u, 0xe3ddd8e2u, 0x641e55bfu, 0x97d06c7cu, 0x2eb55aaeu, 0xab462ec4u,
+        0x2ba214b1u, 0x03e64fc2u, 0xdfc5a51bu, 0xfe25dfffu, 0xa03187f9u, 0x41cfc78bu, 0xbbda8818u, 0x00000001u,
+    },
+    { /* 2^142 */
+        0xfa64d493u, 0xe07dbd9cu, 0xd6fd9a08u, 0xfba1cc53u, 0xb147dcd2u, 0xa37cc1aeu, 0x9837bbf9u, 0x9bb1819au,
+        0x1577cb35u, 0x6b00994eu, 0x1087e835u, 0xcd73e441u, 0x120dc08au, 0x61a967afu, 0xec971744u, 0xfe0e3fcdu,
+        0x7be28c1eu, 0x2afe1c41u, 0xef669285u, 0x64a38400u, 0x4390cc86u, 0x55bbace5u, 0x77da3241u, 0x1d0e393eu,
+        0xee435aadu, 0x3c8ebb14u, 0xeef46484u, 0x658895dau, 0x9c754cc3u, 0x2cc8c289u, 0xe9ef65dbu, 0x3df710d8u,
+        0xe018b49au, 0xdff32160u, 0x745d60beu, 0x68bf1be3u, 0x486bf583u, 0xda5df93au, 0xcb9c6c66u, 0x59d675bdu,
+        0x1d83d219u, 0x4ede24cfu, 0x915474e1u, 0xa5aef24du, 0x3ecfbd6bu, 0x06a53538u, 0x8898b326u, 0xfbf71cacu,
+        0xc1147ca7u, 0xcdc2e1a6u, 0xb6825ce1u, 0x1b8de5a7u, 0x25f09091u, 0xb02349ceu, 0xf68232a5u, 0x846cfd22u,
+        0x1434b90au, 0xfb32c19bu, 0xd18cd539u, 0x062dbe92u, 0xb0d7fe77u, 0x9f0d8975u, 0xb09de619u, 0x5d4fdb7du,
+        0x8822a973u, 0x0c2c6519u, 0x9213c763u, 0xb5900ffdu, 0xaba00493u, 0x41654044u, 0xf1b4e09cu, 0x118bc9e9u,
+        0x5a440279u, 0x18f4720bu, 0x3c0331a7u, 0x6a6509cfu, 0xa79a36c0u, 0x2f6bb4f0u, 0x21b42e75u, 0x03340504u,
+        0xd80934edu, 0xb5b85b77u, 0x2128f4fdu, 0x1addd0a6u, 0x35f17508u, 0x37234da4u, 0xbf6a157du, 0xd5dcc0a8u,
+        0x07b88eaeu, 0x478ed957u, 0xf56f9700u, 0x83b6de9fu, 0x847c0467u, 0x5d74abeeu, 0x3252eb98u, 0x95e4f749u,
+        0xd08863a3u, 0x0311e42fu, 0x1a5275eau, 0x46ac8184u, 0x848c5e47u, 0x2716f675u, 0xae2e9d7eu, 0x12038ac1u,
+        0x34030744u, 0x31e027a2u, 0xeabbc44fu, 0x739facc1u, 0x1d1b743cu, 0x8d333111u, 0xa839a09au, 0xa1aec92bu,
+        0x4536ed7eu, 0x0d6f17d2u, 0xfd0fcd80u, 0xbfd2899du, 0x8a9eb20au, 0xf494d674u, 0xc664802cu, 0x0cc67368u,
+        0x28285c58u, 0x64cee518u, 0x75668f88u, 0x82c89c4au, 0x3c9a53b1u, 0x9473d9fau, 0x32fc4e22u, 0x741555c2u,
+        0x16a1cf3du, 0x9f3709e4u, 0x862ee3a5u, 0xa068e734u, 0xbda604c7u, 0xdc3450cau, 0x46520fb5u, 0xcf27b57au,
+        0x4e748213u, 0xfb4b5608u, 0xc76d6684u, 0x1c191c10u, 0x8c34f85eu, 0x01cd6d48u, 0x8bae9f12u, 0x02800b29u,
+        0xa8b3e60du, 0xd93a652au, 0x4aaa9feau, 0xba1410c9u, 0xef337bd7u, 0x3651f879u, 0xf8df6c5au, 0x74eb21c8u,
+        0xa61cc906u, 0x0f1a9363u, 0x572a9fefu, 0x9c44845cu, 0xd06c7728u, 0x5910c052u, 0x46733f8fu, 0x499f771bu,
+        0x944c4cb2u, 0xb2ac6b2eu, 0x1a47eeebu, 0xfce80c34u, 0x7b2572b7u, 0x77bdc6a3u, 0x35ba0564u, 0x39db8334u,
+        0x731b40f6u, 0x58014253u, 0xeff990eau, 0xa0e4a788u, 0xde9d6732u, 0xcf52a971u, 0xf0acef79u, 0xc85f7b32u,
+        0x89942801u, 0xd911850fu, 0xab95593du, 0xc1e23e13u, 0x22dba3dbu, 0x30fef37bu, 0xc3a1ce1bu, 0xf3286964u,
+        0x9489fd1au, 0xa708af88u, 0x89ca460bu, 0x8a73204au, 0xde31d530u, 0x70256c1bu, 0x7efc05f3u, 0xda067904u,
+        0xbc9fe30bu, 0x491128e2u, 0xee9175deu, 0xe474e507u, 0x6c9a6993u, 0x7eaf7e3au, 0x338367a5u, 0xfb7ae5dcu,
+        0x36e3e4f8u, 0x688ca6a2u, 0x4a9b7ff3u, 0x2bf9ba82u, 0x5776d5f4u, 0x87b41ae0u, 0xde2d3d60u, 0xf100463fu,
+        0x4916db02u, 0xc8dc06dfu, 0x565b71e7u, 0x2f0501d0u, 0xa8e922d0u, 0x330627eeu, 0xbc97c020u, 0xc1a6b041u,
+        0x67e38b6fu, 0x20ecdbb0u, 0x55471463u, 0xcac51d93u, 0x62a14daau, 0xfbc99261u, 0xbc310271u, 0x4bd30c8au,
+        0x1c7b9574u, 0x52961c65u, 0x61922941u, 0xf142b098u, 0x775961e6u, 0x11778563u, 0x299f1be7u, 0x86a07edeu,
+        0x501939fau, 0x9d02a433u, 0xff9c3862u, 0x4ff85564u, 0x8c4bff51u, 0x6c0fce6du, 0x921e1bd4u, 0xa20b7cf2u,
+        0x74c8fa02u, 0x3154c902u, 0x19f450f0u, 0x3ef46415u, 0xcd1f1f8cu, 0x3fda1ddbu, 0xfd5cbd76u, 0xcac25b45u,
+        0x74a958ddu, 0x8b4b4172u, 0x88fdcb8au, 0xcd031182u, 0xfe9ebcfeu, 0xff3462b0u, 0x25434cb9u, 0x8dcfa6d7u,
+        0x3f498d57u, 0x6771fb30u, 0xbac60a46u, 0xb7ed9fa8u, 0x96b8e894u, 0xc5891a78u, 0x134f400du, 0x8b804f9bu,
+        0x08525ad6u, 0xfa73fd7bu, 0x11972367u, 0x0b9d694cu, 0x1186b6d6u, 0xe1a6626au, 0x390d951fu, 0xc502d2aeu,
+        0xdf1ea80bu, 0x34f9bf84u, 0x39b723eau, 0x095b7e09u, 0xfceb6e50u, 0xdd03135bu, 0x555d4ba5u, 0x66ba55dbu,
+        0x7eb6d16bu, 0xf498ee64u, 0xdec77bdfu, 0x4923e6dbu, 0x140e2d2cu, 0x79bc97ceu, 0x17d01742u, 0x140dba5bu,
+        0xbffcf542u, 0xfc96d2bcu, 0x0d602655u, 0x3884f65bu, 0xfef3d1deu, 0xa2420ae7u, 0xd2c3808bu, 0x08f12debu,
+        0x039817c0u, 0xcb3006abu, 0x8599baf8u, 0xb9182ffdu, 0x3ea12372u, 0x5fa87c20u, 0xfc2db95bu, 0xe3b0cfb7u,
+        0x22f3ee2du, 0x75b1b693u, 0xb1097c95u, 0x75c7fae7u, 0x511f5c14u, 0xb7f6daedu, 0x825bde93u, 0x3a128daeu,
+        0x48da80d8u, 0x5dbaa353u, 0xa9907c59u, 0xe2970a8bu, 0x42c6e721u, 0x2774711fu, 0xf5a2e0d3u, 0x5a7341f2u,
+        0xc62ffb9au, 0x3b999069u, 0x77c3bb04u, 0x2755cf0du, 0xb3299420u, 0x87480fe7u, 0x6a4cf944u, 0xd96e7a7bu,
+        0x612acaa5u, 0x983e9315u, 0xb8180166u, 0x10a41becu, 0x31f58e66u, 0xf84f8fa5u, 0xfec4f4ceu, 0xa27b1b5du,
+        0xfc712183u, 0x125f2e4cu, 0x7d0163fcu, 0xdd72ae9eu, 0x7edb22fbu, 0x9b368540u, 0xf6ba6fd5u, 0xfd6bfb45u,
+        0xf9e7ce03u, 0x133a97c7u, 0x14b74bfeu, 0xa8f4fb4au, 0xaed6c56du, 0x9394d014u, 0xeba48c6bu, 0xb9ae88cau,
+        0xc243898eu, 0x0aee698bu, 0x123a6504u, 0x1ba2dcc1u, 0x5fd2648fu, 0xa7322170u, 0xc424ef81u, 0x8676ddc1u,
+        0x6367ebb3u, 0x25c4e25du, 0x4b3113dbu, 0xa4988c11u, 0xdbc2c0d6u, 0x3cf752bfu, 0x906bd515u, 0xd11fc21cu,
+        0x730d778bu, 0x8ca49c79u, 0x5f977a06u, 0x16f2c95au, 0xa135cb48u, 0x170cd1f8u, 0xcd89754au, 0x9fa01afdu,
+        0x0f20aedcu, 0x046d729bu, 0xefef594du, 0xbf770f54u, 0xb743ae7fu, 0xecb70e7fu, 0x33562e0du, 0x3237c155u,
+        0x5b2093b6u, 0x49e17750u, 0x54e67f7du, 0x83dc6bdeu, 0x4162f69du, 0x045d7d3eu, 0x41e653ebu, 0x2ee57045u,
+        0xe38d7e9eu, 0x08d3e20du, 0x1db94aefu, 0x0b01c2aau, 0xa17b6260u, 0xd1448115u, 0x7cd93679u, 0x5bc4ccdcu,
+        0x0c81105cu, 0xbbc2aaebu, 0x6ceb66e5u, 0x2e4a4357u, 0x4c7cb838u, 0xde0d12c5u, 0xb3c6b7f4u, 0x96cd7dd9u,
+        0xb128a693u, 0x1b63abf4u, 0x01c7c5ffu, 0x92aee429u, 0x8615c299u, 0x0c3dd881u, 0xe6a43e8fu, 0x5c6cbe9au,
+        0xa777f099u, 0x6e196239u, 0x556f2f64u, 0x5bb7b5acu, 0x5e1c46b6u, 0xae2e9c5eu, 0xb1c33698u, 0xe827cc72u,
+        0x868100a0u, 0x144f0f32u, 0x56ad6ec9u, 0x9065f829u, 0x000f09fau, 0x009a2cffu, 0xd49e9790u, 0x4970dae2u,
+        0x32a993dcu, 0x05047c4fu, 0x2cfac622u, 0xa5a1cb45u, 0x9c03e1c2u, 0x0ab13ffeu, 0xb513d240u, 0xd057a583u,
+        0x9006594du, 0xc0a03c7cu, 0x21086291u, 0xf2b1c931u, 0xcd65dba6u, 0xea01f42eu, 0xd9949d40u, 0x851158bfu,
+        0x1efbc0c8u, 0x39a96345u, 0xa579b3cfu, 0x1518e14bu, 0xa64dd3bau, 0x18523b7bu, 0xd58dae8eu, 0x8d52b2eeu,
+        0xa6ece594u, 0xa09064a6u, 0x16ae18e2u, 0x5c2795b8u, 0x4be72ce9u, 0xdaf10c54u, 0xddb4eaabu, 0x4b61f48eu,
+        0xb76e5814u, 0xdba26c27u, 0x420f9cf7u, 0x0651ee62u, 0xd0718109u, 0xcead18feu, 0xe1cbbda9u, 0xa1cdb78bu,
+        0xbb3ca063u, 0x0e6da7c0u, 0x94be1845u, 0xd4faf5a6u, 0xb85b1595u, 0xa831c740u, 0x4e66c045u, 0x410b2eb8u,
+        0xe0d189a8u, 0xc285e2feu, 0xa801ab80u, 0x950bf555u, 0xc61e628bu, 0x25ec26d4u, 0x91a5bfceu, 0xb229bcf5u,
+        0xf9be200du, 0xe37cca72u, 0xe7216670u, 0xbf8f62e1u, 0xfaccb500u, 0x20f41155u, 0x2c35fd25u, 0xd79fd637u,
+        0x18befb37u, 0x39c118abu, 0x2d855d43u, 0xc9869fd8u, 0x52dd0c69u, 0xded74026u, 0x67cc868bu, 0x2c3dec25u,
+        0x2adebf3eu, 0x5d2920c8u, 0xb59db85fu, 0x0046d460u, 0x77122affu, 0xb50786d2u, 0x3b002ed0u, 0x92484a17u,
+        0x79803388u, 0xf6d708f5u, 0xae45c163u, 0x80bebc59u, 0x5a71bd9du, 0x2f07fa7fu, 0x1340e486u, 0x01d0569du,
+        0x9f05d9f9u, 0x81f7d3b8u, 0x83944df1u, 0xca273d20u, 0x84fb882fu, 0x682032d4u, 0xb5e7bd15u, 0xbc8dc8f2u,
+        0x639c2568u, 0x20ac914bu, 0x6f235096u, 0x56645272u, 0x4ea69494u, 0x0fbe137cu, 0x7444344eu, 0x275df9a1u,
+        0x61f8af16u, 0xb6ce4871u, 0xbd22104au, 0x662a1843u, 0xe6d0fbd4u, 0xa89eb18au, 0xc533e88fu, 0xa218e4d0u,
+        0x35916ec9u, 0xd35eb7bfu, 0x214c0bd3u, 0x36205f80u, 0x3b4d559bu, 0x3031aebau, 0x9f374f01u, 0x74704defu,
+        0x003a2bcfu, 0x171544d3u, 0xc56526b2u, 0xaede3ca8u, 0x95a38284u, 0xbf0e1584u, 0x115537cau, 0xd71705f1u,
+        0xb6129f22u, 0x00c1ad82u, 0x16e6dd82u, 0x6573423du, 0x3d2eece5u, 0x18642002u, 0x2ada2bc0u, 0x876a5c5cu,
+        0x116053f8u, 0xbe8bd7e8u, 0x3fabe415u, 0xca92c9d6u, 0x9fa0532du, 0x285460d7u, 0x6dcd871au, 0x45c7855bu,
+        0xddf10e0du, 0x8a2971b8u, 0x7c39175eu, 0xd4edc690u, 0x652cfb57u, 0x95b232aeu, 0x9635e033u, 0x50791ddfu,
+        0x1c9b47a2u, 0x50843e67u, 0xcff428c1u, 0x417b7d57u, 0xb5a5c641u, 0x68417df3u, 0x0dcb6b9cu, 0x62918116u,
+        0x89dad3c9u, 0x2070eeb5u, 0xd901ec89u, 0xa08c982bu, 0x7fe7b24fu, 0xf5ebd3d5u, 0xaeb30e0au, 0x63b1f5dcu,
+        0x416fa7afu, 0x4f20bd3bu, 0x2e5735ffu, 0x21d3a3b2u, 0xe58eb902u, 0x19ef2ff2u, 0xfe77f409u, 0xc29a567cu,
+        0x30c673c9u, 0x700f6a48u, 0x8447ce89u, 0x917033f7u, 0xa43b9503u, 0x50c65a54u, 0x9f0aaef4u, 0x515fce4fu,
+        0xc4848bd7u, 0x6a043d6au, 0xe96676fcu, 0x71a7ecd0u, 0x82d40e6eu, 0xc5458741u, 0x5f2caab9u, 0x00000001u,
+    },
+    { /* 2^143 */
+        0xe42ddc22u, 0x35df4569u, 0xb375ebb2u, 0x3711b48bu, 0xd72940f0u, 0x0816e86du, 0x75cb9760u, 0xb1e5ad0fu,
+        0x9bf59626u, 0x8f9b2553u, 0x92dc8f5au, 0x0c18b4cfu, 0xb20ab485u, 0x95c2adffu, 0x38008dc6u, 0x554cc336u,
+        0x83d2c583u, 0x280c8375u, 0x190bed9au, 0x72996ebau, 0xf5dd402cu, 0x4625e0bcu, 0x48743443u, 0x3ae36f57u,
+        0xe01e506cu, 0x548dd60au, 0xf1e4935bu, 0xf5a46f13u, 0x7ed07276u, 0x0b4a6e79u, 0xed1a2fa1u, 0xc741f006u,
+        0x9764d352u, 0xd5e5a933u, 0x5039cbecu, 0xdee58a72u, 0x69bdf6dau, 0x447c6c44u, 0x9fc65b0fu, 0x892179e7u,
+        0xf261a9fcu, 0xf87b554au, 0xe36192eeu, 0xae2a3e9du, 0x320635d8u, 0x072afbe9u, 0x2fe562a7u, 0xef461122u,
+        0xf3fe96b2u, 0x692fdb54u, 0x959e8f3bu, 0x91a5650eu, 0xd2607984u, 0x43723e1bu, 0xfbb28cffu, 0x5e5e3418u,
+        0xdc0fac67u, 0xb79f4ecdu, 0x9681e400u, 0x8a80ab91u, 0xc0b99dc4u, 0x9e57c0aeu, 0xa7810fd3u, 0x6e03a3cfu,
+        0xdad7b381u, 0xd186db7au, 0x20793149u, 0xe77bbe71u, 0xe741bf4eu, 0xe4a9b471u, 0x6ff0a3aau, 0x55671e6bu,
+        0xf33529b1u, 0xf94603fau, 0x2a338c37u, 0x7219a2bfu, 0x786bcbfeu, 0x3e2208ceu, 0xc6c233b1u, 0x0c9b571eu,
+        0x69c8052fu, 0x67ef9135u, 0x8c36f711u, 0x3330b9f1u, 0x908698c6u, 0xca507766u, 0xe258003eu, 0x8068e255u,
+        0x5ddeef3fu, 0x3a208a87u, 0x599de9f3u, 0xbbf3e5d1u, 0xaba636aeu, 0x5ec14044u, 0x8450e055u, 0x843c846cu,
+        0xeb315251u, 0x37767389u, 0x40caec30u, 0xa610acd7u, 0xf4c63682u, 0xe35d0d4au, 0x6ad8d96fu, 0x1247e7c1u,
+        0x62b9b629u, 0x9d77ca11u, 0x3be7d177u, 0x05c32140u, 0xc15bf1dfu, 0x7942b717u, 0x1e1fd15eu, 0x00015054u,
+        0x61d98b9eu, 0x24e80345u, 0x2eb17f77u, 0xeeedb7dfu, 0x95024ca2u, 0x5707e3e3u, 0xaa606e96u, 0x85c3defbu,
+        0x34ba1422u, 0x3d987d4au, 0x0c6523bbu, 0xbfb3605au, 0x22473db2u, 0xf541cb94u, 0x1b9f6704u, 0xf6a44a09u,
+        0xd4d27441u, 0x9eeb5841u, 0x235c9875u, 0x11ba9c72u, 0x886b43edu, 0x84c6a0dfu, 0x6318d4a7u, 0xe6fef4edu,
+        0x00175758u, 0xff402789u, 0xbb8e0b19u, 0x5c01a21au, 0x370475f3u, 0xcc8a2cfeu, 0x37c91d1eu, 0x34c91e15u,
+        0x5c8e0aadu, 0x08651fe8u, 0x929b5ec3u, 0xda53eb1cu, 0x7dc7bdd0u, 0x02cd795fu, 0xb0e4a65cu, 0x8f88b314u,
+        0x10c260bbu, 0x8a797505u, 0x0bdecd6fu, 0xb8c8134du, 0xcc02219fu, 0x096accebu, 0xc98724e7u, 0x7b0dc1e8u,
+        0xe3f90c6du, 0x34aed8beu, 0x2e3c2f20u, 0xe714cdacu, 0x01be9cfdu, 0xf07b23c5u, 0x2c56d4a5u, 0x11003960u,
+        0x23df044cu, 0x51ea4d16u, 0x55233df1u, 0x3fcd8e75u, 0xe71139d8u, 0x5e8c0ad5u, 0x9a81078cu, 0xcf2c589bu,
+        0x2daaba4fu, 0x5ae258d9u, 0x16155980u, 0x2b9d48a2u, 0x4d023867u, 0xb22ca40bu, 0xa0e95e45u, 0x28328f6eu,
+        0x9b5a4527u, 0x6542fe45u, 0xaaefc0b4u, 0x75e642c7u, 0xc55d9ecau, 0xe7647b58u, 0xbec5939bu, 0x287560b2u,
+        0xbe74eef9u, 0xc8ed4229u, 0x423e101du, 0x3ce66e08u, 0xb89f2832u, 0x39c4a36du, 0x94a41a3du, 0xad78b61au,
+        0xf541c522u, 0xe589a21cu, 0x73621a61u, 0x93978ba0u, 0x44dc6471u, 0x2c854a20u, 0xb5579cfbu, 0x4682a1d2u,
+        0x570d19c3u, 0xbe5c387au, 0xd5ee67f3u, 0xad08c959u, 0x0650c976u, 0x82389ee8u, 0x81f8b446u, 0x680da387u,
+        0xf74ce6eau, 0x2aa20bfau, 0x2fb5ac79u, 0x0c12e61fu, 0xde32a234u, 0x6376d82au, 0x363f891fu, 0xadbb44a1u,
+        0x1dd070e8u, 0x8ce53dd6u, 0xf48faa31u, 0xfa47e421u, 0x6c94c29cu, 0xa641b30bu, 0xec23ca28u, 0xfc2b0c93u,
+        0xb0989340u, 0x87e59ce7u, 0xdaf587acu, 0x5de1149eu, 0xfaf7d339u, 0xa7b206d4u, 0xbd291a93u, 0xbeba924bu,
+        0xd171fab2u, 0xee3e67e9u, 0x14575d88u, 0x5ea85319u, 0x485cda7du, 0x9ef7918cu, 0xf42b925fu, 0x96ac95e2u,
+        0x94b7e9e5u, 0x00f23454u, 0xc74b69fcu, 0xe2aff723u, 0x7c0e1d4au, 0x9d947468u, 0x0d9bb060u, 0x91472d09u,
+        0xeb0ab54au, 0xce9a0b65u, 0xa9d763e8u, 0xde73d163u, 0xf2892590u, 0xa8c70f27u, 0xa3922891u, 0x66216efeu,
+        0x36656351u, 0xc828f2dbu, 0x404b719cu, 0x6fb1bcf0u, 0xc98c11a0u, 0x81311ed9u, 0x4800da35u, 0x1c191296u,
+        0x72112a7cu, 0xad69f9fau, 0x80cc1a1au, 0x2eb8bfb1u, 0x50044b6eu, 0xe3fc8e92u, 0x1fb2a951u, 0x416a5141u,
+        0xc7b51cc1u, 0x69df2cacu, 0x5c0ad965u, 0xfaf02cb1u, 0x481c767bu, 0x645e831du, 0x76eb3e36u, 0x0d991a3fu,
+        0x3f65cf2eu, 0x499c8422u, 0x314a5985u, 0x8fe3b264u, 0xdba7cfe3u, 0xa879dfb9u, 0x17e18ffau, 0x007e210au,
+        0x0619b3f5u, 0x574682d2u, 0x61b46454u, 0x01bb1178u, 0xc87500c4u, 0x71782b67u, 0x1cce1343u, 0xcb45d47au,
+        0x90030aabu, 0x4b691db3u, 0xc74819f1u, 0xcd806c1cu, 0x68defa0cu, 0x67cc7f40u, 0x7ee7cdc8u, 0x60467069u,
+        0xc048a6d2u, 0x60a7f9f7u, 0x0e927449u, 0x1ae1e20bu, 0xa8b74460u, 0x27d1b27eu, 0x1bc3acb3u, 0x4324cc1au,
+        0x289a96cbu, 0x59f9b207u, 0x24299347u, 0x2166417eu, 0xd8c8f504u, 0xc6836904u, 0x405d5ec4u, 0x33bc286fu,
+        0x9aadf703u, 0x887fbb20u, 0xfc5bdc85u, 0xa366fcf9u, 0x5dd4a823u, 0xb3fc1cf0u, 0x5981b0e6u, 0x15e8dcaeu,
+        0x0d71e0dau, 0x1169e757u, 0xe69f8133u, 0x7ccc5e81u, 0x80df0044u, 0xd277ed50u, 0xff271d9fu, 0x4f3995acu,
+        0xc712c26au, 0x9a56ce61u, 0x6f86d6dfu, 0x6460ed2fu, 0x9c075636u, 0xf568cc3au, 0xf096015eu, 0x003a2cd6u,
+        0x1007030bu, 0xf82f4419u, 0x620218d7u, 0xf7c6a69cu, 0xf7252f65u, 0x826a370cu, 0xf1111391u, 0x37c6d48cu,
+        0x0e83c383u, 0x4cbf7431u, 0x3ce39cedu, 0xf955fc54u, 0x7875dc4du, 0xf36a44b5u, 0x95e0ae0du, 0xfa171713u,
+        0x30456942u, 0xcb246138u, 0x0b5896d0u, 0xb7ac96a4u, 0x669a198au, 0x65a5a21eu, 0xafcd99fau, 0x45697788u,
+        0xa060fca1u, 0x4d43e91eu, 0xe4c6904eu, 0x5a9c665bu, 0xf13388e0u, 0x8254118du, 0x8f44bc98u, 0xfe7a1f73u,
+        0xce5d9136u, 0xfb9eecf8u, 0xf02e1f98u, 0x91e96c04u, 0x87ddceffu, 0xa65cc564u, 0x79027ca8u, 0x46a4d187u,
+        0xd1a565d8u, 0xe1959e78u, 0x78f6e7f4u, 0x8d3f9fc4u, 0x563e80d4u, 0x8b3857a1u, 0x7ce5bbc6u, 0xa2762ae0u,
+        0xde2bdb26u, 0x5449df5fu, 0xc1cab2f8u, 0x8f569e24u, 0x73cac499u, 0x35a27d60u, 0x7e0eddc4u, 0x79b27956u,
+        0x135526c8u, 0x84461857u, 0x6c62a44bu, 0xf73aaca6u, 0x7eacc3d8u, 0xb015b061u, 0x67157a49u, 0x4d379cc4u,
+        0x2f1c54fbu, 0xb066a0d4u, 0xadb2345cu, 0x64cc7b62u, 0x5ad6ed89u, 0x38a6d457u, 0x4ec92be2u, 0xd4ed5a9eu,
+        0xa957996du, 0x0930958bu, 0xc813d999u, 0xa8f8ff55u, 0xa0bc929bu, 0xa8c35567u, 0xc4de1697u, 0xc0c969feu,
+        0x2e89d1f9u, 0x993400a7u, 0xf6d8c671u, 0xbca3dd82u, 0xc29f467fu, 0xc1890dd1u, 0x8c28ea2au, 0x381814a3u,
+        0x4b31a79eu, 0x51ebde30u, 0x0a8d2d67u, 0x20e7a4cfu, 0xdb919404u, 0x8ab34456u, 0xf174e4e7u, 0xcf2785f6u,
+        0x42ed25a8u, 0xc77d0385u, 0x3e8e00f8u, 0x38d481bdu, 0xbc785706u, 0xcb269c35u, 0x9729bc6au, 0xc34d3dc7u,
+        0xf45f3611u, 0xd2b9eb54u, 0x69a73ef5u, 0xbede626fu, 0x0609282au, 0x47e5732eu, 0x00bf4adau, 0xbfc346c8u,
+        0x93cf0fc2u, 0xafa2b069u, 0x4845e4a0u, 0x2f5f970fu, 0x03aeecdfu, 0xe4af3655u, 0xd88f919au, 0x14942ff2u,
+        0xe0395c0bu, 0x5bbe2f21u, 0xf032cfb3u, 0x71c0f698u, 0xf7269484u, 0xad48f9b1u, 0xf1db9e3fu, 0xbd4e6af9u,
+        0x459b2d6au, 0x4fc347b8u, 0x985837cfu, 0x911d59fbu, 0x0f4de771u, 0x8b722c10u, 0xa54d5fe2u, 0x63eb72e4u,
+        0x753a78bfu, 0x5d61d31du, 0x8222409au, 0x3b95f7a3u, 0xf916c8cdu, 0x6ddd8593u, 0xaa4b64f6u, 0x5849c1f9u,
+        0x533b186bu, 0xa320a844u, 0x477691bdu, 0x954d0e44u, 0x4380688bu, 0x63518be7u, 0x650e9136u, 0x69f42eb8u,
+        0xb11ab239u, 0x43f1d581u, 0x1d36d052u, 0x91ab5fb3u, 0xb63435b2u, 0x82cf8813u, 0x0b2d3337u, 0x2ea84347u,
+        0xd264acfdu, 0xf92eda13u, 0x039f75aeu, 0x1040ea0du, 0x5fc6895bu, 0xddcebd59u, 0x65274229u, 0xef5254c6u,
+        0x4db70406u, 0xe83725f2u, 0x900c37acu, 0xb18afce6u, 0xadcc8cb5u, 0x7157c3c8u, 0xafbd4de0u, 0x9c64dbd4u,
+        0x825fb355u, 0x84cdd0b8u, 0x6961c242u, 0x43afe00bu, 0x3f56df0eu, 0x7568a96eu, 0xb9cfe25eu, 0xc562cc90u,
+        0xb830ab4bu, 0xdc3b72e4u, 0xc61f69ccu, 0x00d830bau, 0x542539dfu, 0xd8e19fa8u, 0xa40f40c0u, 0xdaac80ddu,
+        0x294374dbu, 0x8e30a17au, 0x25954f97u, 0x4da2abbau, 0x56dfa44au, 0x809267afu, 0x638afd62u, 0xe9151e21u,
+        0xad8f500eu, 0xefc1e901u, 0x3b9e4de2u, 0x7f6a892fu, 0x51b52af1u, 0x5858bf99u, 0xf53ace74u, 0xf2723ae3u,
+        0xe566b8fcu, 0xa63497f4u, 0x4e12f174u, 0x9d826850u, 0x02a92d07u, 0x76563e03u, 0x2e315644u, 0x9200a2e3u,
+        0x8524fea4u, 0x1f80ecfbu, 0xa1cddf7eu, 0x6fbbe2adu, 0xac8b3127u, 0x44ffcae0u, 0x38c623dcu, 0x8b14e74fu,
+        0xfd87a270u, 0x4ccff56du, 0x7db493bfu, 0x80a6fe6au, 0x98745dd1u, 0x3f5f8699u, 0x3a285606u, 0x9ad4c0e2u,
+        0x2a5f83f2u, 0x3743646bu, 0x3d19fe11u, 0xeb5696d1u, 0x2d052a4fu, 0xf374fec9u, 0x00a88a0cu, 0x29f6afcdu,
+        0x3e0d28fcu, 0xecd375e8u, 0x30291ffau, 0x97af9e95u, 0x6c6d80c4u, 0xc2a8d271u, 0xe93cc22cu, 0x514138b6u,
+        0x77469affu, 0x0215bc45u, 0xa82f9e9fu, 0x4c69ccbfu, 0x47c5662au, 0x8ad52d90u, 0x2d03c5ccu, 0x7f5d89b5u,
+        0x07952b4fu, 0x069e68d1u, 0x2db57628u, 0xc1e2613bu, 0x048dcef5u, 0x46b6366cu, 0xb4b30ab4u, 0x6bcf5fa0u,
+        0x7081d1f3u, 0xa3d71baau, 0xf08e9ee6u, 0x1a75afa4u, 0x46cf8c7bu, 0xcab493bbu, 0x84aeb108u, 0x00000000u,
+    },
+    { /* 2^144 */
+        0x8f3b02e5u, 0x4704a538u, 0xe82ebf58u, 0xd40f1e44u, 0x19400682u, 0xcacf3c03u, 0x3fa368b5u, 0xe60789edu,
+        0xca77a03au, 0x6445f423u, 0x382941a1u, 0x614ed222u, 0xdf07956fu, 0x7fcb204fu, 0xed55d5b6u, 0x6e0207d5u,
+        0xc7ea2745u, 0xed02672eu, 0x03af9426u, 0xce8b1f93u, 0xcbb6e1c9u, 0x7c91e9c8u, 0x2332edb1u, 0x432e6657u,
+        0xcddaaec4u, 0xf87c5679u, 0x58e152dbu, 0x47abec84u, 0xd1c8ada2u, 0x0ffa16ecu, 0x76e4316cu, 0xbd1c9d6fu,
+        0x973fdca9u, 0xb9f70671u, 0x907ab8ddu, 0x14c00c30u, 0xa206ba01u, 0x79f13a12u, 0x0a0c7ab9u, 0x382d0372u,
+        0xd9c1ea2cu, 0x5301a0e7u, 0x0aa634b3u, 0x459b1fddu, 0xeee73794u, 0x1351cd58u, 0xc46a886eu, 0x0e53fc2du,
+        0xd85a9798u, 0x489674ceu, 0x298a059au, 0x6f09c10cu, 0xa5abbdafu, 0x5c3c2dc1u, 0x38f47257u, 0x7aaaedecu,
+        0xf3f19a59u, 0xfd1dbf0cu, 0xb8d14185u, 0x1a9ec2d4u, 0x979a4af1u, 0xefd33343u, 0x96e67e00u, 0x874f5f9au,
+        0xd9b99c2eu, 0xaaf93938u, 0x79958ae7u, 0xd9c4b3a4u, 0x84c8c12bu, 0xa6ceee6au, 0x0d2ee246u, 0x1210ff57u,
+        0x9cac04afu, 0x8be228bfu, 0xcad13f03u, 0x4eda9656u, 0xa902c342u, 0x4385861au, 0x28b0fc5fu, 0x68032aa1u,
+        0xa4309132u, 0x0a79cce0u, 0x4ec22c36u, 0xc9a051d1u, 0x5f546459u, 0x55f5ffafu, 0x3dc6e166u, 0xa6d3ef23u,
+        0x070a6c75u, 0x4166486cu, 0xd421f0e7u, 0x4f307d98u, 0xcd4c78a2u, 0xad2834a9u, 0x8aa09adbu, 0xcc130bb7u,
+        0x58e61582u, 0x3432a701u, 0x85fbb82au, 0xff54b7a2u, 0x5fcba909u, 0xa3a7fd11u, 0xf7b354ffu, 0x7d879d6au,
+        0xb9d25a72u, 0xce13a1a2u, 0x9522ef4bu, 0x7f0b13f0u, 0xc9f6a151u, 0x230bfb07u, 0x08ef6835u, 0xcf19e1dau,
+        0xe163d9e2u, 0x5adaf434u, 0xd05cbdcbu, 0xe748548eu, 0x16bfc7aeu, 0x29646af4u, 0xdbabf46eu, 0x26b1735eu,
+        0x8347bfd8u, 0x2af56543u, 0xc5edb953u, 0xdb8494c0u, 0x62b4785cu, 0x26668aaeu, 0xe94d3351u, 0xcb69bd16u,
+        0x0b4c6178u, 0xbb41b506u, 0x9cdf3ef1u, 0xcdc04538u, 0xa564ad41u, 0xe991ffd6u, 0xe683a5d9u, 0x5a44f68au,
+        0xca6603cbu, 0x6b3bba73u, 0xae667e09u, 0x9c6a0f35u, 0x2d823d52u, 0x51c35c7au, 0x1d768af5u, 0x6b32887au,
+        0x96e9284eu, 0x7fa6db2cu, 0xc6e8a93au, 0xf2c3015fu, 0x8a041e4du, 0xf764a372u, 0xf40aab26u, 0x548cd66eu,
+        0x8d4feb57u, 0xf366fa95u, 0x36f05660u, 0x618e84d7u, 0x14a49e50u, 0xb8abe0f2u, 0xbaa34bd9u, 0x0c06edb3u,
+        0x7ed69a3au, 0xe7b73af0u, 0xa52f37efu, 0x52cc2e14u, 0xd04b0410u, 0x98f21950u, 0x7ae751e6u, 0x226f99ebu,
+        0x207a20efu, 0x230a7f14u, 0x4bc3343fu, 0x56e3b2b6u, 0x959d018eu, 0x094c317du, 0xec7e384fu, 0x9803c3d5u,
+        0x7a21c634u, 0x934ba5a0u, 0x5a89d55fu, 0xafcfda20u, 0x6c969da5u, 0x542ed835u, 0x1029eb89u, 0xf1657479u,
+        0xacb1cb54u, 0xb0d1687au, 0x11e9aa9du, 0x7b27dc22u, 0x551bfac4u, 0x7e7c83a8u, 0x6c7a2d98u, 0xabd30558u,
+        0xb0bc2600u, 0x2cf18cc1u, 0x6b559b1eu, 0xcd7f4650u, 0xefc22dd2u, 0x8fa35e87u, 0x8c22794eu, 0xa1f2ed8bu,
+        0xae844568u, 0xd998ae34u, 0x10785b18u, 0x78a96ecbu, 0x801ec5eau, 0x986cf0edu, 0xe2b3e60du, 0xdea4b18eu,
+        0xcadc9169u, 0x0e971a75u, 0x391fa92cu, 0x3d7a8fd0u, 0x2ab16dc0u, 0xfae88801u, 0xbf21f3f9u, 0x42df6ccdu,
+        0x87f77fd4u, 0x336c0c22u, 0xc41e6cb4u, 0x7598f343u, 0xb589fd02u, 0xff8e3f3au, 0x9bf80112u, 0xb97a9121u,
+        0xbbd11a1bu, 0x29dc0e6eu, 0xf9428b33u, 0x75b04818u, 0x03ccad66u, 0x972d14d6u, 0x25cbf89eu, 0xe6c1da28u,
+        0x501cc4feu, 0x19ca9111u, 0x922d0530u, 0x832a1fbeu, 0x55b01567u, 0xf1b570e9u, 0x973edd1au, 0xac6e5ee8u,
+        0xa92fd937u, 0xbcd7b657u, 0xbf7c6973u, 0x10aee0b1u, 0xadd58442u, 0x6af79054u, 0x596057fdu, 0xc8deae1fu,
+        0xada9c2b6u, 0x1ffeb97du, 0x215ee194u, 0x2d0aa835u, 0x376fbd59u, 0x46abae65u, 0x568cead1u, 0x1be70136u,
+        0x62fa934du, 0x46e28dabu, 0xb56f819bu, 0x1e00f4aau, 0x90d8ad2cu, 0x6a766ee2u, 0x62c0f358u, 0xdf563d69u,
+        0xbdb7dbb1u, 0x92a5f1dbu, 0xd9720266u, 0xf1a30390u, 0xcb2295d3u, 0xff28a929u, 0x49a343eau, 0x6910fc82u,
+        0xa16c7e68u, 0xe519a8e8u, 0xf981425du, 0x245ea372u, 0x0daa7874u, 0x893ea9afu, 0xddf41ffdu, 0x0f983ea1u,
+        0x68aea0b6u, 0x7ca53f2eu, 0x22d6f8b0u, 0xc0bed866u, 0x28fc8616u, 0xf150fb7fu, 0xaa634db5u, 0x8040a5e5u,
+        0xd8d118fcu, 0xdf80c253u, 0x66868191u, 0x531da77bu, 0x4ee516a9u, 0x4dcf80d9u, 0x30b19922u, 0x1a7fe72bu,
+        0x05d9c433u, 0x230a8f66u, 0x897627beu, 0xb9293d3bu, 0x7473ded1u, 0xfb5f0661u, 0x8a0ac22eu, 0xe7df8e64u,
+        0x182c3705u, 0x5063d980u, 0xdec0713bu, 0x90503b3cu, 0x6470a4d2u, 0x5c0cb1a9u, 0xdcdf4ab0u, 0x3eca2902u,
+        0x7b1ba706u, 0x0a690ff5u, 0x2b3b2e78u, 0x3d9486e2u, 0x54539b0fu, 0x9d663b81u, 0x9cac471eu, 0x7b605b9du,
+        0x8ad3cebau, 0xc350df87u, 0xc88b3b86u, 0x4c0469ffu, 0xba348c7au, 0x1b14928bu, 0x35e4b52cu, 0x2431aebfu,
+        0xb430140au, 0x1c0571fdu, 0xcc7c1e94u, 0xad60c492u, 0xd84e08dbu, 0x5885ff07u, 0x8791f764u, 0xfaeb00eau,
+        0x27a649c6u, 0x8554e3cdu, 0x9790d77au, 0xb397b0e7u, 0x4cb43517u, 0xded710e0u, 0x3e55ddb3u, 0xf68b03f2u,
+        0x75563458u, 0x71d89e4eu, 0x42599cf6u, 0x26a63f6cu, 0x16ff703eu, 0xedc6fca0u, 0x82dd2255u, 0x0601009du,
+        0x2fb2901du, 0x0c822c4cu, 0x6b0dbeadu, 0x932871f2u, 0x491aaa08u, 0x4eb4647eu, 0xaadf09feu, 0xbf12f460u,
+        0x0f7f6fa3u, 0xa2c7683cu, 0x6cee434eu, 0xb4f6c433u, 0x01dd28c1u, 0x34956f92u, 0xfb9881e7u, 0x6b939ebbu,
+        0x1556aa8cu, 0xcdb7425fu, 0xe646c8b0u, 0x5a199cc7u, 0x7aa2a4b7u, 0x867231e7u, 0xc7603b39u, 0x7e453dadu,
+        0x00fed721u, 0xe731883eu, 0xf636f0beu, 0xde0df849u, 0xedcf3baau, 0x161947b7u, 0xca4c90aau, 0x34f2555cu,
+        0xdb346706u, 0x1e0628eeu, 0x88df58e8u, 0xfdbf811bu, 0x9d6e62b8u, 0x98403d7bu, 0x0a4acd19u, 0xe16f12a5u,
+        0x6de720b9u, 0x5da3289bu, 0xb2c8dc15u, 0xb81ef7b1u, 0x38546718u, 0x189363c1u, 0x02de0cb5u, 0x8579cfdau,
+        0x86d5991du, 0xbc0ae21cu, 0x24cc2f48u, 0x928d16e1u, 0xde78bc3au, 0xcc80bfb1u, 0xeb898a03u, 0x8573d0b2u,
+        0x3b89abbbu, 0xe31eca1fu, 0x770d220bu, 0xda644689u, 0x6aa7e524u, 0x40229b42u, 0x1bd5ccaau, 0x4bf8fae4u,
+        0x86d55322u, 0x9df6c963u, 0x35091934u, 0x76c29655u, 0xb1ace00bu, 0xf0c5baa8u, 0x30bead79u, 0xc8a8835bu,
+        0x2ee10d7bu, 0x21c0d87fu, 0x5a33a0beu, 0x5895efcdu, 0xc615bc42u, 0x7794c26bu, 0xc716e530u, 0x1b3ad55au,
+        0x630c826fu, 0x40f0ae73u, 0x1ffbbb51u, 0x9206038fu, 0x332b388fu, 0xf9bede50u, 0xccea65acu, 0x2e0d2e3eu,
+        0x9121bf63u, 0x292da692u, 0x39fc54a4u, 0x93aa9432u, 0xf3b645a4u, 0x216832b2u, 0x991d7261u, 0x6f245de5u,
+        0xa38b40abu, 0x0160b89du, 0xd6aaf1a9u, 0x595568cfu, 0xcf2a37b5u, 0x56e1e7f8u, 0x8fc2d835u, 0xd882e619u,
+        0xea59878cu, 0x7b9848f9u, 0xdd12465cu, 0xc4a7e267u, 0x015674cau, 0xda60fdc6u, 0x9bb43e17u, 0x2eab63beu,
+        0x3cdbf98bu, 0x8c32fda9u, 0xbb1fc3eeu, 0x7f8be55cu, 0x4ccac8a1u, 0x19970385u, 0xabc5788cu, 0xe8a8a5d0u,
+        0x7168ef19u, 0xef001165u, 0x43af82f7u, 0x866b1fb1u, 0x0c6ec1acu, 0xdb63de51u, 0x06bfeabau, 0x44c07348u,
+        0x0875e415u, 0xa9286306u, 0xd42c5841u, 0x6f84c26au, 0xcdc0f454u, 0x6c858415u, 0xda14147fu, 0xf6ab5f47u,
+        0x1382f9b2u, 0x4eb45f71u, 0xd068775au, 0x95b19f77u, 0xf366bb31u, 0xee28506fu, 0xe12d33f7u, 0xf185bcf2u,
+        0x29f73ab0u, 0xa027f168u, 0x12fba74eu, 0xb87b1bffu, 0x47345577u, 0xc7da4a4du, 0x08a6ba71u, 0x8620ac8du,
+        0xaadc7bf9u, 0xd3d3ad43u, 0xaa21f508u, 0xf10ad516u, 0x37d25bd5u, 0x0a719269u, 0x46cb8585u, 0x3728b826u,
+        0x0d181c1du, 0xbbc329d3u, 0x0c4787e8u, 0x5fb68d8fu, 0x45e18a9bu, 0xdbb076cdu, 0xa8c17969u, 0x46828850u,
+        0x9fc77b79u, 0x7ff444e6u, 0x5f7cec1fu, 0x44d2b376u, 0x5f247bc3u, 0x092c7ffdu, 0x38b46a5cu, 0xebcb753au,
+        0x2e1690e2u, 0xf675e42du, 0x9f907a94u, 0xe2bc9b50u, 0xd6623974u, 0xc1a3081eu, 0x11c03523u, 0x109b0c8au,
+        0xcb94829au, 0xc58cd005u, 0x2f123850u, 0x1b56654bu, 0xbc37d1a3u, 0xe1e08ee7u, 0xa067e532u, 0x53de86fbu,
+        0x11067193u, 0x983e4b94u, 0xf86dc6a4u, 0x10172b57u, 0x26edbfefu, 0xd38f0ac6u, 0x00317c71u, 0xd4adb392u,
+        0xcf0c64a9u, 0x3e211c50u, 0xe0633234u, 0xf497283du, 0xde108e7bu, 0x7cbd10b9u, 0x97ae4badu, 0x647dd51du,
+        0xef4e4c7du, 0x90b69bf0u, 0x344e4e83u, 0xf7422b6du, 0xd2088b99u, 0xb4f0788fu, 0x09b338afu, 0x7f3f96dbu,
+        0xc38aa678u, 0x3fb8b580u, 0x86c6f488u, 0xc0966868u, 0xd67f784du, 0xb44d5ee9u, 0xc61c160eu, 0xefda30c3u,
+        0xe211ee05u, 0x80bd2eb1u, 0x5a402404u, 0xb31e1abfu, 0x2c2e52d0u, 0x5868ed8fu, 0x3297b465u, 0x934eae50u,
+        0x75c459a2u, 0x98a0bad3u, 0xe29782a2u, 0x7afd1a63u, 0x2849f415u, 0x2df162ccu, 0x821f9afbu, 0x5688bc4au,
+        0xbd2ceb10u, 0xfec7ee28u, 0x62267e8bu, 0x480ddd85u, 0x4c294389u, 0xf73f0459u, 0xb9c9b275u, 0xa9812059u,
+        0x08bdb937u, 0x5cef271fu, 0xc152512eu, 0x46537de2u, 0x04ef72e8u, 0x8ab85a81u, 0xf65f7c99u, 0xaf1dfb94u,
+        0xbd91c666u, 0x7a3e9243u, 0x05050ea4u, 0x70e092acu, 0xe67bc3fbu, 0x476c0e71u, 0x4d06d9d8u, 0xe9199ac0u,
+        0x5475d663u, 0x565d7d7bu, 0x0f63b34au, 0x1e5496fbu, 0x5a356867u, 0xe4a2fa0cu, 0x05f7c9fau, 0x00000001u,
+    },
+    { /* 2^145 */
+        0xc7e7fb15u, 0xd9a89772u, 0xa1a90c8au, 0x5da4b4c6u, 0x62706849u, 0xf938004du, 0xda8e5916u, 0xf82ae012u,
+        0xc45fe195u, 0x3dc58edbu, 0x8de91c6eu, 0x9b4f0a18u, 0x8cee08c7u, 0x99794aadu, 0xca13a9f9u, 0x8bf24463u,
+        0xec2a5639u, 0xb54d2a3bu, 0x886309ceu, 0x0342e6a6u, 0x6fceb744u, 0x6acd5efau, 0xc65839b5u, 0x206d81b4u,
+        0xea368428u, 0xe51e8b5fu, 0xa1aa6f22u, 0x3e6f91d8u, 0x5c40e5ddu, 0x250b1909u, 0x86a215cbu, 0xffe8278eu,
+        0x4ff88a8cu, 0x2bc34f55u, 0x8f18c78du, 0x9294c195u, 0x139e9718u, 0x4b316574u, 0x5b62efafu, 0x6be5bfafu,
+        0x9afc5a5bu, 0x3254ac1bu, 0x80b82140u, 0x197a5a52u, 0xc35bbd95u, 0xa974fbf4u, 0x77642f99u, 0x9691f45cu,
+        0x8d4054aeu, 0x2fd7f8a1u, 0xd5f25383u, 0x04785ac5u, 0xd1af11dcu, 0xfbf8088eu, 0xda998d78u, 0x91727d9bu,
+        0xc9a5a5fdu, 0x9777f199u, 0xb14e6d11u, 0x4e0dfd28u, 0xc818fd64u, 0x26b929e3u, 0x5307e8b8u, 0xcfe7e941u,
+        0xe3049c32u, 0x75d01199u, 0xb299c70cu, 0xc32bd390u, 0xcd644c4au, 0x2d8d0ffbu, 0x3e8c8dacu, 0x81b91b62u,
+        0x6e7b0705u, 0xf3bbfa72u, 0x1db66627u, 0xc9e59eefu, 0x182bf164u, 0x3ce9f14au, 0x3c723c75u, 0x819d5790u,
+        0x400ef371u, 0xce67f4f6u, 0x87f52931u, 0x103b0087u, 0x6122577du, 0x181ddfdeu, 0xa5ff5e02u, 0xfff91870u,
+        0xc0075e6du, 0x54cad29bu, 0x3a20edabu, 0x28c5bcedu, 0x9d65e6b5u, 0x83a9562fu, 0x78ae3a7bu, 0xc2f07112u,
+        0x652ade51u, 0x8ae9cf7bu, 0xb07d9d49u, 0x6ba71f46u, 0x174579d5u, 0xe4036c04u, 0x017dc239u, 0x33b4c52au,
+        0x9a514a93u, 0x3796156au, 0xe0d68224u, 0x711dbcafu, 0xba88fe6du, 0x1ed2abc4u, 0x70706f0fu, 0xa64a5628u,
+        0x1d26d37eu, 0x5813c559u, 0x0a4911d6u, 0x2b25ae9eu, 0xc5371ec2u, 0x1165ea9au, 0xaa892d00u, 0x83153818u,
+        0x29496fedu, 0x1dbb52b7u, 0x56dc9941u, 0xcd8b718au, 0x947ebd24u, 0x01f58d13u, 0xb9cad404u, 0xb4f8d33du,
+        0x0640f11eu, 0xbf52a19cu, 0x89df91f5u, 0xb2ea4d5au, 0x16dfb4f0u, 0xc43c9737u, 0xf8b9007bu, 0x697a80c2u,
+        0x027a7f9fu, 0x9dcd5192u, 0x2ce8cbe1u, 0x6561ef12u, 0xbe19e9d2u, 0x251c49c1u, 0x6a66f58eu, 0x9c2dd16bu,
+        0x79c1587du, 0xd618b754u, 0x47099bc1u, 0x2a3c24fau, 0x37250ea9u, 0x4ed626e9u, 0xbb82c935u, 0xbf78eb00u,
+        0xe1f7f720u, 0x4a714419u, 0x926aaad4u, 0xa0928337u, 0x83ac5f00u, 0x9bcce3d8u, 0x777809bcu, 0x722ed7afu,
+        0x423e5fddu, 0xedcc6d01u, 0xefaa0b29u, 0x299553f1u, 0x31c9d044u, 0x1665948fu, 0x66ff9dfbu, 0xbd395c81u,
+        0xa54a5f43u, 0x0cc9195au, 0x270340f1u, 0x4cdf602fu, 0x56fb74dcu, 0xacf74f45u, 0xf1898632u, 0x5867dbd5u,
+        0x7c9690cdu, 0xd20183b5u, 0x1d5f05ddu, 0x3aecd94bu, 0xa9a16d24u, 0xd8b7654bu, 0x95338b30u, 0xeecb520eu,
+        0x20c52a2du, 0x71b31759u, 0x7b3e824fu, 0xec42b1abu, 0x85fb58e3u, 0x7ad5b77fu, 0x57c9a582u, 0xaa84e7eeu,
+        0xb1f6f327u, 0x31f39e89u, 0x0c9b1bdfu, 0x6e31a379u, 0xde0616e4u, 0x8a4bb761u, 0x0b70b664u, 0xf0a9cb8eu,
+        0xc358572bu, 0xb871c3b2u, 0x9a2853a5u, 0xe3dc6d49u, 0xfc2cc157u, 0xcb2bfd40u, 0xb8dc2fcbu, 0x460d20b1u,
+        0x401f48e1u, 0x4dc71b8fu, 0x2638a005u, 0xc229f36eu, 0x6254b453u, 0x4c644c76u, 0xa0562eb7u, 0x2d6889bfu,
+        0x9a6728bfu, 0x3f9bb91cu, 0xec056f1eu, 0x6086f5f3u, 0x84185631u, 0xdab0cfd8u, 0x9de2610eu, 0xde0d9c8eu,
+        0x38ef4875u, 0xc363a1c0u, 0x00c10cfau, 0xf9e09845u, 0x03c64b82u, 0x377f6e7du, 0xf1de124eu, 0x7e7c1a46u,
+        0x028d1be2u, 0x46072687u, 0x625c7076u, 0x2445bb98u, 0x4a4b4643u, 0x811d5226u, 0x309a13dau, 0x96171a6au,
+        0x77a544f0u, 0xe31d0867u, 0x65e8d797u, 0x6b3f8975u, 0x1f8b1531u, 0x0225d48eu, 0x9a67fc95u, 0xcf9a0b97u,
+        0x13468157u, 0x4fd93862u, 0x2fd5b400u, 0x123811c4u, 0x0d706166u, 0xd4339b9bu, 0x5e9f2483u, 0x4bc2dbb5u,
+        0xbe3dab97u, 0x1ad6bf65u, 0x12415f97u, 0xcd4162f6u, 0x6855f5f4u, 0xae3654f8u, 0xc8a74608u, 0xef45d0ecu,
+        0xdb9efb78u, 0x38b30620u, 0xaba56f4eu, 0xd6316517u, 0x0f081affu, 0xdf2528a5u, 0x4c39e4c3u, 0x4c83f9c8u,
+        0x2995dde3u, 0x7359ee7du, 0x6b5c5936u, 0x32039a93u, 0x452eba5du, 0x0644ca39u, 0x723aa84cu, 0x530e9867u,
+        0x13b20fc5u, 0x3392d8adu, 0x4cf1949cu, 0x4b927135u, 0xfbdf2972u, 0x71d72c67u, 0x2a6a082cu, 0x7e8f867au,
+        0x12d162c1u, 0xeb081e52u, 0xaafd4ee4u, 0xb4802b69u, 0x083e8763u, 0xaef2cc72u, 0x5512f3f5u, 0x7a4e0f11u,
+        0xbb042124u, 0xdd4fee0du, 0x10976b0bu, 0x3b83b5e7u, 0xe7aa466au, 0x5b8db3d1u, 0x68083412u, 0xba3811d6u,
+        0x96a3094bu, 0xdcc2c6e4u, 0xcdb89c0du, 0x14a775f8u, 0x2ba3e3f9u, 0x148828a4u, 0x909f6b7cu, 0x7b04b427u,
+        0xe62dac6du, 0x0cf99689u, 0x7bb1076bu, 0x66ac0806u, 0x3ad31d19u, 0x2d11794eu, 0x9da95c2du, 0x418ec256u,
+        0xb8179fb6u, 0x5fd332f4u, 0x655d93c1u, 0x18a3e129u, 0x6594f81cu, 0x789bacb9u, 0xc5bc0506u, 0xb2b0341fu,
+        0x5865bda6u, 0x2df5fcdau, 0xf398156au, 0x6e082193u, 0x59a0cfe5u, 0x434e5603u, 0xd9b60a07u, 0x628fb267u,
+        0x200460f1u, 0x95fa2502u, 0x87ae711fu, 0x4da46e31u, 0x6a596ccdu, 0x91f8c83eu, 0x0c1b0b0bu, 0x14b0f37au,
+        0xe244fcb0u, 0xde127e23u, 0xcd65328au, 0x73c65c59u, 0xd38987dau, 0x5c11a8c7u, 0x479fb8d8u, 0x1c833c29u,
+        0x4b89167bu, 0x9f1ff1b2u, 0x0e2cdcb3u, 0x6062b6b8u, 0xc5650d98u, 0x03ca3268u, 0x87c0c791u, 0x1ecb1fa8u,
+        0xd1199c37u, 0x045e236cu, 0x3004adc9u, 0x21e506e8u, 0x5ab74647u, 0x430f90a3u, 0x6fc37129u, 0x6c60150cu,
+        0x6bbddfc8u, 0x659cef71u, 0xb9cdda60u, 0xdd43c741u, 0xbce77c9au, 0x8c724df8u, 0xe5b45764u, 0xccbf5028u,
+        0x0f67850fu, 0xb21272dfu, 0x5ffd1a9bu, 0x29e28bfdu, 0xd3b9ba19u, 0xfec7eb97u, 0x7ae5c97fu, 0x7f4e1cd2u,
+        0x49dcfcbbu, 0xf5695e97u, 0xf6b3ac28u, 0x07b75d75u, 0x1779f4e2u, 0xc2f37fc8u, 0xffe21982u, 0x1de536edu,
+        0xabe43977u, 0xd0ba9041u, 0xb331437du, 0xe9bce110u, 0x9b00d9ecu, 0xb9ec46cau, 0xe0cc2717u, 0x2844066au,
+        0x7b06dc61u, 0x7381eef9u, 0xad54ccb1u, 0x5a9fce3fu, 0x7bee8044u, 0x4564e85du, 0x398b3d8fu, 0x9de9b97cu,
+        0xb8b89514u, 0xdcf66c53u, 0xb728bee3u, 0x25b12360u, 0x9e45862eu, 0xd3b28ddeu, 0x5e9d6463u, 0x9ab69716u,
+        0x3a05129du, 0xb248461eu, 0x1948608cu, 0xce47929cu, 0xdd0e606cu, 0x28cca3f4u, 0x47eaeaecu, 0x1b1af184u,
+        0x888db6edu, 0xbf2753c0u, 0xf509146du, 0x25c15871u, 0xb00aa8c1u, 0xfa1d1b32u, 0x38164359u, 0xf3647060u,
+        0xef52238du, 0x917ed849u, 0x3d8346d8u, 0xe3fb3392u, 0xc0184575u, 0xb4d2712au, 0x6bf1c3b9u, 0xe429ce72u,
+        0x6965c5d2u, 0x296aeb08u, 0xa8c518f1u, 0x2564b23du, 0xdf862c69u, 0x1e18bf06u, 0xd03deb58u, 0xe2dfae72u,
+        0x419a0c8cu, 0x7b1eb157u, 0x84845674u, 0x4e0518a9u, 0xe70cf748u, 0xe913667fu, 0x506b81fbu, 0xabbc3297u,
+        0x6adc4ff0u, 0xd37d71f5u, 0xfd79977du, 0x65e40efbu, 0x6d09169fu, 0x7066a4ecu, 0x98b1c031u, 0x9dd12bf2u,
+        0xd78319a0u, 0x6ead1170u, 0x4103bde8u, 0x826df2b1u, 0x2754421fu, 0x88c6b5f4u, 0xac16b435u, 0x0cec9363u,
+        0x02e94942u, 0x32486457u, 0xb167e0f4u, 0x57ac12e4u, 0xd0e33336u, 0x77c4f917u, 0x2b04cdf1u, 0x5a4a2d7du,
+        0x08b01f97u, 0x9191cd1du, 0x3ce67b0fu, 0x1aeecda6u, 0x055c491du, 0x79d4022fu, 0xda145c11u, 0x2ce5f7bcu,
+        0xf92c1fe8u, 0x73e8ca32u, 0xde778d86u, 0x1859c7b0u, 0x299d6322u, 0x33a7e529u, 0xbbb6a5aeu, 0x4f2ac9dbu,
+        0x3ca8a9e5u, 0xcc45d0d0u, 0x00137f1cu, 0x448401edu, 0x8a994db8u, 0x20961843u, 0xd8012348u, 0x587b55fbu,
+        0x87bafdd9u, 0x07dbad53u, 0xeb70a14bu, 0x7d713b82u, 0xf081b169u, 0x55043ea9u, 0x27a9b27cu, 0xa6b49308u,
+        0x15ed70f2u, 0x85d9de59u, 0x44684e1cu, 0x5f86b14du, 0x23b409c4u, 0xaa5cc390u, 0xad25d89du, 0x587444e8u,
+        0xe238187eu, 0x73169f75u, 0x1e7fe6eeu, 0xabe9aec2u, 0x9db98d95u, 0x8c7f193cu, 0xf21825f4u, 0xc608addcu,
+        0x428c8b1bu, 0x326567a6u, 0x0b144cfdu, 0x536119e3u, 0x257ac52bu, 0x8d9717f6u, 0x891fbb30u, 0x44524a67u,
+        0xf7650f1cu, 0xd987f75eu, 0x7f2a22ecu, 0x578b6ceeu, 0x476ee7f7u, 0xa9a4163eu, 0xfbc505cbu, 0x764579a7u,
+        0x7a63e120u, 0x158314d6u, 0x15b5037du, 0xa9f93baeu, 0x39cc7bdcu, 0x9a69fd9bu, 0x16726f7eu, 0x0860d2ceu,
+        0xca21b5e0u, 0xd2163b10u, 0x5e1a52cfu, 0x54eb373bu, 0xd3b10bc4u, 0x00da9986u, 0x327bce8au, 0xa6fedce5u,
+        0xeee58ee3u, 0x463adf9du, 0xac357efbu, 0xda78fae6u, 0x2ca24969u, 0x56524457u, 0x558e494fu, 0x8a47e23du,
+        0x1fb89cddu, 0x4aec7636u, 0x172f9ca6u, 0x29ab7014u, 0x4dbae7b9u, 0x9a379059u, 0x52cd2cdau, 0x68adecb7u,
+        0x13257c96u, 0xf3e6b005u, 0xde3c4494u, 0xd818efe9u, 0x5e0d2675u, 0x955a3463u, 0x514e353bu, 0x395ca9e1u,
+        0xbc5e6a00u, 0x97beb02bu, 0x0b63aaa9u, 0xb70a297cu, 0x045457f1u, 0xf449c7ebu, 0x0a6e69beu, 0xd1478b99u,
+        0xdeccccf3u, 0x718f8981u, 0x314d3c00u, 0xc93545b2u, 0x5a58dfdfu, 0x50850373u, 0xec019e5au, 0x20669c5fu,
+        0x1118df35u, 0x4ea03c5au, 0x5b6702a0u, 0xa400d6a7u, 0xd7c23ee1u, 0xd5d49040u, 0x728a25bdu, 0x5a7d1ceeu,
+        0x8baf6618u, 0x456a42c2u, 0x77da15abu, 0x713aec48u, 0x1b80bd91u, 0x011d84e6u, 0x6e443243u, 0x527be12fu,
+        0x3846812du, 0x43cc7f5cu, 0x6fed848du, 0xb040881au, 0xa7a2ec1au, 0x08911e73u, 0xa85d9a79u, 0x00000000u,
+    },
+    { /* 2^146 */
+        0xdf998a55u, 0x208c3de0u, 0x5be73a6bu, 0xe4656b05u, 0x21e57622u, 0xf34da906u, 0x4fca2a10u, 0x01eb7332u,
+        0x6c57821cu, 0x11478815u, 0x856c6f7au, 0x32ed0638u, 0x9d31715au, 0x30c6efb5u, 0xf3278bd5u, 0x1dc96a80u,
+        0xf017cf20u, 0x73b293d7u, 0x18c83ca4u, 0xdf021c7au, 0x2920c23eu, 0xd4cbc585u, 0x9209260eu, 0x8dc73371u,
+        0x7dc862f1u, 0x03b3b4fcu, 0xb51502eeu, 0xc715c6cfu, 0x376630a3u, 0x93ed247cu, 0x7553fccbu, 0x3b5f63c7u,
+        0x45254c85u, 0x52330383u, 0xa34419f7u, 0x07b7e90cu, 0xd142200du, 0x65139d56u, 0x74fa9c8eu, 0x8136dd0cu,
+        0x5640029du, 0x107040b1u, 0x027eed58u, 0xfdfb62ceu, 0xb0bb689au, 0x12fd32f3u, 0x750e2e84u, 0xdfa9f367u,
+        0xf0c4a104u, 0x357fc541u, 0x7f70661bu, 0xea388f35u, 0x5fc2ac9fu, 0x77b61ed9u, 0x3838809du, 0x885a61c1u,
+        0x81abf463u, 0xdc9f6d71u, 0xb48d782eu, 0xe13b4231u, 0x1c063387u, 0x7e3fd8fbu, 0xe157161bu, 0xf4698ebcu,
+        0x6ef11915u, 0x267d2df2u, 0x2f2e1239u, 0xfd44cb16u, 0xe4e759b4u, 0x2fe7f550u, 0x04518e81u, 0x90338c0bu,
+        0x862466a8u, 0x30bf8010u, 0x89f236fau, 0x5772c3a4u, 0x79a810e1u, 0x36a19469u, 0xa9227828u, 0xc8804a7du,
+        0x0d8fcd58u, 0x66605903u, 0xd24494c5u, 0xd523dd15u, 0xb78c24e2u, 0x63dcb132u, 0x9b14f634u, 0xb192f104u,
+        0x1cf60a1au, 0x2fbe5c41u, 0x454bdb81u, 0x11e84884u, 0x5cc32ccdu, 0x2740a473u, 0x8df9bb29u, 0x5e01d197u,
+        0xf459c807u, 0x1a283f94u, 0xc62012b2u, 0xeceb3fceu, 0x8bffaa14u, 0xe9b82959u, 0x68a23f53u, 0xfeaef597u,
+        0x2ca9b5d5u, 0x0dc2f3cfu, 0x851d208bu, 0xfa2ddee7u, 0x8e2c80eeu, 0x9418a343u, 0xbc20165eu, 0xd3467c36u,
+        0x62e5f30fu, 0x3d822126u, 0x85c041fdu, 0xca2bd9e6u, 0x4ff15fe7u, 0x54ce4fb4u, 0x2ed2af33u, 0x8175f4f5u,
+        0xe9cf3331u, 0x11cbe3acu, 0xbce5afe8u, 0xf66a7f60u, 0x95b7cdf3u, 0x544e511bu, 0x08cb6a3cu, 0x2488db29u,
+        0x54f4604au, 0x86156b8bu, 0xa56f8b0du, 0x04ca0e57u, 0xe24f8f9au, 0x368b2446u, 0x1790c689u, 0xce7475a0u,
+        0x8c3ef67bu, 0x162d5ce4u, 0xe5f572adu, 0xeafbf4e6u, 0x569b8007u, 0x7ce13e05u, 0x7575d869u, 0x68d847bcu,
+        0x421006dbu, 0x118ce4abu, 0xea233412u, 0xa0811452u, 0x1187ff6bu, 0xfef8f69fu, 0xc332ed0eu, 0x9a450412u,
+        0xc529d92bu, 0xf8b34d8eu, 0x7780a7dfu, 0xcf38c602u, 0x1ac56371u, 0xf8f81772u, 0xe1f0bb9du, 0x429e64abu,
+        0xdd899c28u, 0x79e95b5eu, 0xcfcbd9a9u, 0x7924d2b3u, 0x99bd0d54u, 0xfe6ed193u, 0xc8035cecu, 0x633d6b02u,
+        0x9654ba64u, 0xd8785815u, 0x945c6218u, 0x3d881e07u, 0x8af8b342u, 0x248f6fecu, 0xfd703c38u, 0xef34c2c4u,
+        0x612bfee7u, 0xf82ca1fdu, 0x0d69ca7du, 0xf968eb0cu, 0xee63d714u, 0xaaaafcf1u, 0xd7921b54u, 0xdd4bed60u,
+        0x1c485f92u, 0xc8123deeu, 0x16a0f93fu, 0x9c7423a6u, 0x66c33829u, 0xc5f6841cu, 0x5359ffa0u, 0xc4fc55edu,
+        0x8fc13e3au, 0xadb1723bu, 0x6ec1fa39u, 0x898ddd11u, 0x88bf1547u, 0x6936d8abu, 0x6da2597cu, 0xb21f9827u,
+        0xfbfebb72u, 0x8c40f844u, 0xfc2dfca9u, 0x5e66a2b0u, 0x8bc805fcu, 0xea9396efu, 0xb53e9143u, 0xe3dac066u,
+        0xcab2e669u, 0x5b4216b4u, 0x15530c41u, 0x887678bdu, 0xe8e93ad8u, 0x38b7606eu, 0xda078094u, 0xaec771e5u,
+        0x9cfe5f3au, 0x9eb2e2a7u, 0x25bcff54u, 0x12815de3u, 0xd5f53b66u, 0x2143bcd0u, 0xb5fded9du, 0x559617b4u,
+        0x550ea186u, 0x0bd1ae4bu, 0xa6110fcbu, 0xa270f8f1u, 0xb7ba0510u, 0x7d7e66a8u, 0x95b5f510u, 0xd36e475eu,
+        0x8cdebb35u, 0x03399ed4u, 0xb94ea7dbu, 0x8b1fbcfcu, 0x50b2ee77u, 0x89e069a2u, 0x41dca2e0u, 0x21afc927u,
+        0x990a7672u, 0x3bb45b81u, 0x3aa03bf4u, 0x2e758b7eu, 0x9145107du, 0xe7df69d6u, 0x8755163eu, 0xd604490cu,
+        0xaa60f8c3u, 0x92da6c65u, 0x4aebdb20u, 0xb5c40ec8u, 0xc460abe4u, 0x125b8b2du, 0xc53840ccu, 0x30155b60u,
+        0xffc94477u, 0xb1f20b66u, 0x8bf0bd3du, 0xfcc95b0cu, 0x329cccb9u, 0xfc323fd3u, 0x358f4550u, 0x6d2487d9u,
+        0x1389a2a4u, 0xf13c7f02u, 0x4230ce65u, 0x8d54a1b2u, 0x13dfe6b9u, 0x27231cdfu, 0x37280009u, 0x785bada0u,
+        0x39442a1eu, 0xf985cfdeu, 0x031fdaa8u, 0x7fd6c4c4u, 0x12509035u, 0xcb94fbf8u, 0xa1a439e7u, 0x8039f2aau,
+        0x75e20f9du, 0x470ec157u, 0xa96412c2u, 0xf10c020cu, 0x5b599289u, 0xa72710a9u, 0xa169d9e0u, 0x6f268794u,
+        0x6662ad16u, 0xff7784ceu, 0x45e09088u, 0x8a396dccu, 0xf5c31f7fu, 0xfd6701d0u, 0xf354e61au, 0x61575c3fu,
+        0x212e901eu, 0x081523f2u, 0x758d4a9du, 0xb449f6e7u, 0xcc1a632cu, 0xcc04a184u, 0xbea1f986u, 0xaca4a1ceu,
+        0x10ad37d5u, 0x4a61eda3u, 0x26aab40bu, 0xe1138457u, 0xbd45377au, 0x52ebc9acu, 0xddcf6c97u, 0x3c4f5a0du,
+        0x6c0cde2fu, 0x0f579627u, 0x6fa3f0cfu, 0x75161cd0u, 0x948b3da7u, 0x9d1b9f6eu, 0x17b9a183u, 0xeb84353cu,
+        0x8275a417u, 0x2337fcd7u, 0x3cb6314eu, 0x2368d9a6u, 0xb7c4aad4u, 0xa1853897u, 0x767c033eu, 0xe3363173u,
+        0xfa37340du, 0xe2557205u, 0xce871d94u, 0x86527046u, 0xe09ae5deu, 0x0a34b946u, 0x386ca49cu, 0x360642e9u,
+        0x6cf8484du, 0x5af2ec9bu, 0x25b74d27u, 0x2f4506d9u, 0x22bad160u, 0xa5a4cd22u, 0x06b58f1fu, 0xdf4f3301u,
+        0xc40477f4u, 0x23b19726u, 0xf1c9b96fu, 0x57b946f3u, 0x220d72b9u, 0x4293478cu, 0x7de2fbc8u, 0xabaae611u,
+        0xe9d62ff1u, 0x1c3aae8eu, 0x3d98e88bu, 0x87026a27u, 0x70db2cc1u, 0xa98ff7c7u, 0xd7853850u, 0x8ef738c3u,
+        0x3492692bu, 0xe68133bcu, 0x3a1233cfu, 0x1a30a9bau, 0x98290cc4u, 0x1c97d3b8u, 0x5819903du, 0x95244667u,
+        0x8ebee365u, 0x52042248u, 0x3992612cu, 0xfa28e421u, 0xded11aa2u, 0x2c62cfe3u, 0x5c5ea60bu, 0x8ea023d2u,
+        0x280d41a2u, 0x6e614561u, 0x2d0b1a3au, 0xc24fc5e2u, 0xcfa7bb50u, 0xdbd5eb2eu, 0x162ddf89u, 0xa686c820u,
+        0x0fd16305u, 0x2bd69d09u, 0x483d9ff5u, 0xd33aa375u, 0x53b60996u, 0xa26155e6u, 0xd535b4b7u, 0xb12b657bu,
+        0x220155e7u, 0x77ca8a4eu, 0xf1034e8cu, 0x7695c34au, 0x6daa638fu, 0x568d8747u, 0x3e97daa3u, 0x838ebc5fu,
+        0x05289e38u, 0xc9668432u, 0x26a1479du, 0x66b338fcu, 0x90dcd3aau, 0xb6f24d23u, 0xd76b037cu, 0x928aff65u,
+        0x4392a920u, 0xe694f5fbu, 0xc07cb5f2u, 0xa44f6754u, 0xa60f5962u, 0x2538fc86u, 0x3bff12a1u, 0xbafe7a53u,
+        0x01c78e88u, 0x1d701428u, 0x36041a53u, 0x4a5e4d9bu, 0x0df6c3b2u, 0xa28e16e5u, 0x40efc12cu, 0x56667b1bu,
+        0xea6dab5cu, 0xc0211cdeu, 0xa9f24786u, 0x6abfb0abu, 0x9f5cc00fu, 0xf8f52ce1u, 0x58b00954u, 0x5f321b3du,
+        0xf480a23bu, 0x7acd48fdu, 0x6ad08561u, 0xf9942c10u, 0xfc1f5965u, 0x2f8cb8dbu, 0x707040e0u, 0x95f392b9u,
+        0xff0b5174u, 0xad01e63au, 0x19ea278cu, 0xf43fab65u, 0x28b93cbcu, 0xfc8d3cacu, 0xf2656af5u, 0x8356bcddu,
+        0xd9fa919fu, 0x2b1d95ccu, 0x277ecf31u, 0x137248dcu, 0xb1a92183u, 0x257c2ffdu, 0xbd200afcu, 0x2e98b094u,
+        0x62ed9fe3u, 0xf4419798u, 0xcb13a4afu, 0x46a5e84cu, 0x666566e4u, 0x49ea2dc9u, 0xef0b0e72u, 0x5c37bf91u,
+        0x8a517453u, 0x45db8ac7u, 0xb8ad5754u, 0x6ed78e51u, 0xcc36c7bfu, 0x51f16c38u, 0x3b8c7dbbu, 0x6e2c2eefu,
+        0xeadd1e55u, 0xb889a2fcu, 0x676a87d4u, 0x418a1512u, 0xe6f06f1cu, 0xd0b615b7u, 0x2719593bu, 0xa36bed0au,
+        0x34372e43u, 0x1d88278bu, 0x34cebc3cu, 0x186c1f7au, 0x8d2a75f1u, 0xa96cdb7eu, 0x3c68abb2u, 0x0191d96au,
+        0x362b9d50u, 0xc7a5fe75u, 0x3d613e20u, 0x5da0b120u, 0xbc43535au, 0x891a2a47u, 0x0369b059u, 0x069ea398u,
+        0x121e469bu, 0xc793b6e1u, 0xbd515d76u, 0xe33ab8c8u, 0x11b43bb6u, 0xff2988ceu, 0x854b09f0u, 0x8e5ae4b0u,
+        0xdca028a3u, 0xac26d27du, 0xfb9d98fdu, 0xe7739963u, 0x84876324u, 0x2abddd53u, 0xa5f31752u, 0x77e4ed08u,
+        0x524f1ba6u, 0xd1171edfu, 0xea61fa78u, 0x65ff7a65u, 0xab1ed061u, 0x58cdb742u, 0xe7393671u, 0xf7b18f4du,
+        0xc73c26f2u, 0x5de7d5a4u, 0x94fb6ffbu, 0xa54e5c7eu, 0xb0e2af4au, 0x010aefa3u, 0x317377e8u, 0x083a5393u,
+        0x8ba43034u, 0x1dcf60f1u, 0xbc1a21dcu, 0x290d02e3u, 0x8f777cc3u, 0x4936de37u, 0xe03595fcu, 0x2e2935b7u,
+        0x5ec4dc54u, 0xf0f720b2u, 0xdd09a2d1u, 0xb2bfc16au, 0x1870ac74u, 0x6db5b23cu, 0xcf5f347du, 0x3d984306u,
+        0x2854abc5u, 0x432efb30u, 0x1f431304u, 0xbe09d7efu, 0xd1351f29u, 0xd9c35603u, 0x29c769c4u, 0x3239209bu,
+        0x5e598610u, 0xfe07b92eu, 0xf0352bbeu, 0xe9130b46u, 0x59087554u, 0xcded8160u, 0xb37239f9u, 0xedecc661u,
+        0x8ae9adc8u, 0xb42d27a0u, 0x5c7ccfc4u, 0x974552e0u, 0x14c77360u, 0xa81ccab6u, 0xb5ac9b6fu, 0x3e4e9658u,
+        0xbc75377bu, 0x42350752u, 0x8420618eu, 0xab31e01eu, 0x8b338858u, 0x8e7434ffu, 0x7b9d6885u, 0x06e2a1e7u,
+        0x91a2ac82u, 0x15aa8643u, 0x7d7e5c9au, 0x8ed079a4u, 0xe6f2eb25u, 0xafbc112du, 0x963c91f4u, 0xf515cdcbu,
+        0x217adf41u, 0xafbca10du, 0xb0dedcabu, 0xad1158ecu, 0x810334b1u, 0x34933234u, 0x041c1249u, 0x3d5c5f2au,
+        0x1ba982efu, 0x7432a400u, 0x9803c45fu, 0x09a973c6u, 0x05a8a03eu, 0x9d8c11c0u, 0x61a0a611u, 0xa684849fu,
+        0x4aebbf1cu, 0xad9d8b0eu, 0x8bb2601bu, 0xfe34dbf2u, 0xa702ef1eu, 0x6a81a83fu, 0xd357c780u, 0x53b7a440u,
+        0xd5d1dbfcu, 0x73808e23u, 0x3f91bf97u, 0x8bf4237fu, 0x98d07696u, 0x9438f40du, 0x60b87e7bu, 0x1fd8e3f1u,
+        0x6e7c7a3du, 0xd9c54ba2u, 0x2d72e26cu, 0xcc5b9badu, 0x14429161u, 0xfde4cb57u, 0x569ec277u, 0x00000001u,
+    },
+    { /* 2^147 */
+        0x5491ad63u, 0x0dbfde8fu, 0x3704a9f1u, 0xcfdf410du, 0xab7e851du, 0x69336f62u, 0x497666aau, 0x8e283c51u,
+        0xaeab0de1u, 0xb66d8565u, 0x9325196au, 0xa8bcf530u, 0xd682ed95u, 0x7fa853bau, 0xe97357c6u, 0xd8a1de65u,
+        0x994f0d1bu, 0xc5cb51b2u, 0x34ea3cbbu, 0x596b9fb5u, 0xbbaac14eu, 0x7d0e6733u, 0xf06c2bd6u, 0x9905bae8u,
+        0x0c7e3003u, 0xd4ada6e0u, 0x3797c7edu, 0xadd22c95u, 0x009049dbu, 0x83fb720cu, 0xf71d1f0eu, 0xf76d188bu,
+        0x20f42a62u, 0x0981e24bu, 0x23fffd63u, 0x400b99c5u, 0x397306f1u, 0xfb16ea8au, 0x18191c49u, 0xae5ab9c4u,
+        0x7737cc6cu, 0x98f01e59u, 0x769cfcf6u, 0xc3f2422bu, 0xbc466314u, 0xb026c31bu, 0xfd5af688u, 0x6f3a88d6u,
+        0x5478e963u, 0x1cf95f3du, 0x153a1381u, 0x98c18ac6u, 0x117b4ab0u, 0x387ffdccu, 0xfa3ed44du, 0xe73aa7f4u,
+        0xa9edf1c7u, 0xe7df03e2u, 0xd65992e1u, 0xb0d2579fu, 0xdd2cf4deu, 0xac20952au, 0x2b7503d5u, 0x694a063bu,
+        0x9f1f0cc9u, 0xf4f83e16u, 0x33c6c927u, 0x6c1912f8u, 0xf47ae723u, 0xbd019850u, 0xc668c6fau, 0x5aab8380u,
+        0x657c352au, 0x2a3dd548u, 0xcc05abffu, 0x231902cau, 0x88411660u, 0x1f82b18eu, 0x2662068bu, 0x3291147eu,
+        0x48ff9ee0u, 0x22f525a1u, 0x8958e2cau, 0x673e14f8u, 0xf931f5e3u, 0x07e586e9u, 0xa89a3101u, 0x85df3bf7u,
+        0xf079e489u, 0xc1cdcc2du, 0x8c6c241eu, 0x2abd5315u, 0xf7a7a449u, 0x0ef818aeu, 0x8cf5982bu, 0x57f91a7du,
+        0x9468c986u, 0xd053e1b4u, 0x4b169381u, 0x9046195bu, 0xd3a7ad59u, 0xefe29abfu, 0x76a9eb80u, 0x871a0fd9u,
+        0x0a20ab17u, 0x7c5b98e7u, 0x645aa537u, 0x58ee969bu, 0x9143b670u, 0xdc254443u, 0xe1c85627u, 0x106492efu,
+        0x2c701c82u, 0x5b63c6d2u, 0x983c3047u, 0xbdf4f74du, 0xadb23066u, 0x05a67b12u, 0x4bb057e3u, 0x7962d397u,
+        0xff14e3bdu, 0xcb5fa2c6u, 0x5eb2f774u, 0x078653ccu, 0xc3859bf2u, 0xf041b458u, 0x4aa8193fu, 0x0157ca15u,
+        0x3d328a36u, 0x614af0bfu, 0xc7a215d3u, 0xc13439a9u, 0x3d0a338du, 0x3c7b6f35u, 0xbc9811d2u, 0x4842fd14u,
+        0x91ae63c0u, 0xe7db0eeeu, 0xe17b2ff9u, 0xe6fd23b4u, 0xd31aef9cu, 0x145486ebu, 0xf9a62f47u, 0xea9c5d21u,
+        0xaaf93dd3u, 0x56e547dcu, 0x0722892eu, 0xfc4e2e43u, 0x30f3a7dbu, 0x90dff3ccu, 0x4c4f5306u, 0xd2ae2704u,
+        0x26a049e5u, 0x11ae8beau, 0x654e09bau, 0x445d925au, 0xe3f34b1fu, 0x051574a8u, 0xbd50890fu, 0x97bd07a4u,
+        0x92b80731u, 0x6aad2939u, 0xfcf4a557u, 0xe2f479fdu, 0x3f3f7417u, 0xd3388e00u, 0x96c48ad6u, 0x2324850fu,
+        0x0ac7c977u, 0x20e7b725u, 0x3c69b657u, 0xcec26938u, 0xb9f36c58u, 0x6cc1a055u, 0x8be6b02du, 0x74a5e868u,
+        0x21280f6du, 0x280a8f2au, 0x1beabadau, 0xf0c89dcdu, 0x96a266cfu, 0x2564a483u, 0x0fd5c0ffu, 0xfe447cc2u,
+        0xc86faec1u, 0x9d9c3ffau, 0xf6aa56b2u, 0x31f5e33du, 0xcfa2199au, 0x96a160ffu, 0x56033268u, 0x4d33e46cu,
+        0x5936f59eu, 0xbe4dd504u, 0x82afdd36u, 0x0a02c110u, 0x1a3e6d22u, 0x96518115u, 0x13cb3a00u, 0xa2190ec7u,
+        0xa4faee3fu, 0x39dc50c4u, 0xd8191c90u, 0xd77031dfu, 0xa532207bu, 0x43495882u, 0x2b3b1a4fu, 0x0059a745u,
+        0xaf9b119fu, 0xebdcab14u, 0x63a59fe6u, 0x56ae40dcu, 0xa53ed400u, 0x86e5b76au, 0x237290a7u, 0xe8eab06eu,
+        0xd4ea3608u, 0x0a29bc93u, 0x365a1faau, 0x495fded6u, 0xb64e365du, 0x91d8658du, 0xfe9bd8e8u, 0xd5d513a6u,
+        0x1d15c949u, 0x55f3c171u, 0x4f826968u, 0x27cc9d8bu, 0x27432bd2u, 0x9fa9a2edu, 0x3fd5e78bu, 0x1d92f23bu,
+        0xee0857d8u, 0xd48eef33u, 0x9c8ddfbeu, 0x1413f8bau, 0x07a93262u, 0x3ba00cffu, 0x521f01a3u, 0xff70f1dcu,
+        0x611fce26u, 0x82a6e91fu, 0x0d05be77u, 0x6601aecau, 0x0272f094u, 0x4923d111u, 0xb8a1e45eu, 0x7124e0a8u,
+        0xa39cd55fu, 0xef15eac3u, 0x8330fcf6u, 0xc25d2055u, 0x60e11c0fu, 0x91f41dbau, 0xf80e8807u, 0x4e0e4ee1u,
+        0xdaa53198u, 0x5f6128c8u, 0xba38b643u, 0xa6a09e1bu, 0xda1cb01fu, 0xc685bcb4u, 0x1847c7c3u, 0x54ed07aau,
+        0x5f5cbb83u, 0x97fab43eu, 0x96269893u, 0xda561f2cu, 0x486a84a5u, 0xdb4e12d7u, 0xf8bafb49u, 0x17214868u,
+        0x1ac3da7du, 0x931a17a7u, 0x7d31942cu, 0xbef660dau, 0x242b20f7u, 0x3a08ec1fu, 0x4f4d54ddu, 0x1d66c439u,
+        0x5591caaau, 0x4ab2b7cau, 0x01eafcf9u, 0x1ed16401u, 0x23832748u, 0xf57c66a4u, 0xe05aa18du, 0xa536198eu,
+        0x2678bf76u, 0xc69b9287u, 0xd5fe4176u, 0x080f6a94u, 0x058943aau, 0x9eb06163u, 0x9f6639e7u, 0x5b8c0221u,
+        0x28e529b6u, 0x72753787u, 0x9d4c5aabu, 0x263decdcu, 0x4574e6efu, 0xacbae221u, 0xcf2179f0u, 0x9fb233e8u,
+        0x7291df4bu, 0x2b5b727cu, 0xb406fe76u, 0x345fbecfu, 0x3c5e4311u, 0x241d3dd8u, 0x047d1a15u, 0x0e74cbfbu,
+        0xcabe15b2u, 0x330cfbf3u, 0x0266237fu, 0xe1637124u, 0xaf129a01u, 0x44e9d550u, 0x1d056307u, 0xee6ea4b4u,
+        0x73082752u, 0x591a1616u, 0x07481121u, 0x8d2d905bu, 0x2c664bc0u, 0x044d4a01u, 0xe1711b25u, 0x31364638u,
+        0xc5925effu, 0x6285fd4du, 0x597b42c0u, 0x0c0efba7u, 0x919dd528u, 0x27c607e2u, 0x3f688922u, 0x68625200u,
+        0x0ce7862bu, 0x50fb9816u, 0xb50807ceu, 0x07eb5a20u, 0x9ebcfaaau, 0x01e1c967u, 0x26a27e2bu, 0x8a531278u,
+        0x72882e09u, 0x7842a600u, 0xd4e9d5e7u, 0x0a5d4d79u, 0x0fabc8bau, 0x67331271u, 0xcb60d3e5u, 0x3c20ee4cu,
+        0xee111696u, 0x6a273a3du, 0xa1597c77u, 0x37202da1u, 0x79a75653u, 0xc41f1238u, 0xc088eca6u, 0x73a87787u,
+        0x011c0152u, 0xc2ea4b98u, 0xd390a336u, 0xd42e41f1u, 0xfcf8313au, 0x66062151u, 0xf52186dfu, 0x383e6e2du,
+        0x27bea4a1u, 0x77bbee4du, 0x9a58f8e3u, 0xa2c4cecau, 0x3b31ce02u, 0x8420c94cu, 0xa237eaacu, 0xbe3abb80u,
+        0x9d64644au, 0x22eae164u, 0x79aab496u, 0x19dc11e4u, 0xf8cbb3f9u, 0x195a7f5au, 0xa070afe2u, 0xaea2819fu,
+        0xc738029au, 0xd6acbd9au, 0x4c74a259u, 0x2e5e76a1u, 0x8c4a23b9u, 0xb62ca7f3u, 0xe01aabc8u, 0x242d7c32u,
+        0x013f328fu, 0x24c74317u, 0x776e7b9du, 0xe2c3a4f9u, 0xc30f0894u, 0x9875fae9u, 0x2038f412u, 0x2ba10111u,
+        0xbb01cb19u, 0x0e89f529u, 0x29bec70du, 0x2a2d669du, 0xfb0584b9u, 0xdfa72f1fu, 0xea896860u, 0xa282e9c7u,
+        0x892f1013u, 0x86aa1782u, 0xc944caaau, 0x91c1d175u, 0x45fa8009u, 0xa66801e9u, 0x73174c4au, 0x07295c74u,
+        0x0edf6fd8u, 0xb636c2b1u, 0xdbb0352cu, 0x15162999u, 0xee01a86du, 0x23ebcb96u, 0x66056c4bu, 0xe3ba15fbu,
+        0x2a2d20a9u, 0x24708f9fu, 0xf34f1eb4u, 0xe4d1eb1cu, 0xcff8c10fu, 0xa78cac88u, 0x4e0d38d4u, 0x84096cebu,
+        0xc4dedcbdu, 0x8c0c3078u, 0x03ab68d5u, 0xd22a22f7u, 0x5049ff79u, 0xbee4fbefu, 0x3c90bd4du, 0xb23fd444u,
+        0x1c029368u, 0x3c8eea4du, 0x39062986u, 0x210fadcdu, 0xfd6bfcdfu, 0x08fb4fe8u, 0xf8d3837fu, 0x1f4d0b97u,
+        0x9b990047u, 0x167f12c5u, 0x534a6f70u, 0x2d8f700bu, 0xf0b7b270u, 0x025fc534u, 0x6d3ce422u, 0x294ddcdau,
+        0xdfb52824u, 0x4addf850u, 0x8d3d7cc5u, 0x1fb55e9du, 0x604893c9u, 0x2b21edebu, 0x3cebc25bu, 0x57866663u,
+        0x5ffaa45au, 0x0ceaa452u, 0x68cc8c96u, 0x4f91f249u, 0x550095c8u, 0x9b29cc64u, 0x663898a3u, 0x992d77d7u,
+        0xebd0d60fu, 0x2f57547eu, 0xab175dd4u, 0x84215057u, 0x1120fea6u, 0xb7ae2537u, 0xd658117eu, 0x5da1bdf1u,
+        0x93a92524u, 0xc28cd12au, 0x6690f312u, 0xdd416e9bu, 0x5239fc7bu, 0xcae71e0du, 0xdcf8ba0cu, 0x0419d76eu,
+        0x47ef7756u, 0x52e576c1u, 0x64b5abb6u, 0x344a8159u, 0x0bf2b624u, 0x1013ef68u, 0x1bdcaf0au, 0xa780bac6u,
+        0x36874fe7u, 0x0d6a5156u, 0xc7c2782du, 0x44626596u, 0x435884ffu, 0x07efae07u, 0x66c9e07fu, 0x2695db3eu,
+        0x200890e5u, 0x879d9475u, 0x841a031au, 0xeacd3dd7u, 0xacf13708u, 0x5920e0afu, 0xf535bb32u, 0xa03f97efu,
+        0x6c8e9c26u, 0xa0615ab6u, 0x834e6f1bu, 0x2c079294u, 0x8ecc7656u, 0x053e5ca5u, 0x3884acacu, 0x04425e4au,
+        0xbec010c2u, 0xee95e73cu, 0x480054a4u, 0xe1415929u, 0x9bb2c1b9u, 0xb5c517e7u, 0x2ac34edcu, 0x417e9a66u,
+        0x7d3b9636u, 0xe1bdef9bu, 0xcbe1e7adu, 0x6b930a00u, 0xb2833097u, 0xd75c5a7du, 0xa4471dc4u, 0x983385e2u,
+        0x691691dcu, 0x723c80a8u, 0xd8c292e8u, 0xf0b82af1u, 0x8e28e81du, 0x8e416124u, 0xec2371d2u, 0x4627100du,
+        0x9f473775u, 0xfdd60058u, 0x0f706862u, 0xb2028149u, 0x5c7ff93au, 0xfb0517b4u, 0xd697095au, 0x49d78689u,
+        0x3b8d9fe9u, 0x06bb27b4u, 0x5e131b7eu, 0x77563182u, 0xad5e346eu, 0x58b8e9a1u, 0x425bb519u, 0x7c2c1d86u,
+        0xa8085243u, 0xcb4c7fdcu, 0x773d5ccfu, 0x724f88ddu, 0x526767fbu, 0x21e8f139u, 0x6e56172cu, 0xf2b4afcfu,
+        0x2cb254c3u, 0x597caed3u, 0xf4e38cd9u, 0x0b59b4dbu, 0x312236dfu, 0x282e9863u, 0x6dbd55e6u, 0x8cd6a492u,
+        0xb7162150u, 0x8ae925ecu, 0x1a35be15u, 0x0f9a038bu, 0x4727b03eu, 0x5ab78012u, 0x7e4b8274u, 0xedd5189au,
+        0x643f971cu, 0xa95bd5e7u, 0x18a332efu, 0x36da0b62u, 0xfd8c8dd6u, 0x34456dcdu, 0x3edcbc68u, 0x87b418ebu,
+        0x32dda776u, 0x2d82d8e9u, 0x0782403cu, 0xb57c0b06u, 0x09aeb113u, 0x0bc9bba1u, 0x4637dfc1u, 0x65595fc4u,
+        0x1da70510u, 0x55432453u, 0x4a459cb3u, 0xeeb0f354u, 0x38f87afeu, 0xdfd9f5b0u, 0x4639b9e2u, 0xc32a108fu,
+        0x4b7924dfu, 0x098a9ad8u, 0x87f67ac7u, 0x4bd924e0u, 0x1e2da189u, 0xbc088611u, 0xb0e4420eu, 0x76f89f85u,
+        0xa7e26c35u, 0x558136f6u, 0xd52807beu, 0xff8bda34u, 0xc1b8bba6u, 0x01e90da8u, 0xde3ac9ffu, 0x00000000u,
+    },
+    { /* 2^148 */
+        0xdba48be3u, 0x03713550u, 0xff97a91cu, 0xbf735619u, 0xaa6865a6u, 0xfffe2389u, 0x693aa339u, 0x2a573612u,
+        0x6faccc47u, 0x9a8155a5u, 0x7e8ee9f4u, 0x837c0d8fu, 0x9df19bb4u, 0x050263cau, 0xe1c8b475u, 0xc303cd56u,
+        0x93dc014fu, 0x85b00725u, 0x3d1cc620u, 0x87ebb1bdu, 0x27daac1au, 0xaac84afbu, 0x4bf6651cu, 0xfd0db5e4u,
+        0x85fb8401u, 0x5f81978fu, 0xa0712d1eu, 0xbf59be9fu, 0xf1616043u, 0xb3dac0ebu, 0x0bddccebu, 0xd78db27eu,
+        0xcbc28ae9u, 0x93bc4683u, 0xb79d151cu, 0xaa17aa02u, 0x38e62658u, 0x469cc063u, 0x5ab3c42cu, 0x2be35701u,
+        0xa41589aeu, 0x1c31f901u, 0x1eca5b77u, 0x47584aafu, 0x4d6cbcd9u, 0xdc8438a6u, 0x05e8f0a7u, 0xd24ceb84u,
+        0xeee4dfe1u, 0x6cb8c49fu, 0x81154174u, 0x7170a8b9u, 0xb02369c6u, 0x60a30c7au, 0x4aa85b59u, 0x71ebf3bfu,
+        0x580d9993u, 0x68c58c52u, 0x2d665132u, 0xe78a05b4u, 0xa5b18097u, 0x118ea3dbu, 0xa3e3c205u, 0xc96973cdu,
+        0x5dee27b4u, 0xe20995d1u, 0xa3fc528eu, 0xfe38afd7u, 0x31a3648au, 0x42b695aeu, 0x623aa5bfu, 0xd63fdaa7u,
+        0x52effa69u, 0x6426d34cu, 0xb0168d95u, 0xc7bbeae2u, 0x8e3bad0du, 0x58520e80u, 0xd680fd00u, 0x241da515u,
+        0x9c10cfcau, 0x37845f5au, 0x374ec9d4u, 0x96101c03u, 0x60f66edeu, 0x8aaeb32au, 0x530ab3e9u, 0x17d246a5u,
+        0x5b218106u, 0x95bd6c24u, 0x233cad23u, 0x53926a6du, 0xac403be9u, 0xf63cb922u, 0x9a2eac03u, 0xa365110eu,
+        0xc1c16dcbu, 0xe58f2c2cu, 0xd899dcd4u, 0x11fcf6dfu, 0xd3307754u, 0xca2fd5a4u, 0x0a5b48e5u, 0x5fff0129u,
+        0x7be382c2u, 0xbbc0d2c8u, 0xe1787774u, 0x8d554af0u, 0x70b4d1f6u, 0x37b7ba3cu, 0x17585634u, 0x73608cfau,
+        0x0ca464beu, 0x5f7e1048u, 0x50e07d13u, 0x377dfc43u, 0x806487e0u, 0x3f669aecu, 0x60b8457eu, 0xded5be47u,
+        0xe9f42927u, 0x6316a14au, 0xfcfdf25du, 0x21c61ed3u, 0xb581a99cu, 0x9060fc9eu, 0xf4707be2u, 0xfadb8cceu,
+        0x9020cc07u, 0x0d101a5cu, 0x85733ee8u, 0xbcff6deeu, 0xcadc78e1u, 0x3d2e879fu, 0x65cfc216u, 0xb3196ecau,
+        0x0d4f09fbu, 0xa9c68efdu, 0xe6842db2u, 0x589506e1u, 0xddad74ccu, 0x1c0f5678u, 0x14962667u, 0xb3d65a2au,
+        0xf3827d5du, 0x4668a8efu, 0x81898dd4u, 0x33f0454eu, 0xdffc051du, 0x61c97c42u, 0x5862b65au, 0x9fa703c5u,
+        0x9689a91bu, 0x065d5bcau, 0x5f50dd78u, 0x66ed3af3u, 0x7c0b9e57u, 0xb9e4469fu, 0x092c5598u, 0x4f61ec57u,
+        0x90c35a5fu, 0xdbf0bf57u, 0xd9af03f7u, 0x123b39f5u, 0xbfcc1700u, 0xf4ca1648u, 0x132a4021u, 0xabbed1e4u,
+        0x5c674df8u, 0x6597efc4u, 0x1548c3bfu, 0xcf7b0309u, 0xfda06cf1u, 0xe3630e7cu, 0x059ae034u, 0x734dc790u,
+        0x016be069u, 0xe7cccdc8u, 0x1124cd09u, 0xbeb6df54u, 0xf978ebb4u, 0xb0dfe46du, 0x518781a9u, 0x291b0c41u,
+        0xa88e6c15u, 0xaca59ac2u, 0xaca4f059u, 0x7fad5754u, 0x4511f123u, 0xc1b1bc3fu, 0x050dee38u, 0x4be7513cu,
+        0x58d6e745u, 0x572bd645u, 0x704c23f3u, 0xe5639facu, 0xe57d0e79u, 0x40cf33a4u, 0x25e7dc78u, 0x5a06b4a8u,
+        0x81be703eu, 0x0405ac7eu, 0x312a61d7u, 0x41716f0cu, 0x097c7961u, 0x3452b674u, 0xf4c30ed6u, 0xf685a472u,
+        0xf064e6e0u, 0x1f138627u, 0x64fc5185u, 0x00154c8du, 0x4ad10e5fu, 0xe1394c25u, 0x93b1c8b7u, 0x113ca4f5u,
+        0x3e163be8u, 0x60fce857u, 0xbbc269ecu, 0xdef84edeu, 0x1f2b8c26u, 0x2bb36a04u, 0xf8ff68a0u, 0x5595d6abu,
+        0x364f5604u, 0x2982eb91u, 0xc2a17fa2u, 0xa2b43e50u, 0x1bf21300u, 0x82953cb7u, 0x7a2e6c13u, 0xfd9104c6u,
+        0x2105a475u, 0x71e462e0u, 0xdf294694u, 0xe50a80fbu, 0x26a970f7u, 0x3f85d53du, 0x2dc9a358u, 0xcabded78u,
+        0xc8daf4c5u, 0x2d83d6c4u, 0xa59908fdu, 0x782d7b8fu, 0x2864e10cu, 0xea2842e9u, 0xbe0422a3u, 0x819ad016u,
+        0x774309efu, 0x9a111ff7u, 0x01d472b3u, 0xda55b53du, 0x206e496cu, 0xb24fb45fu, 0xe00f9df4u, 0xc36249a8u,
+        0x7152b825u, 0xd784d9acu, 0xd37019c6u, 0x5a424022u, 0x5d97cd73u, 0xf1705e3fu, 0x86fe3aa9u, 0x468cdaeeu,
+        0x7b56bc5eu, 0xa8491d87u, 0xf7c5f846u, 0x5f48c4fdu, 0x0808de26u, 0x8ffd40e4u, 0xdd301b34u, 0xac75282fu,
+        0xb98f1669u, 0xab0c3ca7u, 0x94a685cbu, 0xfc4940d6u, 0xf99a6ba1u, 0x73f25ce1u, 0x10eac40bu, 0x83ecaf92u,
+        0x30234167u, 0x6642603cu, 0x601d2436u, 0x8ea443dfu, 0x1d7b2f17u, 0x3c1a7b8eu, 0xe1dae4feu, 0x1863563fu,
+        0x0dfb4a34u, 0x5473383du, 0x1c0c5adau, 0xa3033f70u, 0x3576cb71u, 0x39f42167u, 0x3af9f837u, 0xf53b3510u,
+        0xaeccdb0cu, 0xf333181eu, 0x5f6ccd07u, 0x152d9379u, 0x7544fcf5u, 0xbbe53ab9u, 0x3c5fb6beu, 0x9ec33be2u,
+        0x7b9925bfu, 0xceef71d0u, 0x0fba4b9bu, 0x89ad614bu, 0xfe1f7721u, 0x893f7d18u, 0xb09108f3u, 0x30713273u,
+        0x3e17c087u, 0x3926b0f4u, 0x378065d5u, 0xa561d35eu, 0x76bf566cu, 0x6be51e19u, 0x84454786u, 0x0a326400u,
+        0xbe27af8eu, 0xd62009aeu, 0xac7bcdd1u, 0x4dfb8a32u, 0x070c449bu, 0xa8c5ae9fu, 0x412e3dc7u, 0x0ef621c9u,
+        0xd21b15b1u, 0xe8c28e35u, 0x331c1a81u, 0x1737aa32u, 0x4704e7a6u, 0xcb914a49u, 0x3e57f744u, 0xd61ebc04u,
+        0x3d6bed5bu, 0x1266e19eu, 0x6a3874bbu, 0xfc291f8bu, 0xd59f91ffu, 0xc5c1c656u, 0xcfa386d3u, 0x5ec9ee41u,
+        0x70995686u, 0xc302a1b5u, 0x8f324b10u, 0x6e06a174u, 0x55aa537au, 0x7b79d353u, 0xd63bfb00u, 0x29aca1eau,
+        0xa0fba536u, 0xae546d36u, 0x4ebda480u, 0xfd40f94bu, 0x2e96c227u, 0xbc08d2a5u, 0xdd462364u, 0xab254111u,
+        0x5d9cb759u, 0x77ddbec5u, 0x3b76be39u, 0x439391c8u, 0x8b4d6691u, 0x0b744277u, 0x8f430169u, 0xe9f15a2cu,
+        0xbbfdb346u, 0x8ac7f4ceu, 0x0b76a47au, 0xb13155b0u, 0xce1e5d9eu, 0x10a4788fu, 0xcab29549u, 0x749cf68bu,
+        0x5b076025u, 0xae5390a3u, 0x562f31ebu, 0x644087ffu, 0xaac16ea2u, 0xc4dfd0e8u, 0xc50e8b72u, 0xd947b43du,
+        0xadbc27aau, 0x24008e12u, 0x26ae4350u, 0x0d5a16b1u, 0xcf230b47u, 0xe741893au, 0x68773b71u, 0x91348770u,
+        0x7b638f6bu, 0x0294cd2fu, 0x887ea2dfu, 0x60327197u, 0x6ead9e74u, 0x62f7c5bdu, 0xb23ab68cu, 0x9621318du,
+        0xc84921b8u, 0x4d420792u, 0x2cb2d67bu, 0x6550ac32u, 0x2e7c34b1u, 0x2c9b411cu, 0x1486e5bfu, 0x89518e55u,
+        0xf7240d8au, 0x644f2d77u, 0xf82aa1ecu, 0xa3fcb8c4u, 0x73830b12u, 0x8f26e4c7u, 0x5b5b1e18u, 0xf0230ba1u,
+        0x7b4beda3u, 0xfa01dc29u, 0x64d5e0a1u, 0x44558ea9u, 0x88db0b7bu, 0x1ce84ff5u, 0x7697c6cdu, 0x624e5b71u,
+        0x219148beu, 0xb8796feau, 0x5ffd3eccu, 0x9fbd5169u, 0xfcff575fu, 0x0c94df63u, 0xa8fb4dd0u, 0x31dab69du,
+        0x9fb2fbbbu, 0x0d1d103cu, 0x09ab48c1u, 0xb9119e36u, 0x268a7557u, 0x7c822a11u, 0xfa44faa0u, 0x532d27dcu,
+        0x18cce4b9u, 0x7c850693u, 0x80c3e72du, 0x9d560fccu, 0x186bb600u, 0x06c548d1u, 0xa7c76685u, 0x996c4c50u,
+        0xb3fef4fdu, 0xcebdc6cdu, 0xd5ab05f6u, 0xedc221d9u, 0xcdc096e6u, 0x5c361c25u, 0xe3c2ab47u, 0xceb0e16bu,
+        0x7284db16u, 0xa112a6d4u, 0x05f39af4u, 0xfa4fe3abu, 0xcb751ccdu, 0xdc3b8ddfu, 0x4a4ca6f3u, 0x77b032c7u,
+        0xad8246b9u, 0x13fb47a4u, 0x03f50b58u, 0xed7dc9ffu, 0x934b0ee2u, 0x0b0ea67fu, 0x9563d6f7u, 0x74bf2f6au,
+        0xfdc9100au, 0x9fbfd1f0u, 0x4f61252cu, 0x3722f7c7u, 0x4ab99e48u, 0xa014296fu, 0x638f4018u, 0xe0288a27u,
+        0xef604439u, 0xf1a4abf7u, 0xa541e29au, 0x6314af39u, 0xb3cefad5u, 0x47999e40u, 0x1c88a836u, 0xd4a34d23u,
+        0xbade8c6du, 0x5d265a30u, 0x4d13516cu, 0xefdb148bu, 0x635b24bau, 0x7845b396u, 0x790ea15bu, 0x6c2959bbu,
+        0x30c02d7fu, 0x83168626u, 0x7034e8fbu, 0x11666cfdu, 0x8a00e519u, 0xdc56c978u, 0x0e4537adu, 0x5f6d0b49u,
+        0x07bdc7aeu, 0x14d4c297u, 0x4811ec10u, 0x2dbc0c06u, 0xd35fc9a7u, 0x52da9528u, 0x8f8692f9u, 0x4d98a8ddu,
+        0x73022488u, 0x9612a0c6u, 0x107a14e9u, 0x302a8250u, 0x2d5e3120u, 0x4890afa6u, 0x45265ad3u, 0x2f09699cu,
+        0xc3fca6cfu, 0x7991d4d5u, 0x9e178d83u, 0x82113343u, 0x5efb9d5du, 0x822b97b2u, 0x450867d5u, 0x4ea972a8u,
+        0x113d2716u, 0x4d2529cau, 0xae9d81d7u, 0x2825a512u, 0x90782fefu, 0x3acebcc0u, 0xd722daefu, 0x571ddbe9u,
+        0xeea24005u, 0x4f57ff44u, 0xba42270fu, 0x9a7ab8deu, 0xc20eb265u, 0xe78b9002u, 0x8a94907bu, 0xc279470au,
+        0x6330d979u, 0x0402f5f2u, 0x47a32e5bu, 0x7a58822bu, 0x1a016820u, 0x8f089997u, 0x08c5e5c5u, 0xa9874371u,
+        0x885f3a66u, 0xa41ac3d1u, 0x65a8cc58u, 0x076d7d42u, 0x6e30ca1au, 0x3ff6fdf6u, 0x825b8d95u, 0x357c7d32u,
+        0xd4f2141du, 0xd4d93d1fu, 0xb6fdf528u, 0x17e4dbafu, 0xf4160e83u, 0x67f9dcacu, 0x816b1a9bu, 0xd33d9195u,
+        0x1260483du, 0x05eb2e41u, 0x83d39adcu, 0x7ab5f7b2u, 0xe6c01cadu, 0xc73e8526u, 0xdff59101u, 0x5bc47d59u,
+        0xafe08d1eu, 0xa628d597u, 0xfd6f66c1u, 0x9be42006u, 0x8a275c84u, 0xb08ca7c5u, 0x94c3f2fdu, 0x9250c34bu,
+        0xff827fe5u, 0x73c691e6u, 0xd3fc525au, 0xcbddab01u, 0x88e9099eu, 0x4c8cc367u, 0xac1232ecu, 0xcccebd28u,
+        0x29da65d9u, 0x52ff3031u, 0xb4c6ca17u, 0xe6c30027u, 0xe5dc1013u, 0x09f822f4u, 0xfacb3859u, 0x96b6e625u,
+        0x1105ba4bu, 0x47edace5u, 0x4dd1a510u, 0x6cf4b347u, 0xf61ac102u, 0xc5c8db5bu, 0x3487a4d6u, 0x0a6ed8f4u,
+        0xf36bfdf2u, 0x270ba5c3u, 0x3d9e21a0u, 0xa7acf9bau, 0x8a54201au, 0x9e489f65u, 0x206a5b49u, 0x3e8e08c8u,
+        0x4932965au, 0x093971e5u, 0xe4994490u, 0xe212e436u, 0x744bec8fu, 0x1ee577d7u, 0xe65c060cu, 0x00000000u,
+    },
+    { /* 2^149 */
+        0x791dc562u, 0x041914dcu, 0x37965d53u, 0x3a8e387eu, 0x5c01f9b8u, 0x2e758acfu, 0xceb79e23u, 0x6042fdd7u,
+        0xd3dd0156u, 0xd2417258u, 0x8502e4f2u, 0x93c28d89u, 0x418c5ddcu, 0xa220d095u, 0x5cde7b5bu, 0x2a855291u,
+        0x0aa7fb51u, 0x769d391au, 0x5427633au, 0x9f3e9c78u, 0xf9cf07bau, 0x60201051u, 0xa885293fu, 0xccf8b597u,
+        0xd7fc4bf3u, 0x0b719dd9u, 0x8456e396u, 0x51fa8935u, 0x33f36406u, 0x71a60a02u, 0xdf39a07du, 0xe64268c3u,
+        0x3e82240cu, 0x82ce5b7cu, 0x455b496au, 0x21384275u, 0xc91ba507u, 0x17c0ecf9u, 0xb546973eu, 0xe70efda9u,
+        0xdbe7a1c8u, 0xe0f5caebu, 0xdc71646eu, 0xb7eae940u, 0xdfbaaa68u, 0x2a7492c8u, 0x892d905cu, 0x0c7b7053u,
+        0x8b3bb87au, 0x85fc3653u, 0x6bb21ecfu, 0x0d439675u, 0x55044c68u, 0x93927b93u, 0xae85fc41u, 0x7acda9feu,
+        0x2007de6cu, 0x2c4e97dau, 0xb6f31042u, 0xe644aed3u, 0xcec57ca3u, 0xf08f719cu, 0xd1a46491u, 0x9512c2e6u,
+        0xc54aa622u, 0xb112e219u, 0x5e10e2aau, 0xa618c56au, 0x57e9e03cu, 0xf906d88fu, 0xfff30afdu, 0x703f6844u,
+        0xf6ac4acfu, 0xab422ad3u, 0xce77dcc8u, 0xf357248bu, 0x01bb697cu, 0xdde84422u, 0x51dd3314u, 0x481429c6u,
+        0xc75d8b39u, 0x6e6e8302u, 0xf2b691c1u, 0x8aa671a7u, 0xcda78f7eu, 0x90d044fdu, 0xe5831addu, 0x044f0a03u,
+        0x5bae091au, 0x36e65347u, 0xaebc7732u, 0x33a56e7bu, 0x2d45b7deu, 0x11fdb5f6u, 0xb6c24945u, 0xc4d32290u,
+        0x43c25033u, 0x00a03036u, 0x490cb439u, 0x98a83f35u, 0x09d040c4u, 0xd0d527d4u, 0x73fe4ba9u, 0xdd18a192u,
+        0x370ce840u, 0xafbf1df9u, 0xe11a33d9u, 0xc53ee85cu, 0x585abe89u, 0x734243a5u, 0xb4aa819fu, 0xbd282577u,
+        0x2c3fa230u, 0x01f543e2u, 0x48ff5a0au, 0x52987aa1u, 0x22856402u, 0x1a05d6cbu, 0xb0fe393bu, 0xd1f84472u,
+        0x4ef81100u, 0xe9efb67du, 0x64b906d0u, 0x50a11ea7u, 0x4df4385au, 0xd58830bcu, 0x89dec9e8u, 0xb957ebafu,
+        0xdf7ff09bu, 0xb7ebd21eu, 0x07288745u, 0x3a16e2fbu, 0x379ba10eu, 0xa30573b6u, 0x580c665cu, 0xc74c6805u,
+        0xc12f791au, 0xf7798365u, 0xafe495c5u, 0x8e9486e2u, 0xf89acea8u, 0x0a387beeu, 0x8cc9a2acu, 0x096847dfu,
+        0x95671f9eu, 0x28bd88bbu, 0x7904cab5u, 0x4b0024b3u, 0xd5d04e2du, 0x001cb1a0u, 0x4d82b65eu, 0x6a7d9129u,
+        0xf5943a13u, 0xb6bd6ebbu, 0x098fa9d8u, 0x5b412c29u, 0x66e726e1u, 0xca8a0179u, 0x11e9a568u, 0xcb064d0du,
+        0xdc189f2bu, 0xd2f36e58u, 0xf48aadc6u, 0xdfa28991u, 0x114c1c5cu, 0x0db0f0c5u, 0x8c45c9c0u, 0x93035525u,
+        0x07193583u, 0xa8b20095u, 0x82c56c89u, 0xfd89d4ecu, 0x95b6aab5u, 0x4b94ea38u, 0x488a3132u, 0xf4d9b06eu,
+        0x0d6ea1c3u, 0x089ea1c6u, 0x1cb1e435u, 0x059fdf94u, 0x5abe8b5bu, 0x211869f5u, 0xd5ba7a21u, 0x5bb87541u,
+        0x4ea4b78du, 0xedc46895u, 0x954bd364u, 0xb8a882e1u, 0xeb4fd31eu, 0xf58248f2u, 0x14f1ae0bu, 0x89064524u,
+        0x8610e298u, 0x9dff0ab4u, 0x0adeb794u, 0xed134a9bu, 0xa781c369u, 0x7ba48ec3u, 0x940c77a6u, 0xf44cebb8u,
+        0x411a6864u, 0x92d42e29u, 0x7eb3d076u, 0xd8928996u, 0x9351f7f0u, 0x2579e6a5u, 0x7c767667u, 0x97d1a781u,
+        0xc9bd360bu, 0x36c2f80bu, 0x4c3c206du, 0xeedbcd48u, 0xcf9fc24fu, 0xd727d3e7u, 0x3e86fa50u, 0xa9b42369u,
+        0x2abee0b0u, 0xb2ff8de6u, 0x3c7f4b2bu, 0xa8a3e2b2u, 0xee6d3c06u, 0x39c77d96u, 0xfc3c76b9u, 0x0eb1791cu,
+        0x2751a507u, 0xcefddf51u, 0xa0e2b3a3u, 0x62c849ceu, 0x835e7186u, 0x63e93af7u, 0x93a2619du, 0x1f15ed3eu,
+        0x740b67bbu, 0x5172f544u, 0x60014f00u, 0x981ce675u, 0x257d96a2u, 0x93bb1f95u, 0xd016bebcu, 0x09dfe973u,
+        0x2b422896u, 0x03da5cefu, 0xd3f00e26u, 0x525241a0u, 0x2c0d17d8u, 0x2d54a8eeu, 0xa998a356u, 0xa1cc8177u,
+        0xb7089961u, 0xe53d4326u, 0xb9a23911u, 0x1b4d3666u, 0x6e5ac166u, 0xa6799888u, 0x2f58ef86u, 0xe4cf21a9u,
+        0x7df40dc9u, 0xb575cf3fu, 0x241fc817u, 0x962e69beu, 0xf7c452bcu, 0xf13e79eau, 0xcb3b2c9eu, 0x144f7f3bu,
+        0x644c90edu, 0xf17d2d66u, 0x5fafda8eu, 0x72631896u, 0xc734836eu, 0x1cd11227u, 0x6e5a4daau, 0x4da560dcu,
+        0x541d934au, 0xa347dfbcu, 0xe155126bu, 0x09b9966eu, 0x20437a1cu, 0xf99af109u, 0xac71b28au, 0x5407c406u,
+        0x0f156d28u, 0x8143ad77u, 0x88c6beeeu, 0x0e4857c8u, 0x81e38909u, 0xa79c2fa6u, 0x85b20de2u, 0x6cb963c7u,
+        0xa316c3fau, 0x9ef00842u, 0x64e86c26u, 0x0c8a4db8u, 0x65bafc37u, 0x2f9b28edu, 0x08b308e8u, 0x936dd39fu,
+        0xdb5ed188u, 0xf823da79u, 0x9d62ae2du, 0x176ca38au, 0x1e44fcb5u, 0x829a4d61u, 0xa0e8a5b2u, 0x94c25b38u,
+        0x797be416u, 0xee27e47cu, 0x61bb0a88u, 0xf1330c07u, 0xb77041eau, 0x4cd37595u, 0x7f2c2e7bu, 0xb97b3aaeu,
+        0xacf58d3fu, 0x3f6805d7u, 0xb1df3dbeu, 0x778f51cfu, 0x43b501d4u, 0x2ecbe4d8u, 0x7ef59a83u, 0xc994bc2fu,
+        0x29bd4ce6u, 0x593f1e6au, 0x2adad2d8u, 0x0450d123u, 0xb60b76d7u, 0x51f60cb3u, 0xd045dfb5u, 0xdf7ae891u,
+        0xa4f922ceu, 0x5388ef0fu, 0x418a0a3fu, 0x28a7ca51u, 0x6bbf7e98u, 0xadcc0508u, 0x0c5f113bu, 0xe9fe1b33u,
+        0x657a9a83u, 0x64c52a4au, 0x264c3228u, 0x2e4aacffu, 0x08205608u, 0x7b946920u, 0xec2b2e70u, 0xf80453e1u,
+        0xfdb93c9au, 0x518d82d0u, 0xa5f755a4u, 0x9defcfddu, 0x5c81d0e4u, 0x70b28f47u, 0x0f8d089bu, 0xfdbe882bu,
+        0x30d45a0fu, 0xdc307003u, 0xb9035db9u, 0xa466d370u, 0xe44849c3u, 0xaf1b661eu, 0x3008b995u, 0x64226902u,
+        0x3fce55f0u, 0xfda40a82u, 0xead10ea4u, 0x110a73dau, 0x7764e9a8u, 0x037fa2cbu, 0x4b43f2cbu, 0xf0d190a9u,
+        0x1096fc80u, 0x248f96ceu, 0x71163043u, 0xc4c139cau, 0x9279c3ccu, 0xec81155cu, 0xee98db5fu, 0x07dff4a9u,
+        0xfe288637u, 0x9d5d2c38u, 0xba047db7u, 0x76249f1eu, 0xd1f0a8c5u, 0xf8783a5eu, 0x0fcce88cu, 0xe206536au,
+        0xcd3f88cdu, 0xfe520adfu, 0x4ca8b42au, 0x17aa4ca5u, 0x702247f3u, 0xef0f8828u, 0x2fb6fa16u, 0xa8a2e796u,
+        0x3466be58u, 0x7d053e28u, 0x04fc14d4u, 0xa2569e3bu, 0x0878a6b7u, 0x273b0c66u, 0x11462de4u, 0x827be96eu,
+        0xdb0ffba2u, 0x873000c6u, 0x7c958e7eu, 0x62b944aau, 0xdcf94495u, 0x5e55b4a8u, 0x5eecb8cbu, 0xf90de92au,
+        0x7e9870f5u, 0x935932a0u, 0x150d45efu, 0xa21f9706u, 0x8105eb0du, 0x3b9d644cu, 0x1deb42efu, 0xd1a63236u,
+        0x6edb858au, 0xaf1899f3u, 0x594bad49u, 0xfdd9c433u, 0xd098712cu, 0x867b29d1u, 0x4a71c532u, 0x6b729b8bu,
+        0x5ddce675u, 0x56c32030u, 0x6d28832eu, 0x4e1fe59cu, 0xecd9d926u, 0x3458e2a1u, 0x4e0c95c7u, 0xefa1303au,
+        0x4bc4c6b2u, 0x2731af9fu, 0x523f18c6u, 0x39518b19u, 0x0de23927u, 0xd6ac620au, 0x98fb0537u, 0x4dff4275u,
+        0xc2b4dd1au, 0x52cbbea4u, 0x1cbfa2acu, 0x0e974bacu, 0x21b1f1cdu, 0xa9f70d29u, 0x505c1d0fu, 0xdd88486eu,
+        0x2b1751e1u, 0xbf703ec3u, 0xc6ae96abu, 0x1e9827b4u, 0x597a6217u, 0x9f08a1a0u, 0x7bb351fau, 0xb7be03a4u,
+        0x68274179u, 0xad239b2cu, 0x6def3b12u, 0xaf28a131u, 0x510e3887u, 0xd1855822u, 0x06e32efau, 0xcb18a287u,
+        0xa6c83cd7u, 0x1348dd65u, 0xc84b5543u, 0x2701f88fu, 0x6617ef5au, 0x1d3599f0u, 0xcc156e37u, 0x8c69fc1bu,
+        0xc695a694u, 0x7e2d0484u, 0xe6dafd19u, 0x5889e104u, 0xda80496au, 0x5fcafbf4u, 0x0de3e9e3u, 0x808546b2u,
+        0xcb1f057cu, 0x4e094039u, 0x4b936ba6u, 0x33859594u, 0x446bfda9u, 0xc22d9dcau, 0xc42330eeu, 0xbb8dad9du,
+        0xfd5e0975u, 0x1328956cu, 0xb56f2e92u, 0xb88916ffu, 0x8c1bafe9u, 0xde91936au, 0x08d27af0u, 0x9d7a3bedu,
+        0x9261ab5fu, 0x31e11d60u, 0x51b6c131u, 0x7162145eu, 0x731aaa72u, 0xbace6639u, 0x7147be86u, 0x20120452u,
+        0xf7c7095eu, 0xa49f3cecu, 0xc6592c37u, 0xedaff5b6u, 0x906b538du, 0x71039b19u, 0x1fdf9b21u, 0xeb507a42u,
+        0x03370127u, 0x91fcd680u, 0x04810f5cu, 0x02b89437u, 0x6768a054u, 0xfc899c38u, 0xdf8e81b5u, 0xc33ff549u,
+        0xdb1379b2u, 0x64a6d3aeu, 0xf7d5ffecu, 0x873a4f3au, 0x69437bf4u, 0xbe13819au, 0xb940f0deu, 0xc43eb9a8u,
+        0x0b6f05deu, 0x37d8a111u, 0xec148ebfu, 0x3bf036c4u, 0x8889ba98u, 0xd04d8966u, 0xd8fd77f2u, 0x9dd54867u,
+        0x9ae75cc0u, 0x38b7877fu, 0x5b79fc40u, 0xe14feb01u, 0xcd2d275au, 0x565b6d1bu, 0x3983f7afu, 0x6998e537u,
+        0x1424e6f4u, 0xc16f1b2cu, 0x3f81f502u, 0x61faf7b1u, 0x38efd518u, 0xc3cf02d1u, 0x3b286b16u, 0xa42676feu,
+        0x47588e49u, 0x0921a63du, 0x7c4252cbu, 0xcbb89ea8u, 0x6b352285u, 0x7ee02b24u, 0x10a6a8cdu, 0xad760723u,
+        0xc6aac8b6u, 0x75e76a19u, 0xfa608eaeu, 0xb6a81152u, 0x00fc3a07u, 0x3437e340u, 0x2e6d4250u, 0x451b3003u,
+        0x39171d29u, 0xc28ad678u, 0x7a853604u, 0xc77c7f23u, 0xbfb99b2fu, 0xbdd92542u, 0x5746ef8du, 0x3846107eu,
+        0x68bdf0b5u, 0x04a5be6fu, 0xad50e982u, 0xef217a7fu, 0xf58e178cu, 0x0728576cu, 0x57e732f6u, 0xc3d70296u,
+        0xfaa95272u, 0xb9e35989u, 0x5624fa96u, 0x9f0e083bu, 0xbd756222u, 0x91a13739u, 0xac14e942u, 0x165c88c3u,
+        0x91f4842cu, 0xd337f4c8u, 0x3dea8365u, 0x60422144u, 0x7126bed6u, 0x5648afafu, 0x5f8bef59u, 0xa0597e2fu,
+        0x0a13ed53u, 0x2973fd21u, 0x3e7f4b35u, 0x3f13c352u, 0x8699f198u, 0x0c4f4a29u, 0xfed5946bu, 0x6d31b10au,
+        0xd6fc2214u, 0xd0b9ceeau, 0xd1a1aeb3u, 0x09624c44u, 0x36d50b93u, 0xbeff2f21u, 0x10e9562bu, 0xb4dfea4cu,
+        0xbaad3ee5u, 0xf6b4572au, 0xac512d75u, 0x3cc28bacu, 0x43e02182u, 0xb7c2bc02u, 0xcb2437ecu, 0x00000001u,
+    },
+    { /* 2^150 */
+        0xe99790a9u, 0xce2db87fu, 0xe77e0343u, 0xc2dd7d97u, 0xc9af3699u, 0x635ba45au, 0xfdbc0bd9u, 0xd206b9b7u,
+        0xa5d91995u, 0x75880ac9u, 0xa17c5f13u, 0xc61c7686u, 0x26139ef6u, 0xb15af5e5u, 0x95dc37e2u, 0x18f91fd2u,
+        0x00713bd4u, 0x4ec69cc7u, 0x62c61ce2u, 0x50910db1u, 0x6d403b12u, 0x4b0e9a22u, 0x7335ca8au, 0xe8fc67fau,
+        0x6a0d4629u, 0xd2ee477du, 0xfc11bdfdu, 0x32fe55f9u, 0xd544ca27u, 0xfd946348u, 0xc544d2dau, 0x09e827aau,
+        0xc9b0c55bu, 0xf162c78fu, 0xdb2582a8u, 0xb6446ed9u, 0x7dec3e76u, 0xca04f329u, 0x5cb7d1b7u, 0xf1ac6378u,
+        0xf012930au, 0x7c09e067u, 0x4db380c9u, 0xe1cda553u, 0x39db26dbu, 0x2c7c217fu, 0x6b8720fcu, 0xe190fe19u,
+        0xd67f4d51u, 0x92b7494fu, 0x7993e0d7u, 0xc67f95a0u, 0x338c29e1u, 0x58cee816u, 0x21d1ed22u, 0x60afc081u,
+        0xa9618840u, 0x2e0d66e6u, 0xe83c4fb8u, 0x13689088u, 0x40e80b01u, 0xbcb157dcu, 0xdbae939du, 0x2db187ffu,
+        0x8d8710d7u, 0x600a8b5du, 0x99bd2449u, 0x2ebe2471u, 0xee13a9ceu, 0xe3eeb10eu, 0x1be62700u, 0x5218fa3du,
+        0x2ce82769u, 0x7c631180u, 0x0f24e0adu, 0x1581932fu, 0xa113bf44u, 0xa1fde563u, 0x2c00a025u, 0xcb3f826au,
+        0x2394ef17u, 0x243789f3u, 0x1c35b776u, 0x9101cbe0u, 0x13f3bb17u, 0x1ecf1d2cu, 0xbf349c0cu, 0x5763167bu,
+        0xe69bcc8au, 0x9010ce3au, 0x01e378fau, 0xea9368afu, 0x0c8f4759u, 0x5fecf1bau, 0xfbe8764bu, 0xaf355918u,
+        0x5db820d6u, 0x9541fb7bu, 0x7520692eu, 0x02482cdbu, 0xaf8dd849u, 0x92e4e17au, 0x1071f97du, 0x6801b769u,
+        0x8c285874u, 0x10673fedu, 0x6717054eu, 0x8de6ef84u, 0x8520a8fbu, 0xc9e02fecu, 0xf5fbe288u, 0x72d05608u,
+        0x340a2c2fu, 0xb6887fbcu, 0x9c3752cfu, 0x8b79f776u, 0x07ea562au, 0xed3c72cfu, 0x33e90cf5u, 0xca52b7d8u,
+        0x4ed27a7cu, 0x73eca16fu, 0x6d9fdb9cu, 0xb2f99ca8u, 0xf3d1c7b5u, 0x09883f89u, 0x7ece293au, 0xd4fca37eu,
+        0x88ba15e2u, 0xd5bad454u, 0xd5f29269u, 0x97048cdbu, 0xf6edf94du, 0x2627319eu, 0x20269a97u, 0x1b189684u,
+        0x1257ff3du, 0xcb24ad70u, 0x847f4d8cu, 0x4e1dcb7fu, 0xc0316f95u, 0x51ef3db2u, 0x8a9a7447u, 0xfbc72354u,
+        0x9d0a7c9fu, 0x557579c9u, 0x4e7038e5u, 0xf9d7d41eu, 0x583436efu, 0x38a31faeu, 0x760c804du, 0x8ced7aeeu,
+        0x3e678a3au, 0x312ecb72u, 0x90bb4d1bu, 0x444d18fdu, 0x0de2a665u, 0x32782ffbu, 0xc746ee86u, 0x4b4f8caau,
+        0x670153aeu, 0xaf4807e9u, 0xd37b7cb7u, 0x08a4f1eau, 0x8b746e3du, 0x1b6c3f90u, 0x864d19fdu, 0xc38e815fu,
+        0x6bd6965du, 0x808be04du, 0x327b4dfcu, 0x77c01112u, 0x4674f105u, 0xab0329e5u, 0x2f6a1876u, 0xdd297b3cu,
+        0xa0b4c100u, 0xd3886cdeu, 0xccfde969u, 0x54f9ec71u, 0x2c925522u, 0x4bedc49du, 0x0cee0eb2u, 0x1839911eu,
+        0x7435c58fu, 0x6c619331u, 0x307d5a59u, 0x49e9b591u, 0x8aa1e61du, 0x8bd69cfeu, 0xd79c6a17u, 0xb1d42433u,
+        0x41b51c71u, 0xf28a66f0u, 0xbbfc5b44u, 0xf03cf5d5u, 0x50705232u, 0xc872e7e0u, 0x4c0dca59u, 0x42eabc88u,
+        0x2370fdf1u, 0xca2f80ccu, 0xcc3bc09bu, 0xa1bc88eeu, 0x2d900aa7u, 0x8d9627b6u, 0x64cea0e1u, 0xe96ea403u,
+        0x3cda68cfu, 0x938140f8u, 0xff205870u, 0xaf587891u, 0x173366a8u, 0xed123eacu, 0x0d8340c4u, 0x1c89e22bu,
+        0x5d10c14du, 0xc3771717u, 0x29901e09u, 0xfd5c4dbeu, 0x92581bfcu, 0x7a419308u, 0x58e27aacu, 0xce2749b9u,
+        0xa967577fu, 0x48ee39b5u, 0x0e69c174u, 0x8ff16696u, 0xcc4bf55du, 0xc86756a6u, 0x8e80b5bcu, 0x22ef405eu,
+        0x53be68cdu, 0x8e25b21du, 0xa0c4f3b9u, 0x158d576eu, 0x3af8cb2eu, 0x94a3473bu, 0xb51e83b5u, 0x1cb92bc9u,
+        0x178a4780u, 0x103d62a7u, 0xf1be585bu, 0x61c40384u, 0xe6dd790eu, 0x0e84bcf0u, 0xd95f7861u, 0xa2c626b4u,
+        0xd1e29742u, 0xccca73c4u, 0x69fb062fu, 0x3f45f3e2u, 0xaba82523u, 0xf153fbc0u, 0xfd79f591u, 0x62f576b2u,
+        0x1617aa07u, 0xa4433f97u, 0x8a068c60u, 0x6a9aa840u, 0xb5408393u, 0x33a27cc6u, 0x8e60bb55u, 0x7a50b39bu,
+        0x19fecb3fu, 0x86b24e3eu, 0xdfe4d982u, 0x3aef7553u, 0xde298240u, 0xbe61b465u, 0x373f7c4au, 0x99de49e8u,
+        0x88b85e4bu, 0x85ac7ca8u, 0x5c7176abu, 0x81bf3ed2u, 0x2c9917a4u, 0x92d5a9f4u, 0xdc052a60u, 0x462b4655u,
+        0x39782a96u, 0x4ab67e48u, 0xf046cbebu, 0x80907e4cu, 0xdc7e317au, 0x82533959u, 0x1457de96u, 0xa1913a91u,
+        0x65f6a15eu, 0x4395fc3fu, 0xed276208u, 0x2fe28e27u, 0xfba58807u, 0x80209ee3u, 0xd9ac33fdu, 0xbda41f3au,
+        0x52758a19u, 0x49a9b9a9u, 0x5457217eu, 0x3c76c0f2u, 0x974516f1u, 0x50dd8b03u, 0x2390aa0fu, 0xedfa4bd3u,
+        0x00d10043u, 0x75cbaf19u, 0x72f27d74u, 0x9b425729u, 0x1dc7b03au, 0x8ac0ba6bu, 0x54bd5fddu, 0xf60a24b2u,
+        0xcd0d9555u, 0x31303320u, 0x89b18b0au, 0x2f4c1f84u, 0x2733c0dcu, 0x73545700u, 0xd73aae75u, 0xef0d99b4u,
+        0xd41b3a9au, 0x657efa49u, 0x7b6d3920u, 0x6fa25570u, 0x9b6cc291u, 0x843e3017u, 0x44c162a3u, 0x9fdbaa85u,
+        0x0ee0ae0du, 0xf14303f2u, 0xcf69d7c5u, 0x67a2e41au, 0x1b0ef4bau, 0x988f6370u, 0x73c51de1u, 0xaa54dba3u,
+        0xb3b2a115u, 0x823a5323u, 0xbd56f37du, 0x41ad6ad6u, 0xab989f2fu, 0xb8bfc8fau, 0xf579e314u, 0xd75d72c9u,
+        0x7af15759u, 0xce6b1bf6u, 0x29f97cf5u, 0x775f8511u, 0x2e916506u, 0xe2e78260u, 0x660f6123u, 0x135315d6u,
+        0x78c74ae6u, 0x92a1d552u, 0xdcde566eu, 0xbb96c5f5u, 0xfba5ef06u, 0xf79574deu, 0x5b228f65u, 0x03d7ff38u,
+        0xfef191c1u, 0xd7acf550u, 0x897608beu, 0xa01f4b7du, 0xe3ae6b4fu, 0xc9388dd7u, 0x0e05e02cu, 0x24df1c7cu,
+        0x9323d78bu, 0x0dfc58bbu, 0x0561ed87u, 0x5393b23au, 0xc0b604e2u, 0xf61f5436u, 0x9260b667u, 0xffc3552bu,
+        0x1c9c6948u, 0x061db340u, 0xa45704dbu, 0x69245a97u, 0xd4994f84u, 0x4b0f04a5u, 0x67c69924u, 0x5d0b8293u,
+        0x4004eb8fu, 0x162a5d65u, 0xca668913u, 0x0b5508e6u, 0xb5932f76u, 0x36e27807u, 0x18999de0u, 0x064fe30eu,
+        0xaf69bb54u, 0x6d074490u, 0xf7d5a09cu, 0x46a37bdfu, 0x3891b6a0u, 0xb9007010u, 0xc292d5b2u, 0x974c4e05u,
+        0xf0e9075du, 0x07f5ad48u, 0xfb7d8c37u, 0x1fe1d459u, 0x8abaab65u, 0x4ec3bda1u, 0xa506ed6du, 0x2ef89826u,
+        0x224af864u, 0x7414ece2u, 0xeb5d8b9fu, 0x09d8d287u, 0x5031ac45u, 0xf4f07b3au, 0xb025cb36u, 0x008a5554u,
+        0xa955b926u, 0xb23e84aeu, 0x7f6c070fu, 0x551fb323u, 0x7518b112u, 0xcae37c43u, 0x82f668d1u, 0x22fc0da7u,
+        0x01b62485u, 0x885399b8u, 0x83ec1b72u, 0x3813c240u, 0x388b2c42u, 0x471968a6u, 0xfd46619eu, 0x88a5ab1fu,
+        0x43a03928u, 0x611ec2f4u, 0x2e088e7cu, 0x2b9a72fbu, 0x49a4dce8u, 0x59bf141du, 0xbf1f80ccu, 0xe66f5ad0u,
+        0xfbe8b0d1u, 0x8e8f95a2u, 0x5eb22139u, 0x54ee4bb0u, 0xb70af1f0u, 0xf9dd689fu, 0xcf3ebafcu, 0x56e9c25eu,
+        0x52d43283u, 0x38da480fu, 0x4d0d1fa1u, 0x58f7a7cfu, 0x4e9cfc16u, 0x37eb22edu, 0x8c8162f5u, 0x3517c988u,
+        0x752c1077u, 0x4104efefu, 0x5aa64667u, 0x394467d6u, 0xe9d06376u, 0xaaf812bau, 0xbb289f71u, 0x5db1612cu,
+        0x6f3db7ccu, 0x2f59d96bu, 0xb92a7c1cu, 0x9b1f3ee8u, 0x33d9e1fdu, 0xd6d9f333u, 0x602b114bu, 0xd5bd794cu,
+        0x5786a93bu, 0x0c42a6cdu, 0x9b5e0ff4u, 0xa263e66bu, 0x992fc92cu, 0xdf33f333u, 0x4d4c308bu, 0x817b4e62u,
+        0x91d4bd48u, 0x0a0b8181u, 0x162930b8u, 0x5022029eu, 0x6ceaa099u, 0xf6e3aa44u, 0xb54b23cau, 0x77a91a11u,
+        0xbbe0e185u, 0x335f44acu, 0x488ca9e0u, 0x5c9af596u, 0x6924f174u, 0x12fd9b77u, 0x42b2c121u, 0x142bccd9u,
+        0x6896b4d3u, 0xb538649bu, 0xb282dad4u, 0x116d067du, 0x968c7a12u, 0xe077b09eu, 0x3753edc9u, 0x959458e2u,
+        0x77d63366u, 0x630f2a30u, 0xd901be14u, 0xfe42e1c9u, 0x9d29b562u, 0x7ce848b3u, 0x376b2b0eu, 0x5cc9f915u,
+        0xc0d16aacu, 0x15e97f49u, 0x38c4f1c6u, 0x60971290u, 0xcccd1ba7u, 0xa97e3f7bu, 0xb9be1b8fu, 0xef69af8cu,
+        0x792885ecu, 0x223a6b25u, 0x5151ec38u, 0x8423dee8u, 0x05350e50u, 0xcfa7a11cu, 0xdba2e05cu, 0x6051b395u,
+        0x36eae455u, 0xe27a4977u, 0x13fb9b57u, 0x9adb57f7u, 0xf36aee5bu, 0x51442ad5u, 0x1f8aebb9u, 0xb62c02ebu,
+        0xd69bc908u, 0x7198a21du, 0xc101d639u, 0xa056381du, 0x9a451ac6u, 0x0cea13f4u, 0xd8dd2389u, 0x522798cbu,
+        0xf8c7e842u, 0x4499ceb5u, 0x66b4fd6eu, 0xb30ff1edu, 0xb21f678cu, 0xceaf94b9u, 0xf19e9938u, 0xddb59341u,
+        0x030d1f64u, 0xbf320883u, 0x8c3a7aa1u, 0xc36c62f0u, 0x53701799u, 0x27f5b0e1u, 0x3f9bb3f1u, 0xeb8dd921u,
+        0x0aa61108u, 0x664d3195u, 0x964d0ebfu, 0x8be48957u, 0xcafe4829u, 0xf9658d50u, 0xe7246af2u, 0x63c773aau,
+        0x1ad0b271u, 0x5e83e11bu, 0x7bbbe20eu, 0x1f25a6a8u, 0xc961557du, 0x18f3f928u, 0xf93005acu, 0xcb11806eu,
+        0x754aa80au, 0x46278ec6u, 0x50b18573u, 0xf1105885u, 0xfc8782a8u, 0xc63431b3u, 0xdb59ec0au, 0x9e3bf50eu,
+        0x6aba2408u, 0x737176bcu, 0xea78d1f1u, 0x8ce63ac2u, 0x8efe702au, 0x140fe490u, 0x9aacd2a4u, 0xa683a1c5u,
+        0x83169871u, 0x4ae0a60eu, 0xaddef250u, 0x737aeb12u, 0x6ebbdf50u, 0xc3e7e773u, 0xd2d92ee0u, 0x44760e09u,
+        0x811ef7c2u, 0xd74a4d77u, 0x2c1958f2u, 0x1f43a0c3u, 0xa03b301fu, 0xb8df02fdu, 0xe87fbb39u, 0x06765455u,
+        0xe0aa3990u, 0x98f81e5au, 0x79b3e3dcu, 0xd4b3fa25u, 0xd260cf8cu, 0x8b27e6cfu, 0xaa5771c9u, 0x82fa55afu,
+        0xd787dfb3u, 0xe38e33b4u, 0x99a4200fu, 0xfa49f1fbu, 0x0ab3eb09u, 0xd5243cd6u, 0xb530cd28u, 0x00000000u,
+    },
+    { /* 2^151 */
+        0x4ae0bf55u, 0x5269f6fbu, 0xb788334eu, 0x5086932du, 0x6f0822e9u, 0xcc2d524bu, 0x3f5d4df4u, 0x3cc2f7d2u,
+        0x3015d944u, 0xe4a99107u, 0x434ee45du, 0x694fd17cu, 0xd4fe63c5u, 0x3c8ff9f4u, 0xe7157827u, 0x9f8486c8u,
+        0xa75ae437u, 0x700afdcdu, 0x97dd7fe0u, 0xa110ae00u, 0x807c5c71u, 0xee211e78u, 0xc8c79a91u, 0xa1c568a9u,
+        0x3b52a405u, 0x6c96465bu, 0x038aace3u, 0xc697ca67u, 0x2b1cf01fu, 0xd3d0d8dau, 0x97eae4bfu, 0x7f011a1au,
+        0x33a4f1a4u, 0x50e7a462u, 0xe6030fe5u, 0x38c65014u, 0x1e70ebd1u, 0x091ac3abu, 0xac64ae80u, 0xdd69ac53u,
+        0x721114deu, 0xdf2b9b73u, 0xf439c4cau, 0x6a9fe526u, 0x2f0da8e9u, 0x0034d0f8u, 0x8a4b2678u, 0x34807621u,
+        0x83e6280du, 0x0d5b4904u, 0x5f4bbe07u, 0xfebc5d91u, 0xd6f1a450u, 0x9ec84eb5u, 0x2e8f7874u, 0xe6dcb7adu,
+        0x789ba82fu, 0xc59fb87au, 0xb4dff71fu, 0xc318bcf0u, 0xb1c3ced0u, 0x05ecdb11u, 0x253e5350u, 0xdc9a0312u,
+        0x9466d0f7u, 0xceb5d0acu, 0x48635febu, 0x167ea7c7u, 0x8b34af7eu, 0x65f77468u, 0xa7228a0cu, 0x4d42b340u,
+        0x7d96a31du, 0x8509ffc6u, 0x4871d5e6u, 0x6532ec02u, 0xda3bbf4du, 0xc80c2dc5u, 0x78745a20u, 0xe14f5025u,
+        0xe2b2f1d4u, 0x7c4f8579u, 0x66c27441u, 0x5149ae31u, 0xc91c752au, 0xb3cb62c8u, 0x986ba7b4u, 0x78511b8au,
+        0x1bcc9cb4u, 0x08007c71u, 0x1d85f2f2u, 0x43b61365u, 0x42d3d011u, 0x614d6583u, 0x7a7d9412u, 0x0abf28dcu,
+        0x008d347cu, 0x49d167e7u, 0xbd0d79d3u, 0x46fc0508u, 0x08b5e0dfu, 0x1dd5a2d1u, 0xfdfc6385u, 0x5fced9c2u,
+        0xc67ba779u, 0x9992bd05u, 0x08d9a384u, 0x00a5fb13u, 0x224b65abu, 0xdd32de6du, 0xf1f9b367u, 0x13c1cb43u,
+        0x2497a80au, 0xab14c182u, 0x16a106a2u, 0x4d4d4490u, 0x34eb6f89u, 0xfaf66100u, 0x97921a29u, 0xb8417dd3u,
+        0xde6b98feu, 0x9564ea18u, 0x210db08au, 0x4374ce53u, 0xcc2e5635u, 0xe009914du, 0x549c6eb9u, 0x5873ca35u,
+        0x10564905u, 0xb7501a2fu, 0xda6c15d0u, 0x13216696u, 0x72752931u, 0x86544566u, 0xf06aa55eu, 0xbaa809d8u,
+        0x20445b63u, 0xff5a68c4u, 0x4003fdfcu, 0xc9a33d43u, 0xca2779f5u, 0xb2173ec4u, 0x5d24caa0u, 0x1a901fe9u,
+        0x6db7a4ccu, 0x864b9939u, 0xe3695d48u, 0xd5fec469u, 0xe5927ce3u, 0xc28d08e4u, 0x44270338u, 0xb95dc04au,
+        0x27faad84u, 0x6d274a0fu, 0x9b277a25u, 0x42b18d46u, 0x2ab2d132u, 0x90d18d3bu, 0xb6ad534du, 0x1ce8747eu,
+        0x01de7de0u, 0x14c7a000u, 0xf789cf64u, 0xc14b1975u, 0xe217d117u, 0x47c44e66u, 0x99de310eu, 0xa852690bu,
+        0x68b5fcd4u, 0x16a8bb4cu, 0x043adf0cu, 0x00ba36c9u, 0x0d701eb8u, 0x1e85ede7u, 0xc33dc7b5u, 0x86412db9u,
+        0x44a5abd2u, 0x1cf42637u, 0xaa70e52fu, 0x58b0682eu, 0x46fa1ed2u, 0xb0894158u, 0x285c5eb5u, 0x05223b6fu,
+        0x60ce1b6au, 0xbaa2c294u, 0xc9d57462u, 0x6db42aa3u, 0x665e3269u, 0xb0e52313u, 0xcca72c95u, 0x87fa09a7u,
+        0xcaa08183u, 0x63cf23ffu, 0x9a066124u, 0xcf6935ebu, 0x2752a894u, 0xe5c4e669u, 0xef1c4b2fu, 0xe23fc7dbu,
+        0x94bfc0c4u, 0x5310706du, 0x5c7f0fd2u, 0xe1661cf8u, 0x6407506du, 0xc0bc42c2u, 0xe5d4e030u, 0x5662503du,
+        0x6f8c0701u, 0xa94a7122u, 0xbf8d4043u, 0xdcfadc4eu, 0x776ab51bu, 0x6f1efddeu, 0x60062465u, 0x366d58cdu,
+        0x94bb3048u, 0x7b52ce3bu, 0x7226f454u, 0x55891a7fu, 0xf3304947u, 0x71642862u, 0x8240c74du, 0xc0f8fac0u,
+        0xebec02b6u, 0x5a90cb4eu, 0xd0ac3cc1u, 0xb76c90c6u, 0xa604783eu, 0x7c217eebu, 0xa40c0de7u, 0xcb291464u,
+        0xdc51d2deu, 0x5680b122u, 0x73707242u, 0xec0c283eu, 0x1e151179u, 0x1b2b06c4u, 0x5a71ea8au, 0xf7565de1u,
+        0x329aac84u, 0x23fccf7cu, 0xbc788d56u, 0x23f6c4aeu, 0x1f03140du, 0x4a60f2b8u, 0x47433243u, 0x63587549u,
+        0xd711d788u, 0x8e3acd57u, 0xb0c22ae9u, 0x63fd1646u, 0x067dc6acu, 0xf0b368cdu, 0xfc8491bdu, 0x114f264cu,
+        0xb6c2d751u, 0xccbe2244u, 0xa3791a36u, 0x626984bau, 0x853c523bu, 0x5eaf4331u, 0x11c60bb7u, 0xcd010ffbu,
+        0x221ee7c9u, 0x12940b10u, 0x20b0fb85u, 0x467d07f7u, 0xdfdb8ab7u, 0x4837d9fbu, 0x9b5e0d62u, 0xf39f8657u,
+        0x7ef99214u, 0xb415ca68u, 0xa70a6937u, 0xeea8427fu, 0x9313fe68u, 0x49f93d33u, 0x8715d1e6u, 0xdb3a7ebau,
+        0x61d08206u, 0x02a8ee3bu, 0xa66cfbedu, 0x1fc29004u, 0x1802e967u, 0x2ac39bfdu, 0x487288b5u, 0xe8f055d3u,
+        0x920c34b4u, 0xa83fe96eu, 0xa72fc0d5u, 0x4155ac50u, 0x41685214u, 0xc51851d7u, 0x99116d65u, 0xa1f4bc63u,
+        0x21977079u, 0x53a75ffbu, 0x4ba7585bu, 0xfedf3f83u, 0x0dcc9a33u, 0x49277984u, 0x0f9338d1u, 0x653b07adu,
+        0xe1713f45u, 0xc2a481b6u, 0x6ca4e776u, 0x09669cb3u, 0x1e9d473au, 0x51e55654u, 0xe6247f76u, 0x5a581bdeu,
+        0xd1cfb2c9u, 0xddc693b2u, 0xd5e1947bu, 0xf0f7046fu, 0x9fa7bd8fu, 0xd95b5fe8u, 0xfd336abdu, 0x8680db21u,
+        0x14ae7b03u, 0x4b0ab2e7u, 0x14685579u, 0xabdcee5au, 0xba1003b9u, 0x757cba51u, 0xe299c862u, 0x721afdefu,
+        0x3138cc6cu, 0x715d7d04u, 0xe044a297u, 0x6034905cu, 0xb1c862a0u, 0xafc94665u, 0x2256d380u, 0xadcf3328u,
+        0x44ae55feu, 0x9b10ed57u, 0x8b27ba5cu, 0x402a486eu, 0x7fe4c5b3u, 0xeba40f7du, 0xee14af33u, 0x8e0cfc0au,
+        0xdcde5dfau, 0x628df5acu, 0x56ec4f6cu, 0x7d956f43u, 0xfc231f58u, 0xde1c28feu, 0x40ba6dfbu, 0x4366eb9fu,
+        0x5b6e6354u, 0x4017cd28u, 0x0d349f64u, 0x1fde0f29u, 0xc18cc265u, 0x38801c71u, 0x280f9237u, 0x77e30354u,
+        0xcf33ac0bu, 0x4595f842u, 0xa973642du, 0x58603458u, 0x047e3837u, 0x69533d38u, 0x45a79bafu, 0xeb170331u,
+        0x52b81200u, 0xe9affa16u, 0x49b7accfu, 0xca03300fu, 0x4d71fec0u, 0x49ea894bu, 0x913cb7f6u, 0x9379d7d5u,
+        0xcdfc7227u, 0xe25aa535u, 0xe40ac255u, 0xec1edeffu, 0xd479aae6u, 0xca089cc3u, 0x920b782du, 0x2601596bu,
+        0x7002b48fu, 0x1fd8bb9du, 0x0384814bu, 0xa0b50ca5u, 0x255f8d40u, 0x66098cbfu, 0x53de995au, 0x808d9df9u,
+        0x1ebd2658u, 0xf477fb48u, 0x15e881d2u, 0x38e272e3u, 0xf383f66du, 0x073d2f5du, 0x0d9f903eu, 0xd4f1ceb4u,
+        0x4c11fb84u, 0xb04bd6beu, 0xb477c6a0u, 0x7227f5e3u, 0x7cc5fd14u, 0x864d7cbcu, 0xe4bff11bu, 0x4595caf1u,
+        0x88e5ca78u, 0x0529b940u, 0xdc584158u, 0xa76a74deu, 0x751e8185u, 0xb55c08f8u, 0x623736bau, 0xbed301e9u,
+        0xcbde7f86u, 0x905fef44u, 0x30e8e7f3u, 0xe158575du, 0x855d6092u, 0xac556b99u, 0xda3bfe95u, 0xe36db662u,
+        0xa6de4c3fu, 0xd4171394u, 0x0bf5a1a2u, 0x912f4658u, 0x86e5661fu, 0x0148e368u, 0x4e55beccu, 0x9523858eu,
+        0x6b1ab2a0u, 0x721541f3u, 0x74e0cc31u, 0x3c66b485u, 0x763c5b51u, 0x6cf327b5u, 0x4ebab605u, 0xc72f4676u,
+        0x0d27ecdau, 0x6f8bec8bu, 0x9d50c2d7u, 0x0f34a06fu, 0xe0a9ae24u, 0x5497fbedu, 0xab55856bu, 0x524ff3ccu,
+        0xd6092900u, 0x8c29850cu, 0xb813ddf0u, 0x1681ca7du, 0x397c9399u, 0x96232946u, 0x39d0aa00u, 0x67af15abu,
+        0x798ca825u, 0xe23a0a95u, 0x11a47b94u, 0xc5987a5du, 0xc9b67a2au, 0x43026039u, 0x94001260u, 0xf3be5952u,
+        0xbe9b3d68u, 0xd50d2e54u, 0x745f6b0fu, 0x8294806fu, 0x19b39c80u, 0x4317f183u, 0x4cb0ca0eu, 0x451bf1d1u,
+        0xcd69e180u, 0xe15e70f8u, 0xad7efa12u, 0xc365c09eu, 0x7a5a6ab9u, 0x2132182cu, 0x4c60150eu, 0xbc56b48eu,
+        0x4566acfcu, 0xa873b0ddu, 0xfa51cb04u, 0x3ebe16c7u, 0x5982369du, 0xc97bd38bu, 0xb4b4fdefu, 0xd957f531u,
+        0x5e80d964u, 0xe6546b7bu, 0x3b216e33u, 0x87b070beu, 0x60f31a57u, 0xca066a4cu, 0x68d396b2u, 0x7f29d77du,
+        0x2d27037fu, 0xd330140eu, 0x2c0cfd86u, 0xbadf8ec5u, 0xda08c086u, 0x9cc9d769u, 0x85c5aeb4u, 0x7008d826u,
+        0x64f76bd8u, 0x4c8ed1bcu, 0x42e51d69u, 0xd217794au, 0x54b9c50bu, 0x40e55e5cu, 0x19241b67u, 0x84ad399du,
+        0xec775586u, 0x3fad7fa4u, 0xf336f2d6u, 0xae6644e8u, 0xfe0a5c11u, 0x7b4ccbcau, 0x3793fb9au, 0x3cddb878u,
+        0x4f91653au, 0x32731685u, 0x3fdeb0bau, 0x7bbcadfdu, 0x85a31c05u, 0xd2950c78u, 0xe7513533u, 0x79b1c667u,
+        0x9803632cu, 0xcb197832u, 0xb9003d72u, 0xf1962436u, 0xa623e394u, 0x357c88f5u, 0xb0ee5d78u, 0x1c83a95bu,
+        0xf3d7adb4u, 0xc00aa320u, 0x76728fd2u, 0x496ee13cu, 0x4b1aad0au, 0x852d6a19u, 0x5f8a6afeu, 0xe546aa72u,
+        0x0e47c88fu, 0xb1a8b145u, 0xb4322a83u, 0xf01b4a3bu, 0xaf0c6d98u, 0x4458ed3fu, 0xd5b61595u, 0x929a7a15u,
+        0x94b10fcbu, 0x2d482f4eu, 0xf3fe658au, 0xc7545102u, 0x318fff4au, 0x05dad5d0u, 0x34cfb9a5u, 0x300b9d1eu,
+        0x6d2f413cu, 0xd6a1f712u, 0x9ccb9925u, 0x7f8bd1adu, 0xb09a8a64u, 0xb286ef07u, 0x0559c3bau, 0x081f9ea6u,
+        0x151e3d9cu, 0x83d0c1cau, 0x136e19f9u, 0xeb420507u, 0x15b63346u, 0x39ba2d0fu, 0xf286f6d7u, 0xb2a07d54u,
+        0xcecbe061u, 0xf454542cu, 0xdac64da2u, 0x2c7ab279u, 0x396e538au, 0x2b7e28d7u, 0x14044507u, 0xcaa218e3u,
+        0xd31b6004u, 0xebfc8324u, 0xb705f254u, 0x0697dd0eu, 0x5a7179e7u, 0x2a97e3edu, 0x12e36507u, 0x97e5aef1u,
+        0x38a7de59u, 0xb8c6287cu, 0xfbdfa0f4u, 0xe94b0462u, 0x3a4fc5e2u, 0x5915f9d7u, 0x59829b65u, 0x793a28feu,
+        0x0bb1e65bu, 0x608932c9u, 0x101251c6u, 0xa7ef64b2u, 0x155eb570u, 0x99be63adu, 0x96b371c2u, 0xbd6e195eu,
+        0x2e2ab23fu, 0xbdd4cb58u, 0x5eaa125bu, 0xddd9f2bbu, 0xbe0f2198u, 0x07327b17u, 0xe12e6834u, 0xe3824314u,
+        0x1e6ae2cbu, 0xd9191784u, 0xf1de23f2u, 0x385f3463u, 0x60d906c0u, 0xe3d8521bu, 0xfa0f8b10u, 0x00000000u,
+    },
+    { /* 2^152 */
+        0xb7bfba27u, 0xde230573u, 0x65e5f079u, 0xd3a2f994u, 0xa1ee57adu, 0xc9261452u, 0x205adef8u, 0xe352cdcau,
+        0x61b1a675u, 0x8879bf3fu, 0x2b164b76u, 0xee2b0f9du, 0x1f551941u, 0xd782082fu, 0x2eb36250u, 0xfc0f3560u,
+        0x946b5dceu, 0x6c6a1291u, 0x7392136du, 0xb8d79d1cu, 0x74e4ddfcu, 0xae15072eu, 0xf61cbd1cu, 0x970ac09fu,
+        0x2e3172a4u, 0x46e2b762u, 0xc5a791a9u, 0x6ed7d4dfu, 0x3693b6d5u, 0x57c04394u, 0x8275bc5fu, 0x41e79acfu,
+        0x17292ff2u, 0x90be7c10u, 0x32ae5fc2u, 0x12edd68eu, 0xba206f88u, 0xa4125362u, 0xd2f50cdfu, 0xa3defb37u,
+        0x68a3f1abu, 0xa59729e3u, 0xa041016eu, 0xe1397fe8u, 0xe3b9fad2u, 0x8b8eff2du, 0x5371d233u, 0xbfc455ffu,
+        0x85dc2ca8u, 0x0182723bu, 0x1a815281u, 0x07e3a07fu, 0x2537ca6cu, 0xd9f1ceb2u, 0x23610abdu, 0xb9367790u,
+        0xcf85de28u, 0x6315df09u, 0xc6f5bea2u, 0x73b9e27fu, 0x18911a6eu, 0xe5533926u, 0x22becd86u, 0xb5f6355fu,
+        0x99a745e9u, 0x44fdb516u, 0x1d8f71d0u, 0x3c34a319u, 0xffcd8dceu, 0x0c42eb23u, 0x2b538a0cu, 0x6295d15bu,
+        0xcf3f130du, 0xbfd1eba7u, 0x1cbd7031u, 0x3e769211u, 0x0a0fa37au, 0x56601b63u, 0xd7cabfc7u, 0xa9d63d86u,
+        0xc3524c48u, 0xfa0b958eu, 0xc0972318u, 0xef17c63du, 0x4b01a652u, 0x37d32f07u, 0xba47913bu, 0xbed42ebau,
+        0xe4e5d6bau, 0x9e39bcc1u, 0x4b9e899fu, 0xc817caceu, 0xe86b661bu, 0xf063a0b1u, 0x8c7862beu, 0xc96f5bdcu,
+        0xef4b2662u, 0x8a8d8116u, 0xd004fa44u, 0x1f25e4d2u, 0x4ef1eb5eu, 0xfe57b2bau, 0x07d7069au, 0x0dd893a7u,
+        0x10154ce6u, 0x1c64a1b2u, 0x1cc5a09fu, 0x59c15871u, 0x714aa40eu, 0xf4394817u, 0x5f13d494u, 0xbbd57409u,
+        0x6e0e92bbu, 0x48d6eafau, 0xe1274a24u, 0xa3672d1au, 0x720e03a9u, 0xd1e06f6cu, 0xcc557f44u, 0x7ceebf43u,
+        0x9b094f8du, 0x29546717u, 0x02d53ea3u, 0xb0616db6u, 0x2741cc8fu, 0x940cb91cu, 0x03332b42u, 0xe68f2784u,
+        0xa6880205u, 0x04d9d1e4u, 0xacbf3267u, 0x1d904a5eu, 0x59083ed7u, 0x97f3424du, 0x1862e2b2u, 0xf90b8c56u,
+        0xa3d98030u, 0x87b89d46u, 0xe932c58eu, 0xd00d550au, 0xad3124fau, 0x5a1d7eb2u, 0x7e0f0e85u, 0xa770e76eu,
+        0x91bedd4cu, 0xe695fc42u, 0xb9f74460u, 0x922a4599u, 0x70f807bfu, 0xab28ec41u, 0x42bfefd3u, 0x53210e48u,
+        0x6f47d7b7u, 0x634044beu, 0xd5e15328u, 0x0608c20du, 0x48b0cbdeu, 0x2f56c43bu, 0x724769fbu, 0x9d92e7d7u,
+        0xbfebed2fu, 0x505051c4u, 0x3625deceu, 0x37b9a9d3u, 0xdc99065bu, 0x50f81455u, 0x4ba3ea7fu, 0x8c026436u,
+        0xa0b6aa87u, 0xc4ebbb2eu, 0x3597f12du, 0xb613f69bu, 0xbdb323ceu, 0xb0d3e4e3u, 0xd89995a9u, 0x45fb2547u,
+        0x95360e18u, 0x7403315fu, 0x3a204ad7u, 0x5f3186ceu, 0x36f5a8deu, 0x9b1c4583u, 0xada5503cu, 0x3d256d10u,
+        0xb7b2acdfu, 0xca77e060u, 0x858636d0u, 0x682c9a73u, 0x7606e2cbu, 0x8a937cc6u, 0x4e12e84du, 0x7ab4fbf8u,
+        0x45230fc7u, 0x77ba7e60u, 0xbe6db22du, 0x0c0820e3u, 0xba1734ecu, 0x42b77203u, 0x95bb7317u, 0x932b3e1bu,
+        0x5d8f93fcu, 0x755271c5u, 0x25e96f9du, 0xbd6d7814u, 0x0e54bb38u, 0x77e251fau, 0x632a0cb6u, 0x278544e9u,
+        0x366fcdbfu, 0x3057749bu, 0x5bfe1036u, 0x3e824201u, 0x0451e3e0u, 0x9be60c72u, 0x7f514f84u, 0x31f20e2bu,
+        0x5ab01d69u, 0x4bc5deb9u, 0x482daf8du, 0xd53eed05u, 0x0e65c00du, 0xf15d0f17u, 0xe2d7bf9cu, 0x6c9475e0u,
+        0x404120cfu, 0x1dbbab13u, 0xe2c8aa33u, 0xf1fe0e64u, 0x28b9a006u, 0x3f15caf1u, 0xc30f186au, 0x55a3ed04u,
+        0xb3ba2377u, 0xecbbef6eu, 0xd613ca9bu, 0x778674d8u, 0x3f493c5du, 0x2156bacau, 0x91504380u, 0x3927ed03u,
+        0xffef49cbu, 0x53ccc3f0u, 0x876fc147u, 0x6010dc14u, 0x095bd774u, 0xc1424616u, 0xfbb3c0c5u, 0xf8b8e3ddu,
+        0x206ff579u, 0x56afc3e5u, 0x119bbcedu, 0xe75b33e9u, 0xf50030b7u, 0x25d02610u, 0xcd1ba93eu, 0x78b30d05u,
+        0x20c1eb52u, 0x325988eeu, 0x42915f46u, 0x6db259f3u, 0x3c854f20u, 0x41675d9du, 0x40b196cdu, 0x923f4768u,
+        0x4d78f098u, 0x90d80edbu, 0x1fa02716u, 0x64e07410u, 0x42b59cdeu, 0xe93ce691u, 0x0adb7b6cu, 0xc8401e9cu,
+        0xc797a1afu, 0xdf0427b4u, 0xfe0c3bdau, 0xa3034d02u, 0x39be0975u, 0x8e19bba3u, 0x154b500au, 0xe8af0b9fu,
+        0x5dc0ee9du, 0x256c2ce5u, 0x7ac05dfcu, 0xadcb73cbu, 0xf6d7685eu, 0x512b5d4eu, 0xfe3f7a5fu, 0xc1718251u,
+        0xca2c94b6u, 0x9fe6b28fu, 0xdef3a702u, 0x3b355710u, 0x0ba6e5ccu, 0x44f14f4au, 0x9aa4bd59u, 0x8df5578au,
+        0x213945b6u, 0xd9fde187u, 0x45fdf6edu, 0x91e0ec7du, 0x1be72b87u, 0x6c6ab0b8u, 0xbf876b48u, 0x0236603bu,
+        0x586aa727u, 0x3adb082du, 0x3b694795u, 0x5e21fa59u, 0x1fd0a372u, 0x79958260u, 0x9bbd7e54u, 0x81f54cf1u,
+        0xfeefb1dbu, 0x041baed7u, 0x8fb35e7bu, 0x4717209fu, 0x8552856eu, 0xa3e7038au, 0x7a5b08aau, 0x5282d0a3u,
+        0x3c669451u, 0x31721beeu, 0xa483a8efu, 0x1bff63abu, 0x3d1a87b1u, 0x05868770u, 0x7122ecacu, 0xb6d063e4u,
+        0xe11049a8u, 0xc0232ef7u, 0x1158ba4eu, 0xbd49d2e6u, 0x15360d97u, 0x431f9b31u, 0xb6e0c014u, 0xcba2513du,
+        0xabc8dd9du, 0xdd20a78fu, 0x34fad5d4u, 0xb165e900u, 0x09d50de6u, 0x37a84594u, 0xcaae3e52u, 0xe05dea93u,
+        0x6222bdfcu, 0xc5bf95a1u, 0xa4e5b0a4u, 0xb413c17eu, 0x4cfa5778u, 0xa9299a15u, 0xd9ac0761u, 0xc882c359u,
+        0xaac8f5e1u, 0xf9087026u, 0x1d2c7d3eu, 0xa5165c5fu, 0xe0409de5u, 0x2e814519u, 0x0b764dcbu, 0xce1b1132u,
+        0x2c5afa7cu, 0xdac1020eu, 0x3e11b022u, 0x1e8f46c6u, 0x710a1d67u, 0x5997abcau, 0x0acfadd7u, 0x45c72354u,
+        0x38924f54u, 0x89c383ccu, 0xfd1cb2ecu, 0xbf8b22fau, 0xca112665u, 0x01cee952u, 0xefb29884u, 0x2472028eu,
+        0x7678f01cu, 0xcf53ce59u, 0xa50578c6u, 0x5f28c0cfu, 0x8cb06e3eu, 0x4e2e9e58u, 0x53f4925au, 0x5874d4cfu,
+        0x5799d6dcu, 0x3e50c8acu, 0x36f44b89u, 0x4be1eda6u, 0x11c544dbu, 0x2bea1437u, 0xab5e076fu, 0xa1ee8280u,
+        0xafd7e9b4u, 0xfe79c5afu, 0xeb6df08cu, 0x30defb4eu, 0x0eaeaf8bu, 0x6156092fu, 0xb724503bu, 0x4a73f136u,
+        0x5546992au, 0xc1fa947au, 0x552e202au, 0x052ec612u, 0xe2f4cf22u, 0xe383223eu, 0xa9ff21b0u, 0xbb9435bfu,
+        0xaa18d9b4u, 0xdc75eb5eu, 0x4259082bu, 0xf3e42df2u, 0xd77af616u, 0x662b52b2u, 0x8427d029u, 0x3b8f36dcu,
+        0x9f7bd4bfu, 0xbd47dfa4u, 0xf98068feu, 0x9b4d5a2du, 0x0053329fu, 0x6f66b6e5u, 0x77815206u, 0x86ee4f66u,
+        0xe89c0248u, 0xe3537348u, 0xe39e9790u, 0xd1d1419eu, 0xcd7fedb3u, 0x7f8dcb6bu, 0x900ae513u, 0x73478beau,
+        0xcde30121u, 0x208ded41u, 0x05676df7u, 0x1a65a688u, 0x65301915u, 0x23d22d85u, 0x8ff43900u, 0x98f7bebau,
+        0x417473afu, 0x6d0450d5u, 0x801eb53bu, 0x4a8e2037u, 0x7942a849u, 0x8abb0500u, 0x9588ba02u, 0x01d3c841u,
+        0x8a8d7601u, 0xddb5f7f0u, 0x61f58e32u, 0x153a1ff7u, 0xd87014b9u, 0x4b68dff0u, 0xe55c8de4u, 0xbdd1f6c3u,
+        0xf52f23fdu, 0x0ed1759eu, 0x92cb21fbu, 0x4187f403u, 0x1fe3f68eu, 0x1d13171au, 0xad88d8d1u, 0x29c3c692u,
+        0x33c818fau, 0xb78ea853u, 0x3fdc155fu, 0x728640acu, 0x0413029cu, 0x8f3532d7u, 0xf6872f5du, 0xb0335217u,
+        0x4d36c283u, 0x025306e4u, 0x34a77786u, 0xa052f18fu, 0xf36ec014u, 0xe7852762u, 0x64f9b3a4u, 0xd0ce3a07u,
+        0x9156328fu, 0xc76c853eu, 0x188433ffu, 0xe4c4c200u, 0x75044995u, 0xc13ae4c4u, 0xf08295eau, 0xb18c443fu,
+        0x9c7b55bau, 0xeb883441u, 0xfb511383u, 0x8f1b7146u, 0xb3a4399du, 0xe4b9d2dcu, 0x6f36842au, 0xca76edf2u,
+        0x501e9cabu, 0x90126d3eu, 0x35a03d7fu, 0xcdd4fa4fu, 0x43b88446u, 0x09d0bc03u, 0x41b631a9u, 0x63293b9fu,
+        0x793e4dd3u, 0x636cfc8eu, 0xf939be1cu, 0xe2a590abu, 0x2a122e94u, 0x1d9a218fu, 0x60cacd66u, 0x63e57a39u,
+        0x2cd309f1u, 0xeec1b461u, 0xfffa58deu, 0x0f358986u, 0xc862aeb7u, 0xa9268fa8u, 0x1959f4feu, 0x324d5d5bu,
+        0x929b5654u, 0x0c745e69u, 0x406bd907u, 0xadd28717u, 0xa1db0ec7u, 0x48bd5628u, 0xa8214440u, 0x22f6672bu,
+        0x64183f39u, 0xbd2ebcceu, 0xb6ee89f8u, 0xe5293ba8u, 0x6e900c5au, 0x77b7bbe5u, 0x109d6ec0u, 0xd10fad2cu,
+        0xa5cc5b9au, 0x6475812cu, 0x5dfa995fu, 0xf911e7e0u, 0x7b84cd76u, 0xe033c91au, 0x7b82154du, 0x5017e153u,
+        0x237cdf48u, 0x7389fe52u, 0xcade0735u, 0xb845fe66u, 0xec8f495eu, 0x11f11caau, 0xead63bf9u, 0xc3329883u,
+        0x9b7df730u, 0xb6c489c4u, 0x2207575eu, 0x6378e490u, 0xa7324db8u, 0xca143a94u, 0xbaec90e8u, 0xf96a31dau,
+        0x9d85bdbbu, 0xa9adc75eu, 0xb658331fu, 0xac8b2badu, 0xa49da8abu, 0xe5b9984bu, 0x95f51bccu, 0x67e73c78u,
+        0xac2a79c9u, 0xadfe170au, 0x559bd74eu, 0x87a56b6cu, 0xa8a23b12u, 0xc2634be3u, 0x3503bdb2u, 0x573e468cu,
+        0xf992cb3du, 0x11a18d75u, 0xfc9f3c54u, 0xee9c8ec2u, 0x8eb3386cu, 0x578b00f6u, 0x15ba486bu, 0x44d4d1c4u,
+        0xa1f33cd8u, 0x3aad5e64u, 0x97373480u, 0x43ee306bu, 0x39c40db2u, 0x8faca40au, 0xfec1ea41u, 0x0b68b06cu,
+        0x6bb62035u, 0x713f82f8u, 0x1cc9b0f4u, 0x2e4dd7fau, 0x38226499u, 0x75ff8364u, 0x281a9ff5u, 0xb0142745u,
+        0x7bd9cafau, 0x53f2735bu, 0x2cf65598u, 0xb4f8224au, 0x3d98b0aeu, 0x183811ebu, 0x0f782095u, 0xcefbca55u,
+        0x6d919ea5u, 0x556da0d3u, 0x5ba79d1du, 0x228f1e7du, 0x96b4f585u, 0x33ec843bu, 0x2e88e0e3u, 0x806c8950u,
+        0x489690cdu, 0xe3da4ee3u, 0xf9cd4c74u, 0xc6b9927bu, 0xd9d11997u, 0xe4d3f4fbu, 0xd85d6914u, 0x00000000u,
+    },
+    { /* 2^153 */
+        0x9a7d6befu, 0x13bfbf43u, 0xb9276a57u, 0x1e0c4759u, 0xff7f2916u, 0x25501c8fu, 0x64d80690u, 0xa4987705u,
+        0xe8fecb6fu, 0x98f54523u, 0xa4d04c77u, 0x1d7571a5u, 0x21ec43dfu, 0x20083969u, 0xec9d867fu, 0x45fa72d8u,
+        0x921fbfdeu, 0x2162a0ddu, 0x93ec3523u, 0xe942a404u, 0x46974546u, 0xed4bba8du, 0xf36b115du, 0x15b9eca4u,
+        0x752e45e4u, 0x76d9623eu, 0x6d5176e3u, 0x3c20e1d0u, 0xda2e9679u, 0xc78d6ec6u, 0xc232e05au, 0x4ad05a70u,
+        0xd687ebabu, 0xe13b69ecu, 0x0f7e8044u, 0x74553c5fu, 0xab3d33e4u, 0xae759561u, 0x22adc093u, 0xcfeeee0au,
+        0xe402aaf4u, 0x0d83fd0bu, 0xdbc9fddbu, 0xce877b1fu, 0xeb48df81u, 0x456b3475u, 0x9eecd164u, 0xa02f9e74u,
+        0x65454270u, 0xcd521306u, 0x4c04f882u, 0xf7035a1au, 0x1e167fc2u, 0x7e96aed7u, 0x7299e090u, 0x6460aba9u,
+        0x0d98bd9au, 0x6b994cb4u, 0xb9232b28u, 0xc281968cu, 0x6350f972u, 0xd0f8d1f3u, 0xa4acaf16u, 0x11ae6245u,
+        0x30128257u, 0x319f109du, 0xda4c0506u, 0x32ea7852u, 0x29c027d7u, 0x6062915cu, 0x671276d2u, 0x4826249bu,
+        0x695dbb70u, 0xd6488e20u, 0x3ee85c2bu, 0x809b3c8eu, 0x50d6d284u, 0x8e9ae91au, 0x1b6f73dbu, 0x222af3a4u,
+        0xdf868f8bu, 0x9a32c8a2u, 0xb8fa27d4u, 0x07b00310u, 0x0ddcb921u, 0xf4f861e2u, 0xb75fbc4bu, 0x11deebd6u,
+        0xcac20b32u, 0x4ff72227u, 0xd15a9161u, 0xc4ac3ff3u, 0xaa38feacu, 0x53625edau, 0xeff23555u, 0x4d7d8868u,
+        0x0bb6a66du, 0x9c0612f3u, 0x277f022bu, 0x8b1e4086u, 0xfa245a38u, 0xb06506f8u, 0xbbf8f09cu, 0xd702473du,
+        0x0d8423b4u, 0xabaca296u, 0xc91a47f4u, 0x0fc2cf0au, 0x1ad462b9u, 0x09b9cdefu, 0x14563ce0u, 0x5fc6d9edu,
+        0x38f9bd59u, 0x46fa5e93u, 0x71ad33acu, 0xe8a3195au, 0x90db74fau, 0xd5baa267u, 0x7f4be106u, 0x0a5e7480u,
+        0x81f210eau, 0x694c3720u, 0x72c90c5fu, 0xd251e795u, 0x9229d8fbu, 0xbd0016a4u, 0xff71d1aeu, 0xcc488f2bu,
+        0x72c4af10u, 0xb8ca41b3u, 0x4007d04fu, 0xefb8f09fu, 0x53082c19u, 0xd085a2b3u, 0x54ccfc68u, 0xdc0e3886u,
+        0x5ed0f488u, 0x96d44fe9u, 0x3b0a45deu, 0xcd65afe2u, 0xa1ded6e0u, 0x0f416e5bu, 0x3e995ac0u, 0x988e8d0au,
+        0x14fe8d6cu, 0x99479c66u, 0x123b3089u, 0x90c3f764u, 0xeb4c02fdu, 0x51e684eeu, 0x93e66e51u, 0x630ae491u,
+        0x07492e83u, 0x06d619e6u, 0x4998917au, 0x2a371debu, 0x74805880u, 0x072b55ebu, 0x802d599cu, 0x2d84b058u,
+        0x75345042u, 0x19385a5bu, 0x375044e4u, 0xc7f288e6u, 0x3e6097e8u, 0xf5ac6a60u, 0x826a8fadu, 0x675c545cu,
+        0xead35c20u, 0xbe0235a7u, 0x2b18057du, 0x795d65d6u, 0xe1c8f456u, 0xc0037316u, 0xea15edd9u, 0x86a5c586u,
+        0x97a87213u, 0x3f306089u, 0xadd9839bu, 0x930f6339u, 0x01329230u, 0x583fff7eu, 0xd2bca2eeu, 0x6118350cu,
+        0xde7c3a76u, 0xe84750a6u, 0x5f76e0d5u, 0x57dfc60bu, 0xd0eabcdcu, 0x133e1c4fu, 0x7e9f753eu, 0x92ea28b6u,
+        0xccd11a38u, 0x9dfd3122u, 0x19d680efu, 0x23ed3b2au, 0xc94d825du, 0x12271858u, 0xf3dc2639u, 0xbdda433bu,
+        0x2ad09a3du, 0x85edbfe7u, 0x591b678bu, 0x48ff94f6u, 0x8f861205u, 0xe7274c58u, 0x4c6b43acu, 0xc484d179u,
+        0x27a9e942u, 0xe0df30f3u, 0x364d8ce3u, 0x1b3b642du, 0xa1136bcbu, 0xfd1c1cc8u, 0x14b682bau, 0xcc99fee3u,
+        0x830f998bu, 0x77b2e841u, 0x70446587u, 0xcd5ec1e2u, 0xa72c6840u, 0xbb3f2d52u, 0x8cefaa11u, 0x8816f28fu,
+        0x691ad0fbu, 0x6cd97b05u, 0x4e87087fu, 0x8357ee5eu, 0xe61a5414u, 0x38635858u, 0x280ba6a1u, 0xee2e2c31u,
+        0x9478b541u, 0xb0978befu, 0x2a04273cu, 0xdc666f62u, 0x4fc65657u, 0xdb3e5a11u, 0xcfa12625u, 0x8111c433u,
+        0xf54a884eu, 0x4f1689f3u, 0x69479e9fu, 0xad441ef4u, 0x539e67c6u, 0x4b476e0eu, 0xb45b4968u, 0xad33a2c5u,
+        0x60fa174cu, 0x3bbb2c17u, 0x720d7402u, 0xf75e4d2au, 0xb80945c2u, 0x6782254bu, 0x34a64446u, 0x1cf06704u,
+        0xaf3e097bu, 0xc179c6fau, 0xd7e86a7au, 0xecf573fdu, 0x21bbdb1cu, 0xf80b0ed0u, 0xf6f72592u, 0xd39fe845u,
+        0x25840773u, 0xe5112d50u, 0x1eb2046cu, 0xadfba005u, 0xc6cc69d1u, 0x8b19ae7bu, 0x59dc9a45u, 0x456d1c27u,
+        0x39967814u, 0x7423af6bu, 0xc54a3adau, 0xc17f85ceu, 0xd018b2e0u, 0x6266a725u, 0x5313f482u, 0xc2b9a033u,
+        0xca740175u, 0xcbbb020fu, 0x9a2a81f9u, 0x458a0fbau, 0xeb9eb285u, 0x27bd9086u, 0x926c5cacu, 0xbb10ffd8u,
+        0xb50a823cu, 0x38ad9dd9u, 0x7b6b99bau, 0x08f9ae55u, 0xd26bfb61u, 0x4969b27bu, 0xd476106fu, 0xfcb53efcu,
+        0xb4605d27u, 0x730fd085u, 0x53f15ff4u, 0x7a1a6f97u, 0x51f45b81u, 0xdb8b8f0eu, 0x99c9c743u, 0x9ac07ae6u,
+        0x1cde2257u, 0xd01d97b3u, 0x435a742eu, 0x980c39d0u, 0xe91b3d95u, 0x6bac685fu, 0x4b2daf6au, 0x172e4ff1u,
+        0xaccea6e9u, 0x4bdc3872u, 0x545d55b1u, 0xaae1656au, 0x85e621c1u, 0xd129eeacu, 0x20add901u, 0x1bee7d6du,
+        0x9fc8e344u, 0x7992955du, 0xeb015ce9u, 0x22ccd1bfu, 0xc9ff2c2fu, 0xc90c0371u, 0x97907157u, 0xaaa3627fu,
+        0x78dfc1fdu, 0x820b7bdau, 0xe0e00a3au, 0x7c36f708u, 0xa5ea8b0bu, 0x5bb31320u, 0xdd56982fu, 0x000b5b59u,
+        0xbe483e6fu, 0x747fd8b7u, 0xd5670e6fu, 0xced91022u, 0x4b0881cfu, 0xaccd017bu, 0xd9eb4e71u, 0x082dacdcu,
+        0x6415004du, 0x6629f40cu, 0xeef672ccu, 0x701c72a6u, 0x4b132a0cu, 0xbf4a4914u, 0x362f2cb9u, 0x5a4658c7u,
+        0x87d27721u, 0xe48d6b24u, 0x45958fddu, 0x2ab3225cu, 0x9fe450dfu, 0x35a8fc8eu, 0xe16d6a34u, 0x5bd6c32fu,
+        0x69d46aceu, 0x757eb570u, 0x11cf33bfu, 0x27147b3eu, 0x6bb4a90bu, 0xde40a0cdu, 0xca5e025du, 0xaf0d74b6u,
+        0xb357989cu, 0x2372a909u, 0xb2a5bfe5u, 0xdb923284u, 0xd3292491u, 0xffdbb04eu, 0x820bc300u, 0xf3274190u,
+        0xde00a38fu, 0xed2e462du, 0x2edd7fc9u, 0x6874b5fbu, 0xbf878160u, 0x59333d1eu, 0x89f0f399u, 0x5199bff3u,
+        0xbd3d66feu, 0x136d2aa8u, 0x7731da0cu, 0x8413a251u, 0x1c1e3fecu, 0x8baf4e27u, 0xe3ee3d94u, 0xa36cc34fu,
+        0x3ffabee1u, 0x58f13ac5u, 0x20cb1166u, 0x5154c9f2u, 0xafdfe8aeu, 0x45ba1566u, 0x4a926449u, 0xe687d908u,
+        0xe585f31du, 0x9a06d6a2u, 0x3c070c49u, 0xfcbae13au, 0x7fbadb66u, 0xaad8fbd0u, 0x0b803324u, 0x6c6cd618u,
+        0xac146b64u, 0x2fcbf9e2u, 0xa2e478a2u, 0x6dd859dbu, 0x7d2fdd0bu, 0x53824755u, 0x31a1d5fau, 0x8c4a25f0u,
+        0x2d617ab6u, 0xdf91e637u, 0x6fd487acu, 0x949fc4c6u, 0x9ffa1985u, 0xcb62e99eu, 0x5cf68110u, 0x8ec0494bu,
+        0x431a43f4u, 0x1387960fu, 0x6c06ccadu, 0x6cf9a381u, 0xcef8075fu, 0x65dba449u, 0x298e6f91u, 0xc34d63f2u,
+        0x1d006f62u, 0xc99da1dfu, 0xa5144d14u, 0x0f80c6aau, 0x83ede4e1u, 0x061048c4u, 0xa75724c9u, 0x394cab9eu,
+        0xcb2a1df4u, 0x453388f3u, 0x332a1074u, 0x4a996e52u, 0x7793cfc0u, 0xc93fe8bcu, 0x19229decu, 0xc5aa6dafu,
+        0xf7c44a6au, 0x3a3e60d6u, 0x951cf916u, 0xab7b9e96u, 0x389f0b2bu, 0x2fe4e90bu, 0xa6e213fbu, 0x0ad4ce00u,
+        0xd99a162eu, 0xb9810ccbu, 0x7648e884u, 0xd8450297u, 0x8bb4b616u, 0x70b4dd32u, 0xb6f5a47au, 0xe7628372u,
+        0x9726acdbu, 0x2d4e409eu, 0xc2153e01u, 0x01da3f35u, 0x1208d7d3u, 0xcc3ebd0bu, 0xe8844b02u, 0xb13cb6b6u,
+        0xdba3f840u, 0xf8a45e4bu, 0x0b171bb1u, 0x80c0ef7cu, 0x68a4039eu, 0xb937e098u, 0xe08a8146u, 0xcfe27129u,
+        0xbe603b8bu, 0x0a0e7a61u, 0xa1812103u, 0x061c0378u, 0x9e35d9e8u, 0x9f68bfa7u, 0x31405dfcu, 0xad400bf3u,
+        0x24ae10f0u, 0xff958ae2u, 0x3e3aeb70u, 0x8306f722u, 0x32e885afu, 0x97bfa4d6u, 0x296ccdb5u, 0x9f3a652du,
+        0x00ffc4cau, 0x9194aeb6u, 0x2b0b5c9cu, 0xd57bbb99u, 0xe4c49778u, 0xcf369557u, 0xd56d84d3u, 0x69353226u,
+        0x3e075b86u, 0xe48d1dbbu, 0xd535c048u, 0x33a92697u, 0x60103de8u, 0xe3689158u, 0x20355989u, 0xdf1403c6u,
+        0xa86960d6u, 0x47f85211u, 0x0f035baau, 0xccb0cd83u, 0x85a254d0u, 0xfafe1482u, 0xd1e37f31u, 0x6ebf6bbcu,
+        0x1a0cb1a6u, 0xbb591d17u, 0x8c609b65u, 0xd0c4cac0u, 0x7a0fb9efu, 0xe9563527u, 0xbbe9d36bu, 0xbd4de8d4u,
+        0x3930d4e9u, 0xd15f5e24u, 0x4b65ffdbu, 0x556777c6u, 0xfad9973fu, 0x970073cdu, 0x1807383du, 0xcb237cfdu,
+        0x024d8cdau, 0xff708026u, 0xba35c910u, 0xa445d40du, 0x80c6bd0bu, 0xd6656719u, 0xb05e69eau, 0xa3e5e3adu,
+        0x4cbf2767u, 0x7f516fb9u, 0xc6f91737u, 0x89fedc75u, 0x1d98e463u, 0x4e1fbffbu, 0x94d4aa14u, 0x96690d4cu,
+        0x16c76b00u, 0xa8a548beu, 0x7f76fde5u, 0xcd8542e5u, 0xd6f95844u, 0xb888c7f8u, 0x70d8e690u, 0x2c7b0210u,
+        0x72a6e360u, 0x247cd437u, 0x75b5d4f2u, 0x40210911u, 0xe81d5118u, 0xef5c2d73u, 0x8eed2ba8u, 0x7ac7f2deu,
+        0x31f09887u, 0xe0a57ae7u, 0x18f8f1e5u, 0x31cd067au, 0xa22403c2u, 0x1498af34u, 0x2b2e722au, 0x56c9259du,
+        0xe8f04cb9u, 0x5e1dfc87u, 0x4e8abb0eu, 0x3e7e3f4eu, 0x618893d4u, 0xc99e1d5au, 0x270b7c3du, 0xd7b0a738u,
+        0x3d89c7dcu, 0x197f302bu, 0xc55179dau, 0x9c81500au, 0xcb9e754cu, 0x42890a94u, 0xadcc2b72u, 0xba4cc390u,
+        0xb2a21d45u, 0x2a1f31e9u, 0x9c69ec2bu, 0x982408e0u, 0x3cec2c8du, 0x36929e2cu, 0xf0a3d0e7u, 0xaba9b859u,
+        0xbc71d996u, 0x028c3a0cu, 0x6d01a995u, 0x3379d0a6u, 0xca236ed0u, 0x5d407fbcu, 0x9e660aaau, 0x3e76eb07u,
+        0xc99952eeu, 0x0ee9597cu, 0x4adf8d8cu, 0xfef9f2a5u, 0x158f8aeeu, 0x936e148eu, 0x5774fee2u, 0xb5d4f090u,
+        0x5f0b2e39u, 0x55dac644u, 0xd9dce785u, 0x98b0dc2cu, 0xd42eae27u, 0xf76ecad7u, 0xbff1ced0u, 0x00000001u,
+    },
+    { /* 2^154 */
+        0x83664a46u, 0x329e3868u, 0x8188b29fu, 0x297af8b7u, 0xa324b35eu, 0x0895b6e8u, 0x42a53e88u, 0x5eca0f7fu,
+        0x4667277du, 0x377f8cd7u, 0x99971d26u, 0x2692a379u, 0xa7162672u, 0xc6c60864u, 0x9386d436u, 0x44fce4f4u,
+        0xaea196adu, 0xf1e43493u, 0x7b7a7312u, 0x2b88979eu, 0x08413d04u, 0xc39ba2c2u, 0x9128f303u, 0xeb927586u,
+        0x44eb5fccu, 0xb72d78c9u, 0x94b872b3u, 0x4571af5cu, 0xb33bce3fu, 0xa38b5ec7u, 0xe1ce4875u, 0xea086fd7u,
+        0xf2b7b4f5u, 0xf31ff5a8u, 0xbecb7346u, 0xd1acce92u, 0x278d28d5u, 0x14fbb2a4u, 0xec4855d9u, 0xe588be47u,
+        0x3d776576u, 0x3fb85439u, 0x7d537b25u, 0xf872d3e6u, 0x12400ad7u, 0x405d37d0u, 0x60794400u, 0x0c364db6u,
+        0x90b9f465u, 0x2e21dfcfu, 0x590b7be3u, 0x2cedcbc1u, 0x902bd0fcu, 0x94dfb629u, 0x0e776f25u, 0x7fed4982u,
+        0xe925842cu, 0xa26a77cau, 0x52fca1cau, 0xd09ed7a7u, 0x76cd7488u, 0xca8e8c27u, 0xa5b6fe9au, 0x6267e29fu,
+        0x1b9ab500u, 0xb36a447fu, 0x33b2d9fbu, 0x61064a24u, 0x38299927u, 0xcdbf85dbu, 0xb05e90f4u, 0xc9b53b04u,
+        0xc8e30f4au, 0xb98da46fu, 0xfcf2e385u, 0x1d682891u, 0xe83f88fau, 0x82cef943u, 0xc2e37088u, 0xe9d8f591u,
+        0xaf52698au, 0xe2f224d4u, 0x2a6fddc6u, 0x8e97a8a2u, 0x35949d10u, 0xf50b6739u, 0x7476a105u, 0x11d67671u,
+        0x46d2c78cu, 0xffa98ce7u, 0xf7fd0537u, 0x5f6dd1c5u, 0xda6206d5u, 0xde116a37u, 0xe2aa8a8fu, 0x89694066u,
+        0xbe1b4a85u, 0xdf58b107u, 0x5207531du, 0xaf010d83u, 0x3c38c246u, 0x249096b4u, 0x8fa0fecfu, 0x675ee1d5u,
+        0xe6167e2fu, 0xd728e0f5u, 0x4bc9f82du, 0xd61c7323u, 0x16a95cf6u, 0x03cf7cbfu, 0xbf2e342fu, 0x6b5aa1d1u,
+        0x978a48f7u, 0x2093904cu, 0xf9d3bbfcu, 0x22935d58u, 0x4b83ed14u, 0xbf595a99u, 0xa140e2b8u, 0x87cd74dfu,
+        0x29e7fc41u, 0x9d8e7088u, 0xb63d8af2u, 0x2d61ecc5u, 0xdb4839e6u, 0xc135ebedu, 0xf6b60d3cu, 0xb60adbeau,
+        0x59e3dbcau, 0xc7029819u, 0x304b1784u, 0x2c70705eu, 0x06415ed5u, 0xd279866du, 0xb0257f2fu, 0x1289cc93u,
+        0xe42324d1u, 0x4d2b4633u, 0xdcfd4ec9u, 0xa7da0ec0u, 0x2b8f46dbu, 0xbe080aeau, 0x8834db5du, 0x434629d3u,
+        0x71dd4104u, 0xd415f1b6u, 0x95f1a9beu, 0xfcfc8b33u, 0xaf8df050u, 0x48a6eeffu, 0x3bd972efu, 0x4a1d8c02u,
+        0xf340038au, 0x35f7a044u, 0x4da26a49u, 0xabe5a8d5u, 0xb37c88f3u, 0x6f4ce1f2u, 0x5f7df2b7u, 0xf86a061eu,
+        0xfd2f2794u, 0xfeca9d28u, 0xde96bf9cu, 0xf8c79d6au, 0x16376a1cu, 0x448ec0f2u, 0x49aca50eu, 0xbd78c4abu,
+        0x82561f36u, 0x5d423f90u, 0x49381c3eu, 0x35537a7du, 0x429341f5u, 0x02238b92u, 0x51ededd0u, 0xa0c49b08u,
+        0xa4a76a57u, 0x977ad81eu, 0xc661c3cbu, 0xa2341744u, 0xdb008399u, 0xc567f21bu, 0x8113fbafu, 0xdd331630u,
+        0x62aaa0d1u, 0x404bf432u, 0x5695e0d3u, 0xe0fb3240u, 0x97a3749au, 0xb7509e46u, 0xff1628f2u, 0x4efff70au,
+        0x6fefb726u, 0xd273b932u, 0x8b1fead1u, 0x0d422b05u, 0xffe876deu, 0x04876a22u, 0xc39e1da8u, 0xbb7d7d33u,
+        0x0d770f0cu, 0x2f20a823u, 0xfc76e1abu, 0x12969d3du, 0x55a7af98u, 0x10001e1bu, 0x66bf132cu, 0xb2417514u,
+        0x7b54f5eau, 0xb2b1325du, 0x3a684686u, 0xb5b321f1u, 0xab9e9669u, 0x712d3e5au, 0x82c6da4cu, 0xe8ecbf61u,
+        0x76f4baeau, 0xa9a797b5u, 0xeec5df6eu, 0x5543a0e7u, 0xeeb739d0u, 0x037c4889u, 0xd08c9b56u, 0x589f53a6u,
+        0xa76edf81u, 0xabf724bfu, 0x6f41a526u, 0x16f125c1u, 0xfb3238ebu, 0xf06d8f34u, 0xb7332b45u, 0x629a0ea4u,
+        0x38363cd8u, 0xb845be26u, 0x3aa1b43fu, 0x589255d9u, 0xb15a68dbu, 0x3d21f12bu, 0x326fef43u, 0x003f42d6u,
+        0xa0233facu, 0x1c8edaeau, 0x75babf6fu, 0xe3891422u, 0x090f4875u, 0x3ec4ba92u, 0xd1d44931u, 0x191291c7u,
+        0xe8358055u, 0xe2df9730u, 0x1de19e1au, 0x84b3600cu, 0x3602089au, 0x2cb25005u, 0x37015d58u, 0x2e0c64a4u,
+        0xc3680422u, 0x68b5e182u, 0x440b28a2u, 0xb353fb2fu, 0x96a8b8b2u, 0x57b9df1fu, 0x3b4ecfdcu, 0x41512e48u,
+        0xe078b3aau, 0xb69b7016u, 0xda2f28deu, 0xdb4858eeu, 0x7dc89830u, 0x10a42542u, 0x770feb72u, 0xc477a170u,
+        0xe3e0e56au, 0xc652b440u, 0xdd1f321du, 0x15c6e2f6u, 0xbe95acaau, 0xcf51390du, 0x312f5b2fu, 0xefc9a8a4u,
+        0x6256d513u, 0x3eef02b6u, 0x5cffd5a4u, 0xceef394du, 0xe6f247b1u, 0xd3577b00u, 0xc81f0308u, 0x48f57ab0u,
+        0x68e2f67fu, 0x319eb01bu, 0x1521f4f5u, 0x1f3bab75u, 0xc6967a1fu, 0xc6ad5ae7u, 0x10e4c65cu, 0x34f47d94u,
+        0x96a61eb5u, 0xd81476e7u, 0xb078917fu, 0xfa50ac42u, 0x8151182bu, 0x9ad84ba4u, 0x67281c3eu, 0xbbaff75eu,
+        0xa2947c63u, 0x55bc92d5u, 0x2e0b594cu, 0xb77bad10u, 0xf2a3af61u, 0x32079300u, 0xe853a6dfu, 0xc2059c7fu,
+        0xdd166f5bu, 0x0a85abcfu, 0xe48e0319u, 0x5da7df4au, 0x144aaae9u, 0x418d40f3u, 0x657c210au, 0xbc45bc07u,
+        0xfe25e66au, 0x819a0a11u, 0xbf92be0au, 0x166b87e9u, 0x32ee91f1u, 0xa73d020cu, 0xdcd1a71fu, 0xddbd86c5u,
+        0x53fce7a0u, 0x60b4e292u, 0x63bf2640u, 0xfdec38b0u, 0x56352971u, 0x0f861077u, 0xe03aa3dau, 0x711a4e65u,
+        0x86543bfdu, 0x8652d97cu, 0xaa86d8e1u, 0xecad8164u, 0x38f659dfu, 0xfbc77b70u, 0x78ed8263u, 0x447753e4u,
+        0x940795e7u, 0xd232a78bu, 0x2ae9f329u, 0x8479c862u, 0x110160dfu, 0xb5ee0cbdu, 0x05095850u, 0x660af818u,
+        0xd73b62dfu, 0xef1fa01au, 0x55aab84bu, 0x19461a71u, 0x9e414e81u, 0x88c892e7u, 0x67bec065u, 0x44d90e4cu,
+        0x67e70a47u, 0x2093f2fcu, 0xac7c4c0eu, 0x55ac23c6u, 0x970c8ba9u, 0x1df0b733u, 0x14a5f638u, 0xf7feb1a2u,
+        0xe0ff773du, 0x4b14ccdeu, 0x8f0ce8bcu, 0x83e6aae8u, 0xa061d2cdu, 0x6629ff1cu, 0x14da67a5u, 0x446cf873u,
+        0xa18da1c0u, 0xaaa04352u, 0x15c83e5fu, 0x7b481e94u, 0x29c5c6b5u, 0xa74795e4u, 0x17eaf4b4u, 0x15b2262du,
+        0x9f92cafbu, 0x1e2cb620u, 0x03e4a433u, 0xb509fa8au, 0x0c9892b2u, 0x1f7ee808u, 0x558b8da6u, 0xa0ed0e6eu,
+        0x27274a28u, 0x6927a363u, 0x7162e778u, 0x5694e050u, 0x9a84234au, 0x4968cbbau, 0x02d86507u, 0xae5beaceu,
+        0xf515ded8u, 0x49023fcbu, 0x47574301u, 0xe44d540fu, 0x3be32616u, 0x2788c81fu, 0xce39d20eu, 0x65ef2864u,
+        0x2e132620u, 0xb0c62b69u, 0x0d31c2e8u, 0x7f2e83bdu, 0xa304d8a1u, 0xe9e8ae77u, 0xfc2666a2u, 0xc5ddd189u,
+        0x2e4ed549u, 0x599bb267u, 0x05cab9ddu, 0x1718ca51u, 0xda466346u, 0xee99cc49u, 0x0d1a278bu, 0x7d3c56b2u,
+        0xaa008c7fu, 0xa5bb5a3cu, 0x49c991e0u, 0x0461ec86u, 0xf2cddbcdu, 0x01eb2b22u, 0x6b377bf7u, 0x1a7b493fu,
+        0x23606450u, 0x67d6e9afu, 0xafe5ee00u, 0xa6afe38au, 0x37a60423u, 0x432e8c40u, 0x0c1fafa8u, 0xec2a9cb6u,
+        0x921c3374u, 0x0db78ce3u, 0x03ab8052u, 0xc4210cd0u, 0xa7091470u, 0x4a0dc00au, 0xa920c613u, 0x8fe94309u,
+        0xfa99257eu, 0xfb274420u, 0xafe66adeu, 0x72529fc9u, 0xd5d53f71u, 0x19dcd403u, 0xc81b9982u, 0x9e615652u,
+        0x344ce9a1u, 0x786e02b9u, 0xd5074eeeu, 0xf5562a14u, 0xd603a9fau, 0xf13e0f76u, 0x76c31463u, 0x88cc7dc0u,
+        0x26c41068u, 0xc313cd2bu, 0x587097f9u, 0x4744be0bu, 0x3fe564e2u, 0x96b21723u, 0xeb790bfbu, 0x584a69cau,
+        0x30da39dbu, 0xf66d75e2u, 0x83ec03b2u, 0x5dcc6be7u, 0x3e12b83eu, 0x1299d47cu, 0xea41281du, 0xe5520232u,
+        0x62c96385u, 0xfb1a13cbu, 0x81b02fb8u, 0x6325d3bau, 0xf3982e8du, 0x5ec13efcu, 0x1beb350au, 0x9d0d8c71u,
+        0x2c54d9a6u, 0x608a5ed8u, 0x62b8a1a9u, 0xe6626d35u, 0xda32181eu, 0xfeded248u, 0xbd39fbb4u, 0x2033c509u,
+        0x2b83ff38u, 0x784bb35fu, 0x437a2986u, 0x43e52bdfu, 0x7b8109bfu, 0x97e31847u, 0x6c775af5u, 0xf4edf05au,
+        0x511a3738u, 0x2abc8478u, 0xea35790fu, 0x7cbb3335u, 0x4cb3b3c6u, 0x8b274bffu, 0x4b18e183u, 0x92e58b13u,
+        0xb95dfdf4u, 0x148fba75u, 0x1f668e18u, 0xd1841a1eu, 0xd1dbbd5fu, 0x3a8e27ceu, 0xafa9085fu, 0x2d8f74aeu,
+        0x2f2d487fu, 0xdeff81ddu, 0xc7a9e27cu, 0x8f21523du, 0x4732be99u, 0x3c4a3104u, 0xdb38cb53u, 0xab8f24e3u,
+        0x6cb2001au, 0xd49a4ed4u, 0x663cbf54u, 0xd331cbe2u, 0x4e825e28u, 0xdea185bbu, 0x22300ca2u, 0xa089b61bu,
+        0xc612badeu, 0x45598a3du, 0xe0f30941u, 0x2e76c4b0u, 0x7e916248u, 0xe24feeabu, 0xed8b8774u, 0x0efa4775u,
+        0xd1bdfd0bu, 0xb35f1923u, 0x07d5a121u, 0x5ba4ecb9u, 0x13d81429u, 0xd0e4e7cfu, 0x234c6331u, 0x5d022377u,
+        0xdba2df68u, 0xd63ac042u, 0x7468874au, 0x9feda8dau, 0xb10b09d5u, 0xb37cda74u, 0x2d951647u, 0x28db5099u,
+        0x8c9c014cu, 0x9de3f175u, 0x7877b889u, 0x0e9c2728u, 0x69ea9359u, 0x1e25dc87u, 0x22604190u, 0xb50efa4au,
+        0xf0f2e4d3u, 0x30321616u, 0x139dcb30u, 0xf324fa79u, 0xf345a679u, 0xd4fbd74au, 0xc4907570u, 0x7ffc850eu,
+        0x2d27d7b8u, 0x74a89fa6u, 0xff33ed9eu, 0x2f176e33u, 0xb16727c8u, 0x1804dc95u, 0x8894b683u, 0x75c6e238u,
+        0xeed453d6u, 0xbd64983cu, 0xe396175cu, 0xa382a414u, 0xa3344ee2u, 0x762847a2u, 0xdc971d06u, 0x27579011u,
+        0x5b2a1420u, 0x0e612832u, 0x827bc958u, 0x1806de36u, 0x8c4de6b4u, 0xfae67b7fu, 0x7cca8f64u, 0x9b69a1e8u,
+        0x40c3070bu, 0x0ebeb586u, 0x785e0cc6u, 0x19c5e669u, 0xc6578f2bu, 0xc3e4c9b4u, 0x6f0462e9u, 0xfaa467a4u,
+        0x6e576e96u, 0x65a6841au, 0x97999c3bu, 0xec92325eu, 0x87db7ac3u, 0x42ad4a7fu, 0xeeb1d752u, 0x5211a28bu,
+        0x34a21884u, 0x8416beb5u, 0x584e1f05u, 0xcdfcd673u, 0x93147bdeu, 0xf25d0df2u, 0x2dd6a53bu, 0x00000001u,
+    },
+    { /* 2^155 */
+        0x7eb5dda5u, 0xe8ccf11fu, 0x2f23085eu, 0x9a52b826u, 0x7e58a35eu, 0x7c5183bau, 0x30967b6du, 0x1777805eu,
+        0x296a3380u, 0x2ed1532du, 0xfad622a1u, 0xc7ab9f00u, 0x4742de17u, 0x7511c3ccu, 0x402bc83fu, 0xf867e3e3u,
+        0x9594ae90u, 0x4c4cd4f5u, 0xa45f9489u, 0x3e40dd6fu, 0xba8fe3dfu, 0xd7a5c361u, 0xb7b973c6u, 0xcc6b8dbcu,
+        0xdcf39ea2u, 0xf95c6395u, 0x787a7a68u, 0xb80f082du, 0x0f53d4b1u, 0x3777d0abu, 0x657000fdu, 0x6b640e4du,
+        0x25f6e7e1u, 0x11f03f32u, 0x86a568fau, 0x9fc70b42u, 0x6452dd2cu, 0x141d2518u, 0xb34b490au, 0x8c2b1bffu,
+        0xc893e41fu, 0x9d0d5198u, 0x3d8dbb0cu, 0x3aabc46du, 0xa641f1fdu, 0xcbae98edu, 0x4eb6578du, 0x246e8461u,
+        0xa56dccbbu, 0x1e8cec44u, 0xe7a89fe4u, 0xa9165104u, 0xb21ec4c9u, 0x832c77f3u, 0x904586cbu, 0xb6232a19u,
+        0x07e0ef8bu, 0xfe77cb15u, 0xa54a14f6u, 0x5651771eu, 0x30c24a4eu, 0xe32c1bb8u, 0xe8e9ddcdu, 0xec61b023u,
+        0x0c8c59d6u, 0x0ddb0360u, 0xfe295e27u, 0x747be93bu, 0x485b3b6au, 0xc07f407eu, 0xddfd56adu, 0x1c8624c7u,
+        0x94b1a78au, 0x7c32272eu, 0xff478350u, 0x32982da3u, 0x8e21892au, 0x067bbeb3u, 0x69591d18u, 0xdc8767f3u,
+        0x7ed923b5u, 0xbef97330u, 0x62065187u, 0x4788c7eeu, 0xe0af2c04u, 0xc348e7c7u, 0x1d504c8bu, 0xa2f28cfdu,
+        0xe39f06d6u, 0x14bcbf70u, 0x4c507c59u, 0x69ca9250u, 0xe5247497u, 0x90b701f1u, 0x54bc590du, 0xcc99e67eu,
+        0xde54a280u, 0x96f9646au, 0x2e062afbu, 0x14a827e6u, 0x856b8a07u, 0x67bad1a9u, 0x0b8509aeu, 0x63a24632u,
+        0x55a6c3f6u, 0x4ea30884u, 0xdbe1909cu, 0xa3ddc877u, 0xfd7ea0dfu, 0x0a6f560eu, 0xaa0998e2u, 0x54732634u,
+        0x0de1f350u, 0xb7651279u, 0x86289711u, 0xd79ade87u, 0x08f3fe4bu, 0x4526df48u, 0xa4ae12a4u, 0x7736a3ceu,
+        0x01de0cf8u, 0x53ae8e11u, 0xac5340e7u, 0xca850426u, 0xc844cffeu, 0x514cf0ceu, 0xc2707ae6u, 0xed866277u,
+        0x0a5b08abu, 0xb44af7f5u, 0x76a6a1d6u, 0xaf7d60deu, 0x0ea8bb17u, 0x72f41a2bu, 0x18b1b903u, 0x24dc1839u,
+        0x86c74d4cu, 0xe28ef3beu, 0x7e1ce0f7u, 0x6d5f3251u, 0x3a22d274u, 0xdabd0b78u, 0x0272a3ffu, 0x89a673a0u,
+        0xc61748b5u, 0x58032af5u, 0xb371c8d5u, 0x880f93d3u, 0xdd671232u, 0xed9a3b80u, 0xa25b94b7u, 0x0be50d43u,
+        0xec096b1du, 0xfcdbfc2au, 0xfae5fbd7u, 0x9e28adf1u, 0x7b2a77fau, 0x27d23c08u, 0xe701c263u, 0xbacbf06bu,
+        0x42a015c2u, 0x14d6b45fu, 0x72fa6adfu, 0x12cde173u, 0xf269262du, 0xa84379c4u, 0x23587adeu, 0x6d27a6aau,
+        0x1b3525d3u, 0x9c231c1cu, 0x9da17bbdu, 0x4557f2e9u, 0xc4e2403fu, 0x22759658u, 0x7750732eu, 0x7c22b4c3u,
+        0xbfaccb4du, 0x033b8d91u, 0x2427537fu, 0x7d8be721u, 0x23e8a6dbu, 0xa2c1787bu, 0xcfcb5250u, 0xc2bfc6c1u,
+        0xf20039c3u, 0x853a2dfdu, 0xc961b3c1u, 0x95ef2975u, 0xf83c1430u, 0xd81110cau, 0x26a1f4cdu, 0xd5442961u,
+        0xcdb0a32eu, 0xdcb62997u, 0x223f0dd4u, 0x4ffcac07u, 0xdce73f4bu, 0x9b1a3163u, 0x981e8eb8u, 0xd46a76b5u,
+        0x157d25b0u, 0xb9ee36d2u, 0x5d1023deu, 0x94dc45d4u, 0x95097afdu, 0xfc807566u, 0x656f6eacu, 0xcfaad6f7u,
+        0xf2797cedu, 0xd6f293f4u, 0x117517d1u, 0xb0161986u, 0xac490fc8u, 0x4d73ec62u, 0x49397844u, 0xc79c4c10u,
+        0x57f5d482u, 0xede8728au, 0x4ec71eecu, 0xc5714608u, 0x5afe24a9u, 0x0ff04579u, 0xd30e027au, 0xab432bb9u,
+        0x1a54757fu, 0x3d7f10e2u, 0x8fb4c4d3u, 0xbe0970c0u, 0x3f1203fau, 0x990f68d6u, 0xf25da041u, 0x1e1986afu,
+        0xf0050035u, 0xcdc55f12u, 0xc08d0415u, 0xd0ce0019u, 0x0d93e328u, 0xd28827a3u, 0x84702bf1u, 0xc1d24b2fu,
+        0x91bd4705u, 0xde2c1cc5u, 0xa1a7ac75u, 0x171429b7u, 0xc6778f84u, 0x4ecdb1dbu, 0xeb05cd5du, 0x7f9333ceu,
+        0xd3699aa2u, 0x420ad08eu, 0x1228a4acu, 0xcf07d19cu, 0xe2e29c47u, 0xee799748u, 0x06117c69u, 0x575741c4u,
+        0xf31b0a6au, 0x9cd9ee1au, 0x51040fa2u, 0x5691f3cfu, 0x1ae700c1u, 0x7a0ae337u, 0x668a35abu, 0xc721e752u,
+        0xd5356fbau, 0x1c9a336du, 0x318d0c76u, 0x1a844f3fu, 0x60e8054fu, 0x781c8a13u, 0xd2eee0bfu, 0x785ec4e2u,
+        0x71963352u, 0xb98b5edbu, 0x715b0159u, 0x25fe4667u, 0x1f6f0531u, 0x4b4b8e81u, 0x24bb1d3cu, 0xb6828cc7u,
+        0x4fcb1e5cu, 0x6c910d9du, 0xa2fdd1b4u, 0x7ea3d783u, 0xff6738d8u, 0xd37e10fbu, 0x6bdb692eu, 0xee4dc7fdu,
+        0x8f41403eu, 0x1d0fb1c7u, 0x5f35e906u, 0xae8220ddu, 0x97629f01u, 0x3dfd53ddu, 0x74c05f5eu, 0x09619b64u,
+        0xee6aadcdu, 0xebca6921u, 0xcb5d3acau, 0x7edb6c65u, 0xa042a421u, 0xe8116de1u, 0xd23690ddu, 0xfe884a68u,
+        0x649765e7u, 0x776aefabu, 0xcdbae671u, 0xa3a78bdeu, 0xe1317ff0u, 0x2f677ad4u, 0x6bdb440du, 0xd744dbc2u,
+        0x0cc1beffu, 0x02a525e7u, 0x95753471u, 0x83aab2d9u, 0xaaf7623cu, 0x2a18fc54u, 0x3b8b22ecu, 0xf87b551fu,
+        0xabccd5f4u, 0x900eb340u, 0xcfdde9aau, 0xe1582951u, 0x53548466u, 0xaf9fce21u, 0x9c8376d0u, 0xc1589aebu,
+        0x12d5216fu, 0x8358e644u, 0x5070aba6u, 0x4bde4973u, 0xe68debf0u, 0x4e59c165u, 0x54e6b47fu, 0x75f29daeu,
+        0x4cd4f4b7u, 0x553cc91eu, 0xe9858afcu, 0x87d094e0u, 0xc18362ccu, 0x6aa7f31bu, 0x55553c32u, 0xb527e98du,
+        0x3d9d463du, 0xc81bfbd0u, 0x17aef484u, 0x4977790eu, 0xc72c0153u, 0x0de2ebdcu, 0x791e2e3eu, 0x0696b653u,
+        0x8b05c7dfu, 0x8bece855u, 0x88d3cbdbu, 0xf782b696u, 0x3f35905eu, 0xcf809a4eu, 0x351808adu, 0x87cb67e4u,
+        0x438d6de9u, 0x01192790u, 0xe7ae574cu, 0x3cff0420u, 0xea7320e4u, 0x2cfb8594u, 0xff01b109u, 0x21ddb77fu,
+        0x15897229u, 0x8dd5d64au, 0x202d4acdu, 0x9d848db7u, 0x05f679f5u, 0xc2c79109u, 0xd2a12e0fu, 0x4538b9c5u,
+        0x3cd6579cu, 0x913796e5u, 0x71e44d38u, 0x2700deebu, 0x3a6389b0u, 0x1ad9ff9bu, 0x118aeebcu, 0x1b76a0b8u,
+        0x4a685670u, 0x8bf683f6u, 0xf8e1c9bau, 0xdc313daeu, 0xdd291b53u, 0xb2ba7cbdu, 0x118a2009u, 0xa90d4038u,
+        0x1c07b3fau, 0x6992856fu, 0xc2152210u, 0x42702aeeu, 0x93c87aa3u, 0x6c8334fau, 0x18c369cau, 0xa6f7256fu,
+        0x23dc3888u, 0x78a1d79cu, 0xc3ec62b8u, 0x2f428131u, 0xc395566au, 0x60d3e073u, 0xb5487611u, 0x07abd9ccu,
+        0xc9127d7du, 0xc8b2e309u, 0xb6974f61u, 0xfbdbf89bu, 0x6c8346a5u, 0x7ce35742u, 0x5a3a19d3u, 0x0dcda9f2u,
+        0x4ae269ddu, 0xb49d3b1cu, 0x44715453u, 0xb1db10a9u, 0x424b180fu, 0xbc4e8801u, 0x9f7a9bf3u, 0x3707cbbfu,
+        0xdf252293u, 0x2f6438adu, 0xaa637fd0u, 0xce992366u, 0x8d5036a0u, 0xf3085b9du, 0xc4113ccbu, 0xcc48bb01u,
+        0xc2e7f6e9u, 0x92c7779eu, 0x45ecdf00u, 0xba9d1a59u, 0x10b69a14u, 0xcc9ebc31u, 0xb16e2a75u, 0xceec7d04u,
+        0x2ccda10au, 0xda53f40fu, 0xf41cc6eau, 0xa1e7ad51u, 0xe811adc5u, 0x66430854u, 0xb5c4a77au, 0xfd881c75u,
+        0x3b09d90cu, 0x3204c4cau, 0xe280a5ddu, 0xff00381du, 0x3cbd32d7u, 0x506ef90eu, 0xedb7c942u, 0x0efc1616u,
+        0x42f935c3u, 0xbeef3dfcu, 0xfb359976u, 0x3ccc1ec2u, 0x4dfaf59fu, 0x6d4871c1u, 0x5c385c70u, 0xf663c1bcu,
+        0xa7816c80u, 0x9043a46cu, 0x61c9fe95u, 0x6f5107a0u, 0x2b0a66aau, 0x772068b9u, 0xae1d9b39u, 0xc1529a95u,
+        0x3ba7de00u, 0xf38e1059u, 0xa758eb7au, 0xc8238d37u, 0x0cb34307u, 0xc9568005u, 0x6ab3dc26u, 0xde2dca7cu,
+        0x42f2c799u, 0x399754cdu, 0x217f79eau, 0x68852963u, 0x7a7466a6u, 0x95b2358fu, 0x2fc9a048u, 0xb4046843u,
+        0xe04dd2fau, 0x4596d09au, 0xc8b86a45u, 0x7a2d6cc3u, 0xb1ec4ca2u, 0x4b084230u, 0xd3f88783u, 0x4be63faeu,
+        0x40f14d6cu, 0x706570bfu, 0x8595ed21u, 0x963be3c9u, 0x58e5d971u, 0x3b43f686u, 0x194952bfu, 0x926d8d60u,
+        0x4a020e16u, 0x2a956d08u, 0x7d98675du, 0x33e71607u, 0xe7eb5c77u, 0xb3ce1362u, 0x4a986fa2u, 0x6aed3af8u,
+        0xa9afe8ceu, 0x62550bf9u, 0xc6fcefc5u, 0xe3f6ef1au, 0x3da59705u, 0x902a7413u, 0xa0e05462u, 0xea942acau,
+        0xfe5b272fu, 0x0063c06au, 0xbcf26fe4u, 0x173e2aedu, 0x23308899u, 0xe8d4d128u, 0x804ac4deu, 0xe5884fe1u,
+        0xe8d1b7a8u, 0x3ea07bebu, 0xbadd8a9cu, 0x04c3a7ebu, 0x26f91cd0u, 0xc033e364u, 0x9f06de49u, 0xa5a4c2d1u,
+        0x0f1faab8u, 0xc2f1efbcu, 0xdcd0de4fu, 0x548017f5u, 0x1600e8fdu, 0xe443252du, 0x096ef382u, 0xb9caaa39u,
+        0xc96dd77au, 0x55fe2ee9u, 0xbe3e3ad2u, 0x34273d46u, 0x690576f7u, 0xba0ce5b0u, 0x96ec946du, 0xa72082feu,
+        0xacc9c43au, 0xd15a213cu, 0x2dd22b0bu, 0xae430ceau, 0x681a9574u, 0x9a433519u, 0x5bd6078du, 0xad5c124eu,
+        0x5b19bcc8u, 0x0b6122ceu, 0xb7b64186u, 0xb27b36cfu, 0x29d24da7u, 0x932f26efu, 0xfec031a4u, 0xe2bb305fu,
+        0x53bfd153u, 0xba3e89e3u, 0xa0c6703du, 0x99b4556bu, 0x87ac5e18u, 0xd4ab9094u, 0x7fb38fa2u, 0x2dda31afu,
+        0xb7a2d1aeu, 0x8f22f526u, 0xa653d813u, 0x39d4d4aeu, 0x8de8191fu, 0x4cc5da8fu, 0x5e04f0dfu, 0x57518a6bu,
+        0xbdd74726u, 0x5d09d63au, 0x1bdf7c57u, 0xc9648c6au, 0x9c687647u, 0xf65c7d48u, 0x2134f96cu, 0xfa60b152u,
+        0xd20f8e31u, 0x3c93b96cu, 0x8e2a1cd2u, 0x26828a5du, 0x750ffe4bu, 0xb93430fdu, 0xa33c6262u, 0x9447044du,
+        0xa535de0cu, 0xb735286bu, 0x95409f26u, 0x81009acau, 0x415cdd8cu, 0xacc320f9u, 0xf1e6d2b7u, 0xdcff4c41u,
+        0x7813d774u, 0xc7d26a51u, 0x6e562697u, 0x6fd14646u, 0x8396cdbbu, 0xdb4fd769u, 0x7c9abf5bu, 0x61effcc5u,
+        0xa9c3116bu, 0x9945ba0fu, 0x8b9de155u, 0x714b9755u, 0xad3955cbu, 0xf679ed02u, 0xbc26abbfu, 0x00000000u,
+    },
+    { /* 2^156 */
+        0x7489b159u, 0x0deae4f5u, 0x8f65de15u, 0x5b09d07bu, 0xd659f1c5u, 0xd3423ac8u, 0x574d2b98u, 0x6e96bbbau,
+        0x7d294f23u, 0x73f99819u, 0x07d20925u, 0x0bf48bc2u, 0x96ee49fau, 0xb7576034u, 0x2f1ba347u, 0x80b525b5u,
+        0x3504055eu, 0xa11a8a3bu, 0xe9357fdeu, 0x33fb48d3u, 0x59636808u, 0x6a5ead20u, 0x8eb2a939u, 0xa07a1844u,
+        0x042e0c62u, 0x461421cdu, 0x8b0c9716u, 0x80ca3cd0u, 0xbc6a616fu, 0xb01df3b8u, 0x8e974c39u, 0x83980817u,
+        0x892122e0u, 0x2b64648bu, 0x5e7b4694u, 0x9a10857bu, 0x14af4d0au, 0x75edf3a8u, 0x2a84558cu, 0xf7f15b58u,
+        0xde3c41a0u, 0x8d0013d7u, 0x210f5665u, 0x0e92b517u, 0x3c79de7du, 0x6e01877bu, 0x45fb7218u, 0x49389af0u,
+        0x58cb2286u, 0x3ae7e7a5u, 0x1ae10beeu, 0x882bc60eu, 0x8796ba8cu, 0x68c617b4u, 0xd91e7847u, 0x5dc56c87u,
+        0x693a501cu, 0x5451e152u, 0x36da8de0u, 0xb9adcb13u, 0x5d8fd509u, 0x981eade0u, 0x75d7fa70u, 0xaf6d4d92u,
+        0xc7570105u, 0x5ea5f4acu, 0xdedbb4cfu, 0x9d7a414eu, 0x5d387046u, 0x26a5e3afu, 0xd9f7f4a1u, 0x230e63f4u,
+        0x8cf683b0u, 0xca70b1b1u, 0x08d22c7du, 0x7f7920ccu, 0x7bb2e391u, 0x2d31ce95u, 0xc5cc7cb5u, 0x1d5d94a3u,
+        0x729b7221u, 0x82c73460u, 0x29bc7827u, 0x3008abb9u, 0xaf787febu, 0x26263e2au, 0x37693ba7u, 0xad07e6e2u,
+        0x77640824u, 0xc65f5a04u, 0x156346e1u, 0x9ac51ed0u, 0x71f01a81u, 0x3711d82fu, 0xef1b6a03u, 0x7d9e7393u,
+        0xed69a5f1u, 0x6d4813c7u, 0x0330ae8bu, 0xee0992eeu, 0x467409d3u, 0x9d46a069u, 0xcf558c81u, 0xaa1212c8u,
+        0x08ed7a96u, 0xc2ccaa55u, 0xb841ae2du, 0x156c5326u, 0xecdd27d6u, 0x21bcd373u, 0x89eac2e7u, 0xc3b2021du,
+        0x0ea87d0du, 0x5ae44505u, 0xf1daa8aeu, 0xda8dfb73u, 0x9f119675u, 0x72e8f68cu, 0x6a346b3bu, 0xc6a06482u,
+        0x0b62e651u, 0x03357d01u, 0x0ac84f6fu, 0xa92714b0u, 0x43e87c39u, 0x744bafffu, 0x3859a5edu, 0x73ab1846u,
+        0xd124320fu, 0xf1069679u, 0x809a8438u, 0x502e473eu, 0x8c3af74cu, 0xbaa97023u, 0x687aa1e1u, 0xc9cb75e9u,
+        0x8c36980bu, 0x12ae77f6u, 0x71ff37ecu, 0x2305df4du, 0xfd315874u, 0x5b321ad2u, 0x51ee93a7u, 0x227813e0u,
+        0xc79e3468u, 0x88d22ccbu, 0x20da1232u, 0x8d6ac802u, 0x0bd91e32u, 0xe6212d97u, 0x92045407u, 0xe40a6b36u,
+        0x70fead87u, 0xc1cd9ddau, 0xbc873ac4u, 0xf037ca32u, 0xd4eb9ef4u, 0xdc64d785u, 0xf4d8cfccu, 0xa76d5137u,
+        0x738d15e6u, 0x49f386ecu, 0xfb2800eau, 0x6df18589u, 0xe6102079u, 0x413fad44u, 0x9ab26c64u, 0x5d799253u,
+        0x3a4d068cu, 0x1ac1d2f7u, 0xe5d0245eu, 0x07b48caeu, 0x386baf28u, 0x4682ebd6u, 0x0cf7eec0u, 0xbec2d474u,
+        0x2edd7913u, 0x2e4aab64u, 0x65e5a651u, 0xb916ffe1u, 0xe391efa6u, 0xf082c7c6u, 0x8a635de6u, 0xe4a81d8cu,
+        0xb2075898u, 0xfa3a3073u, 0xbbef5fd9u, 0xf592ed48u, 0xbbc3ca1eu, 0xd18d9622u, 0x108cf21cu, 0x599941c0u,
+        0x1424131bu, 0x54cfbc5bu, 0x89e48fa1u, 0x04585808u, 0x7cd7dc0au, 0x1c77aa60u, 0x904929a7u, 0xad4a6271u,
+        0x52f03243u, 0xbf939e67u, 0x4247b0c6u, 0x9d84911bu, 0x21c4b8d8u, 0x7a7b8c7cu, 0x52e25d26u, 0x5db29e69u,
+        0x04e895adu, 0x45ac5979u, 0xbe6b07e1u, 0xcd02ff67u, 0xb2c65d2eu, 0xfaf3d998u, 0xeda6f03eu, 0xa22ed3ebu,
+        0x4c2383eau, 0x1262db13u, 0x1ac031acu, 0xff772170u, 0x18a93513u, 0x76d8d977u, 0xca43801bu, 0xfa55bcfbu,
+        0xec7146b4u, 0x94c692f8u, 0xbf412d05u, 0x032293b0u, 0xc6f22439u, 0x35d07a9du, 0xadc281c5u, 0x39fb576bu,
+        0x8ff01eb3u, 0xf5ce4fb8u, 0x7095fffbu, 0x15582a2au, 0x7c166628u, 0x04e36938u, 0x73ee9a1du, 0x02c18565u,
+        0x0e72dbaeu, 0x59e3f577u, 0x293a1adcu, 0xe99aef3au, 0xe404a578u, 0x17707681u, 0x9d1ef104u, 0x45288fb3u,
+        0xabfff813u, 0x451dd7a3u, 0x773e2843u, 0xde882ea8u, 0x8befd13fu, 0x019e3e15u, 0x0f47d350u, 0x08f78740u,
+        0xdbda41afu, 0xd6d7b6ebu, 0x69472917u, 0x15a39356u, 0x99f974d6u, 0x1c7540bdu, 0xbb62eff5u, 0x3134ba8cu,
+        0xfae2dbdau, 0xe4061d02u, 0x3a2f3bc1u, 0x849e7a43u, 0x137d35f4u, 0x8194199eu, 0xd5797793u, 0x4686b080u,
+        0x412da7e9u, 0xe6699b29u, 0x0db0f0a2u, 0x25d3773du, 0x3d4b794cu, 0xca10b8d9u, 0xb6d8c974u, 0x4b588ec5u,
+        0x75172066u, 0x3561e044u, 0x71aee043u, 0xd08764dfu, 0x936a2d09u, 0x02a4647du, 0xc173c9b4u, 0x8e1ca440u,
+        0xa9ae536cu, 0x0dafe2aeu, 0xfec9ce64u, 0x73259f3du, 0x0acb6335u, 0xd320ca77u, 0x1e4c9a50u, 0xc3542221u,
+        0xb1abbf46u, 0xe2b8f263u, 0xa181188eu, 0xfcf3c610u, 0xe545427fu, 0x44b38adcu, 0xe190c3fbu, 0x19aaebbcu,
+        0x91192476u, 0x341d120du, 0xdd4f357eu, 0x632d4bafu, 0xd8a86184u, 0xf844c765u, 0xcbd8de15u, 0xf9b43d15u,
+        0xec76f98du, 0x92c92df8u, 0x598e5d31u, 0x6e4e6148u, 0x3801409fu, 0xcf2e8eeeu, 0x2c2b7767u, 0x1a0ab113u,
+        0x5f5c92ffu, 0x041a9c99u, 0x0f3047a4u, 0xa5bdd0dcu, 0xdde989ccu, 0xf1cf2c52u, 0x385a6dbbu, 0x97954aa9u,
+        0xcd23604bu, 0xc70e39aau, 0x96a1ec8eu, 0xed725ccfu, 0xe91308f3u, 0xaeb4f92du, 0xa2c91f25u, 0xe1d170e1u,
+        0x03fcce91u, 0x712d8cf8u, 0x6c857f8bu, 0xc5a75c09u, 0x2685b43au, 0x081d9095u, 0x70b5cc2au, 0x2aa1bd4fu,
+        0xa96d8e73u, 0x77af5a97u, 0x44742e8fu, 0xc39f6015u, 0xd6412aabu, 0x8707bad4u, 0x0ad4faedu, 0xfda1ab67u,
+        0x517e3f63u, 0x4219ceb8u, 0xb5b8d13du, 0x231227d9u, 0x59efbcd2u, 0x4125f0beu, 0x15013119u, 0x3f57bf75u,
+        0x5ebc328au, 0x000d3635u, 0xdc0ce165u, 0x53fc56a1u, 0xf7ae9e66u, 0xebd04554u, 0x23fed095u, 0x4071512du,
+        0x7dfc4a2eu, 0x913c594cu, 0x713e9fb9u, 0xed45ebafu, 0xedd0e8dau, 0x9a8d6690u, 0x11337be1u, 0xe48d2d43u,
+        0x0fee42c7u, 0x0ccdf8f9u, 0xbd741e6bu, 0x0f487f82u, 0x15e21accu, 0xb71defb3u, 0x6808558au, 0x25f20dc7u,
+        0xe4de9cb4u, 0x5d8523a4u, 0x5e4a76aeu, 0x3ebc8141u, 0xb41306acu, 0x141c35d9u, 0xb8ed1a40u, 0x7dbf2cc1u,
+        0x08883394u, 0x504040e0u, 0x61766160u, 0xc4969d5cu, 0xc43f78ecu, 0x36cc76a7u, 0x6ac19457u, 0xf5a4f794u,
+        0x21f8ab6eu, 0x3997514fu, 0xff40fd2au, 0xfe81c1acu, 0x14d83ed4u, 0xf62107a8u, 0x99a2d179u, 0x8a3ac59au,
+        0x6a811501u, 0x76bb0b4au, 0x1f7ff372u, 0xc4a65c37u, 0xf5403b9du, 0x99700bd6u, 0xffee0853u, 0x79f02b95u,
+        0x0a384cd7u, 0x7efefcf6u, 0x32934c99u, 0xeb19a30au, 0xb951063eu, 0x55805c2au, 0x90259effu, 0x7fa493a1u,
+        0xb6f09f3eu, 0x626f6879u, 0x4bef46b7u, 0x1a51bbc3u, 0x485d91e6u, 0x28c03a79u, 0x13718bd2u, 0x07219e70u,
+        0x5b7c5553u, 0x09905534u, 0x74537078u, 0x7a4b10e3u, 0xb6f7184bu, 0xf920e214u, 0xafdb50cau, 0x33c82602u,
+        0xd9f53e33u, 0x193eb5f4u, 0x29f58262u, 0x239aae1eu, 0x4b1373cau, 0xa7d7fe29u, 0xf093ee1eu, 0x215b6a1du,
+        0x6dc4b3ccu, 0xa590270cu, 0xb6027cc1u, 0x75006191u, 0xeb8cf04cu, 0xe5e91bceu, 0xb4b91559u, 0xba39cf99u,
+        0x0b6df65au, 0x8aa8b723u, 0x861f40dbu, 0xa3c83e5cu, 0x2dbb4bfeu, 0xb2ec336au, 0xc9abcc50u, 0x300f61d1u,
+        0xa607b0b8u, 0xdd0b33aeu, 0x4193cc80u, 0x8fc948eeu, 0x2b9df5fau, 0xb76ca689u, 0xaa6391d7u, 0x43a73c0du,
+        0x8c96c8b0u, 0x1fd5f71cu, 0xf376d1e7u, 0x9c27b5d7u, 0xd9362525u, 0x6272ea10u, 0x87a245cau, 0xd9135c43u,
+        0x81a8b839u, 0x581a15dbu, 0x23d29f26u, 0x31e4d3abu, 0x683b05dcu, 0xc4b4c48au, 0x27f1d278u, 0xf5096de1u,
+        0x2026e770u, 0x29805d67u, 0x39c525ebu, 0xeed38fb9u, 0x48439709u, 0xe4c439d6u, 0x6913c17cu, 0xba610786u,
+        0x601e1147u, 0xf49781afu, 0x00a4ba93u, 0x55848968u, 0xe3566b3bu, 0x662778c5u, 0x231dfb50u, 0xb9ae3b82u,
+        0x537f4037u, 0x7d4f68a2u, 0x09a76a14u, 0xc2afc3c1u, 0x488820fau, 0x47294b95u, 0x3a1d57b4u, 0x539eb1b5u,
+        0x4da94176u, 0x214412bdu, 0xa662dccdu, 0xb694a4f8u, 0x76cde0ffu, 0xfc43e738u, 0xe3ea1b71u, 0xf517c416u,
+        0x4db8f875u, 0xeaedc776u, 0x0c274959u, 0x625f037au, 0xd5d4bb34u, 0x609d59b8u, 0x99faf061u, 0xb19684e2u,
+        0x67892147u, 0xab750533u, 0x659fc8c8u, 0xba5a7f81u, 0xf3f6a70eu, 0xb9d585e8u, 0xad4cbb8bu, 0x238446f8u,
+        0x6bad20d9u, 0x4be34604u, 0xffc4c9e9u, 0xdfcc94acu, 0x70318471u, 0x56e0f07cu, 0x2fa23286u, 0xa6862b36u,
+        0x381bdd28u, 0x44a28a91u, 0xa72522b7u, 0x6bfe567du, 0x271ec832u, 0xd2abe1ddu, 0x72543523u, 0x7c9234e2u,
+        0x94ba1c67u, 0xf6eb6ae7u, 0x8db40ac2u, 0x8bff35d8u, 0xbaf10f79u, 0xfb0c207au, 0x94cea5ceu, 0x5a4aaa6du,
+        0xa2bd274eu, 0x73cfa6fau, 0xe2f48fcbu, 0xe5fb1320u, 0x9e1a58aau, 0x9b67edf7u, 0xdd922ab8u, 0x75e362f5u,
+        0x34a73a17u, 0xc2fffd2bu, 0x063acc82u, 0x27333b32u, 0xb04ccda5u, 0x1ec2491eu, 0x7665caa1u, 0x3a1610d7u,
+        0x2c5d928du, 0x3078f9b7u, 0xf3a27f83u, 0x20a3cca0u, 0xb6c13b60u, 0x97cf1a05u, 0x0ab69cd7u, 0xaa28cb57u,
+        0xb2fa17e8u, 0xb9841481u, 0x4360a7bau, 0x0c1d19f1u, 0xe54608a9u, 0x9ed22185u, 0xfa6a7832u, 0xb2e26412u,
+        0x938bc25cu, 0x0afc0ee8u, 0x9d52e25au, 0x0f9c5baau, 0x7d7c009cu, 0x0ebce30bu, 0xa5e21134u, 0xd88daa0bu,
+        0x3ee247b1u, 0x1f5472cbu, 0xd36c20acu, 0x09cbb65eu, 0x5a3bea84u, 0x47465528u, 0x9133b4deu, 0xee5cbe66u,
+        0x34e45682u, 0xc5ad6871u, 0xd1f6c131u, 0xf1baf6e5u, 0x260f8591u, 0xd340efefu, 0x567b10e7u, 0xf51d9b09u,
+        0xb43976ceu, 0x445a3e1au, 0xa3ebcf64u, 0x6ef712dcu, 0x2f2af30bu, 0x4acd4086u, 0x92592cb9u, 0x00000001u,
+    },
+    { /* 2^157 */
+        0xf4c67f82u, 0xa473c8edu, 0x81699422u, 0x216c7237u, 0x7c1c45f1u, 0x6002640fu, 0x3c30a9e0u, 0x7ec70446u,
+        0x95ee2cd4u, 0x34d059eau, 0x65caa2f2u, 0x782a2c47u, 0x70fd48eau, 0xe8547551u, 0xb0013274u, 0x3966d8ceu,
+        0x5bd6746au, 0x18cb75cbu, 0x57193c99u, 0x601e9232u, 0x27a725b3u, 0xd22731d9u, 0x23b4a4b0u, 0xd8db210du,
+        0x1df4c6f2u, 0xebec5af9u, 0xbc8708b0u, 0x470d1853u, 0xec2fb6b0u, 0xfc450b48u, 0xa3bbfad2u, 0xf6d38cf2u,
+        0xa128f7d1u, 0xf7bfb4a7u, 0xcb8d84b6u, 0x950de1ceu, 0x28b44800u, 0x225d0123u, 0x599d808fu, 0x77641d75u,
+        0x2e2da223u, 0x321d6e6fu, 0xa4abd39du, 0x37a9c01du, 0x3ca4c35fu, 0x79466ebau, 0x92c3e802u, 0xd59f9179u,
+        0xed2e3b81u, 0xcc2f39feu, 0xe4acab00u, 0x296dea76u, 0x02ed4bf6u, 0xcd51d357u, 0xf8e24706u, 0x92a5db95u,
+        0xefdde615u, 0x54850bc3u, 0xd2e1f1c9u, 0xd70ea245u, 0x609a7188u, 0x569ca8f9u, 0x768a78d2u, 0x02e15466u,
+        0x35659b97u, 0x7fdb571du, 0x568cdcacu, 0xa76d6105u, 0x86f8da5fu, 0xa1aa7db4u, 0xb4804222u, 0x80abb4eeu,
+        0x67b19e10u, 0xfbbc0f05u, 0x53fcab1au, 0x57053e23u, 0x04c1dd1au, 0xfebe6c71u, 0x45281e3bu, 0x8d81dd1eu,
+        0xc2ae6f43u, 0xce923256u, 0xf51c74d7u, 0x3a89e1d2u, 0x5373759fu, 0x23aadb9eu, 0x83597750u, 0xb6d2fdaau,
+        0x0ebdac70u, 0x4e91827du, 0xbc980826u, 0x49a3e0b8u, 0xe2228bb5u, 0xeef34614u, 0x72665851u, 0x345c1048u,
+        0x17abd4f1u, 0xc91793aeu, 0x9d6f30a3u, 0x3f04f84au, 0x1d9092e6u, 0xe455386fu, 0xbea1b12fu, 0xa4e31aedu,
+        0x084f2d68u, 0xad7f4522u, 0x9fd53c31u, 0x5f09eba0u, 0x95e9a47bu, 0x4841c2c7u, 0x46f55fd4u, 0x8ad9b3f4u,
+        0x7fb3de3eu, 0xcb79c541u, 0x3eb76a96u, 0x38304261u, 0x7cc04316u, 0xd164a189u, 0xa0735211u, 0x03953d07u,
+        0x0e6f0e0bu, 0x6c02983du, 0x140759f8u, 0x46651310u, 0x71d8c918u, 0xdfe4b416u, 0x5b0f5d58u, 0x0c722de3u,
+        0xc34d3abeu, 0xdef966cfu, 0x28ad3badu, 0xb411719fu, 0x17ac4c2cu, 0xfd0b75a9u, 0x6c1315dbu, 0xb838dbb1u,
+        0xaf8c1036u, 0x0f327c76u, 0x54b2cc63u, 0x1de4e449u, 0x539c0948u, 0xffb4c188u, 0x98d7e462u, 0x7139fc31u,
+        0xe9b4449du, 0xf2bcdd75u, 0xe44e15d2u, 0x2226af45u, 0x6e7e42afu, 0x9d4794adu, 0x035e332au, 0x8ebebf24u,
+        0x0552e300u, 0xe4e40101u, 0xa4cecbe4u, 0x9597e764u, 0x9fe9e40cu, 0x7be4f4bau, 0xd7c18d76u, 0xdd985f0bu,
+        0xe3a27097u, 0xd1bcb57fu, 0x9046b1c0u, 0xd8dcc38eu, 0x6d9b906du, 0x72667f7fu, 0xf4222b97u, 0xe04766adu,
+        0xc6481a66u, 0xb27e2e36u, 0x8d611930u, 0x0dd0ca4fu, 0x0123815bu, 0x5b717685u, 0xaeeefce6u, 0xf5dc2967u,
+        0xe76427b3u, 0x8d017babu, 0x8f1f4653u, 0x7c78a59bu, 0xdef5c8beu, 0x0fe27d93u, 0x2ecc0801u, 0x2d28a2d6u,
+        0xe52c0dddu, 0x2cf4db9fu, 0x1229f76bu, 0xa5bca5c0u, 0xd10bea76u, 0x1797c5c8u, 0xc71b68c6u, 0x8c04ff9fu,
+        0x340c9187u, 0x28443db7u, 0xcc029a28u, 0xa2514436u, 0x73b3dbafu, 0xee38894au, 0xc20c6f94u, 0x5a3ee872u,
+        0xe2a694b0u, 0xdbc6fe49u, 0xb79edd91u, 0x66685206u, 0x1ffce791u, 0x0474cd01u, 0x7750a557u, 0xbc6eb947u,
+        0xf15767a5u, 0xb26669d9u, 0x3f1f03d3u, 0x2a7df119u, 0xd6b5c657u, 0xa25a25a8u, 0xf26b6e3eu, 0xf46d819fu,
+        0x58b399bau, 0x60f66b2bu, 0xad85a677u, 0xac5c88bau, 0xbcc5455eu, 0x17d0099du, 0xdf8e68c4u, 0x8821da1cu,
+        0x03804f87u, 0xe945e9fdu, 0x6be04d73u, 0x0946cb39u, 0xf7dae00du, 0xf7f4ed1bu, 0x6b988a94u, 0x697efdbfu,
+        0xd8d4eecau, 0x15a4591eu, 0x7300b518u, 0xa003066cu, 0x81874f71u, 0xcbacfb4eu, 0x37d12d0au, 0xd1d8fac8u,
+        0x08f339ffu, 0x059b0183u, 0x6263603au, 0x1d9e2d69u, 0xafdde275u, 0x4d308ca2u, 0x6468d437u, 0x33e087f2u,
+        0x4e292b1bu, 0xf80d80a8u, 0xea1196d0u, 0x19244298u, 0x52204b8fu, 0xb2b00e85u, 0x06ee6a86u, 0x7d5e99bau,
+        0x1a7e66a7u, 0x54420596u, 0x3a8fdefcu, 0xe19d6916u, 0x527501d1u, 0x13346130u, 0x3c9fd3b2u, 0x8ec4b390u,
+        0x1488d3d5u, 0x5f41f6ecu, 0xf3b897d3u, 0xd0e282a0u, 0xf73c9e33u, 0x53600a90u, 0xf7463f9au, 0x1bd5b5a0u,
+        0x50387002u, 0x18eaf44au, 0x7102db14u, 0x310e3fb1u, 0xe1803392u, 0x9ba97da3u, 0x9e1b4547u, 0xdf9f5f34u,
+        0xbe53a639u, 0x0e9fd8e9u, 0x0f449b76u, 0x24f2cd23u, 0xc9e40633u, 0xba66341cu, 0x9b988e40u, 0xf6cd33dbu,
+        0x9067bee7u, 0x7a1a004cu, 0x9c27b57fu, 0xdebcf401u, 0x2b025fcau, 0xfc4b6f0du, 0xc9b57aadu, 0xa2a0adabu,
+        0xe4998096u, 0x5a826343u, 0x8dca09c0u, 0xd0626fdbu, 0x709f011au, 0x16be4248u, 0xa10d0a59u, 0xec46a8dbu,
+        0xe28a4526u, 0xca5d4fc3u, 0x4206c607u, 0x9a4e9ca6u, 0x426c352bu, 0x6b514881u, 0xb431d9eau, 0x6ee69692u,
+        0x288eb796u, 0x8f9265dfu, 0x057b9849u, 0x538698feu, 0x4a23d649u, 0x5c608dcau, 0x430412f1u, 0xfc6523b6u,
+        0x89fd4840u, 0x4dc42fddu, 0xe8105d4au, 0x1ac1252cu, 0xedb265deu, 0x93b023c8u, 0x8f6ddd6fu, 0x0e2fa425u,
+        0x8bf1ade3u, 0xff0c7f1cu, 0xb49d2f4du, 0xa897231au, 0x31dfdac6u, 0xa8373440u, 0xae25eb49u, 0xc5af24dbu,
+        0x55160bf9u, 0x2a1f9bf7u, 0xba966623u, 0x8136bfdeu, 0x8a40a575u, 0x9d56ab5du, 0x3dfdd096u, 0x8fff8d78u,
+        0x077b6b6fu, 0x23e71af1u, 0x8ec79d93u, 0x5d855d43u, 0xc8a012ceu, 0x9396839au, 0x9b0fef72u, 0xde17e2a3u,
+        0xec57639au, 0xfb8adca5u, 0xe690ac5du, 0x5f6d75f7u, 0xc30231ecu, 0x2139676bu, 0x7314bd7du, 0x2aa52fc7u,
+        0x5fd60460u, 0x51cbd77au, 0x0b530f31u, 0x2633d187u, 0x8d1f63aeu, 0x90cd3686u, 0x61b9b1f7u, 0xed20ddeau,
+        0xf5f8ed8cu, 0x219887e8u, 0x62696206u, 0x0848fda7u, 0x79c26edfu, 0xf0b71328u, 0x1a1a95c3u, 0xd6e93427u,
+        0x854d912eu, 0xcf64ca67u, 0xa3958df5u, 0x0d72d765u, 0x6625623fu, 0xc01bf06fu, 0xe9ce01ddu, 0x2545f31au,
+        0x611081bau, 0x60d190e2u, 0x162d6088u, 0x17a55fedu, 0xe8a1c9e2u, 0x3f73ed89u, 0x80f97272u, 0x438c357cu,
+        0x29349c3cu, 0x42a9069eu, 0x4a2b9b8du, 0xfdcba9a1u, 0x76fbd7bdu, 0x4cf31203u, 0xc7094202u, 0xc2540012u,
+        0xf0a8f12au, 0x9b1ab360u, 0x2bcbb78cu, 0xb6ca1b40u, 0x6f8d0898u, 0x5c0ba197u, 0x8e292befu, 0x52ed67a9u,
+        0xbf428794u, 0xa372b097u, 0x8209715fu, 0x8e65f480u, 0x710417a2u, 0x0b014c69u, 0xf14898b6u, 0x798ec7afu,
+        0x6b3760d7u, 0x00b4b21fu, 0xc5157277u, 0x5be22e05u, 0x36b1a7b0u, 0x7f3db512u, 0x272f3c78u, 0x134b2840u,
+        0x95814009u, 0xabec6d41u, 0xd8fa8d14u, 0xb5eea38du, 0xc552d75du, 0x38713f3du, 0x0ae87704u, 0xffc63dafu,
+        0xe31a4c67u, 0x8927d368u, 0x448e0566u, 0x367e2fdfu, 0x360671a4u, 0x53542494u, 0x0d588a39u, 0xa9d2d4a0u,
+        0xd61d7b8fu, 0xc5ed82b7u, 0x25b76b99u, 0xd451b692u, 0x219b4c0fu, 0xc81d2594u, 0x448263c1u, 0xa45a8accu,
+        0x410315e5u, 0xd415e251u, 0xa5b771ceu, 0xf31b368au, 0x793b8401u, 0xf850b757u, 0x46e22db3u, 0x284296c8u,
+        0x84924e95u, 0x6b169f79u, 0x2638637bu, 0x266ce540u, 0x27a4b1a3u, 0x8d030d20u, 0xe428fabau, 0x619a3d56u,
+        0x89a1a20fu, 0x40afe9e6u, 0x4b8d53a9u, 0xa8f83440u, 0xd52b41d9u, 0x47356647u, 0xc163579au, 0xd0fecb08u,
+        0x491f268fu, 0x3a62eb9bu, 0xf0688ba5u, 0x9f56b77eu, 0xdb02a800u, 0xff6a35c6u, 0x84d8ccfbu, 0x59e703efu,
+        0x319e7971u, 0x7241cc80u, 0x3f4416e0u, 0x2a347234u, 0x24569998u, 0x4edfd9e5u, 0x21668eeau, 0xca815bd8u,
+        0x2210271au, 0x93668d7fu, 0x791bbf57u, 0xd60a04b7u, 0x5566ecceu, 0x3ec2e491u, 0xe793712bu, 0xab46f863u,
+        0xdbc57ae1u, 0x9bf2e4cbu, 0x21c6ba3fu, 0xb992a769u, 0xd04d3491u, 0xc6162b81u, 0x7cc68d71u, 0x0beec3cbu,
+        0x87827464u, 0xdb82e967u, 0x9dbab0ffu, 0x8bc9351au, 0x320dfe65u, 0x04b597e1u, 0xa1da6601u, 0xf7dd92aau,
+        0xa46159bdu, 0xebe77e4au, 0x3c8f9431u, 0x9e13c4e2u, 0xb6a98fa6u, 0xdcb28747u, 0xcc164a46u, 0x9ca99463u,
+        0x7f09bfd2u, 0x5261ef78u, 0xd6fa2792u, 0x52bcf092u, 0x0969e590u, 0x1bed6f48u, 0xcc7a7db9u, 0x84ea0b20u,
+        0x008fa3bau, 0x7573e100u, 0xe3c4fa73u, 0xd89c1fc7u, 0x067cfa0eu, 0xd3e1accbu, 0xbfa0b713u, 0xb8a37e91u,
+        0xbe8f75e0u, 0x168435c2u, 0xabbd0cf5u, 0x59286f74u, 0x35f233bcu, 0x7831eaceu, 0x399d1c6cu, 0xcdcca9d1u,
+        0x06931497u, 0xd418a356u, 0x1afcea77u, 0x2097f004u, 0x723e4ae8u, 0xbf9ab3b0u, 0xef698436u, 0x7a8b35aau,
+        0x8b423418u, 0x77b45938u, 0x5e73eb0bu, 0xe5c56e0bu, 0x368cd2dfu, 0x125046cau, 0xc02d2f14u, 0xa9e47275u,
+        0x5f5b9342u, 0xf44424dbu, 0x8d083b10u, 0xa7d62e3au, 0xb2128fa6u, 0x7e00f32cu, 0xe4adf68du, 0x590361b5u,
+        0x7019bf4eu, 0x1670c1a9u, 0x194b6a9bu, 0x352af8cfu, 0xfe841488u, 0x9c426724u, 0x11de9c70u, 0x2a4e69a2u,
+        0x736e6c09u, 0x53d24c3bu, 0xf77a807cu, 0x0b887b2bu, 0x949f73ecu, 0x93b15a56u, 0x2ef98a7du, 0xd2608dd8u,
+        0xc0e654eeu, 0x237ebd8du, 0x37cc611eu, 0xe58f51e3u, 0xdf8cfb39u, 0xed4ba15eu, 0xef3c34d7u, 0x3af4c37bu,
+        0xa7a922c7u, 0x28ff414du, 0xa98e0effu, 0xa83692a4u, 0x0bd87d5fu, 0x0e72f87eu, 0xc1e9e861u, 0x4ffe65b3u,
+        0x78dbb58fu, 0xf4b19fc3u, 0xe8176c77u, 0x9e0c03deu, 0xbfd9efddu, 0xef1d3c56u, 0x2e0d70e7u, 0x2aff8cedu,
+        0x97013554u, 0x553d5e03u, 0x3173cc91u, 0x0bbd7f40u, 0x207f6066u, 0x1fed9893u, 0x94f1a03fu, 0x8f6c85fcu,
+        0xabd48b7eu, 0x4a2fe0e3u, 0xfd24fd58u, 0x933be4dcu, 0xfcac3182u, 0x97125882u, 0x5dbf3274u, 0x00000001u,
+    },
+    { /* 2^158 */
+        0x20b257dfu, 0xa6a4ce5au, 0xe59bcf13u, 0x2c92d08fu, 0x2d7a6ba6u, 0x9ba5a31au, 0x96ac5e94u, 0x7875b40cu,
+        0x4f46a79fu, 0x4363e1d9u, 0x4ba72590u, 0x9e58ad3fu, 0xd327ed8bu, 0xc17c1719u, 0x47b4e7ecu, 0xda7d66e0u,
+        0xcaa3eae4u, 0xe08809aau, 0xf327bdfeu, 0x7db13947u, 0xce543009u, 0xd8a90d83u, 0x9a9f4650u, 0xa66a75a8u,
+        0x482820deu, 0xdbcd33dfu, 0xa8527055u, 0x929256d2u, 0x18957e19u, 0x9e7596c8u, 0x45b8a94au, 0x566b3f41u,
+        0xe46b5af9u, 0x94f0a8a3u, 0x6d962260u, 0x35693677u, 0xddc9d6cfu, 0xab7beef1u, 0x00688ef3u, 0x021529acu,
+        0xe7ddb792u, 0x088db8d8u, 0xf6acef6bu, 0x6dc60e91u, 0x2052576eu, 0xd83e67d7u, 0xc4eb0c80u, 0xd793e841u,
+        0xe990f62bu, 0xe5c74cc7u, 0xcb5cb08du, 0x12b15bdfu, 0xd18690d7u, 0xacbe2da4u, 0x0f3076b4u, 0x4b720573u,
+        0x4415636eu, 0x0e9694a8u, 0x5949c64du, 0x626d94d0u, 0x4bffaa19u, 0x2b20db69u, 0xf5149c46u, 0xbd08feddu,
+        0xbe2d7fb4u, 0x957404e0u, 0x93d82a0du, 0x6f7af674u, 0x4488b74fu, 0x123011d0u, 0xdc6b3252u, 0xce05f2e4u,
+        0x4b282915u, 0xcb3dd773u, 0x27d9c397u, 0x80e11f16u, 0x9450f2d7u, 0x3544e3efu, 0x9d9b4010u, 0xa6ac8180u,
+        0xffde7f10u, 0xd189e84du, 0x1cfa1fcau, 0x8fbba86fu, 0x9a2769f9u, 0x3875154au, 0xfa4e36c7u, 0x8a7c72f6u,
+        0xfe4484f2u, 0x55190168u, 0x3c769d7du, 0x9e872476u, 0x74177316u, 0x565e0270u, 0x06a828a3u, 0x16ec27d2u,
+        0x1a4f09d2u, 0x21cecaf8u, 0x500e01f2u, 0xdf17e962u, 0x8c72bcd9u, 0x01337690u, 0xea26d086u, 0x3c9fc171u,
+        0xbaceaaa4u, 0xb805fffdu, 0x3d4a7744u, 0xb922f4f4u, 0x2f5cb9bfu, 0xe0b758cau, 0x1e4ceb86u, 0x707cbc94u,
+        0x047541bau, 0xd1708babu, 0x89b32140u, 0xde63be97u, 0xb5d17ceau, 0x05e4ab30u, 0x5f77d852u, 0x86d983f3u,
+        0x72d817ebu, 0x35c4420au, 0xfe9c4576u, 0x648da587u, 0xd8d198e7u, 0xd0cf63bau, 0x0afe302eu, 0xfd6bcdb7u,
+        0xea2d0bd8u, 0xf5bdbb22u, 0x7f01f253u, 0x7d8be486u, 0x8e4ad15eu, 0xa48a23a6u, 0x431bb7e9u, 0xb2f0e0b0u,
+        0x88c005dfu, 0x4f52638eu, 0xe5fe731du, 0xd33522d2u, 0x0a070a0eu, 0x1246687eu, 0xcf599031u, 0x526d3aa6u,
+        0x632ade6eu, 0x0e9afff7u, 0x957c15d5u, 0x71340011u, 0xb81de64eu, 0x1a453610u, 0xea6c1ebeu, 0x5dab9753u,
+        0x8f597222u, 0xa95538d8u, 0x2789ba45u, 0xbbdc7e4au, 0xd2eb23d0u, 0x835c3a4eu, 0x7a2fd926u, 0x90806b97u,
+        0x140c2664u, 0xdb678339u, 0x5e8b1dafu, 0xec0350c2u, 0xf8dff14du, 0x1c590e15u, 0x2b38487eu, 0x8fdfc7e0u,
+        0xa78a6ae4u, 0x5bd848a8u, 0x14688ddbu, 0xf8d50da5u, 0x9bd802b7u, 0xf55d2862u, 0x6ebeaf5fu, 0xc64a354au,
+        0x729d820du, 0xd4f5830du, 0x82cf32d3u, 0xe2c69d2eu, 0xb14aa7b5u, 0x03d1ba90u, 0xeea95ddcu, 0x5acb242cu,
+        0x9e10aed0u, 0x80cb80bbu, 0xb00039fdu, 0xb187ae53u, 0xea0710b9u, 0x3ed12dd7u, 0x29ae266cu, 0x423e78c5u,
+        0xe6c6bf00u, 0x9bd4265bu, 0x07d9beddu, 0xe5507a40u, 0x15c4ece4u, 0x383e84ccu, 0x3c0b0f26u, 0x600fb6f0u,
+        0x3b6b77dbu, 0xdf9797aeu, 0x6d20f29au, 0xacd79c3cu, 0xc0d4246eu, 0x64dae651u, 0x46976ecdu, 0xa03bf540u,
+        0x8176694cu, 0x5fef049du, 0x39c71a1bu, 0xa0e9c008u, 0x29468cfeu, 0x363fca7fu, 0x81ce69e3u, 0x7c860835u,
+        0x2cf0ccc1u, 0x34d3651bu, 0xe2afb28bu, 0xce1897b4u, 0xc0a9a67cu, 0xb36d3611u, 0xc93d3f71u, 0xf3977503u,
+        0xe58e18e6u, 0xef31368cu, 0x10f4b220u, 0x8fa6994cu, 0x5366b157u, 0x861e5619u, 0x830dc6cfu, 0x95dd830bu,
+        0x8b56bddbu, 0x1c90d1a0u, 0xd7defe14u, 0xeeebfb68u, 0xb0a46e1bu, 0xa85e87a3u, 0x4fe76be3u, 0xe9aa356bu,
+        0x8f87d6e7u, 0xdf0029acu, 0x6918d98du, 0x9a7129a3u, 0x820e8293u, 0xb9c71841u, 0x0bc78124u, 0x48f3e7aeu,
+        0xd33e77d2u, 0xab0d7d62u, 0xa7c4bf89u, 0xb8a1918du, 0x28e6c763u, 0x875fb336u, 0xf493d9b4u, 0x61ddbe38u,
+        0xd899f798u, 0xcb4b493du, 0x0af14698u, 0xd1b5184cu, 0x91c6e0c5u, 0x16d4a4e7u, 0xca03e27cu, 0x6f216d26u,
+        0x9d68acb0u, 0xed05dec6u, 0x17006fcau, 0x9140cd51u, 0x5c617fabu, 0x2771fc8eu, 0x19731d4au, 0xa2e63d85u,
+        0xcca2131fu, 0xfaba996eu, 0xf8adb05fu, 0xdb292b14u, 0x11ef022fu, 0x2ba5de2eu, 0x48b1feffu, 0xf2cc1b4cu,
+        0x35c30f3fu, 0xc4d94368u, 0xc8a6ce1fu, 0x459a40b9u, 0xa80a7d9du, 0x4a004267u, 0x772736c2u, 0x252a69a6u,
+        0xbe1e40a5u, 0x79e4c2e6u, 0xda13db39u, 0x5d28daf7u, 0xa8f784aau, 0x3cccf99eu, 0x32db4ab7u, 0x33bbd060u,
+        0x27b7e769u, 0x699d60aau, 0x80950e22u, 0x1bfa5207u, 0x2655b20cu, 0x2c0575afu, 0x40288c98u, 0x3be7366du,
+        0x5285d61du, 0x9509c49du, 0x851ad45cu, 0x0fa8b12au, 0xc26c97beu, 0x506dec55u, 0xf782f725u, 0x264148b5u,
+        0xd94fd279u, 0xe8247b59u, 0x79902f72u, 0x7b697116u, 0xf7c52e7du, 0x9a9dc6f5u, 0x48253612u, 0x340ad374u,
+        0xdaa16fe2u, 0xece4f668u, 0x13d78d80u, 0x54102a94u, 0x0ab4d968u, 0xe6b303d8u, 0x71e8acc6u, 0xc056498fu,
+        0x3f3e6f2fu, 0x47a01510u, 0x9a0627ceu, 0xc392700cu, 0xd579c9deu, 0x14796e9cu, 0xff386b40u, 0xee744722u,
+        0x86f17c76u, 0x6f8661bbu, 0x814bb615u, 0x82b5c01du, 0xe46dd5bfu, 0x542663d7u, 0x30360386u, 0xba50580fu,
+        0x812fa285u, 0x6ea58cffu, 0x83804b0eu, 0x652a7e9du, 0xc371a3beu, 0xc7e28983u, 0x7867bc28u, 0x1da71d53u,
+        0xb58b3d8fu, 0x20adcfc8u, 0x2ce6c31au, 0x410c8159u, 0x21001c8fu, 0x245b6277u, 0x6b8c09cfu, 0xfb4caf98u,
+        0x5882da01u, 0x07013065u, 0x3a7a9f83u, 0xb3ecb052u, 0x4180e652u, 0x8233d584u, 0x7bb15c0du, 0x4aa531f1u,
+        0xa48aebdfu, 0xdca87e57u, 0x5de10894u, 0x1120f841u, 0x3c5f575au, 0xa376d10fu, 0xb3c36829u, 0xcf03cbcdu,
+        0x9d259bcdu, 0xbebf66e6u, 0x72b652cdu, 0xaa5d99a6u, 0x5439b522u, 0x7df246d6u, 0x014a0bd7u, 0xdf9c8e58u,
+        0x67f12538u, 0x40ddb332u, 0x021f5cb5u, 0x6ad81bb7u, 0x45d28797u, 0x037464eau, 0xf1c8c1f2u, 0x54784e0bu,
+        0xf52e6c0au, 0xcfc938abu, 0x9c72b3cdu, 0x012a052cu, 0x2397b2ebu, 0x9d1bbfc9u, 0x54a30aefu, 0x73b825b9u,
+        0xff2185e7u, 0x47af0b8au, 0xf9ea2d48u, 0x7aa4b0feu, 0x2fe27e34u, 0x082f2a51u, 0x7d1b3c25u, 0x1e18a379u,
+        0x948b8ad7u, 0x757595a2u, 0x9c32eff5u, 0x1b546671u, 0x1ef62811u, 0x5f309c07u, 0xbd3d9415u, 0x6a8c89e7u,
+        0xce22576bu, 0x3ff135f0u, 0x1d2d618du, 0x3c8ee6a0u, 0x9d557939u, 0x43292a6cu, 0x4decb518u, 0xb2fd95ddu,
+        0x3dc2411eu, 0x91237615u, 0x8f467846u, 0x3699d05au, 0x713b7b0au, 0x1968af2bu, 0x3d6b4ac4u, 0x98ee8ed1u,
+        0xc3795c92u, 0x138c3b0eu, 0x8278eab9u, 0x85805a4bu, 0x6ad296a1u, 0x40206d83u, 0x6aadb66au, 0x5bc10146u,
+        0x03fa2b39u, 0x04e4b223u, 0x56e62eb9u, 0x9895c48au, 0x65e9d9fcu, 0xf2960789u, 0xa6936514u, 0xb9c9550eu,
+        0x65d9e53fu, 0x50d3a1b4u, 0x73002e0au, 0x12d8ccd7u, 0x88f12f98u, 0x8fc771bau, 0x6ceeec49u, 0x76733973u,
+        0xc88f4bf1u, 0xd3f6f87cu, 0x3d7f839fu, 0x4d53e1d8u, 0xd4afb23eu, 0x3a27d6a9u, 0x0d26f568u, 0x3f81affdu,
+        0x09f721cbu, 0xd70d68acu, 0x6fca080cu, 0xf326ef64u, 0xcd4df4e3u, 0xac3f4effu, 0xa1f3dbbeu, 0x18bc021bu,
+        0x07899de0u, 0x582e4641u, 0x31dc4671u, 0x41dcb155u, 0xdf426ad6u, 0x85435ecbu, 0xb1d63719u, 0xb331f36au,
+        0xb62088b9u, 0x740ca30bu, 0x205b6987u, 0x5866fbdbu, 0x49d88ed5u, 0xc2d14332u, 0xf2a3cd7du, 0x3f64bcefu,
+        0x4f7919fcu, 0x0ea1e5f6u, 0x7fd00b42u, 0xe3234f9bu, 0x45e64f8cu, 0x032429fdu, 0xa8c06ec5u, 0xaa561686u,
+        0xafc00109u, 0xcdab3fc4u, 0x831e386fu, 0xca7af36bu, 0x6606a0e7u, 0xc4b4e16du, 0xd55674a2u, 0x6b2cfd63u,
+        0x8ccd6f58u, 0x94dbd5acu, 0xb68b754cu, 0x890b7bc1u, 0x83c64bc4u, 0xa6ae899bu, 0xbb46a667u, 0xbd9b8e32u,
+        0x94c13c8du, 0xba46d0e3u, 0x4cdb1c56u, 0x968fea1cu, 0x5f4bf149u, 0x6179c79au, 0x989f380eu, 0x4196da8au,
+        0x7fd1697du, 0x5be03593u, 0xcd164310u, 0x5b1a2f4eu, 0x7ab0517cu, 0xeea14667u, 0xce4cf922u, 0xec98711bu,
+        0x82594ee3u, 0xab534c80u, 0xd9d11fb1u, 0xa4aa9471u, 0x549f069du, 0x9c8809fdu, 0x08481b81u, 0xd61fbb67u,
+        0xd328b0f5u, 0x98cccf1eu, 0x5840f5b6u, 0x1f1735e5u, 0x2f5b0c84u, 0x5ccc7194u, 0xe44d9230u, 0xf04df7f8u,
+        0xaf3f4910u, 0x8787eb1bu, 0xe69b20beu, 0xfe41e7f9u, 0x5ddc424fu, 0x1093bd23u, 0x139a572bu, 0xc9d44191u,
+        0x8cacfaf6u, 0x45463838u, 0xa54b338cu, 0x36a0da88u, 0x6b9b2c3bu, 0xa184409eu, 0xdfd3d1aeu, 0x84f885b2u,
+        0x269d3cd8u, 0x53d9b1a9u, 0xbb66f29au, 0x832c2ee9u, 0xfe89da23u, 0x678de069u, 0x715a7b48u, 0x7f26ad27u,
+        0x314cbcceu, 0xa704bd64u, 0xbc9c69c9u, 0xe1765575u, 0x5ef03a04u, 0x27c56c8eu, 0x00de0d89u, 0xa2929dbcu,
+        0xda863bb3u, 0x751e13dfu, 0xe45084b1u, 0xf54eaa6bu, 0x4174b3a1u, 0x00ca5a8bu, 0x049ce645u, 0x60079a55u,
+        0xc7ddccf1u, 0x8cf748c2u, 0xf9db0c3fu, 0x602f9665u, 0x45abad1fu, 0x8de10a76u, 0xb61211b9u, 0x093712deu,
+        0x996a7d6eu, 0xcc01584du, 0x4bddfec9u, 0x36f008d0u, 0x7ecaaccfu, 0xe84a1704u, 0x0e146840u, 0xb25a50e8u,
+        0x94d098b9u, 0x98a68481u, 0x36b294c6u, 0x7b8bff6au, 0x5d81e8c8u, 0x72f85c59u, 0x2065dd3eu, 0x49e9ef7au,
+        0x3a2cc6c4u, 0x671353f5u, 0x4c5b86f1u, 0x669ec268u, 0xc4ad85bcu, 0x832a292fu, 0x26be6208u, 0xb48ee08au,
+        0xcf528068u, 0xb85403b5u, 0x8b781f31u, 0x0b276ca3u, 0xf13b140au, 0xc0e0b196u, 0x2902cf92u, 0x00000001u,
+    },
+    { /* 2^159 */
+        0xfdf6a420u, 0x6cc08cd1u, 0x099bb3c5u, 0xb05a0d12u, 0xa63faad6u, 0xa6fa890au, 0xb37efe15u, 0xbc8b2639u,
+        0x5708228du, 0x9d97b7fbu, 0xaead5ae9u, 0x19df5e2bu, 0x86c3cf4au, 0xe39987e1u, 0x2f7c509fu, 0x307589acu,
+        0x25a21585u, 0x886a0a7au, 0x05cd3678u, 0x28b780dbu, 0x1ebf598eu, 0x58de329fu, 0x575b706bu, 0x7da5e46cu,
+        0x5a7fcbe6u, 0xc19d17c2u, 0x2477f80au, 0x42804122u, 0xab466c09u, 0xaa28057au, 0x3e7a7140u, 0x4649b3cau,
+        0x82d7f263u, 0x2be0b155u, 0x0aa677f1u, 0x9086d8a5u, 0x14b26bceu, 0xd82a36f9u, 0x55310e6cu, 0x4a828909u,
+        0x4a33264bu, 0x44da215fu, 0x6867a47bu, 0x02001b35u, 0x83789397u, 0x2cfaf48eu, 0xc1462394u, 0xed9ed8a5u,
+        0xfc5eee51u, 0xc806763bu, 0x3e8e11b3u, 0xcb33815eu, 0x44a807f9u, 0x31bb6af6u, 0x0a2c7549u, 0x21871855u,
+        0x330e7ec8u, 0x2ddbadc9u, 0xc3623ae9u, 0x6cdc65d0u, 0x1b75d032u, 0xa87329b4u, 0x8b9b6ca4u, 0xdf78c140u,
+        0xd25853b6u, 0x542c286au, 0x7fe49890u, 0x2572de33u, 0x63433210u, 0xcc44798au, 0x22d2cf15u, 0xf4fa26cfu,
+        0x7b3b36b2u, 0x5ce6263du, 0xd206dcb9u, 0x4bb49efbu, 0x082ef05au, 0xa81ed848u, 0x9252395au, 0x3cfc93c9u,
+        0x51582aa3u, 0x122dee95u, 0x4883696fu, 0xe8ef4fb9u, 0x8f8f7fb5u, 0x9c2973edu, 0x08e6ee4bu, 0xbb3b9c77u,
+        0x4a615416u, 0xd47d1538u, 0x3be82721u, 0x06a89b03u, 0x21add28eu, 0xab7a7c17u, 0x1e3212bau, 0x9d65ff60u,
+        0x7ce17cceu, 0xe1f4d1bau, 0xd90ce271u, 0x4f2a7fe6u, 0x9d12123eu, 0x80974d2eu, 0xb271a51au, 0xce636c30u,
+        0x7b2ed595u, 0x0d175056u, 0x4c58625cu, 0xfc9e3dbeu, 0xe45153dbu, 0xd1cfdcc3u, 0x1d5b9821u, 0x2dc2404fu,
+        0xf1e791cdu, 0xe2a7803du, 0xe0bb8eb9u, 0xb9b76f8au, 0xd44cf26au, 0x09f412d6u, 0x2d92debcu, 0x3f55b7d0u,
+        0x36b6aef2u, 0x451f49e5u, 0x8cdeafdau, 0xaa6ff8efu, 0x43b27999u, 0xb4ff30bbu, 0xbd99b152u, 0xa74b7868u,
+        0xb2f7d999u, 0x27fd1885u, 0x84a91778u, 0x638b830du, 0x7c60f892u, 0x48aaae3fu, 0x50bb1a43u, 0x1f70f1bbu,
+        0x6b25e78cu, 0x3e24b113u, 0x2c060281u, 0xe25fd29au, 0x55a6cd2du, 0xc5a318b7u, 0x976907ccu, 0x8f7905ecu,
+        0xb74f01bdu, 0xe4972b07u, 0x2658ff9bu, 0x5ec1fc71u, 0x71b61812u, 0x8e3cc76fu, 0xe137ad20u, 0x16bea957u,
+        0x3db1cd22u, 0x7fa9060du, 0xd0dba3eau, 0x31a3bdffu, 0xa96cfdb4u, 0xeacf6debu, 0xc989de16u, 0x2f9bd165u,
+        0x2fed215du, 0xddeb93beu, 0x067fd1efu, 0xf1702c2du, 0xe29fed1au, 0x0aafd4e2u, 0x4921e8c5u, 0x4e4c3b50u,
+        0x4f45c70bu, 0xc56e2e1au, 0xfd3a237au, 0x105e97fdu, 0xc4680b58u, 0xee1d491cu, 0x4df7becau, 0xd05abe90u,
+        0x358f5034u, 0xed187861u, 0x9fbc63f2u, 0x734f56e0u, 0xc2fdd213u, 0xc77aba52u, 0xc1d497dfu, 0x43308d65u,
+        0xba682e2du, 0x56a74df3u, 0x3d50ab31u, 0xc4dde18au, 0xd7e15183u, 0x4dd172cdu, 0xdacb2d6eu, 0x03f41749u,
+        0xc3db473fu, 0x5b8f5285u, 0x9c7d8c42u, 0x2aa3a26eu, 0x601d941eu, 0x8337512au, 0xd782092du, 0x0965876fu,
+        0x4462fee0u, 0xc455d40au, 0xa08eb640u, 0xa3029fa8u, 0x85f2f845u, 0x46c057f0u, 0xe894f1e1u, 0xd562f44bu,
+        0xbbefd6b8u, 0x6eb3d39au, 0x0922a99du, 0x027f97e0u, 0x5c813e3bu, 0xf69dcb0au, 0x21293682u, 0x14536efcu,
+        0x41410b1du, 0xae0d4453u, 0xe1bc719eu, 0x741b6470u, 0x1ba85fdau, 0xc6845032u, 0x86c62d2au, 0xe8360817u,
+        0x8e2830e3u, 0x81597385u, 0xdffae3b1u, 0x2b673a35u, 0x6e53c4ccu, 0x6c1e58c3u, 0xf4267797u, 0x4950db54u,
+        0x317a5318u, 0xea49107du, 0xc34e0c91u, 0x6169541fu, 0x9be4d56cu, 0xf2d36e28u, 0x5ed33af6u, 0xbd052763u,
+        0xb3678cbeu, 0x34c1b2c2u, 0x8ab8e078u, 0xc99db07au, 0xe14bece1u, 0x2a310752u, 0x8614d74au, 0x39bdda63u,
+        0xebbc8e3fu, 0xd82a8643u, 0xf26eda61u, 0x8a7fd13cu, 0x3eb43807u, 0xca4123d6u, 0x7ceeaca1u, 0x996d0218u,
+        0x2b1631e6u, 0xc8bf4213u, 0xbd144429u, 0x1400eb96u, 0xd65e8dd4u, 0x89b83fc0u, 0xe6eb4d56u, 0xb1aaee35u,
+        0x8a2aae7cu, 0x96d8af62u, 0x56a49ffcu, 0x15b1c52fu, 0x2eb2d80bu, 0x7d3d160eu, 0x3c484f8eu, 0x01ef4426u,
+        0x7d32e8ffu, 0xe38b11f3u, 0xd1f6553eu, 0x6150018du, 0x51837e20u, 0x54ed61d7u, 0xeed9000cu, 0xfc64ad3au,
+        0xbfa2c415u, 0x1aeda235u, 0x45476dc8u, 0xe0625a18u, 0x72476538u, 0xef0deec3u, 0xc0bc6959u, 0xa736ff21u,
+        0x79f6dcbbu, 0x6bcfe551u, 0x6b03ed07u, 0x0f02046du, 0x072947ddu, 0xb2b90867u, 0xe2d99c28u, 0xbce77610u,
+        0xbb392585u, 0xb0b74c53u, 0xa222e6ddu, 0xde92f46eu, 0xeac90226u, 0x8b32e66au, 0xb0b1ad84u, 0x0c3212a3u,
+        0xa204411au, 0x59e37928u, 0xa65aef12u, 0xfee584c9u, 0x2fa1e07fu, 0x30bb6e69u, 0x53b8b23bu, 0x7e952d63u,
+        0x66d2ceeau, 0x96ab9fecu, 0x4089b393u, 0x4e314893u, 0x9060fe23u, 0xd3089c27u, 0x58e8a451u, 0xcd7d70bdu,
+        0x7928c569u, 0x510e7073u, 0x6e4fcc0eu, 0x35ba9ea9u, 0xfd89d470u, 0x6e62a261u, 0xcb01584cu, 0xa7a498dcu,
+        0xe558c90bu, 0xca0f6729u, 0x3d34a481u, 0xf1ff1dc2u, 0x23d16662u, 0x712f539fu, 0x4286ef20u, 0x91dfa10au,
+        0x03d158a3u, 0x6bbe7564u, 0xcf8b9059u, 0xdb73ba33u, 0xa13dc27cu, 0x1f56cba6u, 0xc0743055u, 0x34968e17u,
+        0x5a72924au, 0x4f6253edu, 0x2b119135u, 0x1baf0883u, 0xa146db85u, 0xbb81bfe5u, 0xc63eb962u, 0xd16c9e93u,
+        0x3eee4affu, 0x852a4cd2u, 0xdba7e78au, 0x23d7dff3u, 0x5589b098u, 0x2c2e479fu, 0xe390c6c6u, 0xfc45657fu,
+        0xa1e0ae80u, 0x356fedb6u, 0x2a95b751u, 0xb27c68c7u, 0x0f096ccbu, 0x49d1b612u, 0xa032461bu, 0x21dc2159u,
+        0xec46de56u, 0x760751c5u, 0x5387e167u, 0x03aa9dbfu, 0x555d3abcu, 0x942473e2u, 0x0c146a8au, 0x902d25b3u,
+        0x628367edu, 0x549f82aeu, 0xbc8971e2u, 0x73424badu, 0x757d29c8u, 0x882c666fu, 0xba983c1bu, 0xfa8bbe6cu,
+        0x51708731u, 0xbec8c915u, 0x1a4001fbu, 0xb968e1a7u, 0x7f71d3cdu, 0x1ecca3d4u, 0x2f7b8b86u, 0xbf79d8ddu,
+        0xc0e9eaa3u, 0xc152b866u, 0xe7ed29a3u, 0xe48ddfa4u, 0x88657a61u, 0x92766e09u, 0xbfa8ac0au, 0xb53def49u,
+        0x13d00973u, 0x426524a6u, 0x0fd84dd0u, 0x14479869u, 0xaddb345au, 0x8553d680u, 0xf5496dd7u, 0xc0972a70u,
+        0x8027ee1au, 0x64050fbcu, 0xc69be544u, 0xe8a120abu, 0x99b421ecu, 0x1ef58ecau, 0x7cbc0783u, 0xa3bfbec9u,
+        0x8cfdd8fdu, 0xf6528ecdu, 0x4d90ecc7u, 0x9c9cba16u, 0xc1d92d31u, 0xda254296u, 0xc4e66059u, 0xe2dc2f0bu,
+        0xc165077au, 0x6fec13b8u, 0x83cc5689u, 0x1da83700u, 0x3a2221b5u, 0x3b363c81u, 0xef558eb5u, 0x6ada253cu,
+        0x3f7c201cu, 0xa412c2e7u, 0xc0f7715du, 0x48a7b092u, 0x1b2a9434u, 0x2d3f6a52u, 0x83a8c6cfu, 0x2e8e7284u,
+        0x0b8de4b4u, 0xab9747a6u, 0xe788c7d4u, 0x38064742u, 0x78535e54u, 0xe670d284u, 0x99275ed7u, 0xca1978d0u,
+        0xf50b5bacu, 0xeb4b2a8bu, 0xd031f705u, 0xc3d8744du, 0x4fe57ccfu, 0x00e08d50u, 0x4387676au, 0x8e732188u,
+        0x52193034u, 0xdd85fbdcu, 0xee4557fdu, 0xca34e246u, 0x9dfcac20u, 0xfc2ee0ffu, 0x84c49b81u, 0x001e60d2u,
+        0x98aef6fau, 0x72488bfcu, 0x8dd749dau, 0x32be58c8u, 0x46682d33u, 0x9f68980bu, 0x645b8470u, 0x78059b55u,
+        0x43a66b68u, 0x23b0ad9eu, 0x567d6d56u, 0x9344cbf0u, 0xd73fe838u, 0x401b1b62u, 0x10ad426du, 0x88048521u,
+        0x7ff4e960u, 0x189d0396u, 0xb9cb75c3u, 0xd5393761u, 0x12be0082u, 0xb49578e4u, 0xdd4a7c61u, 0xbf5df514u,
+        0x9ee0538au, 0xf2d5c32eu, 0x7f85c70cu, 0xe613d73au, 0x37a73e02u, 0x95f08f54u, 0x21206c12u, 0x5a760d29u,
+        0xad14fbd1u, 0xb587d82cu, 0xbf688ca5u, 0xc44ac502u, 0x286f3759u, 0xb3167df6u, 0x188601a4u, 0xc68f993fu,
+        0x30ecb56cu, 0xd5193723u, 0x0bb09f02u, 0xe6079bf2u, 0xb2228efbu, 0x59db0620u, 0x393b76c7u, 0x35315753u,
+        0xc5bc298eu, 0xfb431012u, 0xa021ec2fu, 0xa1678804u, 0x4b6c2193u, 0xd684b7bfu, 0x721d6b37u, 0x937039f6u,
+        0xb87edce7u, 0x3d74d184u, 0x8e8040bbu, 0xd67e1e86u, 0xec759f42u, 0xe6ab9be7u, 0x85ded75bu, 0x77b86d8au,
+        0x58ca3181u, 0xef9caaedu, 0x8f245184u, 0x53db4fd6u, 0x51598fa2u, 0x77692e81u, 0x75ea8ee1u, 0x997cfb3fu,
+        0x11b68f7fu, 0x06c7e2c9u, 0x2d7b8b2eu, 0x084cd81au, 0x372b94f0u, 0x5e8efc85u, 0x6f019aecu, 0x93d1f64au,
+        0xa6abdd18u, 0xa3c16813u, 0xa4921d1au, 0xc4d16726u, 0x7ea23cf0u, 0x226f4a9du, 0xecd1297eu, 0x2395ce0eu,
+        0x68dbcb70u, 0x414a8856u, 0x488203c0u, 0x599f3852u, 0x60dd4542u, 0x9f0756b3u, 0x1415cd30u, 0x431db5dau,
+        0xb7481353u, 0x97a1a2c3u, 0x26e2446du, 0xa4d556a1u, 0x86046c0au, 0x3d236db4u, 0xfb5b046fu, 0xa24d3008u,
+        0x58785c82u, 0x3d15f188u, 0x80965e33u, 0x1debc76cu, 0xec0ee5e3u, 0x070525fau, 0xcb7d2fc2u, 0x483b76dau,
+        0xabb61880u, 0x6efdd2ecu, 0x3f7b408du, 0xa1acc95du, 0x669b91dfu, 0xf742675au, 0xe2d9ce3eu, 0x46291778u,
+        0x32e17323u, 0x7d2d548fu, 0x49f54a2fu, 0xa806bc04u, 0x10b59557u, 0x48f8c118u, 0x971cd648u, 0xafcea034u,
+        0x0a675f91u, 0xbff76c37u, 0xd39d9f0cu, 0x650768f2u, 0x1a03fe1bu, 0xc6b7e50du, 0xeed3fd71u, 0x8ea0368eu,
+        0x820e7555u, 0x4e42d462u, 0xce2f3b43u, 0x35d81792u, 0x4110a7dcu, 0x725f98a3u, 0x3baf1c54u, 0x91bd8c7eu,
+        0xd1a3c5a0u, 0xc60229aau, 0x6b7d5e99u, 0xfaa2f4feu, 0xf62b0facu, 0x0b2f028du, 0x8079c638u, 0xd3865b14u,
+        0x82316209u, 0x11d89b41u, 0xd532f28du, 0x6d2dfeafu, 0x36570539u, 0x1f25743au, 0x766efe6eu, 0x00000000u,
+    },
+};
@@ -0,0 +1,148 @@
+/**
+ * @file philox.c
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * Round function and constants as in Random123 (philox4x32, R = 10).
+ */
+
+#include "philox.h"
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+/** Scale of a 32-bit word to [0, 1) */
+#define PHILOX_TO_UNIT (1.0 / 4294967296.0)
+
+/**
+ * @brief Computes one Philox4x32-10 block.
+ *
+ * @param ctr Counter (4 words).
+ * @param key Key (2 words).
+ * @param out Output (4 words).
+ */
+void philox4x32_10(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+{
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for (int r = 0; r < 10; r++) {
+        uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+        uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c0 = n0;
+        c1 = (uint32_t)p1;
+        c2 = n2;
+        c3 = (uint32_t)p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+/**
+ * @brief Keys a state and positions it at the start of substream 0.
+ *
+ * @param st State to initialize.
+ * @param seed Seed (first key word).
+ * @param stream Stream under that seed (second key word).
+ */
+void philox_init(PhiloxState* st, uint32_t seed, uint32_t stream)
+{
+    st->key[0] = seed;
+    st->key[1] = stream;
+    philox_seek(st, 0, 0);
+}
+
+/**
+ * @brief Positions a state at draw @p index of substream @p substream.
+ *
+ * @param st State.
+ * @param substream Substream (a sample or restart number).
+ * @param index Draw within the substream.
+ */
+void philox_seek(PhiloxState* st, uint64_t substream, uint64_t index)
+{
+    uint64_t block = index / 4;
+
+    st->ctr[0] = (uint32_t)block;
+    st->ctr[1] = (uint32_t)(block >> 32);
+    st->ctr[2] = (uint32_t)substream;
+    st->ctr[3] = (uint32_t)(substream >> 32);
+    st->pos = 4;
+    if (index % 4) {
+        philox4x32_10(st->ctr, st->key, st->out);
+        st->pos = (int)(index % 4);
+        if (++st->ctr[0] == 0) st->ctr[1]++;
+    }
+}
+
+/**
+ * @brief Computes the block at the counter and advances the counter.
+ *
+ * @param st State.
+ */
+static void philox_refill(PhiloxState* st)
+{
+    philox4x32_10(st->ctr, st->key, st->out);
+    st->pos = 0;
+    if (++st->ctr[0] == 0) st->ctr[1]++;
+}
+
+/**
+ * @brief Draws a 32-bit unsigned random integer.
+ *
+ * @param st State.
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t philox_next(PhiloxState* st)
+{
+    if (st->pos >= 4) philox_refill(st);
+    return st->out[st->pos++];
+}
+
+/**
+ * @brief Draws a double in [0, 1) from one 32-bit word.
+ *
+ * @param st State.
+ * @return Random double in the range [0,1).
+ */
+double philox_real(PhiloxState* st)
+{
+    return philox_next(st) * PHILOX_TO_UNIT;
+}
+
+/**
+ * @brief Fills an array with uniform random values in [lo, hi).
+ *
+ * Finishes the current block, then writes whole blocks straight to the
+ * output and keeps the last partial one for the next draw.
+ *
+ * @param st State.
+ * @param out Output array.
+ * @param n Number of values.
+ * @param lo Lower bound.
+ * @param hi Upper bound.
+ */
+void philox_fill_real(PhiloxState* st, double* out, size_t n, double lo, double hi)
+{
+    const double width = hi - lo;
+    size_t i = 0;
+
+    while (i < n && st->pos < 4) out[i++] = lo + width * (st->out[st->pos++] * PHILOX_TO_UNIT);
+
+    uint32_t w[4];
+    for (; i + 4 <= n; i += 4) {
+        philox4x32_10(st->ctr, st->key, w);
+        if (++st->ctr[0] == 0) st->ctr[1]++;
+        for (int j = 0; j < 4; j++) out[i + j] = lo + width * (w[j] * PHILOX_TO_UNIT);
+    }
+
+    while (i < n) out[i++] = lo + width * (philox_next(st) * PHILOX_TO_UNIT);
+}
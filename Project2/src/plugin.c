@@ -0,0 +1,168 @@
+/**
+ * @file plugin.c
+ * @brief Loading of objective plugins from shared libraries.
+ *
+ * The only platform-specific part is opening the library and looking
+ * up its entry point: dlopen/dlsym on POSIX systems, LoadLibrary /
+ * GetProcAddress on Windows.
+ */
+
+#include "plugin.h"
+#include <stddef.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+/** Message for failures detected by plugin_load() itself. */
+static const char* plugin_msg = "no error";
+
+/**
+ * @brief Opens a shared library.
+ *
+ * @param path Path of the library.
+ * @return Library handle, or NULL on failure.
+ */
+static void* lib_open(const char* path)
+{
+#if defined(_WIN32)
+    return (void*)LoadLibraryA(path);
+#else
+    return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#endif
+}
+
+/**
+ * @brief Looks up the plugin entry point in an open library.
+ *
+ * @param lib Library handle.
+ * @return Entry point, or NULL if the library does not export it.
+ */
+static ObjectivePluginEntryFn lib_entry(void* lib)
+{
+    ObjectivePluginEntryFn fn = NULL;
+#if defined(_WIN32)
+    FARPROC sym = GetProcAddress((HMODULE)lib, OBJECTIVE_PLUGIN_ENTRY);
+#else
+    void* sym = dlsym(lib, OBJECTIVE_PLUGIN_ENTRY);
+#endif
+    /* object-to-function pointer casts are not ISO C; copy the bits */
+    if (sym) memcpy(&fn, &sym, sizeof(fn));
+    return fn;
+}
+
+/**
+ * @brief Closes a shared library.
+ *
+ * @param lib Library handle.
+ */
+static void lib_close(void* lib)
+{
+#if defined(_WIN32)
+    FreeLibrary((HMODULE)lib);
+#else
+    dlclose(lib);
+#endif
+}
+
+/**
+ * @brief Loads an objective plugin and builds its Problem descriptor.
+ *
+ * @param path Path of the shared library.
+ * @param h Output handle; pass to plugin_unload() when done.
+ * @param out Output problem descriptor, valid while @p h is loaded.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 if the library cannot be loaded,
+ *         3 if it does not export OBJECTIVE_PLUGIN_ENTRY,
+ *         4 on an ABI mismatch or a missing required function.
+ */
+int plugin_load(const char* path, PluginHandle* h, Problem* out)
+{
+    if (!path || !path[0] || !h || !out) return 1;
+
+    h->lib = NULL;
+    h->api = NULL;
+
+    void* lib = lib_open(path);
+    if (!lib) {
+        plugin_msg = NULL;
+        return 2;
+    }
+
+    ObjectivePluginEntryFn entry = lib_entry(lib);
+    if (!entry) {
+        plugin_msg = NULL;
+        lib_close(lib);
+        return 3;
+    }
+
+    const ObjectivePlugin* api = entry();
+    if (!api || api->abi_version != OBJECTIVE_PLUGIN_ABI ||
+        api->struct_size < sizeof(ObjectivePlugin)) {
+        plugin_msg = "plugin ABI version or table size does not match objective_plugin.h";
+        lib_close(lib);
+        return 4;
+    }
+    if (!api->eval || !api->eval_batch || !(api->lower < api->upper)) {
+        plugin_msg = "plugin is missing eval/eval_batch or has an empty range";
+        lib_close(lib);
+        return 4;
+    }
+
+    h->lib = lib;
+    h->api = api;
+
+    Problem p;
+    p.type = PROB_PLUGIN;
+    p.name = api->name ? api->name : "Plugin";
+    p.short_name = api->short_name ? api->short_name : "Plugin";
+    p.lower = api->lower;
+    p.upper = api->upper;
+    p.separable = 0;
+    p.optimum = api->optimum;
+    p.optimum_tol = api->optimum_tol;
+    p.fast_err = 0.0;
+    p.eval = api->eval;
+    p.eval_batch = api->eval_batch;
+    p.eval_delta = api->eval_delta;
+    p.eval_bounded = NULL;
+    p.eval_batch_f32 = NULL;
+    p.eval_grad = api->eval_grad;
+    p.transform = NULL;
+    *out = p;
+    return 0;
+}
+
+/**
+ * @brief Unloads a plugin library.
+ *
+ * @param h Handle filled by plugin_load().
+ */
+void plugin_unload(PluginHandle* h)
+{
+    if (!h || !h->lib) return;
+
+    lib_close(h->lib);
+    h->lib = NULL;
+    h->api = NULL;
+}
+
+/**
+ * @brief Returns the last loader error message.
+ *
+ * @return Loader error text; never NULL.
+ */
+const char* plugin_error(void)
+{
+    if (plugin_msg) return plugin_msg;
+#if defined(_WIN32)
+    return "LoadLibrary/GetProcAddress failed";
+#else
+    const char* e = dlerror();
+    return e ? e : "dlopen failed";
+#endif
+}
@@ -8,21 +8,13 @@
  */
 
 #include "population.h"
-#include "mt19937ar.h"
+#include "rng.h"
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
-/**
- * @brief Generates a uniform random value in a given range.
- *
- * @param mn Lower bound.
- * @param mx Upper bound.
- * @return Random double in the range [mn, mx).
- */
-static double rand_uniform(double mn, double mx)
-{
-    double u = genrand_real2(); /* [0,1) */
-    return mn + (mx - mn) * u;
-}
+/** Values drawn per rng_fill_real() call when randomizing a float population */
+#define RANDOMIZE_CHUNK 256
 
 /**
  * @brief Initializes a population structure.
@@ -35,16 +27,44 @@ static double rand_uniform(double mn, double mx)
  * @param m Dimension of each individual.
  * @return 0 on success,
  *         1 on invalid arguments,
- *         2 on allocation failure.
+ *         2 on allocation failure,
+ *         3 if n*m*sizeof(double) does not fit in size_t.
  */
 int population_init(Population* pop, int n, int m)
+{
+    return population_init_storage(pop, n, m, STORAGE_F64);
+}
+
+/**
+ * @brief Initializes a population with the given element type.
+ *
+ * @param pop Pointer to Population structure.
+ * @param n Number of individuals.
+ * @param m Dimension of each individual.
+ * @param storage Element type of the matrix.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure,
+ *         3 if the matrix size does not fit in size_t.
+ */
+int population_init_storage(Population* pop, int n, int m, StorageType storage)
 {
     if (!pop || n <= 0 || m <= 0) return 1;
+    size_t elem = (storage == STORAGE_F32) ? sizeof(float) : sizeof(double);
+    if ((size_t)n > SIZE_MAX / elem / (size_t)m) return 3;
 
     pop->n = n;
     pop->m = m;
-    pop->data = (double*)malloc((size_t)n * (size_t)m * sizeof(double));
-    if (!pop->data) return 2;
+    pop->storage = (storage == STORAGE_F32) ? STORAGE_F32 : STORAGE_F64;
+    pop->data = NULL;
+    pop->data_f32 = NULL;
+    if (pop->storage == STORAGE_F32) {
+        pop->data_f32 = (float*)malloc((size_t)n * (size_t)m * sizeof(float));
+        if (!pop->data_f32) return 2;
+    } else {
+        pop->data = (double*)malloc((size_t)n * (size_t)m * sizeof(double));
+        if (!pop->data) return 2;
+    }
 
     return 0;
 }
@@ -59,7 +79,9 @@ void population_free(Population* pop)
     if (!pop) return;
 
     free(pop->data);
+    free(pop->data_f32);
     pop->data = NULL;
+    pop->data_f32 = NULL;
     pop->n = 0;
     pop->m = 0;
 }
@@ -107,9 +129,42 @@ void fitness_free(Fitness* fit)
  */
 const double* population_row(const Population* pop, int i)
 {
+    if (!pop->data) return NULL;
     return &pop->data[(size_t)i * (size_t)pop->m];
 }
 
+/**
+ * @brief Returns a pointer to a specific row of a float population.
+ *
+ * @param pop Pointer to Population structure.
+ * @param i Row index.
+ * @return Pointer to the requested population row, or NULL if the
+ *         population is stored as double.
+ */
+const float* population_row_f32(const Population* pop, int i)
+{
+    if (!pop->data_f32) return NULL;
+    return &pop->data_f32[(size_t)i * (size_t)pop->m];
+}
+
+/**
+ * @brief Copies a population row into a double vector.
+ *
+ * @param pop Pointer to Population structure.
+ * @param i Row index.
+ * @param x_out Output vector (m values).
+ */
+void population_row_copy(const Population* pop, int i, double* x_out)
+{
+    size_t off = (size_t)i * (size_t)pop->m;
+
+    if (pop->storage == STORAGE_F32) {
+        for (int j = 0; j < pop->m; j++) x_out[j] = (double)pop->data_f32[off + j];
+    } else {
+        memcpy(x_out, pop->data + off, (size_t)pop->m * sizeof(double));
+    }
+}
+
 /**
  * @brief Randomizes all individuals in the population.
  *
@@ -117,25 +172,38 @@ const double* population_row(const Population* pop, int i)
  * uniformly distributed within the given bounds.
  *
  * @param pop Pointer to Population structure.
+ * @param rng Random stream, or NULL for rng_global().
  * @param lower Lower bound for values.
  * @param upper Upper bound for values.
  */
-void population_randomize(Population* pop, double lower, double upper)
+void population_randomize(Population* pop, Rng* rng, double lower, double upper)
 {
-    if (!pop || !pop->data) return;
-
-    for (int i = 0; i < pop->n; i++) {
-        double* row = &pop->data[(size_t)i * (size_t)pop->m];
-        for (int j = 0; j < pop->m; j++) {
-            row[j] = rand_uniform(lower, upper);
+    if (!pop) return;
+    if (!rng) rng = rng_global();
+
+    if (pop->storage == STORAGE_F32) {
+        if (!pop->data_f32) return;
+        size_t len = (size_t)pop->n * (size_t)pop->m;
+        double u[RANDOMIZE_CHUNK];
+        for (size_t j0 = 0; j0 < len; j0 += RANDOMIZE_CHUNK) {
+            size_t k = (len - j0 < RANDOMIZE_CHUNK) ? len - j0 : RANDOMIZE_CHUNK;
+            rng_fill_real(rng, u, k, lower, upper);
+            for (size_t j = 0; j < k; j++) pop->data_f32[j0 + j] = (float)u[j];
         }
+        return;
     }
+    if (!pop->data) return;
+
+    /* the rows are contiguous, so the whole matrix is one fill */
+    rng_fill_real(rng, pop->data, (size_t)pop->n * (size_t)pop->m, lower, upper);
 }
 
 /**
  * @brief Evaluates the fitness of each individual in the population.
  *
  * Fitness values are stored in the corresponding Fitness structure.
+ * The whole population is passed to the problem as a single block;
+ * float populations are evaluated in double from their float rows.
  *
  * @param pop Pointer to Population structure.
  * @param prob Pointer to the optimization problem.
@@ -143,11 +211,12 @@ void population_randomize(Population* pop, double lower, double upper)
  */
 void population_evaluate(const Population* pop, const Problem* prob, Fitness* fit)
 {
-    if (!pop || !prob || !fit || !pop->data || !fit->values) return;
+    if (!pop || !prob || !fit || !fit->values) return;
     if (fit->n != pop->n) return;
 
-    for (int i = 0; i < pop->n; i++) {
-        const double* row = population_row(pop, i);
-        fit->values[i] = problem_eval(prob, row, pop->m);
+    if (pop->storage == STORAGE_F32) {
+        if (pop->data_f32) problem_eval_batch_f32(prob, pop->data_f32, pop->n, pop->m, fit->values);
+    } else if (pop->data) {
+        problem_eval_batch(prob, pop->data, pop->n, pop->m, fit->values);
     }
 }
@@ -3,29 +3,158 @@
  * @brief Benchmark optimization problem definitions and evaluation.
  *
  * This module defines a collection of standard benchmark optimization
- * problems and provides a unified interface for evaluating them.
+ * problems and provides a unified interface for evaluating them. The
+ * per-problem metadata lives in a single registry table, and the
+ * numeric kernels live in kernels.c and are reached through the
+ * KernelTable selected for the running CPU.
  */
 
 #include "problem.h"
+#include "kernels.h"
 #include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+/**
+ * @brief Static metadata of one registered problem.
+ */
+typedef struct {
+    const char* name;       /**< Human-readable name */
+    const char* short_name; /**< Compact CSV name */
+    double lower;           /**< Default lower bound */
+    double upper;           /**< Default upper bound */
+    int separable;          /**< Sum of per-coordinate terms */
+    double optimum;         /**< Known global minimum, NAN if unknown */
+    double optimum_tol;     /**< Distance to the optimum that counts as reaching it */
+    double fast_err;        /**< precision=fast error bound (see Problem::fast_err) */
+} ProblemInfo;
+
+/**
+ * @brief Problem registry, indexed by ProblemType.
+ *
+ * Adding a problem means adding an enum value, a row here and a kernel
+ * in kernels.c.
+ *
+ * optimum_tol is how close to the optimum a fitness must be to count
+ * as reaching it (target=optimum). Schwefel's is looser because its
+ * constant 418.9829 is rounded: f at the true minimum is about
+ * 1.3e-5 * m, not 0.
+ *
+ * The fast_err column is the largest |f_fast - f_libm| / max(|f_libm|, 1)
+ * measured over 2*10^5 random vectors per problem for m = 10 and 30,
+ * drawn from the full default range and from 1/10 and 1/100 of it,
+ * and at the local minima local=lbfgs converges to (300 restarts per
+ * m), rounded up, and raised where `make verify` (bounds, midpoint,
+ * shifted and rotated vectors, m = 2..30) found larger errors. Egg
+ * Holder is dominated by cancellation between its large positive and
+ * negative terms; Schwefel and Griewangk reach their largest errors at
+ * minima, where f nearly cancels, Schwefel most when a rotation moves
+ * coordinates past the range. Rastrigin's cos(2 pi x) is off by about
+ * 1e-10 at integer x, which adds up to 3e-8 at the optimum for m = 30.
+ */
+static const ProblemInfo registry[PROB_EGG_HOLDER + 1] = {
+    { "Unknown",                 "Unknown",    -100.0, 100.0, 0, NAN, NAN,  NAN   },
+    { "Schwefel",                "Schwefel",   -512.0, 512.0, 1, 0.0, 1e-2, 5e-8  },
+    { "De Jong 1",               "DeJong1",    -100.0, 100.0, 1, 0.0, 1e-8, 0.0   },
+    { "Rosenbrock",              "Rosenbrock", -100.0, 100.0, 0, 0.0, 1e-8, 0.0   },
+    { "Rastrigin",               "Rastrigin",   -30.0,  30.0, 1, 0.0, 1e-8, 5e-8  },
+    { "Griewangk",               "Griewank",   -500.0, 500.0, 0, 0.0, 1e-8, 5e-9  },
+    { "Sine Envelope Sine Wave", "SineEnv",     -30.0,  30.0, 0, NAN, NAN,  2e-10 },
+    { "Stretch V Sine Wave",     "StretchV",    -30.0,  30.0, 0, NAN, NAN,  5e-8  },
+    { "Ackley One",              "Ackley1",     -32.0,  32.0, 0, NAN, NAN,  2e-9  },
+    { "Ackley Two",              "Ackley2",     -32.0,  32.0, 0, NAN, NAN,  2e-9  },
+    { "Egg Holder",              "EggHolder",  -500.0, 500.0, 0, NAN, NAN,  2e-7  }
+};
+
+static double eval_unknown(const double* x, int m)
+{
+    (void)x;
+    (void)m;
+    return NAN;
+}
+
+static void eval_batch_unknown(const double* X, int k, int m, double* f_out)
+{
+    (void)X;
+    (void)m;
+    for (int r = 0; r < k; r++) f_out[r] = NAN;
+}
+
+static void eval_batch_f32_unknown(const float* X, int k, int m, double* f_out)
+{
+    (void)X;
+    (void)m;
+    for (int r = 0; r < k; r++) f_out[r] = NAN;
+}
 
 /**
- * @brief Creates a Problem structure for a given problem type.
+ * @brief Creates a Problem descriptor for a given problem type.
  *
  * @param t Problem type identifier.
- * @return Initialized Problem structure.
+ * @return Initialized Problem descriptor.
  */
 Problem problem_create(ProblemType t)
 {
+    int known = (int)t >= PROB_SCHWEFEL && (int)t <= PROB_EGG_HOLDER;
+    const ProblemInfo* info = &registry[known ? (int)t : 0];
+    const KernelTable* kt = kernels_active();
+
     Problem p;
     p.type = t;
+    p.name = info->name;
+    p.short_name = info->short_name;
+    p.lower = info->lower;
+    p.upper = info->upper;
+    p.separable = info->separable;
+    p.optimum = info->optimum;
+    p.optimum_tol = info->optimum_tol;
+    p.fast_err = info->fast_err;
+    p.eval = known ? kt->eval[t] : eval_unknown;
+    p.eval_batch = known ? kt->batch[t] : eval_batch_unknown;
+    p.eval_delta = known ? kt->delta[t] : NULL;
+    p.eval_bounded = known ? kt->bounded[t] : NULL;
+    p.eval_batch_f32 = known ? kt->batch_f32[t] : eval_batch_f32_unknown;
+    p.eval_grad = known ? kt->grad[t] : NULL;
+    p.transform = NULL;
     return p;
 }
 
+/**
+ * @brief Attaches a shift/rotation to a problem descriptor.
+ *
+ * @param p Problem descriptor to modify.
+ * @param tr Transform, or NULL to remove it.
+ */
+void problem_set_transform(Problem* p, Transform* tr)
+{
+    if (!p) return;
+
+    int known = (int)p->type >= PROB_SCHWEFEL && (int)p->type <= PROB_EGG_HOLDER;
+    const ProblemInfo* info = &registry[known ? (int)p->type : 0];
+
+    p->transform = tr;
+    p->eval_delta = (known && !tr) ? kernels_active()->delta[p->type] : NULL;
+    p->separable = (tr && tr->rot_t) ? 0 : info->separable;
+}
+
+/**
+ * @brief Returns the input of p's kernels for k vectors.
+ *
+ * @param p Pointer to the problem definition.
+ * @param X Block of k vectors.
+ * @param k Number of vectors (at most TRANSFORM_BLOCK with a transform).
+ * @param m Dimension of each vector.
+ * @return X itself, its transformed copy, or NULL if the transform
+ *         does not match m or fails to allocate.
+ */
+static const double* kernel_input(const Problem* p, const double* X, int k, int m)
+{
+    if (!p->transform) return X;
+    if (p->transform->m != m) return NULL;
+    return transform_rows(p->transform, X, k);
+}
+
 /**
  * @brief Returns a human-readable name for a problem.
  *
@@ -34,26 +163,116 @@ Problem problem_create(ProblemType t)
  */
 const char* problem_name(const Problem* p)
 {
-    if (!p) return "Unknown";
-
-    switch (p->type) {
-        case PROB_SCHWEFEL:               return "Schwefel";
-        case PROB_DEJONG1:                return "De Jong 1";
-        case PROB_ROSENBROCK:             return "Rosenbrock";
-        case PROB_RASTRIGIN:              return "Rastrigin";
-        case PROB_GRIEWANGK:              return "Griewangk";
-        case PROB_SINE_ENV_SINE_WAVE:     return "Sine Envelope Sine Wave";
-        case PROB_STRETCH_V_SINE_WAVE:    return "Stretch V Sine Wave";
-        case PROB_ACKLEY_ONE:             return "Ackley One";
-        case PROB_ACKLEY_TWO:             return "Ackley Two";
-        case PROB_EGG_HOLDER:             return "Egg Holder";
-        default:                          return "Unknown";
+    return p ? p->name : "Unknown";
+}
+
+/**
+ * @brief Returns the short name of a problem used in CSV output.
+ *
+ * @param p Pointer to the problem.
+ * @return Short name of the problem.
+ */
+const char* problem_short_name(const Problem* p)
+{
+    return p ? p->short_name : "Unknown";
+}
+
+/**
+ * @brief Returns the default input range for a problem.
+ *
+ * @param p Pointer to the problem.
+ * @param out_min Output parameter for minimum bound.
+ * @param out_max Output parameter for maximum bound.
+ */
+void problem_range(const Problem* p, double* out_min, double* out_max)
+{
+    if (!out_min || !out_max) return;
+    *out_min = p ? p->lower : registry[0].lower;
+    *out_max = p ? p->upper : registry[0].upper;
+}
+
+/**
+ * @brief Evaluates an optimization problem for a block of solution vectors.
+ *
+ * The kernel bound by problem_create() evaluates every row with a
+ * single indirect call.
+ *
+ * @param p Pointer to the problem definition.
+ * @param X Block of k solution vectors (row-major, k*m values).
+ * @param k Number of vectors in the block.
+ * @param m Dimension of each vector.
+ * @param f_out Output array of length @p k. Every entry is set to NAN
+ *              if the inputs are invalid.
+ */
+void problem_eval_batch(const Problem* p, const double* X, int k, int m, double* f_out)
+{
+    if (!f_out || k <= 0) return;
+
+    if (!p || !X || m <= 0) {
+        for (int r = 0; r < k; r++) f_out[r] = NAN;
+        return;
+    }
+
+    if (!p->transform) {
+        p->eval_batch(X, k, m, f_out);
+        return;
+    }
+
+    for (int r0 = 0; r0 < k; r0 += TRANSFORM_BLOCK) {
+        int nr = (k - r0 < TRANSFORM_BLOCK) ? k - r0 : TRANSFORM_BLOCK;
+        const double* Z = kernel_input(p, X + (size_t)r0 * (size_t)m, nr, m);
+        if (Z) {
+            p->eval_batch(Z, nr, m, f_out + r0);
+        } else {
+            for (int r = 0; r < nr; r++) f_out[r0 + r] = NAN;
+        }
+    }
+}
+
+/**
+ * @brief Evaluates an optimization problem for a block of float vectors.
+ *
+ * @param p Pointer to the problem definition.
+ * @param X Block of k solution vectors (row-major, k*m floats).
+ * @param k Number of vectors in the block.
+ * @param m Dimension of each vector.
+ * @param f_out Output array of length @p k. Every entry is set to NAN
+ *              if the inputs are invalid.
+ */
+void problem_eval_batch_f32(const Problem* p, const float* X, int k, int m, double* f_out)
+{
+    if (!f_out || k <= 0) return;
+
+    if (!p || !X || m <= 0) {
+        for (int r = 0; r < k; r++) f_out[r] = NAN;
+        return;
+    }
+
+    if (!p->transform) {
+        p->eval_batch_f32(X, k, m, f_out);
+        return;
+    }
+
+    /* the transformed rows are double anyway */
+    for (int r0 = 0; r0 < k; r0 += TRANSFORM_BLOCK) {
+        int nr = (k - r0 < TRANSFORM_BLOCK) ? k - r0 : TRANSFORM_BLOCK;
+        const double* Z = (p->transform->m == m)
+            ? transform_rows_f32(p->transform, X + (size_t)r0 * (size_t)m, nr)
+            : NULL;
+        if (Z) {
+            p->eval_batch(Z, nr, m, f_out + r0);
+        } else {
+            for (int r = 0; r < nr; r++) f_out[r0 + r] = NAN;
+        }
     }
 }
 
 /**
  * @brief Evaluates an optimization problem for a given solution vector.
  *
+ * Calls the scalar kernel bound by problem_create(). It shares its code
+ * with the batch kernel, so both produce identical values.
+ *
  * @param p Pointer to the problem definition.
  * @param x Input solution vector.
  * @param m Dimension of the solution vector.
@@ -63,118 +282,106 @@ double problem_eval(const Problem* p, const double* x, int m)
 {
     if (!p || !x || m <= 0) return NAN;
 
-    switch (p->type) {
-
-        case PROB_SCHWEFEL: {
-            double sum = 0.0;
-            for (int i = 0; i < m; i++) {
-                double xi = x[i];
-                sum += (-xi) * sin(sqrt(fabs(xi)));
-            }
-            return 418.9829 * (double)m + sum;
-        }
+    const double* z = kernel_input(p, x, 1, m);
+    return z ? p->eval(z, m) : NAN;
+}
 
-        case PROB_DEJONG1: {
-            double sum = 0.0;
-            for (int i = 0; i < m; i++)
-                sum += x[i] * x[i];
-            return sum;
-        }
+/**
+ * @brief Evaluates the fitness after changing a single coordinate.
+ *
+ * Uses the problem's delta function when it has one; otherwise the
+ * modified vector is copied (to @p scratch) and evaluated in full.
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Current solution vector.
+ * @param m Dimension of the solution vector.
+ * @param f_old Fitness of x.
+ * @param j Index of the coordinate to change.
+ * @param new_xj New value of coordinate j.
+ * @param scratch m doubles for the fallback, or NULL to allocate them.
+ * @return Fitness of the modified vector, or NAN if inputs are invalid.
+ */
+double problem_eval_delta(const Problem* p, const double* x, int m,
+                          double f_old, int j, double new_xj, double* scratch)
+{
+    if (!p || !x || m <= 0 || j < 0 || j >= m) return NAN;
 
-        case PROB_ROSENBROCK: {
-            double sum = 0.0;
-            for (int i = 0; i < m - 1; i++) {
-                double xi = x[i];
-                double xnext = x[i + 1];
-                double a = (xi * xi - xnext);
-                double b = (1.0 - xi);
-                sum += 100.0 * a * a + b * b;
-            }
-            return sum;
-        }
+    if (p->eval_delta) return p->eval_delta(x, m, f_old, j, new_xj);
 
-        case PROB_RASTRIGIN: {
-            double sum = 0.0;
-            for (int i = 0; i < m; i++) {
-                double xi = x[i];
-                sum += (xi * xi - 10.0 * cos(2.0 * M_PI * xi));
-            }
-            return 10.0 * (double)m + sum;
-        }
+    double* y = scratch ? scratch : (double*)malloc((size_t)m * sizeof(double));
+    if (!y) return NAN;
+    memcpy(y, x, (size_t)m * sizeof(double));
+    y[j] = new_xj;
+    double f = problem_eval(p, y, m);
+    if (!scratch) free(y);
+    return f;
+}
 
-        case PROB_GRIEWANGK: {
-            double sum = 0.0;
-            double prod = 1.0;
-            for (int i = 0; i < m; i++) {
-                double xi = x[i];
-                sum += (xi * xi) / 4000.0;
-                prod *= cos(xi / sqrt((double)(i + 1)));
-            }
-            return 1.0 + sum - prod;
-        }
+/**
+ * @brief Evaluates a vector only as far as needed to compare it with a cutoff.
+ *
+ * Uses the problem's bounded kernel when it has one; otherwise the
+ * vector is evaluated in full.
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Input solution vector.
+ * @param m Dimension of the solution vector.
+ * @param cutoff Fitness the vector has to beat.
+ * @return Fitness value, PROBLEM_EVAL_ABANDONED, or NAN if inputs are invalid.
+ */
+double problem_eval_bounded(const Problem* p, const double* x, int m, double cutoff)
+{
+    if (!p || !x || m <= 0) return NAN;
 
-        case PROB_SINE_ENV_SINE_WAVE: {
-            double sum = 0.0;
-            for (int i = 0; i < m - 1; i++) {
-                double a = x[i] * x[i] + x[i + 1] * x[i + 1];
-                double num = sin(a - 0.5);
-                num = num * num;
-                double den = (1.0 + 0.001 * a);
-                den = den * den;
-                sum += 0.5 + (num / den);
-            }
-            return -sum;
-        }
+    const double* z = kernel_input(p, x, 1, m);
+    if (!z) return NAN;
+    if (p->eval_bounded) return p->eval_bounded(z, m, cutoff);
+    return p->eval(z, m);
+}
 
-        case PROB_STRETCH_V_SINE_WAVE: {
-            double sum = 0.0;
-            for (int i = 0; i < m - 1; i++) {
-                double a = x[i] * x[i] + x[i + 1] * x[i + 1];
-                double ra = pow(a, 0.25);
-                double inner = sin(50.0 * pow(a, 0.1));
-                double term = (ra * inner * inner) + 1.0;
-                sum += pow(term, 2.0);
-            }
-            return sum;
-        }
+/**
+ * @brief Evaluates a vector and its analytic gradient.
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Input solution vector.
+ * @param m Dimension of the solution vector.
+ * @param g Output gradient (m values).
+ * @return Fitness value, or NAN if inputs are invalid.
+ */
+double problem_eval_grad(const Problem* p, const double* x, int m, double* g)
+{
+    if (!p || !x || !g || m <= 0 || !p->eval_grad) return NAN;
 
-        case PROB_ACKLEY_ONE: {
-            double sum = 0.0;
-            for (int i = 0; i < m - 1; i++) {
-                double a = sqrt(x[i] * x[i] + x[i + 1] * x[i + 1]);
-                double term = (1.0 / exp(0.2)) * a
-                              + 3.0 * (cos(2.0 * x[i]) + sin(2.0 * x[i + 1]));
-                sum += term;
-            }
-            return sum;
-        }
+    const double* z = kernel_input(p, x, 1, m);
+    if (!z) return NAN;
+    if (!p->transform) return p->eval_grad(z, m, g);
 
-        case PROB_ACKLEY_TWO: {
-            double sum = 0.0;
-            for (int i = 0; i < m - 1; i++) {
-                double a = sqrt((x[i] * x[i] + x[i + 1] * x[i + 1]) / 2.0);
-                double term = 20.0 + exp(1.0)
-                              - 20.0 * exp(0.2 * a)
-                              - exp(0.5 * (cos(2.0 * M_PI * x[i])
-                              + cos(2.0 * M_PI * x[i + 1])));
-                sum += term;
-            }
-            return sum;
-        }
+    /* gradient w.r.t. z into the transform's scratch, then pulled back */
+    double* gz = transform_grad_scratch(p->transform);
+    if (!gz) return NAN;
+    double f = p->eval_grad(z, m, gz);
+    transform_pullback(p->transform, gz, g);
+    return f;
+}
 
-        case PROB_EGG_HOLDER: {
-            double sum = 0.0;
-            for (int i = 0; i < m - 1; i++) {
-                double xi = x[i];
-                double xj = x[i + 1];
-                double t1 = -xi * sin(sqrt(fabs(xi - xj - 47.0)));
-                double t2 = -(xj + 47.0) * sin(sqrt(fabs(xj + 47.0 + xi / 2.0)));
-                sum += (t1 + t2);
-            }
-            return sum;
-        }
+/**
+ * @brief Evaluates several problems on the same block of vectors.
+ *
+ * Calls the fused kernel of the active kernel variant.
+ *
+ * @param X Block of k solution vectors (row-major, k*m values).
+ * @param k Number of vectors in the block.
+ * @param m Dimension of each vector.
+ * @param mask Problems to evaluate (PROBLEM_MASK(t) bits).
+ * @param f_out Output arrays indexed by ProblemType.
+ */
+void problem_eval_multi(const double* X, int k, int m, unsigned mask, double* const* f_out)
+{
+    if (!X || !f_out || k <= 0 || m <= 0) return;
 
-        default:
-            return NAN;
+    mask &= PROBLEM_MASK_ALL;
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+        if ((mask & PROBLEM_MASK(t)) && !f_out[t]) return;
     }
+    if (mask) kernels_active()->multi(X, k, m, mask, f_out);
 }
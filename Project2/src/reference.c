@@ -0,0 +1,162 @@
+/**
+ * @file reference.c
+ * @brief Straightforward libm implementation of the benchmark problems.
+ *
+ * These are the original one-term-at-a-time formulas, evaluated with
+ * the C library's sin/cos/exp/sqrt/pow and compiled without the kernel
+ * flags. They are slow but independent of vecmath.h, and serve as the
+ * reference that fast-precision results are checked against.
+ */
+
+#include "problem.h"
+#include "expr.h"
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * @brief Evaluates a problem with the reference (libm) formulas.
+ *
+ * A shift/rotation is applied with the same transform kernel as
+ * problem_eval(); it involves no transcendental functions.
+ *
+ * @param p Pointer to the problem definition.
+ * @param x Input solution vector.
+ * @param m Dimension of the solution vector.
+ * @return Fitness value, or NAN if inputs are invalid.
+ */
+double problem_eval_reference(const Problem* p, const double* x, int m)
+{
+    if (!p || !x || m <= 0) return NAN;
+
+    if (p->transform) {
+        if (p->transform->m != m) return NAN;
+        x = transform_rows(p->transform, x, 1);
+        if (!x) return NAN;
+    }
+
+    switch (p->type) {
+
+        case PROB_SCHWEFEL: {
+            double sum = 0.0;
+            for (int i = 0; i < m; i++) {
+                double xi = x[i];
+                sum += (-xi) * sin(sqrt(fabs(xi)));
+            }
+            return 418.9829 * (double)m + sum;
+        }
+
+        case PROB_DEJONG1: {
+            double sum = 0.0;
+            for (int i = 0; i < m; i++)
+                sum += x[i] * x[i];
+            return sum;
+        }
+
+        case PROB_ROSENBROCK: {
+            double sum = 0.0;
+            for (int i = 0; i < m - 1; i++) {
+                double xi = x[i];
+                double xnext = x[i + 1];
+                double a = (xi * xi - xnext);
+                double b = (1.0 - xi);
+                sum += 100.0 * a * a + b * b;
+            }
+            return sum;
+        }
+
+        case PROB_RASTRIGIN: {
+            double sum = 0.0;
+            for (int i = 0; i < m; i++) {
+                double xi = x[i];
+                sum += (xi * xi - 10.0 * cos(2.0 * M_PI * xi));
+            }
+            return 10.0 * (double)m + sum;
+        }
+
+        case PROB_GRIEWANGK: {
+            double sum = 0.0;
+            double prod = 1.0;
+            for (int i = 0; i < m; i++) {
+                double xi = x[i];
+                sum += (xi * xi) / 4000.0;
+                prod *= cos(xi / sqrt((double)(i + 1)));
+            }
+            return 1.0 + sum - prod;
+        }
+
+        case PROB_SINE_ENV_SINE_WAVE: {
+            double sum = 0.0;
+            for (int i = 0; i < m - 1; i++) {
+                double a = x[i] * x[i] + x[i + 1] * x[i + 1];
+                double num = sin(a - 0.5);
+                num = num * num;
+                double den = (1.0 + 0.001 * a);
+                den = den * den;
+                sum += 0.5 + (num / den);
+            }
+            return -sum;
+        }
+
+        case PROB_STRETCH_V_SINE_WAVE: {
+            double sum = 0.0;
+            for (int i = 0; i < m - 1; i++) {
+                double a = x[i] * x[i] + x[i + 1] * x[i + 1];
+                double ra = pow(a, 0.25);
+                double inner = sin(50.0 * pow(a, 0.1));
+                double term = (ra * inner * inner) + 1.0;
+                sum += pow(term, 2.0);
+            }
+            return sum;
+        }
+
+        case PROB_ACKLEY_ONE: {
+            double sum = 0.0;
+            for (int i = 0; i < m - 1; i++) {
+                double a = sqrt(x[i] * x[i] + x[i + 1] * x[i + 1]);
+                double term = (1.0 / exp(0.2)) * a
+                              + 3.0 * (cos(2.0 * x[i]) + sin(2.0 * x[i + 1]));
+                sum += term;
+            }
+            return sum;
+        }
+
+        case PROB_ACKLEY_TWO: {
+            double sum = 0.0;
+            for (int i = 0; i < m - 1; i++) {
+                double a = sqrt((x[i] * x[i] + x[i + 1] * x[i + 1]) / 2.0);
+                double term = 20.0 + exp(1.0)
+                              - 20.0 * exp(0.2 * a)
+                              - exp(0.5 * (cos(2.0 * M_PI * x[i])
+                              + cos(2.0 * M_PI * x[i + 1])));
+                sum += term;
+            }
+            return sum;
+        }
+
+        case PROB_EGG_HOLDER: {
+            double sum = 0.0;
+            for (int i = 0; i < m - 1; i++) {
+                double xi = x[i];
+                double xj = x[i + 1];
+                double t1 = -xi * sin(sqrt(fabs(xi - xj - 47.0)));
+                double t2 = -(xj + 47.0) * sin(sqrt(fabs(xj + 47.0 + xi / 2.0)));
+                sum += (t1 + t2);
+            }
+            return sum;
+        }
+
+        case PROB_PLUGIN:
+            /* a plugin has no second implementation; its eval is the reference */
+            return p->eval(x, m);
+
+        case PROB_EXPR:
+            /* the same bytecode, run on scalars with libm */
+            return expr_bound_reference(x, m);
+
+        default:
+            return NAN;
+    }
+}
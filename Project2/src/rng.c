@@ -0,0 +1,132 @@
+/**
+ * @file rng.c
+ * @brief Run-time selection between the random number engines.
+ */
+
+#include "rng.h"
+
+/** Stream behind rng_global() (MT19937, seeded on first draw) */
+static Rng global_rng = { RNG_MT19937, { .mt = { { 0 }, MT_N + 1 } } };
+
+/**
+ * @brief Seeds a stream of the given engine.
+ *
+ * @param rng Stream to initialize.
+ * @param type Engine.
+ * @param seed Seed value.
+ * @param stream Independent stream under the same seed (Philox key
+ *               word, MT19937 jumps of 2^128 draws; dSFMT ignores it).
+ * @return 0 on success, 1 on invalid arguments.
+ */
+int rng_init(Rng* rng, RngType type, uint32_t seed, uint32_t stream)
+{
+    if (!rng) return 1;
+
+    switch (type) {
+        case RNG_MT19937:
+            mt_init(&rng->state.mt, seed);
+            mt_jump(&rng->state.mt, stream);
+            break;
+        case RNG_DSFMT:   dsfmt_init(&rng->state.dsfmt, seed); break;
+        case RNG_PHILOX:  philox_init(&rng->state.philox, seed, stream); break;
+        default:          return 1;
+    }
+    rng->type = type;
+    return 0;
+}
+
+/**
+ * @brief Tells whether the engine has substreams.
+ *
+ * @param rng Stream.
+ * @return 1 for a counter-based engine, 0 otherwise.
+ */
+int rng_counter_based(const Rng* rng)
+{
+    return rng->type == RNG_PHILOX;
+}
+
+/**
+ * @brief Moves to the start of substream @p t (counter-based engines only).
+ *
+ * @param rng Stream.
+ * @param t Substream.
+ */
+void rng_substream(Rng* rng, uint64_t t)
+{
+    if (rng->type == RNG_PHILOX) philox_seek(&rng->state.philox, t, 0);
+}
+
+/**
+ * @brief Draws a 32-bit unsigned random integer.
+ *
+ * @param rng Stream.
+ * @return Random 32-bit unsigned integer.
+ */
+uint32_t rng_next(Rng* rng)
+{
+    switch (rng->type) {
+        case RNG_DSFMT:  return dsfmt_next(&rng->state.dsfmt);
+        case RNG_PHILOX: return philox_next(&rng->state.philox);
+        default:         return mt_next(&rng->state.mt);
+    }
+}
+
+/**
+ * @brief Draws a double in [0, 1).
+ *
+ * @param rng Stream.
+ * @return Random double in the range [0,1).
+ */
+double rng_real(Rng* rng)
+{
+    switch (rng->type) {
+        case RNG_DSFMT:  return dsfmt_real(&rng->state.dsfmt);
+        case RNG_PHILOX: return philox_real(&rng->state.philox);
+        default:         return mt_real(&rng->state.mt);
+    }
+}
+
+/**
+ * @brief Fills an array with uniform random values in [lo, hi).
+ *
+ * @param rng Stream.
+ * @param out Output array.
+ * @param n Number of values.
+ * @param lo Lower bound.
+ * @param hi Upper bound.
+ */
+void rng_fill_real(Rng* rng, double* out, size_t n, double lo, double hi)
+{
+    switch (rng->type) {
+        case RNG_DSFMT:  dsfmt_fill_real(&rng->state.dsfmt, out, n, lo, hi); break;
+        case RNG_PHILOX: philox_fill_real(&rng->state.philox, out, n, lo, hi); break;
+        default:         mt_fill_real(&rng->state.mt, out, n, lo, hi); break;
+    }
+}
+
+/**
+ * @brief Returns the process-wide stream used where an Rng is optional.
+ *
+ * @return Global stream.
+ */
+Rng* rng_global(void)
+{
+    return &global_rng;
+}
+
+/**
+ * @brief Returns the config name of an engine.
+ *
+ * @param type Engine.
+ * @return "mt19937", "dsfmt", "philox" or "unknown".
+ */
+const char* rng_name(RngType type)
+{
+    switch (type) {
+        case RNG_MT19937: return "mt19937";
+        case RNG_DSFMT:   return "dsfmt";
+        case RNG_PHILOX:  return "philox";
+        default:          return "unknown";
+    }
+}
@@ -0,0 +1,238 @@
+/**
+ * @file transform.c
+ * @brief Shift vectors and rotation matrices for transformed problems.
+ *
+ * This module builds o and R for a transformed problem and applies
+ * them to blocks of candidates through the transform kernel of the
+ * active KernelTable.
+ */
+
+#include "transform.h"
+#include "kernels.h"
+#include "mt19937ar.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * @brief Draws a standard normal value (Box-Muller).
+ *
+ * @param rng Generator state.
+ * @return Normally distributed random double.
+ */
+static double rand_normal(MTState* rng)
+{
+    double u1 = 1.0 - mt_real(rng); /* (0,1] */
+    double u2 = mt_real(rng);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/**
+ * @brief Fills q with a random orthogonal matrix.
+ *
+ * Gram-Schmidt (the orthogonalize kernel) over the rows of a Gaussian
+ * matrix. The rows, and therefore the columns, of the result are
+ * orthonormal, and the matrix is uniformly distributed over the
+ * orthogonal group. This is O(m^3): about 2 s at m = 2000 with AVX2.
+ *
+ * @param rng Generator state.
+ * @param q Output matrix (m*m, row-major).
+ * @param m Dimension.
+ */
+static void random_orthogonal(MTState* rng, double* q, int m)
+{
+    size_t len = (size_t)m * (size_t)m;
+    for (size_t j = 0; j < len; j++) q[j] = rand_normal(rng);
+
+    kernels_active()->orthogonalize(q, m);
+}
+
+/**
+ * @brief Builds the shift and rotation for one problem.
+ *
+ * @param tr Transform to initialize.
+ * @param m Dimension.
+ * @param kind Transformation to build.
+ * @param lower Lower bound of the search range.
+ * @param upper Upper bound of the search range.
+ * @param seed Seed for the shift and rotation.
+ * @return 0 on success,
+ *         1 on invalid arguments,
+ *         2 on allocation failure.
+ */
+int transform_init(Transform* tr, int m, TransformKind kind,
+                   double lower, double upper, uint32_t seed)
+{
+    if (!tr || m <= 0 || !(lower < upper)) return 1;
+    if (kind < TRANSFORM_NONE || kind > TRANSFORM_SHIFT_ROTATE) return 1;
+
+    tr->m = m;
+    tr->kind = kind;
+    tr->shift = NULL;
+    tr->rot_t = NULL;
+    tr->work = NULL;
+    tr->work_rows = 0;
+
+    /* a private stream, so building a transform leaves the search's alone */
+    MTState rng;
+    mt_init(&rng, seed);
+
+    if (kind & TRANSFORM_SHIFT) {
+        tr->shift = (double*)malloc((size_t)m * sizeof(double));
+        if (!tr->shift) return 2;
+        double mid = 0.5 * (lower + upper);
+        double half = 0.4 * (upper - lower);
+        for (int j = 0; j < m; j++) {
+            tr->shift[j] = mid + half * (2.0 * mt_real(&rng) - 1.0);
+        }
+    }
+
+    if (kind & TRANSFORM_ROTATE) {
+        if ((size_t)m > SIZE_MAX / sizeof(double) / (size_t)m) {
+            transform_free(tr);
+            return 2;
+        }
+        tr->rot_t = (double*)malloc((size_t)m * (size_t)m * sizeof(double));
+        if (!tr->rot_t) {
+            transform_free(tr);
+            return 2;
+        }
+        /* R^T of a uniformly random orthogonal R is one too */
+        random_orthogonal(&rng, tr->rot_t, m);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Frees a transform.
+ *
+ * @param tr Transform to free.
+ */
+void transform_free(Transform* tr)
+{
+    if (!tr) return;
+
+    free(tr->shift);
+    free(tr->rot_t);
+    free(tr->work);
+    tr->shift = NULL;
+    tr->rot_t = NULL;
+    tr->work = NULL;
+    tr->work_rows = 0;
+}
+
+/**
+ * @brief Makes room for k transformed rows plus k widened rows.
+ *
+ * @param tr Transform.
+ * @param k Number of rows.
+ * @return 0 on success, non-zero on allocation failure.
+ */
+static int reserve_rows(Transform* tr, int k)
+{
+    if ((size_t)k <= tr->work_rows) return 0;
+
+    double* w = (double*)realloc(tr->work, 2 * (size_t)k * (size_t)tr->m * sizeof(double));
+    if (!w) return 1;
+    tr->work = w;
+    tr->work_rows = (size_t)k;
+    return 0;
+}
+
+/**
+ * @brief Transforms k row-major vectors.
+ *
+ * @param tr Transform.
+ * @param X Block of k vectors.
+ * @param k Number of vectors (at most TRANSFORM_BLOCK).
+ * @return Pointer to the transformed vectors, or NULL on failure.
+ */
+const double* transform_rows(Transform* tr, const double* X, int k)
+{
+    if (!tr || !X || k <= 0 || k > TRANSFORM_BLOCK) return NULL;
+    if (reserve_rows(tr, k) != 0) return NULL;
+
+    kernels_active()->transform(X, k, tr->m, tr->shift, tr->rot_t, tr->work);
+    return tr->work;
+}
+
+/**
+ * @brief Transforms k row-major vectors stored as float.
+ *
+ * The rows are widened into the second half of the workspace first.
+ *
+ * @param tr Transform.
+ * @param X Block of k vectors (floats).
+ * @param k Number of vectors (at most TRANSFORM_BLOCK).
+ * @return Pointer to the transformed vectors, or NULL on failure.
+ */
+const double* transform_rows_f32(Transform* tr, const float* X, int k)
+{
+    if (!tr || !X || k <= 0 || k > TRANSFORM_BLOCK) return NULL;
+    if (reserve_rows(tr, k) != 0) return NULL;
+
+    size_t len = (size_t)k * (size_t)tr->m;
+    double* wide = tr->work + tr->work_rows * (size_t)tr->m;
+    for (size_t j = 0; j < len; j++) wide[j] = (double)X[j];
+
+    kernels_active()->transform(wide, k, tr->m, tr->shift, tr->rot_t, tr->work);
+    return tr->work;
+}
+
+/**
+ * @brief Returns m doubles of scratch that do not overlap transform_rows() output.
+ *
+ * @param tr Transform (transform_rows() must have run on it at least once).
+ * @return Pointer to the scratch, or NULL if there is no workspace yet.
+ */
+double* transform_grad_scratch(Transform* tr)
+{
+    if (!tr || tr->work_rows == 0) return NULL;
+    return tr->work + tr->work_rows * (size_t)tr->m;
+}
+
+/**
+ * @brief Maps a gradient with respect to z back to one with respect to x.
+ *
+ * @param tr Transform.
+ * @param g_z Gradient with respect to z (m values).
+ * @param g_x Output gradient with respect to x (m values, not aliasing g_z).
+ */
+void transform_pullback(const Transform* tr, const double* g_z, double* g_x)
+{
+    int m = tr->m;
+
+    if (!tr->rot_t) {
+        memcpy(g_x, g_z, (size_t)m * sizeof(double));
+        return;
+    }
+
+    /* dz_i/dx_j = R[i][j] = rot_t[j][i], so g_x[j] = (row j of R^T) . g_z */
+    for (int j = 0; j < m; j++) {
+        const double* row = tr->rot_t + (size_t)j * (size_t)m;
+        double s = 0.0;
+        for (int i = 0; i < m; i++) s += row[i] * g_z[i];
+        g_x[j] = s;
+    }
+}
+
+/**
+ * @brief Returns the config/summary name of a transformation.
+ *
+ * @param kind Transformation.
+ * @return Name string.
+ */
+const char* transform_name(TransformKind kind)
+{
+    switch (kind) {
+        case TRANSFORM_SHIFT:        return "shift";
+        case TRANSFORM_ROTATE:       return "rotate";
+        case TRANSFORM_SHIFT_ROTATE: return "shift_rotate";
+        default:                     return "none";
+    }
+}
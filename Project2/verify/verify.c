@@ -0,0 +1,841 @@
+/**
+ * @file verify.c
+ * @brief Differential check of the evaluation kernels against the libm reference.
+ *
+ * `make verify` builds this against every object of the program except
+ * main.o and runs it with verify/verify.cfg. For each problem and
+ * dimension it draws seeded vectors over the problem's full range
+ * (problem_range()), including all-lower, all-upper, alternating and
+ * mid-range vectors and random vectors with coordinates snapped to the
+ * bounds, and evaluates them through every kernel path of every
+ * variant the CPU supports, in both precisions:
+ *
+ * - eval, batch, bounded (cutoff +inf), delta (one coordinate
+ *   changed), grad (value only), f32 (float-stored rows, against the
+ *   reference of the rounded rows), multi (fused kernel) and, for
+ *   m <= 1000, shift_rotate (a transformed problem).
+ *
+ * The error measure is the one fast_err is documented in,
+ * |f - f_ref| / max(|f_ref|, 1) (delta: relative to max(|f_old|,
+ * |f_ref|, 1), since its rounding is that of f_old), together with the
+ * distance in ULP. Exact kernels must stay within exact_rel, fast ones
+ * within fast_scale times the problem's fast_err.
+ *
+ * The reference itself is checked against a golden fixture of stored
+ * values (verify/golden.csv, rewritten with --write-golden), so a
+ * different compiler, libm or set of flags cannot move both sides at
+ * once unnoticed.
+ *
+ * The random number engines are checked as well: rng_fill_real() must
+ * give bit for bit the values, and leave the state, of the equivalent
+ * scalar draws, across the engines' block boundaries. dSFMT is checked
+ * against the first values of the reference implementation, Philox
+ * against the Random123 known answers and its seeks against drawing up
+ * to the same position, and an MT19937 jump against stepping (with the
+ * 2^10 step table in verify/mt_jump_2e10.c, made by the same generator
+ * as the 2^128 tables mt_jump() uses).
+ *
+ * Exit status: 0 if every check passes, 1 if a threshold is exceeded,
+ * 2 on a usage, configuration or allocation error.
+ */
+
+#include "dsfmt.h"
+#include "kernels.h"
+#include "mt19937ar.h"
+#include "philox.h"
+#include "problem.h"
+#include "rng.h"
+#include "transform.h"
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Maximum number of dimensions in dims=. */
+#define MAX_DIMS 16
+
+/** Fixed vectors drawn before the random ones (see make_vectors()). */
+#define FIXED_VECTORS 4
+
+/** Largest m checked with a rotation (the matrix is m*m doubles). */
+#define ROTATE_DIM_MAX 1000
+
+/** Evaluation paths compared with the reference. */
+typedef enum {
+    PATH_EVAL,
+    PATH_BATCH,
+    PATH_BOUNDED,
+    PATH_DELTA,
+    PATH_GRAD,
+    PATH_F32,
+    PATH_MULTI,
+    PATH_ROTATE,
+    NUM_PATHS
+} PathId;
+
+static const char* const path_names[NUM_PATHS] = {
+    "eval", "batch", "bounded", "delta", "grad", "f32", "multi", "shift_rotate"
+};
+
+/**
+ * @brief Settings read from verify.cfg.
+ */
+typedef struct {
+    uint32_t seed;          /**< Base seed of the vectors */
+    int vectors;            /**< Random vectors per (problem, m) */
+    int dims[MAX_DIMS];     /**< Dimensions checked with exact kernels */
+    int ndims;              /**< Number of dimensions */
+    int fast_dims[MAX_DIMS]; /**< Dimensions checked with fast kernels */
+    int nfast_dims;         /**< Number of fast dimensions */
+    double exact_rel;       /**< Error bound of the exact kernels */
+    double fast_scale;      /**< Multiplier of each problem's fast_err */
+    char golden[256];       /**< Golden fixture path ("" = none) */
+    double golden_rel;      /**< Error bound of the reference against the fixture */
+    int golden_dims[MAX_DIMS]; /**< Dimensions written by --write-golden */
+    int ngolden_dims;       /**< Number of golden dimensions */
+    int golden_vectors;     /**< Vectors per (problem, m) written by --write-golden */
+} VerifyConfig;
+
+/**
+ * @brief Worst error seen for one problem and precision.
+ */
+typedef struct {
+    double rel;       /**< Largest relative error */
+    double ulp;       /**< Largest ULP distance */
+    int m;            /**< Dimension of the largest relative error */
+    PathId path;      /**< Path of the largest relative error */
+    const char* isa;  /**< Variant of the largest relative error */
+    long checks;      /**< Values compared */
+} Worst;
+
+/**
+ * @brief Removes leading and trailing whitespace in place.
+ *
+ * @param s String to trim.
+ */
+static void trim(char* s)
+{
+    char* p = s;
+    while (isspace((unsigned char)*p)) p++;
+    if (p != s) memmove(s, p, strlen(p) + 1);
+
+    size_t n = strlen(s);
+    while (n > 0 && isspace((unsigned char)s[n - 1])) s[--n] = '\0';
+}
+
+/**
+ * @brief Parses a comma-separated list of positive dimensions.
+ *
+ * @param s List text.
+ * @param dims Output dimensions.
+ * @return Number of dimensions parsed (0 if the list is invalid).
+ */
+static int parse_dims(const char* s, int* dims)
+{
+    int n = 0;
+    while (*s && n < MAX_DIMS) {
+        char* end = NULL;
+        long v = strtol(s, &end, 10);
+        if (end == s || v <= 0) return 0;
+        dims[n++] = (int)v;
+        s = end;
+        while (*s == ',' || isspace((unsigned char)*s)) s++;
+    }
+    return n;
+}
+
+/**
+ * @brief Loads the harness settings.
+ *
+ * @param path Path of verify.cfg.
+ * @param vc Output settings (defaults for missing keys).
+ * @return 0 on success, 2 if the file cannot be opened, 3 on invalid values.
+ */
+static int load_config(const char* path, VerifyConfig* vc)
+{
+    vc->seed = 1;
+    vc->vectors = 64;
+    vc->ndims = parse_dims("2,10,30,1000,20000", vc->dims);
+    vc->nfast_dims = parse_dims("2,10,30", vc->fast_dims);
+    vc->exact_rel = 1e-11;
+    vc->fast_scale = 1.0;
+    vc->golden[0] = '\0';
+    vc->golden_rel = 1e-12;
+    vc->ngolden_dims = parse_dims("2,10,30", vc->golden_dims);
+    vc->golden_vectors = 8;
+
+    FILE* fp = fopen(path, "r");
+    if (!fp) return 2;
+
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        trim(line);
+        if (line[0] == '\0') continue;
+
+        char* eq = strchr(line, '=');
+        if (!eq) continue;
+        *eq = '\0';
+        char* key = line;
+        char* val = eq + 1;
+        trim(key);
+        trim(val);
+
+        if (strcmp(key, "seed") == 0) {
+            vc->seed = (uint32_t)strtoul(val, NULL, 10);
+        } else if (strcmp(key, "vectors") == 0) {
+            vc->vectors = (int)strtol(val, NULL, 10);
+        } else if (strcmp(key, "dims") == 0) {
+            vc->ndims = parse_dims(val, vc->dims);
+        } else if (strcmp(key, "fast_dims") == 0) {
+            vc->nfast_dims = parse_dims(val, vc->fast_dims);
+        } else if (strcmp(key, "exact_rel") == 0) {
+            vc->exact_rel = strtod(val, NULL);
+        } else if (strcmp(key, "fast_scale") == 0) {
+            vc->fast_scale = strtod(val, NULL);
+        } else if (strcmp(key, "golden") == 0) {
+            strncpy(vc->golden, val, sizeof(vc->golden) - 1);
+            vc->golden[sizeof(vc->golden) - 1] = '\0';
+        } else if (strcmp(key, "golden_rel") == 0) {
+            vc->golden_rel = strtod(val, NULL);
+        } else if (strcmp(key, "golden_dims") == 0) {
+            vc->ngolden_dims = parse_dims(val, vc->golden_dims);
+        } else if (strcmp(key, "golden_vectors") == 0) {
+            vc->golden_vectors = (int)strtol(val, NULL, 10);
+        }
+    }
+    fclose(fp);
+
+    if (vc->vectors < 0 || vc->ndims == 0 || vc->nfast_dims == 0 || !(vc->exact_rel >= 0.0) ||
+        !(vc->fast_scale > 0.0) || !(vc->golden_rel >= 0.0) ||
+        vc->ngolden_dims == 0 || vc->golden_vectors <= 0)
+        return 3;
+    return 0;
+}
+
+/**
+ * @brief Draws the test vectors of one problem and dimension.
+ *
+ * Vector 0 is all lower bounds, 1 all upper bounds, 2 alternates them
+ * and 3 is the midpoint of the range; the rest are uniform over the
+ * range with each coordinate snapped to a bound with probability 1/8.
+ * The sequence depends only on (seed, type, m), so vector i is the
+ * same whatever the count.
+ *
+ * @param seed Base seed.
+ * @param type Problem.
+ * @param m Dimension.
+ * @param lower Lower bound.
+ * @param upper Upper bound.
+ * @param count Number of vectors.
+ * @param X Output block (count*m values).
+ */
+static void make_vectors(uint32_t seed, int type, int m, double lower, double upper,
+                         int count, double* X)
+{
+    MTState rng;
+    mt_init(&rng, seed * 2654435761u + (uint32_t)type * 40503u + (uint32_t)m);
+
+    for (int r = 0; r < count; r++) {
+        double* x = X + (size_t)r * (size_t)m;
+        for (int j = 0; j < m; j++) {
+            switch (r) {
+                case 0: x[j] = lower; break;
+                case 1: x[j] = upper; break;
+                case 2: x[j] = (j & 1) ? upper : lower; break;
+                case 3: x[j] = 0.5 * (lower + upper); break;
+                default: {
+                    double u = mt_real(&rng);
+                    double snap = mt_real(&rng);
+                    if (snap < 1.0 / 16.0)      x[j] = lower;
+                    else if (snap < 1.0 / 8.0)  x[j] = upper;
+                    else                        x[j] = lower + (upper - lower) * u;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Maps a double to an integer whose order matches the double's.
+ *
+ * @param v Finite value.
+ * @return Ordered integer key.
+ */
+static int64_t ordered_bits(double v)
+{
+    int64_t i;
+    memcpy(&i, &v, sizeof(i));
+    return (i < 0) ? INT64_MIN - i : i;
+}
+
+/**
+ * @brief Distance between two doubles in units in the last place.
+ *
+ * @param a First value.
+ * @param b Second value.
+ * @return Number of representable doubles between them (INFINITY if
+ *         either is not finite and they differ).
+ */
+static double ulp_distance(double a, double b)
+{
+    if (a == b) return 0.0;
+    if (!isfinite(a) || !isfinite(b)) return INFINITY;
+
+    int64_t ia = ordered_bits(a);
+    int64_t ib = ordered_bits(b);
+    return (ia > ib) ? (double)((uint64_t)ia - (uint64_t)ib)
+                     : (double)((uint64_t)ib - (uint64_t)ia);
+}
+
+/**
+ * @brief Records one comparison with the reference.
+ *
+ * @param w Worst error of the problem so far.
+ * @param f Kernel value.
+ * @param ref Reference value.
+ * @param scale Additional magnitude the error is relative to (>= 0).
+ * @param m Dimension.
+ * @param path Path that produced f.
+ * @param isa Variant that produced f.
+ */
+static void record(Worst* w, double f, double ref, double scale, int m, PathId path,
+                   const char* isa)
+{
+    double rel;
+    if (f == ref) {
+        rel = 0.0;
+    } else if (isnan(f) || isnan(ref)) {
+        rel = INFINITY;
+    } else {
+        rel = fabs(f - ref) / fmax(fmax(fabs(ref), scale), 1.0);
+        if (isnan(rel)) rel = INFINITY; /* inf - inf */
+    }
+
+    double ulp = ulp_distance(f, ref);
+    if (ulp > w->ulp) w->ulp = ulp;
+    if (rel > w->rel || w->checks == 0) {
+        w->rel = rel;
+        w->m = m;
+        w->path = path;
+        w->isa = isa;
+    }
+    w->checks++;
+}
+
+/**
+ * @brief Compares every path of one kernel variant on one block of vectors.
+ *
+ * @param type Problem.
+ * @param m Dimension.
+ * @param X Vectors (k*m values).
+ * @param k Number of vectors.
+ * @param ref Reference values of X.
+ * @param isa Variant under test (already selected).
+ * @param w Worst error of the problem.
+ * @return 0 on success, 2 on allocation failure.
+ */
+static int check_variant(ProblemType type, int m, const double* X, int k, const double* ref,
+                         const char* isa, Worst* w)
+{
+    Problem p = problem_create(type);
+    double lower, upper;
+    problem_range(&p, &lower, &upper);
+
+    double* f = (double*)malloc((size_t)k * sizeof(double));
+    double* g = (double*)malloc((size_t)m * sizeof(double));
+    double* x = (double*)malloc((size_t)m * sizeof(double));
+    float* Xf = (float*)malloc((size_t)k * (size_t)m * sizeof(float));
+    if (!f || !g || !x || !Xf) {
+        free(f);
+        free(g);
+        free(x);
+        free(Xf);
+        return 2;
+    }
+
+    for (int r = 0; r < k; r++) {
+        const double* xr = X + (size_t)r * (size_t)m;
+        record(w, problem_eval(&p, xr, m), ref[r], 0.0, m, PATH_EVAL, isa);
+        record(w, problem_eval_bounded(&p, xr, m, INFINITY), ref[r], 0.0, m, PATH_BOUNDED, isa);
+        if (p.eval_grad) {
+            record(w, problem_eval_grad(&p, xr, m, g), ref[r], 0.0, m, PATH_GRAD, isa);
+        }
+    }
+
+    problem_eval_batch(&p, X, k, m, f);
+    for (int r = 0; r < k; r++) record(w, f[r], ref[r], 0.0, m, PATH_BATCH, isa);
+
+    double* fm[PROB_EGG_HOLDER + 1] = { NULL };
+    fm[type] = f;
+    problem_eval_multi(X, k, m, PROBLEM_MASK(type), fm);
+    for (int r = 0; r < k; r++) record(w, f[r], ref[r], 0.0, m, PATH_MULTI, isa);
+
+    /* float rows are compared with the reference of the rounded rows */
+    for (size_t i = 0; i < (size_t)k * (size_t)m; i++) Xf[i] = (float)X[i];
+    problem_eval_batch_f32(&p, Xf, k, m, f);
+    for (int r = 0; r < k; r++) {
+        for (int j = 0; j < m; j++) x[j] = (double)Xf[(size_t)r * (size_t)m + j];
+        record(w, f[r], problem_eval_reference(&p, x, m), 0.0, m, PATH_F32, isa);
+    }
+
+    /* one coordinate moved to the value of the next vector */
+    for (int r = 0; r < k; r++) {
+        const double* xr = X + (size_t)r * (size_t)m;
+        int j = (int)(((unsigned)r * 2654435761u) % (unsigned)m);
+        double xj = X[(size_t)((r + 1) % k) * (size_t)m + j];
+        double f_new = problem_eval_delta(&p, xr, m, ref[r], j, xj, NULL);
+        memcpy(x, xr, (size_t)m * sizeof(double));
+        x[j] = xj;
+        record(w, f_new, problem_eval_reference(&p, x, m), fabs(ref[r]), m, PATH_DELTA, isa);
+    }
+
+    if (m <= ROTATE_DIM_MAX) {
+        Transform tr;
+        if (transform_init(&tr, m, TRANSFORM_SHIFT_ROTATE, lower, upper, (uint32_t)type) == 0) {
+            problem_set_transform(&p, &tr);
+            problem_eval_batch(&p, X, k, m, f);
+            for (int r = 0; r < k; r++) {
+                record(w, f[r], problem_eval_reference(&p, X + (size_t)r * (size_t)m, m), 0.0,
+                       m, PATH_ROTATE, isa);
+            }
+            problem_set_transform(&p, NULL);
+            transform_free(&tr);
+        }
+    }
+
+    free(f);
+    free(g);
+    free(x);
+    free(Xf);
+    return 0;
+}
+
+/**
+ * @brief Checks every problem in one precision mode.
+ *
+ * @param vc Settings.
+ * @param precision Precision of the kernels under test.
+ * @return 0 if all problems pass, 1 if one exceeds its bound, 2 on allocation failure.
+ */
+static int check_precision(const VerifyConfig* vc, EvalPrecision precision)
+{
+    int fast = (precision == PRECISION_FAST);
+    const int* dims = fast ? vc->fast_dims : vc->dims;
+    int ndims = fast ? vc->nfast_dims : vc->ndims;
+    int rc = 0;
+
+    printf("precision=%s (bound: %s)\n", fast ? "fast" : "exact",
+           fast ? "max(fast_scale * fast_err, exact_rel)" : "exact_rel");
+    printf("  %-24s %10s %10s %10s  %-24s %s\n",
+           "problem", "max ulp", "max rel", "bound", "worst (isa/path/m)", "status");
+
+    kernels_set_precision(precision);
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER; t++) {
+        Worst w = { 0.0, 0.0, 0, PATH_EVAL, "-", 0 };
+
+        for (int d = 0; d < ndims && rc != 2; d++) {
+            int m = dims[d];
+            int k = FIXED_VECTORS + vc->vectors;
+            double* X = (double*)malloc((size_t)k * (size_t)m * sizeof(double));
+            double* ref = (double*)malloc((size_t)k * sizeof(double));
+            if (!X || !ref) {
+                free(X);
+                free(ref);
+                rc = 2;
+                break;
+            }
+
+            Problem p = problem_create((ProblemType)t);
+            double lower, upper;
+            problem_range(&p, &lower, &upper);
+            make_vectors(vc->seed, t, m, lower, upper, k, X);
+            for (int r = 0; r < k; r++) {
+                ref[r] = problem_eval_reference(&p, X + (size_t)r * (size_t)m, m);
+            }
+
+            for (int v = 0; kernels_variant_name(v) && rc != 2; v++) {
+                const char* isa = kernels_variant_name(v);
+                kernels_select(isa);
+                if (check_variant((ProblemType)t, m, X, k, ref, isa, &w) != 0) rc = 2;
+            }
+            free(X);
+            free(ref);
+        }
+        if (rc == 2) break;
+
+        Problem p = problem_create((ProblemType)t);
+        double bound = fast ? fmax(vc->fast_scale * p.fast_err, vc->exact_rel) : vc->exact_rel;
+        int ok = (w.rel <= bound);
+        char worst[64];
+        snprintf(worst, sizeof(worst), "%s/%s/%d", w.isa, path_names[w.path], w.m);
+        printf("  %-24s %10.3g %10.2e %10.0e  %-24s %s\n",
+               problem_name(&p), w.ulp, w.rel, bound, worst, ok ? "ok" : "FAIL");
+        if (!ok) rc = 1;
+    }
+
+    kernels_select("auto");
+    kernels_set_precision(PRECISION_EXACT);
+    return rc;
+}
+
+/**
+ * @brief Writes the golden fixture from the reference.
+ *
+ * @param vc Settings (golden path, dimensions and vector count).
+ * @return 0 on success, 2 on an I/O or allocation error.
+ */
+static int write_golden(const VerifyConfig* vc)
+{
+    FILE* fp = fopen(vc->golden, "w");
+    if (!fp) return 2;
+
+    fprintf(fp, "# problem_eval_reference values of the verify vectors (seed=%u)\n", vc->seed);
+    fprintf(fp, "problem,m,vector,fitness\n");
+    int rc = 0;
+    for (int t = PROB_SCHWEFEL; t <= PROB_EGG_HOLDER && rc == 0; t++) {
+        Problem p = problem_create((ProblemType)t);
+        double lower, upper;
+        problem_range(&p, &lower, &upper);
+
+        for (int d = 0; d < vc->ngolden_dims; d++) {
+            int m = vc->golden_dims[d];
+            double* X = (double*)malloc((size_t)vc->golden_vectors * (size_t)m * sizeof(double));
+            if (!X) {
+                rc = 2;
+                break;
+            }
+            make_vectors(vc->seed, t, m, lower, upper, vc->golden_vectors, X);
+            for (int r = 0; r < vc->golden_vectors; r++) {
+                fprintf(fp, "%d,%d,%d,%.17g\n", t, m, r,
+                        problem_eval_reference(&p, X + (size_t)r * (size_t)m, m));
+            }
+            free(X);
+        }
+    }
+    if (fclose(fp) != 0) rc = 2;
+    return rc;
+}
+
+/**
+ * @brief Checks the reference against the golden fixture.
+ *
+ * @param vc Settings.
+ * @return 0 if every stored value is matched, 1 if one is not, 2 if the
+ *         fixture cannot be read.
+ */
+static int check_golden(const VerifyConfig* vc)
+{
+    FILE* fp = fopen(vc->golden, "r");
+    if (!fp) {
+        fprintf(stderr, "Cannot open golden fixture '%s'\n", vc->golden);
+        return 2;
+    }
+
+    Worst w = { 0.0, 0.0, 0, PATH_EVAL, "reference", 0 };
+    int worst_t = 0;
+    char line[256];
+    int rc = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        int t, m, r;
+        double want;
+        if (sscanf(line, "%d,%d,%d,%lf", &t, &m, &r, &want) != 4) continue;
+        if (t < PROB_SCHWEFEL || t > PROB_EGG_HOLDER || m <= 0 || r < 0) continue;
+
+        Problem p = problem_create((ProblemType)t);
+        double lower, upper;
+        problem_range(&p, &lower, &upper);
+        double* X = (double*)malloc((size_t)(r + 1) * (size_t)m * sizeof(double));
+        if (!X) {
+            rc = 2;
+            break;
+        }
+        make_vectors(vc->seed, t, m, lower, upper, r + 1, X);
+        double before = w.rel;
+        record(&w, problem_eval_reference(&p, X + (size_t)r * (size_t)m, m), want, 0.0, m,
+               PATH_EVAL, "reference");
+        if (w.rel > before) worst_t = t;
+        free(X);
+    }
+    fclose(fp);
+    if (rc != 0) return rc;
+
+    int ok = (w.checks > 0 && w.rel <= vc->golden_rel);
+    printf("golden fixture %s: %ld values, max ulp %.3g, max rel %.2e (bound %.0e",
+           vc->golden, w.checks, w.ulp, w.rel, vc->golden_rel);
+    if (worst_t) {
+        Problem p = problem_create((ProblemType)worst_t);
+        printf(", worst %s m=%d", problem_name(&p), w.m);
+    }
+    printf(") %s\n", ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/** Engines whose fills are checked against their scalar draws. */
+static const RngType fill_engines[] = { RNG_MT19937, RNG_DSFMT, RNG_PHILOX };
+
+/**
+ * @brief Checks rng_fill_real() against the scalar draws of each engine.
+ *
+ * Each fill starts after a prefix of scalar draws and is followed by one
+ * more draw. The offsets and lengths start, end and cross the block
+ * boundaries of the engines (624 words for MT19937, 382 doubles for
+ * dSFMT, 4 words for Philox).
+ *
+ * @return 0 if every fill matches, 1 otherwise.
+ */
+static int check_rng_fill(void)
+{
+    static const int offsets[] = { 0, 1, 3, 381, 382, 623, 624, 625, 1000 };
+    static const int lengths[] = { 1, 2, 3, 5, 381, 382, 383, 623, 624, 625, 1249, 3000 };
+    static double out[3000];
+    int status = 0;
+
+    for (size_t e = 0; e < sizeof(fill_engines) / sizeof(fill_engines[0]); e++) {
+        long checks = 0;
+        long bad = 0;
+        for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+            for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+                Rng a, b;
+                rng_init(&a, fill_engines[e], 20240501u, 0);
+                for (int i = 0; i < offsets[o]; i++) rng_real(&a);
+                b = a;
+
+                int n = lengths[l];
+                rng_fill_real(&a, out, (size_t)n, -5.0, 3.0);
+                for (int i = 0; i < n; i++) {
+                    if (out[i] != -5.0 + 8.0 * rng_real(&b)) bad++;
+                }
+                if (rng_next(&a) != rng_next(&b)) bad++;
+                checks += n + 1;
+            }
+        }
+        printf("rng %s fill: %ld draws vs scalar, %ld mismatches %s\n",
+               rng_name(fill_engines[e]), checks, bad, bad ? "FAIL" : "ok");
+        if (bad) status = 1;
+    }
+    return status;
+}
+
+/**
+ * @brief Checks dSFMT against the reference implementation.
+ *
+ * The expected values are the first [1, 2) outputs for init_gen_rand(0)
+ * in dSFMT.19937.out.txt of the reference dSFMT distribution, which
+ * prints them with %.15f.
+ *
+ * @return 0 if they match, 1 otherwise.
+ */
+static int check_dsfmt_reference(void)
+{
+    static const char* const expect[] = {
+        "1.030581026769374", "1.213140320067012", "1.299002525016001", "1.381138853044628",
+    };
+    const int n = (int)(sizeof(expect) / sizeof(expect[0]));
+    DSFMTState st;
+    int bad = 0;
+    char buf[32];
+
+    dsfmt_init(&st, 0);
+    for (int i = 0; i < n; i++) {
+        snprintf(buf, sizeof(buf), "%.15f", dsfmt_close1_open2(&st));
+        if (strcmp(buf, expect[i]) != 0) bad++;
+    }
+    printf("rng dsfmt reference: %d values, %d mismatches %s\n", n, bad, bad ? "FAIL" : "ok");
+    return bad ? 1 : 0;
+}
+
+/**
+ * @brief Checks Philox4x32-10 against known answers and its seeks.
+ *
+ * The blocks are the philox4x32_10 vectors of kat_vectors in Random123.
+ * A seek to (substream, index) must give the draws found by seeking to
+ * the start of the substream and drawing index words, and a fill after
+ * it the scalar draws, also where the block counter carries into its
+ * high word.
+ *
+ * @return 0 if all match, 1 otherwise.
+ */
+static int check_philox(void)
+{
+    static const struct {
+        uint32_t ctr[4];
+        uint32_t key[2];
+        uint32_t out[4];
+    } kat[] = {
+        { { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u },
+          { 0x00000000u, 0x00000000u },
+          { 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u } },
+        { { 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu },
+          { 0xffffffffu, 0xffffffffu },
+          { 0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu } },
+        { { 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u },
+          { 0xa4093822u, 0x299f31d0u },
+          { 0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u } },
+    };
+    static const uint64_t substreams[] = { 0, 1, 77, 0x100000005ull };
+    static const uint64_t indices[] = { 0, 1, 2, 3, 4, 5, 17, 1003 };
+    const int nkat = (int)(sizeof(kat) / sizeof(kat[0]));
+    double out[64];
+    int bad_kat = 0;
+    long checks = 0;
+    long bad = 0;
+
+    for (int k = 0; k < nkat; k++) {
+        uint32_t got[4];
+        philox4x32_10(kat[k].ctr, kat[k].key, got);
+        if (memcmp(got, kat[k].out, sizeof(got)) != 0) bad_kat++;
+    }
+    printf("rng philox known answers: %d blocks, %d mismatches %s\n",
+           nkat, bad_kat, bad_kat ? "FAIL" : "ok");
+
+    for (size_t s = 0; s < sizeof(substreams) / sizeof(substreams[0]); s++) {
+        for (size_t i = 0; i < sizeof(indices) / sizeof(indices[0]); i++) {
+            PhiloxState a, b;
+            philox_init(&a, 20240501u, 3);
+            b = a;
+            philox_seek(&a, substreams[s], indices[i]);
+            philox_seek(&b, substreams[s], 0);
+            for (uint64_t j = 0; j < indices[i]; j++) philox_next(&b);
+
+            philox_fill_real(&a, out, 13, -1.0, 1.0);
+            for (int j = 0; j < 13; j++) {
+                if (out[j] != -1.0 + 2.0 * philox_real(&b)) bad++;
+            }
+            if (philox_next(&a) != philox_next(&b)) bad++;
+            checks += 14;
+        }
+    }
+
+    /* block counter 2^32 - 1: the fill crosses into ctr[1] */
+    for (uint64_t off = 0; off < 4; off++) {
+        PhiloxState a, b;
+        philox_init(&a, 20240501u, 3);
+        philox_seek(&a, 9, 4 * 0xffffffffull + off);
+        b = a;
+        philox_fill_real(&a, out, 64, 0.0, 1.0);
+        for (int j = 0; j < 64; j++) {
+            if (out[j] != philox_real(&b)) bad++;
+        }
+        PhiloxState c;
+        philox_init(&c, 20240501u, 3);
+        philox_seek(&c, 9, 4 * 0xffffffffull + off + 64);
+        if (philox_next(&a) != philox_next(&c)) bad++;
+        checks += 65;
+    }
+    printf("rng philox seek: %ld draws vs stepping, %ld mismatches %s\n",
+           checks, bad, bad ? "FAIL" : "ok");
+    return (bad_kat || bad) ? 1 : 0;
+}
+
+/** Jump of 2^10 steps (verify/mt_jump_2e10.c). */
+extern const uint32_t mt_jump_2e10[1][MT_N];
+
+/**
+ * @brief Checks mt_jump_poly() against stepping the generator.
+ *
+ * From several positions in the state block, and from an unseeded
+ * state, a 2^10 step jump must give the draws 2^10 single steps reach,
+ * and two jumps those of 2^11 steps.
+ *
+ * @return 0 if all match, 1 otherwise.
+ */
+static int check_mt_jump(void)
+{
+    static const int offsets[] = { -1, 0, 1, 396, 397, 623, 624, 625, 1500 };
+    long checks = 0;
+    long bad = 0;
+
+    for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        for (int twice = 0; twice < 2; twice++) {
+            MTState a, b;
+            if (offsets[o] < 0) {
+                a.mti = MT_N + 1;
+            } else {
+                mt_init(&a, 20240501u);
+                for (int i = 0; i < offsets[o]; i++) mt_next(&a);
+            }
+            b = a;
+
+            mt_jump_poly(&a, mt_jump_2e10[0]);
+            if (twice) mt_jump_poly(&a, mt_jump_2e10[0]);
+            for (int i = 0; i < (1024 << twice); i++) mt_next(&b);
+            for (int i = 0; i < 1300; i++) {
+                if (mt_next(&a) != mt_next(&b)) bad++;
+            }
+            checks += 1300;
+        }
+    }
+    printf("rng mt19937 jump: %ld draws vs stepping, %ld mismatches %s\n",
+           checks, bad, bad ? "FAIL" : "ok");
+    return bad ? 1 : 0;
+}
+
+/**
+ * @brief Runs the random number engine checks.
+ *
+ * @return 0 if all pass, 1 otherwise.
+ */
+static int check_rng(void)
+{
+    int status = check_rng_fill();
+    if (check_dsfmt_reference()) status = 1;
+    if (check_philox()) status = 1;
+    if (check_mt_jump()) status = 1;
+    return status;
+}
+
+/**
+ * @brief Harness entry point.
+ *
+ * @param argc Argument count.
+ * @param argv `verify [--write-golden] <verify.cfg>`.
+ * @return 0 if all checks pass, 1 if one fails, 2 on other errors.
+ */
+int main(int argc, char** argv)
+{
+    int write = (argc == 3 && strcmp(argv[1], "--write-golden") == 0);
+    if (argc != 2 && !write) {
+        fprintf(stderr, "Usage: %s [--write-golden] <verify.cfg>\n", argv[0]);
+        return 2;
+    }
+
+    VerifyConfig vc;
+    int rc = load_config(argv[argc - 1], &vc);
+    if (rc != 0) {
+        fprintf(stderr, "Failed to load '%s' (code %d)\n", argv[argc - 1], rc);
+        return 2;
+    }
+
+    if (write) {
+        if (vc.golden[0] == '\0' || write_golden(&vc) != 0) {
+            fprintf(stderr, "Failed to write the golden fixture\n");
+            return 2;
+        }
+        printf("Wrote %s\n", vc.golden);
+        return 0;
+    }
+
+    int status = 0;
+    for (int pr = 0; pr < 2; pr++) {
+        rc = check_precision(&vc, pr ? PRECISION_FAST : PRECISION_EXACT);
+        if (rc > status) status = rc;
+        if (rc == 2) {
+            fprintf(stderr, "Out of memory\n");
+            return 2;
+        }
+    }
+    if (vc.golden[0] != '\0') {
+        rc = check_golden(&vc);
+        if (rc > status) status = rc;
+    }
+    rc = check_rng();
+    if (rc > status) status = rc;
+
+    printf("verify: %s\n", status == 0 ? "passed" : "FAILED");
+    return status;
+}